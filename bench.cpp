@@ -0,0 +1,482 @@
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "solver.h"
+
+struct Sample {
+	int month;
+	int day;
+	uint64_t solutions;
+	uint64_t nodes;
+	double timeMs;
+	double firstMs;
+};
+struct Summary {
+	int dates;
+	uint64_t solutions;
+	uint64_t nodes;
+	double timeMs;
+	double nodesPerSec;
+	double firstMsMean;
+	double firstMsMax;
+	uint64_t peakKb;
+};
+
+static const int gMonthDays[12] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+void usage()
+{
+	printf("usage: moyuday-bench [options] [M/D ... | all]\n");
+	printf("  -m, --method grid|dlx  search backend, grid by default\n");
+	printf("  -t, --threads N        threads per date\n");
+	printf("  -p, --prune N          region check every N pieces, 0 disables it\n");
+	printf("  -o, --order ORDER      auto, or cell order first|edge|fewest with an optional\n");
+	printf("                         ,index|constrained|awkward piece order, first,index by default\n");
+	printf("  -T, --trans BITS       transposition table of 2^BITS entries, 0 disables it\n");
+	printf("  -k, --kernel NAME      candidate filter scalar|sse2|avx2, the best supported one by default\n");
+	printf("  -r, --repeat N         keep the fastest of N runs per date\n");
+	printf("  -s, --save FILE        save the run as a JSON lines baseline\n");
+	printf("  -b, --compare FILE     compare the run against a saved baseline\n");
+	printf("      --gen-order FILE   time every order on every date and write the fastest ones\n");
+	printf("      --table            allow the compiled table, search is measured by default\n");
+	printf("all 366 days are measured when no date is given\n");
+}
+double elapsedMs(std::chrono::steady_clock::time_point t0)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+uint64_t peakMemoryKb()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS pmc;
+	GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
+	return pmc.PeakWorkingSetSize / 1024;
+#else
+	struct rusage ru;
+	getrusage(RUSAGE_SELF, &ru);
+#if defined(__APPLE__)
+	return ru.ru_maxrss / 1024;
+#else
+	return ru.ru_maxrss;
+#endif
+#endif
+}
+void measure(Solve* s, Sample* smp, int repeat)
+{
+	smp->timeMs = -1;
+	smp->firstMs = -1;
+	for(int k = 0; k < repeat; ++k)
+	{
+		/* every run starts cold, a table warmed by the last repeat would fake the speedup */
+		transClear(s);
+		auto t0 = std::chrono::steady_clock::now();
+		solve(s, smp->month, smp->day);
+		double ms = elapsedMs(t0);
+		if(smp->timeMs < 0 || ms < smp->timeMs)
+		{
+			smp->timeMs = ms;
+		}
+		smp->solutions = s->results.num;
+		smp->nodes = s->nodes;
+
+		/* time to first solution always uses the resumable enumerator */
+		transClear(s);
+		t0 = std::chrono::steady_clock::now();
+		solveInit(s, smp->month, smp->day);
+		arenaClear(&s->results);
+		if(!solveTable(s, smp->month, smp->day))
+		{
+			s->budget = 0;
+			solveStart(s, 0);
+			solveNext(s);
+		}
+		ms = elapsedMs(t0);
+		if(smp->firstMs < 0 || ms < smp->firstMs)
+		{
+			smp->firstMs = ms;
+		}
+	}
+}
+void summarize(const std::vector<Sample>& samples, Summary* sum)
+{
+	memset(sum, 0, sizeof(*sum));
+	sum->dates = (int)samples.size();
+	for(size_t i = 0; i < samples.size(); ++i)
+	{
+		sum->solutions += samples[i].solutions;
+		sum->nodes += samples[i].nodes;
+		sum->timeMs += samples[i].timeMs;
+		sum->firstMsMean += samples[i].firstMs;
+		sum->firstMsMax = std::max(sum->firstMsMax, samples[i].firstMs);
+	}
+	if(sum->dates > 0)
+	{
+		sum->firstMsMean /= sum->dates;
+	}
+	sum->nodesPerSec = sum->timeMs > 0 ? sum->nodes * 1000.0 / sum->timeMs : 0;
+	sum->peakKb = peakMemoryKb();
+}
+bool saveBaseline(const char* path, const std::vector<Sample>& samples, const Summary* sum)
+{
+	FILE* fp = fopen(path, "w");
+	if(nullptr == fp)
+	{
+		fprintf(stderr, "Could not open %s\n", path);
+		return false;
+	}
+	for(size_t i = 0; i < samples.size(); ++i)
+	{
+		const Sample& smp = samples[i];
+		fprintf(fp, "{\"month\":%d,\"day\":%d,\"solutions\":%llu,\"nodes\":%llu,\"time_ms\":%.4f,\"first_ms\":%.4f}\n",
+			smp.month, smp.day, (unsigned long long)smp.solutions, (unsigned long long)smp.nodes, smp.timeMs, smp.firstMs);
+	}
+	fprintf(fp, "{\"summary\":1,\"dates\":%d,\"solutions\":%llu,\"nodes\":%llu,\"time_ms\":%.4f,\"nodes_per_sec\":%.1f,"
+		"\"first_ms_mean\":%.4f,\"first_ms_max\":%.4f,\"peak_kb\":%llu}\n",
+		sum->dates, (unsigned long long)sum->solutions, (unsigned long long)sum->nodes, sum->timeMs, sum->nodesPerSec,
+		sum->firstMsMean, sum->firstMsMax, (unsigned long long)sum->peakKb);
+	fclose(fp);
+	return true;
+}
+bool loadBaseline(const char* path, std::map<int, Sample>& samples, Summary* sum)
+{
+	FILE* fp = fopen(path, "r");
+	if(nullptr == fp)
+	{
+		fprintf(stderr, "Could not open %s\n", path);
+		return false;
+	}
+	memset(sum, 0, sizeof(*sum));
+	char line[512];
+	while(nullptr != fgets(line, sizeof(line), fp))
+	{
+		Sample smp = { 0 };
+		unsigned long long sol = 0;
+		unsigned long long nodes = 0;
+		unsigned long long peak = 0;
+		if(6 == sscanf(line, "{\"month\":%d,\"day\":%d,\"solutions\":%llu,\"nodes\":%llu,\"time_ms\":%lf,\"first_ms\":%lf}",
+			&smp.month, &smp.day, &sol, &nodes, &smp.timeMs, &smp.firstMs))
+		{
+			smp.solutions = sol;
+			smp.nodes = nodes;
+			samples[smp.month * 100 + smp.day] = smp;
+		}
+		else if(8 == sscanf(line, "{\"summary\":1,\"dates\":%d,\"solutions\":%llu,\"nodes\":%llu,\"time_ms\":%lf,"
+			"\"nodes_per_sec\":%lf,\"first_ms_mean\":%lf,\"first_ms_max\":%lf,\"peak_kb\":%llu}",
+			&sum->dates, &sol, &nodes, &sum->timeMs, &sum->nodesPerSec, &sum->firstMsMean, &sum->firstMsMax, &peak))
+		{
+			sum->solutions = sol;
+			sum->nodes = nodes;
+			sum->peakKb = peak;
+		}
+	}
+	fclose(fp);
+	return true;
+}
+void compareLine(const char* name, double base, double cur)
+{
+	double change = base > 0 ? (cur - base) * 100.0 / base : 0;
+	printf("  %-16s %14.3f %14.3f %+8.1f%%\n", name, base, cur, change);
+}
+bool compareBaseline(const char* path, const std::vector<Sample>& samples, const Summary* sum)
+{
+	std::map<int, Sample> base;
+	Summary old;
+	if(!loadBaseline(path, base, &old))
+	{
+		return false;
+	}
+	/* only the dates present in both runs are compared */
+	bool same = true;
+	std::vector<Sample> oldSamples;
+	std::vector<Sample> curSamples;
+	std::vector<std::pair<double, const Sample*>> changes;
+	for(size_t i = 0; i < samples.size(); ++i)
+	{
+		auto it = base.find(samples[i].month * 100 + samples[i].day);
+		if(it == base.end())
+		{
+			continue;
+		}
+		oldSamples.push_back(it->second);
+		curSamples.push_back(samples[i]);
+		if(it->second.solutions != samples[i].solutions)
+		{
+			printf("MISMATCH %d/%d: %llu solutions, baseline %llu\n", samples[i].month, samples[i].day,
+				(unsigned long long)samples[i].solutions, (unsigned long long)it->second.solutions);
+			same = false;
+		}
+		changes.push_back(std::make_pair(samples[i].timeMs - it->second.timeMs, &samples[i]));
+	}
+	Summary oldSum;
+	Summary curSum;
+	summarize(oldSamples, &oldSum);
+	summarize(curSamples, &curSum);
+	oldSum.peakKb = old.peakKb;
+	curSum.peakKb = sum->peakKb;
+	printf("compare with %s, %d dates\n", path, curSum.dates);
+	printf("  %-16s %14s %14s %9s\n", "", "baseline", "current", "change");
+	compareLine("time ms", oldSum.timeMs, curSum.timeMs);
+	compareLine("nodes", (double)oldSum.nodes, (double)curSum.nodes);
+	compareLine("nodes/s", oldSum.nodesPerSec, curSum.nodesPerSec);
+	compareLine("first ms mean", oldSum.firstMsMean, curSum.firstMsMean);
+	compareLine("first ms max", oldSum.firstMsMax, curSum.firstMsMax);
+	compareLine("peak KB", (double)oldSum.peakKb, (double)curSum.peakKb);
+	std::sort(changes.begin(), changes.end(), [](const std::pair<double, const Sample*>& a, const std::pair<double, const Sample*>& b) {
+		return a.first > b.first;
+	});
+	printf("largest regressions:\n");
+	for(size_t i = 0; i < changes.size() && i < 5 && changes[i].first > 0; ++i)
+	{
+		printf("  %2d/%-2d %+.3f ms\n", changes[i].second->month, changes[i].second->day, changes[i].first);
+	}
+	return same;
+}
+/* every date starts from an empty transposition table, so no order profits from the one timed before it */
+double timeOrder(Solve* s, int mon, int day, int cellOrder, int pieceOrder, int repeat)
+{
+	solveOrder(s, cellOrder, pieceOrder);
+	double best = -1;
+	for(int k = 0; k < repeat; ++k)
+	{
+		transClear(s);
+		auto t0 = std::chrono::steady_clock::now();
+		solve(s, mon, day);
+		const double ms = elapsedMs(t0);
+		best = best < 0 || ms < best ? ms : best;
+	}
+	return best;
+}
+bool writeOrderTable(Solve* s, const char* path, int repeat)
+{
+	uint8_t orders[12 * 31] = { 0 };
+	double plainMs = 0;
+	double bestMs = 0;
+	s->autoOrder = false;
+	for(int m = 1; m <= 12; ++m)
+	{
+		for(int d = 1; d <= gMonthDays[m - 1]; ++d)
+		{
+			double best = -1;
+			for(int order = 0; order < ORDER_CELL_NUM * ORDER_PIECE_NUM; ++order)
+			{
+				const double ms = timeOrder(s, m, d, order / ORDER_PIECE_NUM, order % ORDER_PIECE_NUM, repeat);
+				if(0 == order)
+				{
+					plainMs += ms;
+				}
+				if(best < 0 || ms < best)
+				{
+					best = ms;
+					orders[(m - 1) * 31 + d - 1] = (uint8_t)order;
+				}
+			}
+			bestMs += best;
+			const int order = orders[(m - 1) * 31 + d - 1];
+			printf("%2d/%-2d %s,%s %.3f ms\n", m, d, gCellOrderNames[order / ORDER_PIECE_NUM],
+				gPieceOrderNames[order % ORDER_PIECE_NUM], best);
+		}
+	}
+	printf("first,index %.3f ms, fastest per date %.3f ms\n", plainMs, bestMs);
+
+	FILE* fp = fopen(path, "w");
+	if(nullptr == fp)
+	{
+		fprintf(stderr, "Could not open %s\n", path);
+		return false;
+	}
+	fprintf(fp, "/* Generated by `moyuday-bench --gen-order orders.h`, do not edit. */\n");
+	fprintf(fp, "#pragma once\n\n");
+	fprintf(fp, "#define SOLVE_ORDER_HASH 0x%016llxull\n\n", (unsigned long long)s->hash);
+	fprintf(fp, "/* cell order * ORDER_PIECE_NUM + piece order, (month - 1) * 31 + day - 1 */\n");
+	fprintf(fp, "static constexpr uint8_t gSolveOrders[%d] = {", 12 * 31);
+	for(int i = 0; i < 12 * 31; ++i)
+	{
+		fprintf(fp, "%s%d,", 0 == i % 31 ? "\n\t" : " ", orders[i]);
+	}
+	fprintf(fp, "\n};\n");
+	fclose(fp);
+	return true;
+}
+int main(int argc, char* argv[])
+{
+	Solve* s = new Solve();
+	initSolve(s);
+	s->useTable = false;
+	s->threads = 1;
+	int repeat = 1;
+	const char* save = nullptr;
+	const char* compare = nullptr;
+	const char* orders = nullptr;
+	std::vector<Sample> samples;
+	for(int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		const char* val = i + 1 < argc ? argv[i + 1] : nullptr;
+		Sample smp = { 0 };
+		if(0 == strcmp(arg, "-h") || 0 == strcmp(arg, "--help"))
+		{
+			usage();
+			return 0;
+		}
+		else if(0 == strcmp(arg, "--table"))
+		{
+			s->useTable = true;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-m") || 0 == strcmp(arg, "--method")))
+		{
+			s->method = 0 == strcmp(val, "dlx") ? SOLVE_METHOD_DLX : SOLVE_METHOD_GRID;
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-t") || 0 == strcmp(arg, "--threads")))
+		{
+			s->threads = atoi(val);
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-p") || 0 == strcmp(arg, "--prune")))
+		{
+			s->pruneEvery = atoi(val);
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-o") || 0 == strcmp(arg, "--order")))
+		{
+			if(!parseOrder(val, s))
+			{
+				return -1;
+			}
+			i++;
+		}
+		else if(nullptr != val && 0 == strcmp(arg, "--gen-order"))
+		{
+			orders = val;
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-T") || 0 == strcmp(arg, "--trans")))
+		{
+			s->transBits = std::min(std::max(0, atoi(val)), 30);
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-k") || 0 == strcmp(arg, "--kernel")))
+		{
+			int kernel = -1;
+			for(int k = 0; k < FILTER_NUM; ++k)
+			{
+				kernel = 0 == strcmp(val, gFilterNames[k]) ? k : kernel;
+			}
+			if(!setFilterKernel(kernel))
+			{
+				fprintf(stderr, "Unsupported kernel %s\n", val);
+				return -1;
+			}
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-r") || 0 == strcmp(arg, "--repeat")))
+		{
+			repeat = std::max(1, atoi(val));
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-s") || 0 == strcmp(arg, "--save")))
+		{
+			save = val;
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-b") || 0 == strcmp(arg, "--compare")))
+		{
+			compare = val;
+			i++;
+		}
+		else if(0 == strcmp(arg, "all"))
+		{
+			for(int m = 1; m <= 12; ++m)
+			{
+				for(int d = 1; d <= gMonthDays[m - 1]; ++d)
+				{
+					Sample all = { m, d };
+					samples.push_back(all);
+				}
+			}
+		}
+		else if(2 == sscanf(arg, "%d/%d", &smp.month, &smp.day) && smp.month >= 1 && smp.month <= 12 &&
+			smp.day >= 1 && smp.day <= 31)
+		{
+			samples.push_back(smp);
+		}
+		else
+		{
+			usage();
+			return -1;
+		}
+	}
+	if(nullptr != orders)
+	{
+		const bool ret = writeOrderTable(s, orders, repeat);
+		delete s;
+		return ret ? 0 : -1;
+	}
+	if(samples.empty())
+	{
+		for(int m = 1; m <= 12; ++m)
+		{
+			for(int d = 1; d <= gMonthDays[m - 1]; ++d)
+			{
+				Sample all = { m, d };
+				samples.push_back(all);
+			}
+		}
+	}
+
+	auto t0 = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < samples.size(); ++i)
+	{
+		measure(s, &samples[i], repeat);
+	}
+	double wallMs = elapsedMs(t0);
+	Summary sum;
+	summarize(samples, &sum);
+
+	printf("kernel          %s\n", gFilterNames[filterKernel()]);
+	printf("dates           %d\n", sum.dates);
+	printf("solutions       %llu\n", (unsigned long long)sum.solutions);
+	printf("wall time       %.3f ms\n", wallMs);
+	printf("solve time      %.3f ms\n", sum.timeMs);
+	printf("nodes           %llu\n", (unsigned long long)sum.nodes);
+	printf("nodes/s         %.0f\n", sum.nodesPerSec);
+	printf("first solution  %.4f ms mean, %.4f ms max\n", sum.firstMsMean, sum.firstMsMax);
+	printf("peak memory     %llu KB\n", (unsigned long long)sum.peakKb);
+	std::vector<const Sample*> slow;
+	for(size_t i = 0; i < samples.size(); ++i)
+	{
+		slow.push_back(&samples[i]);
+	}
+	std::sort(slow.begin(), slow.end(), [](const Sample* a, const Sample* b) { return a->timeMs > b->timeMs; });
+	printf("slowest dates:\n");
+	for(size_t i = 0; i < slow.size() && i < 5; ++i)
+	{
+		printf("  %2d/%-2d %.3f ms, %llu nodes, %llu solutions\n", slow[i]->month, slow[i]->day, slow[i]->timeMs,
+			(unsigned long long)slow[i]->nodes, (unsigned long long)slow[i]->solutions);
+	}
+
+	int ret = 0;
+	if(nullptr != save && !saveBaseline(save, samples, &sum))
+	{
+		ret = -1;
+	}
+	if(nullptr != compare && !compareBaseline(compare, samples, &sum))
+	{
+		ret = -1;
+	}
+	delete s;
+	return ret;
+}
@@ -0,0 +1,644 @@
+#include "board.h"
+#include "shapes.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/* 128 cell boards, a shift by 64 is undefined so 0 and 64 and up are spelled out */
+struct Mask128 {
+	uint64_t lo;
+	uint64_t hi;
+};
+inline Mask128 operator&(const Mask128& a, const Mask128& b)
+{
+	return { a.lo & b.lo, a.hi & b.hi };
+}
+inline Mask128 operator|(const Mask128& a, const Mask128& b)
+{
+	return { a.lo | b.lo, a.hi | b.hi };
+}
+inline Mask128 operator^(const Mask128& a, const Mask128& b)
+{
+	return { a.lo ^ b.lo, a.hi ^ b.hi };
+}
+inline Mask128 operator~(const Mask128& a)
+{
+	return { ~a.lo, ~a.hi };
+}
+inline Mask128 operator<<(const Mask128& a, int k)
+{
+	if(0 == k)
+	{
+		return a;
+	}
+	if(k >= 64)
+	{
+		return { 0, a.lo << (k - 64) };
+	}
+	return { a.lo << k, (a.hi << k) | (a.lo >> (64 - k)) };
+}
+inline Mask128 operator>>(const Mask128& a, int k)
+{
+	if(0 == k)
+	{
+		return a;
+	}
+	if(k >= 64)
+	{
+		return { a.hi >> (k - 64), 0 };
+	}
+	return { (a.lo >> k) | (a.hi << (64 - k)), a.hi >> k };
+}
+inline bool operator==(const Mask128& a, const Mask128& b)
+{
+	return a.lo == b.lo && a.hi == b.hi;
+}
+
+PieceDef blankShape(const PieceDef&, int rows, int cols)
+{
+	PieceDef p;
+	p.rows = rows;
+	p.cols = cols;
+	p.data.assign(rows * cols, 0);
+	return p;
+}
+
+inline int countBits(uint64_t m)
+{
+#if defined(_MSC_VER)
+	return (int)__popcnt64(m);
+#else
+	return __builtin_popcountll(m);
+#endif
+}
+inline int lowBit(uint64_t m)
+{
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanForward64(&idx, m);
+	return (int)idx;
+#else
+	return __builtin_ctzll(m);
+#endif
+}
+inline bool maskZero(uint64_t m)
+{
+	return 0 == m;
+}
+inline bool maskZero(const Mask128& m)
+{
+	return 0 == (m.lo | m.hi);
+}
+inline void maskSet(uint64_t& m, int i)
+{
+	m |= 1ull << i;
+}
+inline void maskSet(Mask128& m, int i)
+{
+	if(i < 64)
+	{
+		m.lo |= 1ull << i;
+	}
+	else
+	{
+		m.hi |= 1ull << (i - 64);
+	}
+}
+inline bool maskTest(uint64_t m, int i)
+{
+	return i < 64 && 0 != (m & (1ull << i));
+}
+inline bool maskTest(const Mask128& m, int i)
+{
+	return i < 64 ? 0 != (m.lo & (1ull << i)) : 0 != (m.hi & (1ull << (i - 64)));
+}
+inline int maskCount(uint64_t m)
+{
+	return countBits(m);
+}
+inline int maskCount(const Mask128& m)
+{
+	return countBits(m.lo) + countBits(m.hi);
+}
+inline int maskFirst(uint64_t m)
+{
+	return lowBit(m);
+}
+inline int maskFirst(const Mask128& m)
+{
+	return 0 != m.lo ? lowBit(m.lo) : 64 + lowBit(m.hi);
+}
+inline uint64_t maskLowest(uint64_t m)
+{
+	return m & (0 - m);
+}
+inline Mask128 maskLowest(const Mask128& m)
+{
+	return 0 != m.lo ? Mask128{ m.lo & (0 - m.lo), 0 } : Mask128{ 0, m.hi & (0 - m.hi) };
+}
+
+/**
+ * the grid search of solver.cpp with the board size known at compile time, boards smaller
+ * than ROWS x COLS are padded with walls
+ */
+template<typename Mask, int ROWS, int COLS>
+struct BoardKernel {
+	static const int CELLS = ROWS * COLS;
+	struct Place {
+		Mask mask;
+		int piece;
+	};
+	const BoardDef* def;
+	int pieceNum;
+	Mask all;
+	Mask firstCol;
+	Mask lastCol;
+	Mask grid;
+	uint32_t used;
+	int depth;
+	uint64_t count;
+	/* -1 searches every placement at the first open cell, otherwise only that one */
+	int branch;
+	std::vector<std::string>* grids;
+	std::vector<Mask> sums;
+	std::vector<Place> places[CELLS];
+	const Place* path[BOARD_MAX_PIECE_NUM];
+
+	void init(const BoardDef* b, const std::vector<int>& targets)
+	{
+		def = b;
+		pieceNum = (int)b->pieces.size();
+		all = Mask();
+		firstCol = Mask();
+		lastCol = Mask();
+		grid = Mask();
+		for(int i = 0; i < CELLS; ++i)
+		{
+			const int r = i / COLS;
+			const int c = i % COLS;
+			maskSet(all, i);
+			if(0 == c)
+			{
+				maskSet(firstCol, i);
+			}
+			if(COLS - 1 == c)
+			{
+				maskSet(lastCol, i);
+			}
+			if(r >= b->rows || c >= b->cols || 255 == b->marks[r * b->cols + c])
+			{
+				maskSet(grid, i);
+			}
+		}
+		for(size_t i = 0; i < targets.size(); ++i)
+		{
+			maskSet(grid, targets[i] / b->cols * COLS + targets[i] % b->cols);
+		}
+
+		sums.assign((size_t)1 << pieceNum, Mask());
+		for(uint32_t mask = 0; mask < sums.size(); ++mask)
+		{
+			Mask s = Mask();
+			maskSet(s, 0);
+			for(int i = 0; i < pieceNum; ++i)
+			{
+				if(0 == (mask & (1u << i)))
+				{
+					int size = 0;
+					for(size_t k = 0; k < b->pieces[i].data.size(); ++k)
+					{
+						size += 0 != b->pieces[i].data[k];
+					}
+					s = s | (s << size);
+				}
+			}
+			sums[mask] = s;
+		}
+
+		for(int i = 0; i < CELLS; ++i)
+		{
+			places[i].clear();
+		}
+		for(int i = 0; i < pieceNum; ++i)
+		{
+			addPiece(i, b->pieces[i]);
+		}
+	}
+	/* every distinct orientation, anchored at its first cell in row major order */
+	void addPiece(int piece, const PieceDef& src)
+	{
+		PieceDef shapes[8];
+		const int num = shapeOrientations(src, shapes);
+		for(int k = 0; k < num; ++k)
+		{
+			addOrientation(piece, shapes[k]);
+		}
+	}
+	void addOrientation(int piece, const PieceDef& p)
+	{
+		int first = 0;
+		while(0 == p.data[first])
+		{
+			first++;
+		}
+		const int r0 = first / p.cols;
+		const int c0 = first % p.cols;
+		for(int idx = 0; idx < CELLS; ++idx)
+		{
+			const int y = idx / COLS - r0;
+			const int x = idx % COLS - c0;
+			if(y < 0 || x < 0 || y + p.rows > ROWS || x + p.cols > COLS)
+			{
+				continue;
+			}
+			Place pl;
+			pl.mask = Mask();
+			pl.piece = piece;
+			for(int r = 0; r < p.rows; ++r)
+			{
+				for(int c = 0; c < p.cols; ++c)
+				{
+					if(0 != p.data[r * p.cols + c])
+					{
+						maskSet(pl.mask, (y + r) * COLS + x + c);
+					}
+				}
+			}
+			if(maskZero(pl.mask & grid))
+			{
+				places[idx].push_back(pl);
+			}
+		}
+	}
+	/* true if some empty region can not be tiled by the sizes of the unused pieces */
+	bool prune() const
+	{
+		const Mask& s = sums[used];
+		Mask empty = ~grid & all;
+		while(!maskZero(empty))
+		{
+			Mask region = maskLowest(empty);
+			for(;;)
+			{
+				Mask next = region | (region << COLS) | (region >> COLS);
+				next = next | ((region << 1) & ~firstCol) | ((region >> 1) & ~lastCol);
+				next = next & empty;
+				if(next == region)
+				{
+					break;
+				}
+				region = next;
+			}
+			empty = empty & ~region;
+			if(!maskTest(s, maskCount(region)))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	void record()
+	{
+		count++;
+		if(nullptr == grids)
+		{
+			return;
+		}
+		static const char names[] = "123456789abcdefghijklmnopqrstuvwxyz";
+		std::string out(def->rows * def->cols, '*');
+		for(int i = 0; i < def->rows * def->cols; ++i)
+		{
+			if(255 == def->marks[i])
+			{
+				out[i] = '#';
+			}
+		}
+		for(int k = 0; k < depth; ++k)
+		{
+			for(int i = 0; i < CELLS; ++i)
+			{
+				if(maskTest(path[k]->mask, i))
+				{
+					out[i / COLS * def->cols + i % COLS] = names[path[k]->piece];
+				}
+			}
+		}
+		grids->push_back(out);
+	}
+	void search()
+	{
+		const Mask open = ~grid & all;
+		if(maskZero(open))
+		{
+			record();
+			return;
+		}
+		const std::vector<Place>& list = places[maskFirst(open)];
+		size_t i = 0;
+		size_t end = list.size();
+		if(0 == depth && branch >= 0)
+		{
+			i = (size_t)branch;
+			end = i < end ? i + 1 : end;
+		}
+		for(; i < end; ++i)
+		{
+			const Place& p = list[i];
+			const uint32_t bit = 1u << p.piece;
+			if(0 != (used & bit) || !maskZero(p.mask & grid))
+			{
+				continue;
+			}
+			grid = grid ^ p.mask;
+			used |= bit;
+			path[depth++] = &p;
+			if(!prune())
+			{
+				search();
+			}
+			depth--;
+			used &= ~bit;
+			grid = grid ^ p.mask;
+		}
+	}
+};
+
+/* branches only asks for the number of placements at the first open cell */
+template<typename Mask, int ROWS, int COLS>
+uint64_t runKernel(const BoardDef* b, const std::vector<int>& targets, int branch, std::vector<std::string>* grids,
+	int* branches)
+{
+	BoardKernel<Mask, ROWS, COLS>* k = new BoardKernel<Mask, ROWS, COLS>();
+	k->init(b, targets);
+	k->used = 0;
+	k->depth = 0;
+	k->count = 0;
+	k->branch = branch;
+	k->grids = grids;
+	if(nullptr != branches)
+	{
+		const Mask open = ~k->grid & k->all;
+		*branches = maskZero(open) ? 0 : (int)k->places[maskFirst(open)].size();
+	}
+	else
+	{
+		k->search();
+	}
+	const uint64_t count = k->count;
+	delete k;
+	return count;
+}
+
+bool parsePieceRow(const char* line, PieceDef* p)
+{
+	const int cols = (int)strlen(line);
+	if(0 != p->cols && cols != p->cols)
+	{
+		return false;
+	}
+	p->cols = cols;
+	p->rows++;
+	for(int i = 0; i < cols; ++i)
+	{
+		if('#' != line[i] && '.' != line[i])
+		{
+			return false;
+		}
+		p->data.push_back('#' == line[i] ? 1 : 0);
+	}
+	return true;
+}
+bool parseCell(const char* tok, uint8_t* mark, uint8_t* value)
+{
+	int v = 0;
+	*mark = 0;
+	*value = 0;
+	if(0 == strcmp(tok, "#"))
+	{
+		*mark = 255;
+	}
+	else if(0 == strcmp(tok, "."))
+	{
+	}
+	else if('M' == tok[0] && (v = atoi(tok + 1)) >= 1 && v <= 12)
+	{
+		*value = BOARD_VALUE_MONTH + v;
+	}
+	else if('D' == tok[0] && (v = atoi(tok + 1)) >= 1 && v <= 31)
+	{
+		*value = v;
+	}
+	else if('W' == tok[0] && (v = atoi(tok + 1)) >= 1 && v <= 7)
+	{
+		*value = BOARD_VALUE_WEEK + v;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+/**
+ * ; comment
+ * name <text>
+ * size <rows> <cols>
+ * grid, then one line per row of '#', '.', M1-M12, D1-D31 or W1-W7
+ * piece, then one line per row of '#' and '.'
+ */
+bool loadBoard(const char* path, BoardDef* b)
+{
+	FILE* fp = fopen(path, "r");
+	if(nullptr == fp)
+	{
+		fprintf(stderr, "Could not open %s\n", path);
+		return false;
+	}
+	b->name = path;
+	b->rows = 0;
+	b->cols = 0;
+	b->marks.clear();
+	b->values.clear();
+	b->pieces.clear();
+	b->hasMonth = false;
+	b->hasDay = false;
+	b->hasWeek = false;
+	char buf[512];
+	int lineNo = 0;
+	int gridRows = -1;
+	bool ok = true;
+	while(ok && nullptr != fgets(buf, sizeof(buf), fp))
+	{
+		lineNo++;
+		buf[strcspn(buf, "\r\n")] = 0;
+		char* line = buf;
+		while(' ' == *line || '\t' == *line)
+		{
+			line++;
+		}
+		if(0 == line[0] || ';' == line[0])
+		{
+			gridRows = -1;
+			continue;
+		}
+		if(0 == strncmp(line, "name ", 5))
+		{
+			b->name = line + 5;
+		}
+		else if(0 == strncmp(line, "size ", 5))
+		{
+			ok = 2 == sscanf(line + 5, "%d %d", &b->rows, &b->cols) && b->rows > 0 && b->cols > 0;
+		}
+		else if(0 == strcmp(line, "grid"))
+		{
+			gridRows = 0;
+			ok = b->rows > 0 && b->marks.empty();
+		}
+		else if(0 == strcmp(line, "piece"))
+		{
+			gridRows = -1;
+			b->pieces.emplace_back();
+			b->pieces.back().rows = 0;
+			b->pieces.back().cols = 0;
+			ok = b->pieces.size() <= BOARD_MAX_PIECE_NUM;
+		}
+		else if(gridRows >= 0)
+		{
+			int cols = 0;
+			for(char* tok = strtok(line, " \t"); ok && nullptr != tok; tok = strtok(nullptr, " \t"))
+			{
+				uint8_t mark;
+				uint8_t value;
+				ok = parseCell(tok, &mark, &value);
+				b->marks.push_back(mark);
+				b->values.push_back(value);
+				b->hasMonth = b->hasMonth || (value > BOARD_VALUE_MONTH && value < BOARD_VALUE_WEEK);
+				b->hasDay = b->hasDay || (value > 0 && value < BOARD_VALUE_MONTH);
+				b->hasWeek = b->hasWeek || value > BOARD_VALUE_WEEK;
+				cols++;
+			}
+			ok = ok && cols == b->cols && ++gridRows <= b->rows;
+		}
+		else if(!b->pieces.empty())
+		{
+			ok = parsePieceRow(line, &b->pieces.back());
+		}
+		else
+		{
+			ok = false;
+		}
+	}
+	fclose(fp);
+	if(!ok)
+	{
+		fprintf(stderr, "%s:%d: invalid board data\n", path, lineNo);
+		return false;
+	}
+
+	int open = 0;
+	int area = 0;
+	const int groups = (int)b->hasMonth + (int)b->hasDay + (int)b->hasWeek;
+	for(size_t i = 0; i < b->marks.size(); ++i)
+	{
+		open += 0 == b->marks[i];
+	}
+	for(size_t i = 0; i < b->pieces.size(); ++i)
+	{
+		/* padded rows and columns would anchor the same placement at several cells */
+		b->pieces[i] = trimmedShape(b->pieces[i]);
+		for(size_t k = 0; k < b->pieces[i].data.size(); ++k)
+		{
+			area += b->pieces[i].data[k];
+		}
+		/* a piece without any cell would be placed everywhere with a zero shift */
+		if(0 == b->pieces[i].rows)
+		{
+			area = -1;
+			break;
+		}
+	}
+	if((int)b->marks.size() != b->rows * b->cols || b->pieces.empty() || area != open - groups)
+	{
+		fprintf(stderr, "%s: the pieces cover %d cells, the board leaves %d open\n", path, area, open - groups);
+		return false;
+	}
+	return true;
+}
+bool boardTargets(const BoardDef* b, int mon, int day, int week, std::vector<int>& cells)
+{
+	cells.clear();
+	for(size_t i = 0; i < b->values.size(); ++i)
+	{
+		const int v = b->values[i];
+		if((v < BOARD_VALUE_MONTH && v == day) || (v > BOARD_VALUE_MONTH && v == BOARD_VALUE_MONTH + mon) ||
+			(v > BOARD_VALUE_WEEK && v == BOARD_VALUE_WEEK + week))
+		{
+			cells.push_back((int)i);
+		}
+	}
+	/* one cell for each kind of value the board has */
+	return (int)cells.size() == (int)b->hasMonth + (int)b->hasDay + (int)b->hasWeek;
+}
+/* the smallest compiled size the board fits in, the rest of it is walls */
+uint64_t boardRun(const BoardDef* b, int mon, int day, int week, int branch, std::vector<std::string>* grids,
+	int* branches)
+{
+	std::vector<int> targets;
+	if(!boardTargets(b, mon, day, week, targets))
+	{
+		return 0;
+	}
+	const int rows = b->rows;
+	const int cols = b->cols;
+	if(rows <= 7 && cols <= 7)
+	{
+		return runKernel<uint64_t, 7, 7>(b, targets, branch, grids, branches);
+	}
+	if(rows <= 8 && cols <= 7)
+	{
+		return runKernel<uint64_t, 8, 7>(b, targets, branch, grids, branches);
+	}
+	if(rows <= 7 && cols <= 8)
+	{
+		return runKernel<uint64_t, 7, 8>(b, targets, branch, grids, branches);
+	}
+	if(rows <= 8 && cols <= 8)
+	{
+		return runKernel<uint64_t, 8, 8>(b, targets, branch, grids, branches);
+	}
+	if(rows <= 10 && cols <= 10)
+	{
+		return runKernel<Mask128, 10, 10>(b, targets, branch, grids, branches);
+	}
+	if(rows <= 16 && cols <= 8)
+	{
+		return runKernel<Mask128, 16, 8>(b, targets, branch, grids, branches);
+	}
+	if(rows <= 8 && cols <= 16)
+	{
+		return runKernel<Mask128, 8, 16>(b, targets, branch, grids, branches);
+	}
+	if(rows <= 11 && cols <= 11)
+	{
+		return runKernel<Mask128, 11, 11>(b, targets, branch, grids, branches);
+	}
+	fprintf(stderr, "%s: boards up to 11x11, 16x8 or 8x16 are supported\n", b->name.c_str());
+	return 0;
+}
+uint64_t boardSolve(const BoardDef* b, int mon, int day, int week, std::vector<std::string>* grids)
+{
+	return boardRun(b, mon, day, week, -1, grids, nullptr);
+}
+int boardBranches(const BoardDef* b, int mon, int day, int week)
+{
+	int branches = 0;
+	boardRun(b, mon, day, week, -1, nullptr, &branches);
+	return branches;
+}
+uint64_t boardSolveBranch(const BoardDef* b, int mon, int day, int week, int branch, std::vector<std::string>* grids)
+{
+	return branch < 0 ? 0 : boardRun(b, mon, day, week, branch, grids, nullptr);
+}
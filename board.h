@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* boards and piece sets loaded from a data file, solved by a kernel specialized on the board size */
+#define BOARD_MAX_PIECE_NUM 16
+#define BOARD_VALUE_MONTH 100
+#define BOARD_VALUE_WEEK 200
+
+struct PieceDef {
+	int rows;
+	int cols;
+	std::vector<uint8_t> data;
+};
+struct BoardDef {
+	std::string name;
+	int rows;
+	int cols;
+	/* 255 for walls, 0 for open cells */
+	std::vector<uint8_t> marks;
+	/* 101-112 months, 1-31 days, 201-207 weekdays from Monday, 0 for none */
+	std::vector<uint8_t> values;
+	std::vector<PieceDef> pieces;
+	bool hasMonth;
+	bool hasDay;
+	bool hasWeek;
+};
+
+bool loadBoard(const char* path, BoardDef* b);
+bool boardTargets(const BoardDef* b, int mon, int day, int week, std::vector<int>& cells);
+/* one string per solution, rows * cols chars: '#' wall, '*' date, '1'... piece */
+uint64_t boardSolve(const BoardDef* b, int mon, int day, int week, std::vector<std::string>* grids);
+/* placements tried at the first open cell, a full solve is the concatenation of the branches in order */
+int boardBranches(const BoardDef* b, int mon, int day, int week);
+uint64_t boardSolveBranch(const BoardDef* b, int mon, int day, int week, int branch, std::vector<std::string>* grids);
@@ -0,0 +1,723 @@
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "board.h"
+#include "solver.h"
+
+#define FORMAT_CSV 0
+#define FORMAT_JSON 1
+
+struct Date {
+	int month;
+	int day;
+	/* 1 for Monday to 7, 0 when not given */
+	int week;
+};
+struct Options {
+	int format;
+	bool count;
+	bool stats;
+	bool useTable;
+	int method;
+	int jobs;
+	int threads;
+	int pruneEvery;
+	const char* output;
+	const char* table;
+	const char* order;
+	const BoardDef* board;
+	/* worker processes of a sharded run, and the shard this process works on, -1 for the driver */
+	int shards;
+	int shard;
+	const char* checkpoint;
+	const char* cache;
+};
+
+static const int gMonthDays[12] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+void usage()
+{
+	printf("usage: moyuday-cli [options] [M/D[/W] ... | all | -]\n");
+	printf("  -f, --format csv|json  output format, csv by default\n");
+	printf("  -c, --count            print the number of solutions only\n");
+	printf("  -m, --method grid|dlx  search backend, grid by default\n");
+	printf("  -j, --jobs N           dates solved at the same time\n");
+	printf("  -t, --threads N        threads per date\n");
+	printf("  -p, --prune N          region check every N pieces, 0 disables it\n");
+	printf("      --order ORDER      search order, auto or CELL[,PIECE], see moyuday-bench --help\n");
+	printf("  -o, --output FILE      write to FILE instead of stdout\n");
+	printf("  -b, --board FILE       solve the board and pieces in FILE instead of the built in calendar\n");
+	printf("      --no-table         always search, ignore the compiled table\n");
+	printf("      --cache FILE       keep searched dates in FILE when the compiled table does not match the board\n");
+#if SOLVE_STATS
+	printf("      --stats            print search counters to stderr\n");
+#endif
+	printf("      --gen-table FILE   regenerate the compiled solution table\n");
+	printf("      --shards N         search in N worker processes that checkpoint every finished branch,\n");
+	printf("                         running it again resumes the shards that did not finish\n");
+	printf("      --checkpoint PATH  checkpoint files are PATH.0 to PATH.N-1, moyuday-shard by default\n");
+	printf("dates are M/D pairs, 'all' for every day of the year, '-' to read them from stdin\n");
+	printf("boards with weekdays take M/D/W, W from 1 for Monday to 7, a date without W means every weekday\n");
+}
+bool parseDate(const char* str, std::vector<Date>& dates)
+{
+	if(0 == strcmp(str, "all"))
+	{
+		for(int m = 1; m <= 12; ++m)
+		{
+			for(int d = 1; d <= gMonthDays[m - 1]; ++d)
+			{
+				dates.push_back({ m, d, 0 });
+			}
+		}
+		return true;
+	}
+	Date date = { 0 };
+	if(sscanf(str, "%d/%d/%d", &date.month, &date.day, &date.week) < 2 || date.month < 1 || date.month > 12 ||
+		date.day < 1 || date.day > 31 || date.week < 0 || date.week > 7)
+	{
+		fprintf(stderr, "invalid date: %s\n", str);
+		return false;
+	}
+	dates.push_back(date);
+	return true;
+}
+void formatGrid(const Result* res, char* out)
+{
+	for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+	{
+		uint8_t val = res->gridData[i];
+		out[i] = 255 == val ? '#' : (200 == val ? '*' : (char)('0' + val));
+	}
+	out[MAX_COL_NUM * MAX_ROW_NUM] = 0;
+}
+void writeCount(const Options* opt, const Date* date, uint64_t num, std::string& out)
+{
+	char line[256];
+	if(nullptr != opt->board)
+	{
+		const char* fmt = FORMAT_JSON == opt->format ? "{\"month\":%d,\"day\":%d,\"weekday\":%d,\"count\":%llu}\n" :
+			"%d,%d,%d,%llu\n";
+		snprintf(line, sizeof(line), fmt, date->month, date->day, date->week, (unsigned long long)num);
+	}
+	else
+	{
+		const char* fmt = FORMAT_JSON == opt->format ? "{\"month\":%d,\"day\":%d,\"count\":%llu}\n" : "%d,%d,%llu\n";
+		snprintf(line, sizeof(line), fmt, date->month, date->day, (unsigned long long)num);
+	}
+	out += line;
+}
+void writeBoardGrid(const Options* opt, const Date* date, int index, const char* grid, std::string& out)
+{
+	char line[512];
+	const char* fmt = FORMAT_JSON == opt->format ?
+		"{\"month\":%d,\"day\":%d,\"weekday\":%d,\"index\":%d,\"grid\":\"%s\"}\n" : "%d,%d,%d,%d,%s\n";
+	snprintf(line, sizeof(line), fmt, date->month, date->day, date->week, index, grid);
+	out += line;
+}
+void writeCode(const Options* opt, const Solve* s, const Date* date, int index, uint64_t code, std::string& out)
+{
+	char line[256];
+	char grid[MAX_COL_NUM * MAX_ROW_NUM + 1];
+	Result res;
+	unpackResult(s, code, &res);
+	formatGrid(&res, grid);
+	const char* fmt = FORMAT_JSON == opt->format ?
+		"{\"month\":%d,\"day\":%d,\"index\":%d,\"code\":\"%016llx\",\"grid\":\"%s\"}\n" : "%d,%d,%d,%016llx,%s\n";
+	snprintf(line, sizeof(line), fmt, date->month, date->day, index, (unsigned long long)code, grid);
+	out += line;
+}
+void writeBoardDate(const Options* opt, const Date* date, std::string& out)
+{
+	if(opt->count)
+	{
+		writeCount(opt, date, boardSolve(opt->board, date->month, date->day, date->week, nullptr), out);
+		return;
+	}
+	std::vector<std::string> grids;
+	boardSolve(opt->board, date->month, date->day, date->week, &grids);
+	for(size_t i = 0; i < grids.size(); ++i)
+	{
+		writeBoardGrid(opt, date, (int)i, grids[i].c_str(), out);
+	}
+}
+void writeDate(const Options* opt, Solve* s, const Date* date, std::string& out)
+{
+	if(nullptr != opt->board)
+	{
+		writeBoardDate(opt, date, out);
+		return;
+	}
+	if(opt->count)
+	{
+		writeCount(opt, date, countSolutions(s, date->month, date->day), out);
+		return;
+	}
+	solve(s, date->month, date->day);
+	for(size_t i = 0; i < s->results.num; ++i)
+	{
+		writeCode(opt, s, date, (int)i, arenaAt(&s->results, i), out);
+	}
+}
+void solveDates(const Options* opt, const Solve* base, const std::vector<Date>* dates, std::vector<std::string>* outs,
+	std::atomic<size_t>* next, SolveStats* stats)
+{
+	Solve* s = new Solve(*base);
+	statsClear(stats);
+	for(size_t i = (*next)++; i < dates->size(); i = (*next)++)
+	{
+		writeDate(opt, s, &(*dates)[i], (*outs)[i]);
+		SOLVE_STAT(statsMerge(stats, &s->stats));
+	}
+	delete s;
+}
+/**
+ * sharded enumeration, every date is split into the branches of its first placement and branch n of the run
+ * goes to shard n % shards, a worker appends each finished branch to its checkpoint and ends it with done
+ */
+#define SHARD_MAGIC "moyuday-shard"
+struct ShardUnit {
+	size_t date;
+	int branch;
+	uint64_t count;
+	/* codes in hex for the calendar, grids for boards, nothing when only counting */
+	std::vector<std::string> lines;
+};
+std::string shardPath(const Options* opt, int shard)
+{
+	return std::string(opt->checkpoint) + "." + std::to_string(shard);
+}
+/* workers get the options and dates of the driver, checkpoints of any other run are started over */
+uint64_t shardJob(const std::vector<std::string>& args, const BoardDef* board, const std::vector<Date>& dates, int shards)
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	std::string key = std::to_string(shards);
+	for(size_t i = 0; i < args.size(); ++i)
+	{
+		key += " " + args[i];
+	}
+	/* the loaded board rather than its path, an edited board file must not reuse old checkpoints */
+	if(nullptr != board)
+	{
+		key += " " + std::to_string(board->rows) + "x" + std::to_string(board->cols) + " ";
+		key.append(board->marks.begin(), board->marks.end());
+		key.append(board->values.begin(), board->values.end());
+		for(size_t i = 0; i < board->pieces.size(); ++i)
+		{
+			key += " " + std::to_string(board->pieces[i].rows) + "x" + std::to_string(board->pieces[i].cols) + " ";
+			key.append(board->pieces[i].data.begin(), board->pieces[i].data.end());
+		}
+	}
+	for(size_t i = 0; i < dates.size(); ++i)
+	{
+		key += " " + std::to_string(dates[i].month) + "/" + std::to_string(dates[i].day) + "/" + std::to_string(dates[i].week);
+	}
+	for(size_t i = 0; i < key.size(); ++i)
+	{
+		hash = (hash ^ (uint8_t)key[i]) * 0x100000001b3ull;
+	}
+	return hash;
+}
+void writeUnit(FILE* fp, const ShardUnit* unit)
+{
+	fprintf(fp, "unit %llu %d %llu %llu\n", (unsigned long long)unit->date, unit->branch, (unsigned long long)unit->count,
+		(unsigned long long)unit->lines.size());
+	for(size_t i = 0; i < unit->lines.size(); ++i)
+	{
+		fprintf(fp, "%s\n", unit->lines[i].c_str());
+	}
+	fprintf(fp, "end\n");
+}
+/* the finished branches of a checkpoint, false when there is none for this run, a branch cut off by a crash is dropped */
+bool readShard(const char* path, uint64_t job, int shard, std::vector<ShardUnit>& units, bool* done)
+{
+	units.clear();
+	*done = false;
+	FILE* fp = fopen(path, "r");
+	if(nullptr == fp)
+	{
+		return false;
+	}
+	char buf[512];
+	unsigned long long hash = 0;
+	int num = -1;
+	const bool match = nullptr != fgets(buf, sizeof(buf), fp) && 2 == sscanf(buf, SHARD_MAGIC " %llx %d", &hash, &num) &&
+		job == hash && shard == num;
+	bool ok = match;
+	while(ok && !*done && nullptr != fgets(buf, sizeof(buf), fp))
+	{
+		unsigned long long date = 0;
+		unsigned long long count = 0;
+		unsigned long long lines = 0;
+		ShardUnit unit;
+		if(0 == strcmp(buf, "done\n"))
+		{
+			*done = true;
+			break;
+		}
+		ok = 4 == sscanf(buf, "unit %llu %d %llu %llu", &date, &unit.branch, &count, &lines);
+		unit.date = (size_t)date;
+		unit.count = count;
+		for(unsigned long long i = 0; ok && i < lines; ++i)
+		{
+			ok = nullptr != fgets(buf, sizeof(buf), fp) && nullptr != strchr(buf, '\n');
+			buf[strcspn(buf, "\r\n")] = 0;
+			unit.lines.push_back(buf);
+		}
+		ok = ok && nullptr != fgets(buf, sizeof(buf), fp) && 0 == strcmp(buf, "end\n");
+		if(ok)
+		{
+			units.push_back(unit);
+		}
+	}
+	fclose(fp);
+	return match;
+}
+int dateBranches(const Options* opt, Solve* s, const Date* date)
+{
+	if(nullptr != opt->board)
+	{
+		return boardBranches(opt->board, date->month, date->day, date->week);
+	}
+	return solveBranches(s, date->month, date->day);
+}
+void solveUnit(const Options* opt, Solve* s, const Date* date, ShardUnit* unit)
+{
+	unit->lines.clear();
+	if(nullptr != opt->board)
+	{
+		unit->count = boardSolveBranch(opt->board, date->month, date->day, date->week, unit->branch,
+			opt->count ? nullptr : &unit->lines);
+		return;
+	}
+	solveBranch(s, date->month, date->day, unit->branch);
+	unit->count = s->results.num;
+	for(size_t i = 0; i < s->results.num && !opt->count; ++i)
+	{
+		char code[32];
+		snprintf(code, sizeof(code), "%016llx", (unsigned long long)arenaAt(&s->results, i));
+		unit->lines.push_back(code);
+	}
+}
+/* the branches of this shard that the checkpoint does not have yet */
+bool runShard(const Options* opt, Solve* s, const std::vector<Date>& dates, uint64_t job)
+{
+	const std::string path = shardPath(opt, opt->shard);
+	std::vector<ShardUnit> units;
+	bool done = false;
+	readShard(path.c_str(), job, opt->shard, units, &done);
+	if(done)
+	{
+		return true;
+	}
+	/* rewritten without the branch a crash may have cut off, then appended to */
+	FILE* fp = fopen(path.c_str(), "w");
+	if(nullptr == fp)
+	{
+		fprintf(stderr, "Could not open %s\n", path.c_str());
+		return false;
+	}
+	fprintf(fp, SHARD_MAGIC " %016llx %d\n", (unsigned long long)job, opt->shard);
+	std::set<std::pair<size_t, int>> finished;
+	for(size_t i = 0; i < units.size(); ++i)
+	{
+		writeUnit(fp, &units[i]);
+		finished.insert(std::make_pair(units[i].date, units[i].branch));
+	}
+	fflush(fp);
+	size_t n = 0;
+	for(size_t i = 0; i < dates.size(); ++i)
+	{
+		const int branches = dateBranches(opt, s, &dates[i]);
+		for(int b = 0; b < branches; ++b, ++n)
+		{
+			if((int)(n % opt->shards) != opt->shard || 0 != finished.count(std::make_pair(i, b)))
+			{
+				continue;
+			}
+			ShardUnit unit;
+			unit.date = i;
+			unit.branch = b;
+			solveUnit(opt, s, &dates[i], &unit);
+			writeUnit(fp, &unit);
+			fflush(fp);
+		}
+	}
+	fprintf(fp, "done\n");
+	fclose(fp);
+	return true;
+}
+std::string quoteArg(const std::string& arg)
+{
+#if defined(_WIN32)
+	return "\"" + arg + "\"";
+#else
+	std::string out = "'";
+	for(size_t i = 0; i < arg.size(); ++i)
+	{
+		out += '\'' == arg[i] ? std::string("'\\''") : std::string(1, arg[i]);
+	}
+	return out + "'";
+#endif
+}
+/* starts a worker for every shard that is not done, then merges all checkpoints in date and branch order */
+bool runShards(const Options* opt, Solve* s, const char* self, const std::vector<std::string>& args,
+	const std::vector<Date>& dates, std::vector<std::string>& outs)
+{
+	const uint64_t job = shardJob(args, opt->board, dates, opt->shards);
+	const std::string datePath = std::string(opt->checkpoint) + ".dates";
+	FILE* fp = fopen(datePath.c_str(), "w");
+	if(nullptr == fp)
+	{
+		fprintf(stderr, "Could not open %s\n", datePath.c_str());
+		return false;
+	}
+	for(size_t i = 0; i < dates.size(); ++i)
+	{
+		fprintf(fp, 0 != dates[i].week ? "%d/%d/%d\n" : "%d/%d\n", dates[i].month, dates[i].day, dates[i].week);
+	}
+	fclose(fp);
+
+	std::vector<std::thread> workers;
+	std::vector<ShardUnit> units;
+	for(int k = 0; k < opt->shards; ++k)
+	{
+		bool done = false;
+		readShard(shardPath(opt, k).c_str(), job, k, units, &done);
+		if(done)
+		{
+			continue;
+		}
+		std::string cmd = quoteArg(self);
+		for(size_t i = 0; i < args.size(); ++i)
+		{
+			cmd += " " + quoteArg(args[i]);
+		}
+		cmd += " --shards " + std::to_string(opt->shards) + " --shard " + std::to_string(k) + " - < " + quoteArg(datePath);
+#if defined(_WIN32)
+		/* cmd drops the first and the last quote of the line */
+		cmd = "\"" + cmd + "\"";
+#endif
+		workers.emplace_back([cmd]() { std::system(cmd.c_str()); });
+	}
+	for(size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
+
+	std::vector<ShardUnit> all;
+	bool ok = true;
+	for(int k = 0; k < opt->shards; ++k)
+	{
+		bool done = false;
+		readShard(shardPath(opt, k).c_str(), job, k, units, &done);
+		if(!done)
+		{
+			fprintf(stderr, "shard %d did not finish, run again to resume it\n", k);
+			ok = false;
+		}
+		all.insert(all.end(), units.begin(), units.end());
+	}
+	if(!ok)
+	{
+		return false;
+	}
+	std::sort(all.begin(), all.end(), [](const ShardUnit& a, const ShardUnit& b) {
+		return a.date != b.date ? a.date < b.date : a.branch < b.branch;
+	});
+	std::vector<uint64_t> counts(dates.size(), 0);
+	std::vector<int> index(dates.size(), 0);
+	for(size_t i = 0; i < all.size(); ++i)
+	{
+		const ShardUnit& unit = all[i];
+		const Date* date = &dates[unit.date];
+		counts[unit.date] += unit.count;
+		if(nullptr == opt->board && !unit.lines.empty())
+		{
+			/* codes only hold the pieces, the date cells come from the board */
+			solveInit(s, date->month, date->day);
+		}
+		for(size_t k = 0; k < unit.lines.size(); ++k)
+		{
+			if(nullptr != opt->board)
+			{
+				writeBoardGrid(opt, date, index[unit.date]++, unit.lines[k].c_str(), outs[unit.date]);
+			}
+			else
+			{
+				writeCode(opt, s, date, index[unit.date]++, strtoull(unit.lines[k].c_str(), nullptr, 16), outs[unit.date]);
+			}
+		}
+	}
+	for(size_t i = 0; i < dates.size() && opt->count; ++i)
+	{
+		writeCount(opt, &dates[i], counts[i], outs[i]);
+	}
+	return true;
+}
+int main(int argc, char* argv[])
+{
+	Options opt = { 0 };
+	opt.format = FORMAT_CSV;
+	opt.useTable = true;
+	opt.method = SOLVE_METHOD_GRID;
+	opt.jobs = (int)std::thread::hardware_concurrency();
+	opt.threads = 1;
+	opt.pruneEvery = 1;
+	opt.shard = -1;
+	opt.checkpoint = "moyuday-shard";
+	std::vector<Date> dates;
+	const char* board = nullptr;
+	/* options a sharded run passes on to its workers */
+	std::vector<std::string> shardArgs;
+	for(int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		const char* val = i + 1 < argc ? argv[i + 1] : nullptr;
+		if(0 == strcmp(arg, "-h") || 0 == strcmp(arg, "--help"))
+		{
+			usage();
+			return 0;
+		}
+		else if(0 == strcmp(arg, "-c") || 0 == strcmp(arg, "--count"))
+		{
+			opt.count = true;
+			shardArgs.push_back(arg);
+		}
+		else if(0 == strcmp(arg, "--no-table"))
+		{
+			opt.useTable = false;
+		}
+#if SOLVE_STATS
+		else if(0 == strcmp(arg, "--stats"))
+		{
+			opt.stats = true;
+		}
+#endif
+		else if(nullptr != val && (0 == strcmp(arg, "-f") || 0 == strcmp(arg, "--format")))
+		{
+			opt.format = 0 == strcmp(val, "json") ? FORMAT_JSON : FORMAT_CSV;
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-m") || 0 == strcmp(arg, "--method")))
+		{
+			opt.method = 0 == strcmp(val, "dlx") ? SOLVE_METHOD_DLX : SOLVE_METHOD_GRID;
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-j") || 0 == strcmp(arg, "--jobs")))
+		{
+			opt.jobs = atoi(val);
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-t") || 0 == strcmp(arg, "--threads")))
+		{
+			opt.threads = atoi(val);
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-p") || 0 == strcmp(arg, "--prune")))
+		{
+			opt.pruneEvery = atoi(val);
+			shardArgs.push_back(arg);
+			shardArgs.push_back(val);
+			i++;
+		}
+		else if(nullptr != val && 0 == strcmp(arg, "--order"))
+		{
+			opt.order = val;
+			shardArgs.push_back(arg);
+			shardArgs.push_back(val);
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-o") || 0 == strcmp(arg, "--output")))
+		{
+			opt.output = val;
+			i++;
+		}
+		else if(nullptr != val && (0 == strcmp(arg, "-b") || 0 == strcmp(arg, "--board")))
+		{
+			board = val;
+			shardArgs.push_back(arg);
+			shardArgs.push_back(val);
+			i++;
+		}
+		else if(nullptr != val && 0 == strcmp(arg, "--cache"))
+		{
+			opt.cache = val;
+			i++;
+		}
+		else if(nullptr != val && 0 == strcmp(arg, "--shards"))
+		{
+			opt.shards = atoi(val);
+			i++;
+		}
+		else if(nullptr != val && 0 == strcmp(arg, "--shard"))
+		{
+			opt.shard = atoi(val);
+			i++;
+		}
+		else if(nullptr != val && 0 == strcmp(arg, "--checkpoint"))
+		{
+			opt.checkpoint = val;
+			shardArgs.push_back(arg);
+			shardArgs.push_back(val);
+			i++;
+		}
+		else if(nullptr != val && 0 == strcmp(arg, "--gen-table"))
+		{
+			opt.table = val;
+			i++;
+		}
+		else if(0 == strcmp(arg, "-"))
+		{
+			char buf[64];
+			while(nullptr != fgets(buf, sizeof(buf), stdin))
+			{
+				buf[strcspn(buf, "\r\n")] = 0;
+				if(0 != buf[0] && !parseDate(buf, dates))
+				{
+					return -1;
+				}
+			}
+		}
+		else if('-' == arg[0] || !parseDate(arg, dates))
+		{
+			usage();
+			return -1;
+		}
+	}
+
+	BoardDef def;
+	if(nullptr != board)
+	{
+		if(!loadBoard(board, &def))
+		{
+			return -1;
+		}
+		opt.board = &def;
+		if(def.hasWeek)
+		{
+			std::vector<Date> days;
+			days.swap(dates);
+			for(size_t i = 0; i < days.size(); ++i)
+			{
+				for(int w = 1; w <= 7; ++w)
+				{
+					if(0 == days[i].week || w == days[i].week)
+					{
+						dates.push_back({ days[i].month, days[i].day, w });
+					}
+				}
+			}
+		}
+	}
+
+	Solve* s = new Solve();
+	initSolve(s);
+	s->useTable = opt.useTable;
+	s->method = opt.method;
+	s->threads = opt.threads;
+	s->pruneEvery = opt.pruneEvery;
+	if(nullptr != opt.order && !parseOrder(opt.order, s))
+	{
+		delete s;
+		return -1;
+	}
+	if(nullptr != opt.cache && !openSolveCache(opt.cache, s->hash))
+	{
+		delete s;
+		return -1;
+	}
+	if(nullptr != opt.table)
+	{
+		bool ret = writeSolutionTable(s, opt.table);
+		delete s;
+		return ret ? 0 : -1;
+	}
+	if(dates.empty())
+	{
+		usage();
+		delete s;
+		return -1;
+	}
+	if(opt.shard >= 0)
+	{
+		const bool ret = opt.shard < opt.shards && runShard(&opt, s, dates, shardJob(shardArgs, opt.board, dates, opt.shards));
+		delete s;
+		return ret ? 0 : -1;
+	}
+
+	/* every date gets its own buffer, so the output order never depends on the schedule */
+	std::vector<std::string> outs(dates.size());
+	const int jobs = opt.jobs < 1 ? 1 : opt.jobs;
+	std::vector<SolveStats> stats(jobs);
+	std::vector<std::thread> threads;
+	if(opt.shards > 0)
+	{
+		/* merged before the output is opened, so an unfinished run leaves no partial file */
+		if(!runShards(&opt, s, argv[0], shardArgs, dates, outs))
+		{
+			delete s;
+			return -1;
+		}
+	}
+	else
+	{
+		std::atomic<size_t> next(0);
+		for(int i = 1; i < jobs && (size_t)i < dates.size(); ++i)
+		{
+			threads.emplace_back(solveDates, &opt, s, &dates, &outs, &next, &stats[i]);
+		}
+		solveDates(&opt, s, &dates, &outs, &next, &stats[0]);
+		for(size_t i = 0; i < threads.size(); ++i)
+		{
+			threads[i].join();
+		}
+	}
+
+	FILE* fp = stdout;
+	if(nullptr != opt.output && nullptr == (fp = fopen(opt.output, "w")))
+	{
+		fprintf(stderr, "Could not open %s\n", opt.output);
+		delete s;
+		return -1;
+	}
+	if(FORMAT_CSV == opt.format && nullptr != opt.board)
+	{
+		fprintf(fp, opt.count ? "month,day,weekday,count\n" : "month,day,weekday,index,grid\n");
+	}
+	else if(FORMAT_CSV == opt.format)
+	{
+		fprintf(fp, opt.count ? "month,day,count\n" : "month,day,index,code,grid\n");
+	}
+
+	for(size_t i = 0; i < outs.size(); ++i)
+	{
+		fwrite(outs[i].data(), 1, outs[i].size(), fp);
+	}
+	if(opt.stats && opt.shards <= 0)
+	{
+		/* time is summed over the dates, not the wall time of the run */
+		for(size_t i = 1; i < threads.size() + 1; ++i)
+		{
+			statsMerge(&stats[0], &stats[i]);
+		}
+		printStats(stderr, &stats[0]);
+	}
+
+	if(stdout != fp)
+	{
+		fclose(fp);
+	}
+	closeSolveCache();
+	delete s;
+	return 0;
+}
@@ -3,100 +3,13 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstring>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 
-#define MAX_ROW_NUM 7
-#define MAX_COL_NUM 7
-#define MAX_BLK_NUM 8
-#define MAX_BLKROW_NUM 4
-#define MAX_BLKCOL_NUM 4
-
-static const uint8_t gGridMarks[MAX_ROW_NUM * MAX_COL_NUM] = {
-	0,   0,   0,   0,   0,   0,   255,
-	0,   0,   0,   0,   0,   0,   255,
-	0,   0,   0,   0,   0,   0,   0,
-	0,   0,   0,   0,   0,   0,   0,
-	0,   0,   0,   0,   0,   0,   0,
-	0,   0,   0,   0,   0,   0,   0,
-	0,   0,   0,   255, 255, 255, 255
-};
-static const uint8_t gGridValues[MAX_ROW_NUM * MAX_COL_NUM] = {
-	101, 102, 103, 104, 105, 106, 0,
-	107, 108, 109, 110, 111, 112, 0,
-	1,   2,   3,   4,   5,   6,   7,
-	8,   9,   10,  11,  12,  13,  14,
-	15,  16,  17,  18,  19,  20,  21,
-	22,  23,  24,  25,  26,  27,  28,
-	29,  30,  31,  0,   0,   0,   0
-};
-struct BlockInfo {
-	int rows;
-	int cols;
-	uint8_t data[MAX_BLKROW_NUM * MAX_BLKCOL_NUM];
-};
-static const BlockInfo gBlockInfos[MAX_BLK_NUM] = {
-	{
-		2, 3,
-		{
-			1, 1, 1,
-			1, 1, 1
-		}
-	},
-	{
-		3, 2,
-		{
-			1, 1,
-			0, 1,
-			1, 1
-		}
-	},
-	{
-		3, 3,
-		{
-			0, 0, 1,
-			0, 0, 1,
-			1, 1, 1
-		}
-	},
-	{
-		4, 2,
-		{
-			1, 1,
-			1, 0,
-			1, 0,
-			1, 0
-		}
-	},
-	{
-		3, 2,
-		{
-			1, 0,
-			1, 1,
-			1, 1
-		}
-	},
-	{
-		3, 3,
-		{
-			0, 0, 1,
-			1, 1, 1,
-			1, 0, 0
-		}
-	},
-	{
-		2, 4,
-		{
-			1, 1, 1, 1,
-			0, 1, 0, 0
-		}
-	},
-	{
-		2, 4,
-		{
-			1, 1, 1, 0,
-			0, 0, 1, 1
-		}
-	}
-};
+#include "solver.h"
 
 /**
 *       1
@@ -133,7 +46,52 @@ struct Grid {
 	int ypos;
 	SDL_Rect rect;
 	uint8_t data[MAX_ROW_NUM * MAX_COL_NUM];
-	uint8_t cache[MAX_ROW_NUM * MAX_COL_NUM];
+	uint64_t mask;
+};
+/* where the dragged piece lands, in grid cells */
+struct DropTarget {
+	int row;
+	int col;
+	uint64_t mask;
+};
+/* the board and palette are cached in board, frame holds the last presented image */
+struct Scene {
+	SDL_Texture* board;
+	SDL_Texture* frame;
+	SDL_Rect rect;
+	SDL_Rect dragRect;
+	bool dirty;
+};
+/* rects of one color, flushed with one call per kind */
+struct DrawBatch {
+	Color clr;
+	std::vector<SDL_Rect> fills;
+	std::vector<SDL_Rect> rects;
+};
+struct GlyphQuad {
+	int x;
+	int y;
+	uint8_t val;
+	Color clr;
+};
+/* digits 0-9 side by side, tinted per glyph, the quads become one geometry call where SDL has it */
+struct GlyphAtlas {
+	SDL_Texture* atlas;
+	int seg;
+	int w;
+	int h;
+	std::vector<GlyphQuad> quads;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	std::vector<SDL_Vertex> verts;
+	std::vector<int> indices;
+#endif
+};
+/* interval is 0 when vsync paces the presents, start is only set with --startup and cleared once the first frame is reported */
+struct FramePacer {
+	bool pending;
+	Uint64 interval;
+	Uint64 last;
+	Uint64 start;
 };
 struct Block {
 	int state;
@@ -147,13 +105,21 @@ struct Block {
 static SDL_Window* gWindow = nullptr;
 static SDL_Renderer* gRender = nullptr;
 
+#define PALETTE_COL_NUM (1 + (MAX_BLKCOL_NUM + 1) * 4)
+#define PALETTE_ROW_NUM (1 + (MAX_BLKROW_NUM + 1) * 3)
+
 static int gCellSize = 50;
+static int8_t gPalette[PALETTE_ROW_NUM][PALETTE_COL_NUM];
 static int gDropIndex = -1;
 static int gDropX = 0;
 static int gDropY = 0;
 static int gDropCX = 0;
 static int gDropCY = 0;
 static Grid gGrid = { 0 };
+static Scene gScene = { 0 };
+static FramePacer gFrame = { 0 };
+static std::vector<DrawBatch> gBatches;
+static GlyphAtlas gGlyphs;
 static Block gBlocks[MAX_BLK_NUM] = { 0 };
 static const Color gBlockClrs[MAX_BLK_NUM] = {
 	{ 0x70, 0xf3, 0xff, 0xff },
@@ -166,33 +132,55 @@ static const Color gBlockClrs[MAX_BLK_NUM] = {
 	{ 0xa9, 0x81, 0x75, 0xff }
 };
 
-#define MAX_RESULT_NUM 256
-struct Result {
-	BlockInfo blkData[MAX_BLK_NUM];
-	uint8_t gridData[MAX_COL_NUM * MAX_ROW_NUM];
-};
-struct Branch {
-	int idx;
-	int num;
-	int firstCols[8];
-	BlockInfo data[8];
-};
-struct Solve {
+struct AutoSolve {
 	bool enabled;
+	bool finished;
+	bool searching;
+	bool waiting;
 	int month;
 	int day;
+	int resultIdx;
+	int progress;
 	SDL_Rect checkRect;
 	SDL_Rect preRect;
 	SDL_Rect nextRect;
-	uint8_t gridData[MAX_COL_NUM * MAX_ROW_NUM];
-	uint32_t blkMask;
-	Branch blkData[MAX_BLK_NUM];
-	int resultIdx;
-	int resultNum;
-	Result results[MAX_RESULT_NUM];
 };
 static Solve gSolve = { 0 };
+static AutoSolve gAuto = { 0 };
+
+/* placements of the dragged piece, in any orientation, that leave the date solvable */
+struct DragHints {
+	int most;
+	int counts[MAX_ROW_NUM * MAX_COL_NUM];
+	std::vector<uint64_t> masks;
+	Solve* solve;
+};
+static DragHints gHints;
+
+#define SOLVE_SLICE 4096
+#define SOLVE_EVENT_RESULT 0
+#define SOLVE_EVENT_PROGRESS 1
+#define SOLVE_EVENT_FINISHED 2
+struct SolveJob {
+	std::mutex lock;
+	std::condition_variable wake;
+	std::thread thread;
+	std::atomic<int> seq;
+	std::atomic<bool> quit;
+	int month;
+	int day;
+	int more;
+	Solve* solve;
+};
+static SolveJob gJob;
+static Uint32 gSolveEvent = (Uint32)-1;
+#if SOLVE_STATS
+static bool gShowStats = false;
+#endif
 
+
+
+/* segments of a seven segment digit, drawn straight or baked into the glyph atlas */
 void drawNumber(SDL_Renderer* render, int x, int y, int size, uint8_t val)
 {
 	if(val < 10)
@@ -232,7 +220,150 @@ void drawNumber(SDL_Renderer* render, int x, int y, int size, uint8_t val)
 		}
 	}
 }
-int drawUint(SDL_Renderer* render, int x, int y, int size, uint32_t val)
+DrawBatch* batchColor(const Color& clr)
+{
+	for(size_t i = 0; i < gBatches.size(); ++i)
+	{
+		const Color& c = gBatches[i].clr;
+		if(c.r == clr.r && c.g == clr.g && c.b == clr.b && c.a == clr.a)
+		{
+			return &gBatches[i];
+		}
+	}
+	gBatches.emplace_back();
+	gBatches.back().clr = clr;
+	return &gBatches.back();
+}
+void batchFill(const Color& clr, const SDL_Rect& rc)
+{
+	batchColor(clr)->fills.push_back(rc);
+}
+void batchRect(const Color& clr, const SDL_Rect& rc)
+{
+	batchColor(clr)->rects.push_back(rc);
+}
+void batchGlyph(int x, int y, uint8_t val, const Color& clr)
+{
+	if(nullptr == gGlyphs.atlas)
+	{
+		/* every segment is axis aligned, so it is a one pixel wide rect */
+		const int a = gGlyphs.seg;
+		const uint8_t m = gNumberPiex[val];
+		x++;
+		y++;
+		const SDL_Rect segs[7] = {
+			{ x, y, a + 1, 1 }, { x, y + a, a + 1, 1 }, { x, y + a + a, a + 1, 1 },
+			{ x, y, 1, a + 1 }, { x + a, y, 1, a + 1 }, { x, y + a, 1, a + 1 }, { x + a, y + a, 1, a + 1 }
+		};
+		for(int i = 0; i < 7; ++i)
+		{
+			if(m & (1u << i))
+			{
+				batchFill(clr, segs[i]);
+			}
+		}
+		return;
+	}
+	gGlyphs.quads.push_back({ x, y, val, clr });
+}
+/* the glyphs are built for one size, gCellSize / 2, which both the grid and the counter use */
+void buildGlyphs()
+{
+	if(nullptr != gGlyphs.atlas)
+	{
+		SDL_DestroyTexture(gGlyphs.atlas);
+		gGlyphs.atlas = nullptr;
+	}
+	const int a = (gCellSize / 2 - 2) / 2;
+	gGlyphs.seg = a - 1;
+	gGlyphs.w = a + 1;
+	gGlyphs.h = a * 2;
+	if(a < 2 || !SDL_RenderTargetSupported(gRender))
+	{
+		return;
+	}
+	gGlyphs.atlas = SDL_CreateTexture(gRender, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, gGlyphs.w * 10, gGlyphs.h);
+	if(nullptr == gGlyphs.atlas)
+	{
+		return;
+	}
+	SDL_SetRenderTarget(gRender, gGlyphs.atlas);
+	SDL_SetRenderDrawColor(gRender, 0, 0, 0, 0);
+	SDL_RenderClear(gRender);
+	SDL_SetRenderDrawColor(gRender, 255, 255, 255, 255);
+	for(int v = 0; v < 10; ++v)
+	{
+		drawNumber(gRender, v * gGlyphs.w, 0, a * 2, v);
+	}
+	SDL_SetRenderTarget(gRender, nullptr);
+	SDL_SetTextureBlendMode(gGlyphs.atlas, SDL_BLENDMODE_BLEND);
+}
+/* fills first, then outlines, then digits, one call per color and kind */
+void flushBatches()
+{
+	for(size_t i = 0; i < gBatches.size(); ++i)
+	{
+		DrawBatch& b = gBatches[i];
+		if(!b.fills.empty())
+		{
+			SDL_SetRenderDrawColor(gRender, b.clr.r, b.clr.g, b.clr.b, b.clr.a);
+			SDL_RenderFillRects(gRender, b.fills.data(), (int)b.fills.size());
+		}
+	}
+	for(size_t i = 0; i < gBatches.size(); ++i)
+	{
+		DrawBatch& b = gBatches[i];
+		if(!b.rects.empty())
+		{
+			SDL_SetRenderDrawColor(gRender, b.clr.r, b.clr.g, b.clr.b, b.clr.a);
+			SDL_RenderDrawRects(gRender, b.rects.data(), (int)b.rects.size());
+		}
+		b.fills.clear();
+		b.rects.clear();
+	}
+	if(!gGlyphs.quads.empty())
+	{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+		const int idx[6] = { 0, 1, 2, 0, 2, 3 };
+		for(size_t i = 0; i < gGlyphs.quads.size(); ++i)
+		{
+			const GlyphQuad& q = gGlyphs.quads[i];
+			const float u0 = (float)q.val / 10;
+			const float u1 = (float)(q.val + 1) / 10;
+			const float x0 = (float)q.x;
+			const float y0 = (float)q.y;
+			const float x1 = (float)(q.x + gGlyphs.w);
+			const float y1 = (float)(q.y + gGlyphs.h);
+			const SDL_Color c = { q.clr.r, q.clr.g, q.clr.b, q.clr.a };
+			const int base = (int)gGlyphs.verts.size();
+			gGlyphs.verts.push_back({ { x0, y0 }, c, { u0, 0 } });
+			gGlyphs.verts.push_back({ { x1, y0 }, c, { u1, 0 } });
+			gGlyphs.verts.push_back({ { x1, y1 }, c, { u1, 1 } });
+			gGlyphs.verts.push_back({ { x0, y1 }, c, { u0, 1 } });
+			for(int k = 0; k < 6; ++k)
+			{
+				gGlyphs.indices.push_back(base + idx[k]);
+			}
+		}
+		SDL_RenderGeometry(gRender, gGlyphs.atlas, gGlyphs.verts.data(), (int)gGlyphs.verts.size(),
+			gGlyphs.indices.data(), (int)gGlyphs.indices.size());
+		gGlyphs.verts.clear();
+		gGlyphs.indices.clear();
+#else
+		for(size_t i = 0; i < gGlyphs.quads.size(); ++i)
+		{
+			const GlyphQuad& q = gGlyphs.quads[i];
+			const SDL_Rect src = { q.val * gGlyphs.w, 0, gGlyphs.w, gGlyphs.h };
+			const SDL_Rect dst = { q.x, q.y, gGlyphs.w, gGlyphs.h };
+			SDL_SetTextureColorMod(gGlyphs.atlas, q.clr.r, q.clr.g, q.clr.b);
+			SDL_SetTextureAlphaMod(gGlyphs.atlas, q.clr.a);
+			SDL_RenderCopy(gRender, gGlyphs.atlas, &src, &dst);
+		}
+#endif
+		gGlyphs.quads.clear();
+	}
+}
+int drawUint(int x, int y, int size, uint32_t val, const Color& clr)
 {
 	const int a = (size - 2) / 2;
 	x += a / 2;
@@ -240,34 +371,43 @@ int drawUint(SDL_Renderer* render, int x, int y, int size, uint32_t val)
 	int n = 0;
 	if(val < 10)
 	{
-		drawNumber(render, x, y, a * 2, val);
+		batchGlyph(x, y, val, clr);
 		n = a * 2;
 	}
 	else if(val < 100)
 	{
-		drawNumber(render, x, y, a * 2, val / 10);
-		drawNumber(render, x + a + a / 2, y, a * 2, val % 10);
+		batchGlyph(x, y, val / 10, clr);
+		batchGlyph(x + a + a / 2, y, val % 10, clr);
 		n = a * 4;
 	}
 	else if(val < 1000)
 	{
-		drawNumber(render, x, y, a * 2, val / 100);
-		drawNumber(render, x + 3 * a / 2, y, a * 2, (val / 10) % 10);
-		drawNumber(render, x + 3 * a, y, a * 2, val % 10);
+		batchGlyph(x, y, val / 100, clr);
+		batchGlyph(x + 3 * a / 2, y, (val / 10) % 10, clr);
+		batchGlyph(x + 3 * a, y, val % 10, clr);
 		n = a * 6;
 	}
 	return n;
 }
-void drawGrid(SDL_Renderer* render, const SDL_Rect* rect)
+void drawGrid(const SDL_Rect* rect)
 {
+	static const Color white = { 255, 255, 255, 255 };
+	static const Color black = { 0, 0, 0, 255 };
+	static const Color red = { 255, 0, 0, 255 };
+	static const Color border = { 100, 100, 100, 255 };
+	static const Color hints[4] = {
+		{ 0xe6, 0xf6, 0xe6, 0xff },
+		{ 0xcc, 0xee, 0xcc, 0xff },
+		{ 0xb2, 0xe4, 0xb2, 0xff },
+		{ 0x98, 0xda, 0x98, 0xff }
+	};
 	const int a = gCellSize;
 	int x0 = rect->x + (rect->w - a * MAX_COL_NUM) / 2;
 	int y0 = rect->y + (rect->h - a * MAX_ROW_NUM) / 2;
 
 	{
 		SDL_Rect rc = { x0, y0, a * MAX_COL_NUM + 1, a * MAX_ROW_NUM + 1 };
-		SDL_SetRenderDrawColor(render, 100, 100, 100, 255);
-		SDL_RenderDrawRect(render, &rc);
+		batchRect(border, rc);
 	}
 
 	for(int c = 0, x = x0; c < MAX_COL_NUM; ++c, x += a)
@@ -281,35 +421,28 @@ void drawGrid(SDL_Renderer* render, const SDL_Rect* rect)
 			}
 			SDL_Rect rc = { x, y, a, a };
 			m = m >= 200 ? 0 : m;
+			const int hint = gDropIndex >= 0 && gHints.most > 0 ? gHints.counts[r * MAX_COL_NUM + c] : 0;
 			if(0 != m)
 			{
-				const Color& clr = gBlockClrs[(m - 1) % MAX_BLK_NUM];
-				SDL_SetRenderDrawColor(render, clr.r, clr.g, clr.b, clr.a);
+				batchFill(gBlockClrs[(m - 1) % MAX_BLK_NUM], rc);
 			}
 			else
 			{
-				SDL_SetRenderDrawColor(render, 255, 255, 255, 255);
+				batchFill(0 != hint ? hints[(hint * 4 - 1) / gHints.most] : white, rc);
 			}
-			SDL_RenderFillRect(render, &rc);
 
-			SDL_SetRenderDrawColor(render, 0, 0, 0, 255);
 			rc.w++;
 			rc.h++;
-			SDL_RenderDrawRect(render, &rc);
+			batchRect(black, rc);
 			uint8_t v = gGridValues[r * MAX_COL_NUM + c];
 			if(0 == m)
 			{
-				if(v >= 100)
-				{
-					SDL_SetRenderDrawColor(render, 255, 0, 0, 255);
-					v %= 100;
-				}
-				drawUint(render, v > 9 ? rc.x + rc.h / 8 : rc.x + rc.h / 4, rc.y + rc.h / 4, rc.h / 2, v);
+				drawUint(v % 100 > 9 ? rc.x + rc.h / 8 : rc.x + rc.h / 4, rc.y + rc.h / 4, a / 2, v % 100, v >= 100 ? red : black);
 			}
 		}
 	}
 }
-void drawBlock(SDL_Renderer* render, const SDL_Rect* rect, int rows, int cols, const uint8_t* data)
+void drawBlock(const SDL_Rect* rect, int rows, int cols, const uint8_t* data, const Color& clr)
 {
 	const int a = gCellSize;
 	int x0 = rect->x + (rect->w - a * 4) / 2;
@@ -324,26 +457,149 @@ void drawBlock(SDL_Renderer* render, const SDL_Rect* rect, int rows, int cols, c
 				continue;
 			}
 			SDL_Rect rc = { x, y, a, a };
-			SDL_RenderFillRect(render, &rc);
+			batchFill(clr, rc);
 		}
 	}
 }
 
-void updateWindow()
+/* palette slots in cell units, so hit testing does not depend on the window size */
+void buildPalette()
+{
+	memset(gPalette, -1, sizeof(gPalette));
+	for(int i = 0; i < MAX_BLK_NUM; ++i)
+	{
+		const Block& blk = gBlocks[i];
+		for(int r = blk.ypos; r < blk.ypos + MAX_BLKROW_NUM && r < PALETTE_ROW_NUM; ++r)
+		{
+			for(int c = blk.xpos; c < blk.xpos + MAX_BLKCOL_NUM && c < PALETTE_COL_NUM; ++c)
+			{
+				gPalette[r][c] = i;
+			}
+		}
+	}
+}
+int testBlockIndex(int x, int y)
+{
+	if(gCellSize <= 0 || x < 0 || y < 0)
+	{
+		return -1;
+	}
+	int c = x / gCellSize;
+	int r = y / gCellSize;
+	if(c >= PALETTE_COL_NUM || r >= PALETTE_ROW_NUM)
+	{
+		return -1;
+	}
+	return gPalette[r][c];
+}
+void updateGridMask()
 {
-	SDL_Rect rect = { 0 };
+	gGrid.mask = 0;
+	for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+	{
+		if(0 != gGrid.data[i])
+		{
+			gGrid.mask |= 1ull << i;
+		}
+	}
+}
+int floorDiv(int a, int b)
+{
+	return a >= 0 ? a / b : -((b - 1 - a) / b);
+}
+/**
+ * the piece snaps to the cell under a point a quarter cell into its top left cell,
+ * returns whether every cell lands on a free board cell
+ */
+bool snapBlock(int index, int x, int y, DropTarget* t)
+{
+	const BlockInfo& info = gBlocks[index].info;
+	t->mask = 0;
+	if(gCellSize <= 0)
+	{
+		return false;
+	}
+	t->col = floorDiv(x + gCellSize / 4 - gGrid.rect.x, gCellSize);
+	t->row = floorDiv(y + gCellSize / 4 - gGrid.rect.y, gCellSize);
+	bool inside = true;
+	for(int r = 0; r < info.rows; ++r)
+	{
+		for(int c = 0; c < info.cols; ++c)
+		{
+			if(0 == info.data[r * info.cols + c])
+			{
+				continue;
+			}
+			const int gr = t->row + r;
+			const int gc = t->col + c;
+			if(gr < 0 || gr >= MAX_ROW_NUM || gc < 0 || gc >= MAX_COL_NUM)
+			{
+				inside = false;
+				continue;
+			}
+			t->mask |= 1ull << (gr * MAX_COL_NUM + gc);
+		}
+	}
+	return inside && 0 == (t->mask & gGrid.mask);
+}
+/* answers per board state stay in the transposition table of the hint solver between drags */
+void buildHints()
+{
+	DragHints& h = gHints;
+	Solve* s = h.solve;
+	solveInit(s, gAuto.month, gAuto.day);
+	const uint64_t used = s->baseMask | gGrid.mask;
+	uint32_t blkMask = 1u << gDropIndex;
+	for(int i = 0; i < MAX_BLK_NUM; ++i)
+	{
+		if(0 != gBlocks[i].state)
+		{
+			blkMask |= 1u << i;
+		}
+	}
+	memset(h.counts, 0, sizeof(h.counts));
+	h.most = 0;
+	h.masks.clear();
+	for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+	{
+		for(int k = 0; k < s->placeNum[i]; ++k)
+		{
+			const Placement* p = &s->places[i][k];
+			if(gDropIndex != p->blk || 0 != (p->mask & used) || !solveExists(s, used | p->mask, blkMask))
+			{
+				continue;
+			}
+			h.masks.push_back(p->mask);
+			for(uint64_t m = p->mask; 0 != m; m &= m - 1)
+			{
+				const int n = ++h.counts[bitCount((m & (0 - m)) - 1)];
+				h.most = n > h.most ? n : h.most;
+			}
+		}
+	}
+}
+bool isHinted(uint64_t mask)
+{
+	for(size_t i = 0; i < gHints.masks.size(); ++i)
+	{
+		if(mask == gHints.masks[i])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+void layoutWindow()
+{
+	SDL_Rect& rect = gScene.rect;
+	rect.x = 0;
+	rect.y = 0;
 	SDL_GetRendererOutputSize(gRender, &rect.w, &rect.h);
 	{
-		int x0 = rect.w / (1 + (MAX_BLKCOL_NUM + 1) * 4);
-		int y0 = rect.h / (1 + (MAX_BLKROW_NUM + 1) * 3);
+		int x0 = rect.w / PALETTE_COL_NUM;
+		int y0 = rect.h / PALETTE_ROW_NUM;
 		gCellSize = x0 < y0 ? x0 : y0;
 	}
-
-	SDL_RenderClear(gRender);
-
-	SDL_SetRenderDrawColor(gRender, 255, 255, 255, 255);
-	SDL_RenderFillRect(gRender, &rect);
-
 	for(int i = 0; i < MAX_BLK_NUM; ++i)
 	{
 		Block& blk = gBlocks[i];
@@ -351,84 +607,200 @@ void updateWindow()
 		blk.rect.y = rect.y + blk.ypos * gCellSize;
 		blk.rect.w = gCellSize * MAX_BLKCOL_NUM;
 		blk.rect.h = gCellSize * MAX_BLKROW_NUM;
-		if(0 != blk.state)
-		{
-			SDL_SetRenderDrawColor(gRender, blk.clr.r, blk.clr.g, blk.clr.b, blk.clr.a);
-		}
-		else
-		{
-			SDL_SetRenderDrawColor(gRender, 70, 70, 70, 255);
-		}
-		drawBlock(gRender, &blk.rect, blk.info.rows, blk.info.cols, blk.info.data);
 	}
 	gGrid.rect.x = rect.x + gCellSize * gGrid.xpos;
 	gGrid.rect.y = rect.y + gCellSize * gGrid.ypos;
 	gGrid.rect.w = gCellSize * MAX_COL_NUM;
 	gGrid.rect.h = gCellSize * MAX_ROW_NUM;
+	gAuto.checkRect.x = gGrid.rect.x;
+	gAuto.checkRect.y = gGrid.rect.y + gGrid.rect.h + gCellSize + gCellSize / 2;
+	gAuto.checkRect.w = gCellSize / 2;
+	gAuto.checkRect.h = gCellSize / 2;
+	buildGlyphs();
 
-	drawGrid(gRender, &gGrid.rect);
+	if(nullptr != gScene.board)
+	{
+		SDL_DestroyTexture(gScene.board);
+		SDL_DestroyTexture(gScene.frame);
+		gScene.board = nullptr;
+		gScene.frame = nullptr;
+	}
+	if(SDL_RenderTargetSupported(gRender) && rect.w > 0 && rect.h > 0)
+	{
+		gScene.board = SDL_CreateTexture(gRender, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, rect.w, rect.h);
+		gScene.frame = SDL_CreateTexture(gRender, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, rect.w, rect.h);
+		if(nullptr == gScene.board || nullptr == gScene.frame)
+		{
+			SDL_DestroyTexture(gScene.board);
+			SDL_DestroyTexture(gScene.frame);
+			gScene.board = nullptr;
+			gScene.frame = nullptr;
+		}
+		else
+		{
+			SDL_SetTextureBlendMode(gScene.board, SDL_BLENDMODE_NONE);
+			SDL_SetTextureBlendMode(gScene.frame, SDL_BLENDMODE_NONE);
+		}
+	}
+	gScene.dirty = true;
+}
+void drawScene()
+{
+	static const Color white = { 255, 255, 255, 255 };
+	static const Color black = { 0, 0, 0, 255 };
+	static const Color gray = { 70, 70, 70, 255 };
+	batchFill(white, gScene.rect);
 
-	if(gDropIndex >= 0)
+	for(int i = 0; i < MAX_BLK_NUM; ++i)
 	{
-		SDL_SetRenderDrawColor(gRender, 70, 70, 70, 128);
-		Block& blk = gBlocks[gDropIndex];
-		SDL_Rect rc = blk.rect;
-		rc.x = gDropX + gDropCX;
-		rc.y = gDropY + gDropCY;
-		drawBlock(gRender, &rc, blk.info.rows, blk.info.cols, blk.info.data);
+		Block& blk = gBlocks[i];
+		drawBlock(&blk.rect, blk.info.rows, blk.info.cols, blk.info.data, 0 != blk.state ? blk.clr : gray);
 	}
+	drawGrid(&gGrid.rect);
 
-	SDL_SetRenderDrawColor(gRender, 0, 0, 0, 255);
-	gSolve.checkRect.x = gGrid.rect.x;
-	gSolve.checkRect.y = gGrid.rect.y + gGrid.rect.h + gCellSize + gCellSize / 2;
-	gSolve.checkRect.w = gCellSize / 2;
-	gSolve.checkRect.h = gCellSize / 2;
-	SDL_RenderDrawRect(gRender, &gSolve.checkRect);
-	if(gSolve.enabled)
-	{
-		int x0 = gSolve.checkRect.x + gSolve.checkRect.w / 5;
-		int y0 = gSolve.checkRect.y + gSolve.checkRect.h / 3;
-		int x1 = gSolve.checkRect.x + gSolve.checkRect.w / 3;
-		int y1 = gSolve.checkRect.y + gSolve.checkRect.h * 4 / 5;
-		SDL_RenderDrawLine(gRender, x0, y0, x1, y1);
-		x0 = gSolve.checkRect.x + gSolve.checkRect.w * 4 / 5;
-		y0 = gSolve.checkRect.y + gSolve.checkRect.h / 5;
-		SDL_RenderDrawLine(gRender, x1, y1, x0, y0);
+	batchRect(black, gAuto.checkRect);
+	int lineNum = 0;
+	SDL_Point lines[4][3];
+	if(gAuto.enabled)
+	{
+		const SDL_Rect& chk = gAuto.checkRect;
+		lines[lineNum][0] = { chk.x + chk.w / 5, chk.y + chk.h / 3 };
+		lines[lineNum][1] = { chk.x + chk.w / 3, chk.y + chk.h * 4 / 5 };
+		lines[lineNum][2] = { chk.x + chk.w * 4 / 5, chk.y + chk.h / 5 };
+		lineNum++;
 
-		if(gSolve.resultNum > 0)
+		if(0 != gSolve.results.num)
 		{
-			x0 = gSolve.checkRect.x + gSolve.checkRect.w + gCellSize / 4;
-			y0 = gSolve.checkRect.y;
-			gSolve.preRect.x = x0;
-			gSolve.preRect.y = y0;
-			gSolve.preRect.w = gSolve.checkRect.w;
-			gSolve.preRect.h = gSolve.checkRect.h;
-			x1 = gSolve.preRect.x + gSolve.preRect.w * 2 / 3;
-			y1 = gSolve.preRect.y + gSolve.preRect.h / 2;
-			SDL_RenderDrawLine(gRender, x1, y0, x0, y1);
-			SDL_RenderDrawLine(gRender, x0, y1, x1, gSolve.preRect.y + gSolve.preRect.h);
+			int x0 = chk.x + chk.w + gCellSize / 4;
+			int y0 = chk.y;
+			gAuto.preRect.x = x0;
+			gAuto.preRect.y = y0;
+			gAuto.preRect.w = chk.w;
+			gAuto.preRect.h = chk.h;
+			int x1 = gAuto.preRect.x + gAuto.preRect.w * 2 / 3;
+			int y1 = gAuto.preRect.y + gAuto.preRect.h / 2;
+			lines[lineNum][0] = { x1, y0 };
+			lines[lineNum][1] = { x0, y1 };
+			lines[lineNum][2] = { x1, gAuto.preRect.y + gAuto.preRect.h };
+			lineNum++;
 
-			x0 = gSolve.preRect.x + gSolve.preRect.w;
-			x0 += drawUint(gRender, x0, y0, gCellSize / 2, gSolve.resultIdx + 1);
-			SDL_RenderDrawLine(gRender, x0, y0 + gCellSize / 2, x0 + gCellSize / 4, y0);
+			x0 = gAuto.preRect.x + gAuto.preRect.w;
+			x0 += drawUint(x0, y0, gCellSize / 2, gAuto.resultIdx + 1, black);
+			lines[lineNum][0] = { x0, y0 + gCellSize / 2 };
+			lines[lineNum][1] = { x0 + gCellSize / 4, y0 };
+			lines[lineNum][2] = lines[lineNum][1];
+			lineNum++;
 			x0 += gCellSize / 4;
-			x0 += drawUint(gRender, x0, y0, gCellSize / 2, gSolve.resultNum);
+			x0 += drawUint(x0, y0, gCellSize / 2, (uint32_t)gSolve.results.num, black);
 
 			x0 += gCellSize / 4;
-			gSolve.nextRect.x = x0;
-			gSolve.nextRect.y = y0;
-			gSolve.nextRect.w = gSolve.checkRect.w;
-			gSolve.nextRect.h = gSolve.checkRect.h;
+			gAuto.nextRect.x = x0;
+			gAuto.nextRect.y = y0;
+			gAuto.nextRect.w = chk.w;
+			gAuto.nextRect.h = chk.h;
 
-			x1 = gSolve.nextRect.x + gSolve.nextRect.w * 2 / 3;
-			y1 = gSolve.nextRect.y + gSolve.nextRect.h / 2;
-			SDL_RenderDrawLine(gRender, x0, y0, x1, y1);
-			SDL_RenderDrawLine(gRender, x1, y1, x0, gSolve.nextRect.y + gSolve.nextRect.h);
+			x1 = gAuto.nextRect.x + gAuto.nextRect.w * 2 / 3;
+			y1 = gAuto.nextRect.y + gAuto.nextRect.h / 2;
+			lines[lineNum][0] = { x0, y0 };
+			lines[lineNum][1] = { x1, y1 };
+			lines[lineNum][2] = { x0, gAuto.nextRect.y + gAuto.nextRect.h };
+			lineNum++;
+		}
+		if(gAuto.searching)
+		{
+			SDL_Rect rc = { gGrid.rect.x, chk.y + chk.h + gCellSize / 4, gGrid.rect.w * gAuto.progress / 1000, 2 };
+			batchFill(black, rc);
 		}
 	}
+	flushBatches();
+	SDL_SetRenderDrawColor(gRender, 0, 0, 0, 255);
+	for(int i = 0; i < lineNum; ++i)
+	{
+		SDL_RenderDrawLines(gRender, lines[i], 3);
+	}
+}
+/* the dragged piece plus its snapped cells on the board, green if the date stays solvable, orange if it only fits */
+void drawDrag()
+{
+	static const Color gray = { 70, 70, 70, 128 };
+	static const Color green = { 0x30, 0xb0, 0x30, 0xff };
+	static const Color orange = { 0xf0, 0x90, 0x20, 0xff };
+	static const Color red = { 0xe0, 0x30, 0x30, 0xff };
+	Block& blk = gBlocks[gDropIndex];
+	SDL_Rect rc = blk.rect;
+	rc.x = gDropX + gDropCX;
+	rc.y = gDropY + gDropCY;
+	drawBlock(&rc, blk.info.rows, blk.info.cols, blk.info.data, gray);
+	gScene.dragRect = rc;
 
+	DropTarget t;
+	const Color& clr = !snapBlock(gDropIndex, rc.x, rc.y, &t) ? red : (isHinted(t.mask) ? green : orange);
+	for(uint64_t m = t.mask; 0 != m; m &= m - 1)
+	{
+		const int i = bitCount((m & (0 - m)) - 1);
+		SDL_Rect cell = { gGrid.rect.x + (i % MAX_COL_NUM) * gCellSize, gGrid.rect.y + (i / MAX_COL_NUM) * gCellSize,
+			gCellSize + 1, gCellSize + 1 };
+		SDL_UnionRect(&gScene.dragRect, &cell, &gScene.dragRect);
+		batchRect(clr, cell);
+		cell.x++;
+		cell.y++;
+		cell.w -= 2;
+		cell.h -= 2;
+		batchRect(clr, cell);
+	}
+	flushBatches();
+}
+/* only the area under the dragged piece changes between frames unless the scene is dirty */
+void renderFrame()
+{
+	gFrame.pending = false;
+	gFrame.last = SDL_GetPerformanceCounter();
+	if(nullptr == gScene.board)
+	{
+		SDL_RenderClear(gRender);
+		drawScene();
+		if(gDropIndex >= 0)
+		{
+			drawDrag();
+		}
+		SDL_RenderPresent(gRender);
+		return;
+	}
+	if(gScene.dirty)
+	{
+		SDL_SetRenderTarget(gRender, gScene.board);
+		drawScene();
+		SDL_SetRenderTarget(gRender, gScene.frame);
+		SDL_RenderCopy(gRender, gScene.board, nullptr, nullptr);
+		gScene.dirty = false;
+	}
+	else
+	{
+		SDL_SetRenderTarget(gRender, gScene.frame);
+		if(gScene.dragRect.w > 0)
+		{
+			SDL_RenderCopy(gRender, gScene.board, &gScene.dragRect, &gScene.dragRect);
+		}
+	}
+	gScene.dragRect.w = 0;
+	if(gDropIndex >= 0)
+	{
+		drawDrag();
+	}
+	SDL_SetRenderTarget(gRender, nullptr);
+	SDL_RenderCopy(gRender, gScene.frame, nullptr, nullptr);
 	SDL_RenderPresent(gRender);
 }
+/* events only mark what changed, the main loop renders once per frame */
+void updateWindow()
+{
+	gScene.dirty = true;
+	gFrame.pending = true;
+}
+void requestFrame()
+{
+	gFrame.pending = true;
+}
 bool isInRect(int x, int y, const SDL_Rect* rect)
 {
 	return x >= rect->x && x <= rect->x + rect->w && y >= rect->y && y <= rect->y + rect->h;
@@ -451,18 +823,6 @@ int testGridIndex(int x, int y)
 	}
 	return r * MAX_COL_NUM + c;
 }
-int testBlockIndex(int x, int y)
-{
-	for(int i = 0; i < MAX_BLK_NUM; ++i)
-	{
-		Block& blk = gBlocks[i];
-		if(isInRect(x, y, &blk.rect))
-		{
-			return i;
-		}
-	}
-	return -1;
-}
 void removeBlock(int index)
 {
 	for(int r = 0; r < MAX_ROW_NUM; ++r)
@@ -476,31 +836,25 @@ void removeBlock(int index)
 			}
 		}
 	}
+	updateGridMask();
 	gBlocks[index].state = 0;
 }
 bool placeBlock(int index, int x, int y)
 {
-	Block& blk = gBlocks[index];
-	memcpy(gGrid.cache, gGrid.data, sizeof(gGrid.data));
-	for(int r = 0; r < blk.info.rows; ++r)
+	DropTarget t;
+	if(!snapBlock(index, x, y, &t))
 	{
-		for(int c = 0; c < blk.info.cols; ++c)
+		return false;
+	}
+	for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+	{
+		if(0 != (t.mask & (1ull << i)))
 		{
-			int pos = r * blk.info.cols + c;
-			if(0 == blk.info.data[pos])
-			{
-				continue;
-			}
-			int idx = testGridIndex(x + c * gCellSize + gCellSize / 4, y + r * gCellSize + gCellSize / 4);
-			if(idx < 0 || 0 != gGrid.data[idx])
-			{
-				return false;
-			}
-			gGrid.cache[idx] = index + 1;
+			gGrid.data[i] = index + 1;
 		}
 	}
-	memcpy(gGrid.data, gGrid.cache, sizeof(gGrid.data));
-	blk.state = 1;
+	gGrid.mask |= t.mask;
+	gBlocks[index].state = 1;
 	return true;
 }
 int firstDataRow(const uint8_t* data, int rows, int cols, uint8_t val)
@@ -531,227 +885,166 @@ int firstDataCol(const uint8_t* data, int rows, int cols, uint8_t val)
 	}
 	return 0;
 }
-void rotateBlock(BlockInfo* blk)
+
+
+
+void solveDrop(int code, void* data)
 {
-	uint8_t buf[MAX_BLKCOL_NUM * MAX_BLKROW_NUM];
-	memcpy(buf, blk->data, sizeof(buf));
-	int rows = blk->rows;
-	blk->rows = blk->cols;
-	blk->cols = rows;
-	for(int r = 0; r < blk->rows; ++r)
-	{
-		for(int c = 0; c < blk->cols; ++c)
-		{
-			blk->data[r * blk->cols + c] = buf[(blk->cols - 1 - c) * blk->rows + r];
-		}
+	if(SOLVE_EVENT_RESULT == code)
+	{
+		delete (std::vector<uint64_t>*)data;
 	}
-}
-void mirrorBlock(BlockInfo* blk)
-{
-	uint8_t buf[MAX_BLKCOL_NUM * MAX_BLKROW_NUM];
-	memcpy(buf, blk->data, sizeof(buf));
-	for(int r = 0; r < blk->rows; ++r)
+#if SOLVE_STATS
+	else if(SOLVE_EVENT_FINISHED == code)
 	{
-		for(int c = 0; c < blk->cols; ++c)
-		{
-			blk->data[r * blk->cols + c] = buf[r * blk->cols + blk->cols - c - 1];
-		}
+		delete (SolveStats*)data;
 	}
+#endif
 }
-bool solvePlace(Solve* s, int row, int col, int index, int branch)
+void solvePost(int seq, int code, void* data)
 {
-	BlockInfo* blk = &s->blkData[index].data[branch];
-	if(row + blk->rows > MAX_ROW_NUM || col + blk->cols > MAX_COL_NUM)
+	SDL_Event evt;
+	memset(&evt, 0, sizeof(evt));
+	evt.type = gSolveEvent;
+	evt.user.code = code;
+	evt.user.data1 = (void*)(intptr_t)seq;
+	evt.user.data2 = data;
+	if(SDL_PushEvent(&evt) <= 0)
 	{
-		return false;
+		solveDrop(code, data);
 	}
-	const int num = blk->cols * blk->rows;
-	for(int i = 0; i < num; ++i)
-	{
-		if(0 == blk->data[i])
-		{
-			continue;
-		}
-		int r = i / blk->cols;
-		int c = i % blk->cols;
-		if(0 != s->gridData[(row + r) * MAX_COL_NUM + col + c])
-		{
-			return false;
-		}
-	}
-	for(int i = 0; i < num; ++i)
-	{
-		if(0 == blk->data[i])
-		{
-			continue;
-		}
-		int r = i / blk->cols;
-		int c = i % blk->cols;
-		s->gridData[(row + r) * MAX_COL_NUM + col + c] = index + 1;
-	}
-	return true;
 }
-void solveUnplace(Solve* s, int row, int col, int index, int branch)
+void solvePostResults(int seq, Solve* s, size_t from)
 {
-	BlockInfo* blk = &s->blkData[index].data[branch];
-	const int num = blk->cols * blk->rows;
-	for(int i = 0; i < num; ++i)
+	std::vector<uint64_t>* res = new std::vector<uint64_t>();
+	for(size_t i = from; i < s->results.num; ++i)
 	{
-		if(0 == blk->data[i])
-		{
-			continue;
-		}
-		int r = i / blk->cols;
-		int c = i % blk->cols;
-		s->gridData[(row + r) * MAX_COL_NUM + col + c] = 0;
+		res->push_back(arenaAt(&s->results, i));
 	}
+	solvePost(seq, SOLVE_EVENT_RESULT, res);
+}
+void solveFinished(int seq, Solve* s)
+{
+#if SOLVE_STATS
+	solvePost(seq, SOLVE_EVENT_FINISHED, new SolveStats(s->stats));
+#else
+	solvePost(seq, SOLVE_EVENT_FINISHED, nullptr);
+#endif
 }
-void solveGrid(Solve* s, int index)
+void solveWorker()
 {
-	if(index >= MAX_COL_NUM * MAX_ROW_NUM)
+	Solve* s = gJob.solve;
+	int seq = 0;
+	for(;;)
 	{
-		if(s->resultNum < MAX_RESULT_NUM)
+		bool restart = false;
+		int mon = 0;
+		int day = 0;
 		{
-			Result* res = &s->results[s->resultNum];
-			for(int k = 0; k < MAX_BLK_NUM; ++k)
+			std::unique_lock<std::mutex> guard(gJob.lock);
+			gJob.wake.wait(guard, [&] { return gJob.quit || gJob.seq != seq || (gJob.more > 0 && !s->finished); });
+			if(gJob.quit)
 			{
-				memcpy(&res->blkData[k], &s->blkData[k].data[s->blkData[k].idx], sizeof(BlockInfo));
+				return;
+			}
+			restart = gJob.seq != seq;
+			seq = gJob.seq;
+			mon = gJob.month;
+			day = gJob.day;
+			if(gJob.more > 0)
+			{
+				gJob.more--;
 			}
-			memcpy(res->gridData, s->gridData, sizeof(s->gridData));
-			s->resultNum++;
-		}
-		return;
-	}
-	if(0 != s->gridData[index])
-	{
-		solveGrid(s, index + 1);
-		return;
-	}
-	int r = index / MAX_COL_NUM;
-	int c = index % MAX_COL_NUM;
-	for(int i = 0; i < MAX_BLK_NUM; ++i)
-	{
-		const uint32_t msk = (1u << i);
-		if(0 != (s->blkMask & msk))
-		{
-			continue;
 		}
-		Branch* blk = &s->blkData[i];
-		for(int b = 0; b < blk->num; ++b)
+		if(restart)
 		{
-			int x = c - blk->firstCols[b];
-			if(x >= 0 && solvePlace(s, r, x, i, b))
+			arenaClear(&s->results);
+			s->finished = true;
+			if(0 == mon)
 			{
-				if(0 != s->gridData[index])
-				{
-					blk->idx = b;
-					s->blkMask |= msk;
-					solveGrid(s, index + 1);
-					s->blkMask &= ~msk;
-				}
-				solveUnplace(s, r, x, i, b);
+				continue;
+			}
+			solveInit(s, mon, day);
+			if(solveTable(s, mon, day))
+			{
+				solvePostResults(seq, s, 0);
+				solveFinished(seq, s);
+				continue;
 			}
+			s->finished = false;
+			solveStart(s, 0);
 		}
-	}
-}
-
-void solve(int mon, int day)
-{
-	memcpy(gSolve.gridData, gGridMarks, sizeof(gGridMarks));
-	for(int r = 0; r < 2; ++r)
-	{
-		for(int c = 0; c < MAX_COL_NUM; ++c)
+		while(seq == gJob.seq && !gJob.quit)
 		{
-			if(100 + mon == gGridValues[r * MAX_COL_NUM + c])
+			s->budget = SOLVE_SLICE;
+			/* a repeated state can append several results at once */
+			const size_t from = s->results.num;
+			if(solveNext(s))
 			{
-				gSolve.gridData[r * MAX_COL_NUM + c] = 200;
+				solvePostResults(seq, s, from);
 				break;
 			}
-		}
-	}
-	for(int r = 2; r < MAX_ROW_NUM; ++r)
-	{
-		for(int c = 0; c < MAX_COL_NUM; ++c)
-		{
-			if(day == gGridValues[r * MAX_COL_NUM + c])
+			if(s->top < 0)
 			{
-				gSolve.gridData[r * MAX_COL_NUM + c] = 200;
+				s->finished = true;
+				solveCacheStore(s, mon, day);
+				solveFinished(seq, s);
 				break;
 			}
+			const SolveFrame* f = &s->stack[0];
+			solvePost(seq, SOLVE_EVENT_PROGRESS, (void*)(intptr_t)(f->next * 1000 / (f->num + 1)));
 		}
 	}
-
-	gSolve.blkMask = 0;
-	gSolve.resultIdx = 0;
-	gSolve.resultNum = 0;
-	solveGrid(&gSolve, 0);
 }
-bool containsBlock(Branch* blk, const BlockInfo* dat)
+void solveAsync(int mon, int day)
 {
-	const int len = dat->cols * dat->rows;
-	for(int i = 0; i < blk->num; ++i)
 	{
-		BlockInfo* inf = &blk->data[i];
-		if(inf->cols == dat->cols && inf->rows == dat->rows && 0 == memcmp(blk->data[i].data, dat->data, len))
-		{
-			return true;
-		}
+		std::lock_guard<std::mutex> guard(gJob.lock);
+		gJob.month = mon;
+		gJob.day = day;
+		gJob.more = 0 == mon ? 0 : 1;
+		gJob.seq++;
 	}
-	return false;
-}
-int firstBlockCell(const BlockInfo* dat)
-{
-	for(int i = 0; i < dat->cols; ++i)
+	gJob.wake.notify_one();
+	if(0 != mon)
 	{
-		if(0 != dat->data[i])
-		{
-			return i;
-		}
+		solveInit(&gSolve, mon, day);
 	}
-	return 0;
+	arenaClear(&gSolve.results);
+	gAuto.resultIdx = 0;
+	gAuto.progress = 0;
+	gAuto.finished = 0 == mon;
+	gAuto.searching = 0 != mon;
+	gAuto.waiting = false;
 }
-void initSolve()
+void solveAsyncMore()
 {
-	gSolve.enabled = false;
-	gSolve.month = 1;
-	gSolve.day = 1;
-	gSolve.resultNum = 0;
-	for(int i = 0; i < MAX_BLK_NUM; ++i)
 	{
-		const BlockInfo* tpl = &gBlockInfos[i];
-		int len = tpl->rows * tpl->cols;
-		Branch* blk = &gSolve.blkData[i];
-		BlockInfo tmp;
-		blk->idx = 0;
-		blk->num = 0;
-		memcpy(&tmp, tpl, sizeof(BlockInfo));
-		for(int k = 0; k < 4; ++k)
-		{
-			if(!containsBlock(blk, &tmp))
-			{
-				memcpy(&blk->data[blk->num], &tmp, sizeof(BlockInfo));
-				blk->firstCols[blk->num] = firstBlockCell(&tmp);
-				blk->num++;
-			}
-			rotateBlock(&tmp);
-		}
-		memcpy(&tmp, tpl, sizeof(BlockInfo));
-		mirrorBlock(&tmp);
-		for(int k = 4; k < 8; ++k)
-		{
-			if(!containsBlock(blk, &tmp))
-			{
-				memcpy(&blk->data[blk->num], &tmp, sizeof(BlockInfo));
-				blk->firstCols[blk->num] = firstBlockCell(&tmp);
-				blk->num++;
-			}
-			rotateBlock(&tmp);
-		}
+		std::lock_guard<std::mutex> guard(gJob.lock);
+		gJob.more++;
 	}
+	gJob.wake.notify_one();
+	gAuto.searching = true;
+	gAuto.waiting = true;
+}
+void solveAsyncStart()
+{
+	gSolveEvent = SDL_RegisterEvents(1);
+	gJob.solve = new Solve(gSolve);
+	gJob.seq = 0;
+	gJob.quit = false;
+	gJob.thread = std::thread(solveWorker);
+}
+void solveAsyncStop()
+{
+	gJob.quit = true;
+	gJob.wake.notify_one();
+	gJob.thread.join();
+	delete gJob.solve;
 }
 void commitResult()
 {
-	if(gSolve.resultIdx < 0 || gSolve.resultIdx >= gSolve.resultNum)
+	if(gAuto.resultIdx < 0 || gAuto.resultIdx >= (int)gSolve.results.num)
 	{
 		memcpy(gGrid.data, gGridMarks, sizeof(gGrid.data));
 		for(int i = 0; i < MAX_BLK_NUM; ++i)
@@ -762,19 +1055,70 @@ void commitResult()
 	}
 	else
 	{
-		Result* res = &gSolve.results[gSolve.resultIdx];
+		Result res;
+		unpackResult(&gSolve, arenaAt(&gSolve.results, gAuto.resultIdx), &res);
 		for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
 		{
-			uint8_t val = res->gridData[i];
+			uint8_t val = res.gridData[i];
 			gGrid.data[i] = 200 == val ? 0 : val;
 		}
 		for(int i = 0; i < MAX_BLK_NUM; ++i)
 		{
 			Block* blk = &gBlocks[i];
-			memcpy(&blk->info, &res->blkData[i], sizeof(blk->info));
+			memcpy(&blk->info, &res.blkData[i], sizeof(blk->info));
 			blk->state = 1;
 		}
 	}
+	updateGridMask();
+}
+void onSolveEvent(const SDL_UserEvent& evt)
+{
+	if((int)(intptr_t)evt.data1 != gJob.seq)
+	{
+		solveDrop(evt.code, evt.data2);
+		return;
+	}
+	if(SOLVE_EVENT_RESULT == evt.code)
+	{
+		std::vector<uint64_t>* res = (std::vector<uint64_t>*)evt.data2;
+		const bool first = 0 == gSolve.results.num;
+		for(size_t i = 0; i < res->size(); ++i)
+		{
+			arenaPush(&gSolve.results, (*res)[i]);
+		}
+		delete res;
+		gAuto.searching = false;
+		if(first || gAuto.waiting)
+		{
+			gAuto.resultIdx = first ? 0 : gAuto.resultIdx + 1;
+			gAuto.waiting = false;
+			commitResult();
+		}
+	}
+	else if(SOLVE_EVENT_PROGRESS == evt.code)
+	{
+		gAuto.progress = (int)(intptr_t)evt.data2;
+	}
+	else if(SOLVE_EVENT_FINISHED == evt.code)
+	{
+		gAuto.finished = true;
+		gAuto.searching = false;
+		gAuto.waiting = false;
+#if SOLVE_STATS
+		SolveStats* st = (SolveStats*)evt.data2;
+		char title[128];
+		snprintf(title, sizeof(title), "MoyuDay - %d/%d, %llu solutions, %.1f ms", gAuto.month, gAuto.day,
+			(unsigned long long)st->solutions, st->timeMs);
+		SDL_SetWindowTitle(gWindow, title);
+		if(gShowStats)
+		{
+			printf("%d/%d\n", gAuto.month, gAuto.day);
+			printStats(stdout, st);
+		}
+		delete st;
+#endif
+	}
+	updateWindow();
 }
 void onMouseDown(int key, int x, int y)
 {
@@ -788,6 +1132,7 @@ void onMouseDown(int key, int x, int y)
 			gDropCX = gBlocks[idx].rect.x - x;
 			gDropCY = gBlocks[idx].rect.y - y;
 			gDropIndex = idx;
+			buildHints();
 			updateWindow();
 		}
 		else if((idx = testGridIndex(x, y)) >= 0 && 0 != gGrid.data[idx])
@@ -800,6 +1145,7 @@ void onMouseDown(int key, int x, int y)
 			gDropCY = gGrid.rect.y - y + r0 * gCellSize;
 			gDropIndex = gGrid.data[idx] - 1;
 			removeBlock(gDropIndex);
+			buildHints();
 			updateWindow();
 		}
 	}
@@ -848,28 +1194,39 @@ void onMouseUp(int key, int x, int y)
 			gDropIndex = -1;
 			updateWindow();
 		}
-		else if(isInRect(x, y, &gSolve.checkRect))
+		else if(isInRect(x, y, &gAuto.checkRect))
 		{
-			gSolve.enabled = !gSolve.enabled;
-			if(gSolve.enabled)
+			gAuto.enabled = !gAuto.enabled;
+			if(gAuto.enabled)
 			{
-				solve(gSolve.month, gSolve.day);
+				solveAsync(gAuto.month, gAuto.day);
 				commitResult();
 			}
+			else
+			{
+				solveAsync(0, 0);
+			}
 			updateWindow();
 		}
-		else if(gSolve.enabled)
+		else if(gAuto.enabled)
 		{
-			if(gSolve.resultIdx > 0 && isInRect(x, y, &gSolve.preRect))
+			if(gAuto.resultIdx > 0 && isInRect(x, y, &gAuto.preRect))
 			{
-				gSolve.resultIdx--;
+				gAuto.resultIdx--;
 				commitResult();
 				updateWindow();
 			}
-			else if(gSolve.resultIdx + 1 < gSolve.resultNum && isInRect(x, y, &gSolve.nextRect))
+			else if(isInRect(x, y, &gAuto.nextRect))
 			{
-				gSolve.resultIdx++;
-				commitResult();
+				if(gAuto.resultIdx + 1 < (int)gSolve.results.num)
+				{
+					gAuto.resultIdx++;
+					commitResult();
+				}
+				else if(!gAuto.finished && !gAuto.searching)
+				{
+					solveAsyncMore();
+				}
 				updateWindow();
 			}
 		}
@@ -881,20 +1238,20 @@ void onMouseUp(int key, int x, int y)
 			int idx = testGridIndex(x, y);
 			if(idx >= 0)
 			{
-				int day = gSolve.day;
-				int mon = gSolve.month;
+				int day = gAuto.day;
+				int mon = gAuto.month;
 				int val = gGridValues[idx];
 				if(val < 100)
 				{
-					gSolve.day = val;
+					gAuto.day = val;
 				}
 				else if(val < 200)
 				{
-					gSolve.month = val - 100;
+					gAuto.month = val - 100;
 				}
-				if(gSolve.enabled && (day != gSolve.day || mon != gSolve.month))
+				if(gAuto.enabled && (day != gAuto.day || mon != gAuto.month))
 				{
-					solve(gSolve.month, gSolve.day);
+					solveAsync(gAuto.month, gAuto.day);
 					commitResult();
 					updateWindow();
 				}
@@ -908,7 +1265,7 @@ void onMouseMove(int x, int y)
 	{
 		gDropX = x;
 		gDropY = y;
-		updateWindow();
+		requestFrame();
 	}
 }
 bool handleEvent(const SDL_Event& evt)
@@ -926,42 +1283,60 @@ bool handleEvent(const SDL_Event& evt)
 		onMouseUp(evt.button.button, evt.button.x, evt.button.y);
 		break;
 	case SDL_MOUSEMOTION:
-	{
-		SDL_Event next;
-		bool flag = false;
-		int x = evt.motion.x;
-		int y = evt.motion.y;
-		while(SDL_PollEvent(&next))
-		{
-			if(SDL_MOUSEMOTION != next.type)
-			{
-				flag = true;
-				break;
-			}
-			x = evt.motion.x;
-			y = evt.motion.y;
-		}
-		onMouseMove(x, y);
-		if(flag)
-		{
-			ret = handleEvent(next);
-		}
+		onMouseMove(evt.motion.x, evt.motion.y);
 		break;
-	}
 	case SDL_WINDOWEVENT:
 		if(SDL_WINDOWEVENT_SIZE_CHANGED == evt.window.event)
 		{
+			layoutWindow();
 			updateWindow();
 		}
+		else if(SDL_WINDOWEVENT_EXPOSED == evt.window.event)
+		{
+			requestFrame();
+		}
+		break;
+	case SDL_RENDER_TARGETS_RESET:
+	case SDL_RENDER_DEVICE_RESET:
+		layoutWindow();
+		updateWindow();
 		break;
 	default:
+		if(gSolveEvent == evt.type)
+		{
+			onSolveEvent(evt.user);
+		}
 		break;
 	}
 	return ret;
 }
 int main(int argc, char* argv[])
 {
-	SDL_Init(SDL_INIT_EVERYTHING);
+	const Uint64 launch = SDL_GetPerformanceCounter();
+	int fps = 0;
+	for(int i = 1; i < argc; ++i)
+	{
+		if(0 == strcmp(argv[i], "--fps") && i + 1 < argc)
+		{
+			fps = atoi(argv[++i]);
+		}
+		else if(0 == strcmp(argv[i], "--startup"))
+		{
+			gFrame.start = launch;
+		}
+#if SOLVE_STATS
+		else if(0 == strcmp(argv[i], "--stats"))
+		{
+			gShowStats = true;
+		}
+#endif
+	}
+	/* audio, joystick and haptic are never used, video alone also brings up events */
+	if(0 != SDL_Init(SDL_INIT_VIDEO))
+	{
+		printf("Could not init video: %s\n", SDL_GetError());
+		return -1;
+	}
 	gWindow = SDL_CreateWindow("MoyuDay", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 640, 480,
 		SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE);
 	if(nullptr == gWindow)
@@ -970,12 +1345,26 @@ int main(int argc, char* argv[])
 		return -1;
 	}
 
-	gRender = SDL_CreateRenderer(gWindow, -1, 0);
+	gRender = SDL_CreateRenderer(gWindow, -1, SDL_RENDERER_PRESENTVSYNC);
+	if(nullptr == gRender)
+	{
+		gRender = SDL_CreateRenderer(gWindow, -1, 0);
+	}
 	if(nullptr == gRender)
 	{
 		printf("Could not create render: %s\n", SDL_GetError());
 		return -1;
 	}
+	/* without vsync frames are capped at the display refresh rate unless --fps is given */
+	SDL_RendererInfo info;
+	const bool vsync = 0 == SDL_GetRendererInfo(gRender, &info) && 0 != (info.flags & SDL_RENDERER_PRESENTVSYNC);
+	if(fps <= 0 && !vsync)
+	{
+		SDL_DisplayMode mode;
+		const bool known = 0 == SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(gWindow), &mode) && mode.refresh_rate > 0;
+		fps = known ? mode.refresh_rate : 60;
+	}
+	gFrame.interval = fps > 0 ? SDL_GetPerformanceFrequency() / fps : 0;
 
 	memcpy(gGrid.data, gGridMarks, sizeof(gGrid.data));
 	for(int i = 0; i < MAX_BLK_NUM; ++i)
@@ -1003,20 +1392,64 @@ int main(int argc, char* argv[])
 	gBlocks[7].ypos = 1 + (MAX_BLKROW_NUM + 1) * 2;
 	gGrid.xpos = 1 + MAX_BLKCOL_NUM + 1;
 	gGrid.ypos = 1 + MAX_BLKROW_NUM + 1;
-	initSolve();
+	updateGridMask();
+	buildPalette();
+	initSolve(&gSolve);
+	/* dates searched once come back from the cache after the pieces changed, with a matching table nothing is touched */
+	if(solveTableStale(&gSolve))
+	{
+		char path[1024];
+		char* pref = SDL_GetPrefPath("MoyuDay", "MoyuDay");
+		snprintf(path, sizeof(path), "%ssolutions.cache", nullptr != pref ? pref : "");
+		SDL_free(pref);
+		openSolveCache(path, gSolve.hash);
+	}
+	gHints.solve = new Solve(gSolve);
+	gAuto.month = 1;
+	gAuto.day = 1;
+	gAuto.finished = true;
+	solveAsyncStart();
 
+	layoutWindow();
 	updateWindow();
 
 	bool running = true;
 	while(running)
 	{
 		SDL_Event evt;
-		if(SDL_WaitEvent(&evt))
+		int timeout = -1;
+		if(gFrame.pending)
+		{
+			const Uint64 now = SDL_GetPerformanceCounter();
+			const Uint64 due = gFrame.last + gFrame.interval;
+			timeout = now >= due ? 0 : (int)((due - now) * 1000 / SDL_GetPerformanceFrequency()) + 1;
+		}
+		/* drain the queue, so a burst of motion events ends up as one frame at the latest position */
+		if(SDL_WaitEventTimeout(&evt, timeout))
 		{
 			running = handleEvent(evt);
+			while(running && SDL_PollEvent(&evt))
+			{
+				running = handleEvent(evt);
+			}
+		}
+		if(running && gFrame.pending && SDL_GetPerformanceCounter() >= gFrame.last + gFrame.interval)
+		{
+			renderFrame();
+			if(0 != gFrame.start)
+			{
+				fprintf(stderr, "startup: first frame %.1f ms\n", (SDL_GetPerformanceCounter() - gFrame.start) * 1000.0 / SDL_GetPerformanceFrequency());
+				gFrame.start = 0;
+			}
 		}
 	}
 
+	solveAsyncStop();
+	closeSolveCache();
+	delete gHints.solve;
+	SDL_DestroyTexture(gGlyphs.atlas);
+	SDL_DestroyTexture(gScene.board);
+	SDL_DestroyTexture(gScene.frame);
 	SDL_DestroyRenderer(gRender);
 	SDL_DestroyWindow(gWindow);
 	SDL_Quit();
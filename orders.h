@@ -0,0 +1,20 @@
+/* Generated by `moyuday-bench --gen-order orders.h`, do not edit. */
+#pragma once
+
+#define SOLVE_ORDER_HASH 0x6db6dad0837d3686ull
+
+/* cell order * ORDER_PIECE_NUM + piece order, (month - 1) * 31 + day - 1 */
+static constexpr uint8_t gSolveOrders[372] = {
+	3, 4, 3, 4, 3, 2, 5, 1, 2, 0, 4, 2, 3, 3, 2, 4, 3, 4, 3, 4, 4, 4, 4, 3, 3, 4, 5, 4, 4, 4, 0,
+	3, 5, 3, 4, 3, 0, 3, 1, 3, 5, 5, 3, 4, 5, 5, 4, 4, 3, 4, 3, 5, 3, 4, 5, 3, 3, 3, 5, 4, 0, 0,
+	4, 5, 4, 4, 3, 0, 3, 5, 5, 3, 2, 1, 4, 5, 3, 3, 4, 3, 5, 4, 4, 5, 5, 5, 4, 5, 3, 4, 3, 5, 3,
+	5, 3, 4, 4, 0, 1, 4, 0, 1, 0, 1, 4, 4, 3, 1, 3, 0, 4, 4, 3, 4, 5, 3, 3, 3, 4, 3, 5, 3, 3, 0,
+	5, 4, 3, 4, 3, 3, 4, 5, 3, 4, 5, 4, 4, 4, 3, 5, 4, 5, 3, 5, 5, 4, 3, 4, 5, 3, 3, 5, 3, 5, 5,
+	3, 4, 4, 3, 4, 5, 4, 1, 1, 4, 4, 4, 4, 4, 3, 3, 3, 4, 3, 4, 5, 3, 4, 4, 4, 4, 4, 4, 4, 5, 0,
+	5, 5, 4, 5, 5, 1, 3, 3, 3, 4, 5, 4, 3, 3, 4, 3, 5, 3, 4, 4, 3, 5, 4, 5, 3, 4, 5, 4, 5, 3, 4,
+	5, 5, 3, 3, 5, 2, 4, 4, 5, 4, 3, 0, 4, 5, 3, 4, 4, 5, 3, 3, 3, 5, 4, 4, 4, 4, 5, 3, 3, 4, 4,
+	3, 5, 3, 5, 3, 1, 3, 4, 5, 4, 5, 5, 4, 4, 3, 4, 5, 3, 4, 4, 5, 4, 5, 4, 3, 4, 4, 5, 3, 5, 0,
+	5, 3, 3, 5, 1, 1, 4, 0, 0, 4, 4, 5, 3, 5, 1, 3, 1, 4, 5, 5, 4, 4, 3, 4, 3, 3, 4, 3, 4, 3, 5,
+	1, 4, 3, 2, 1, 5, 3, 2, 0, 2, 0, 2, 3, 3, 2, 3, 1, 1, 0, 1, 5, 4, 5, 4, 3, 3, 4, 3, 5, 4, 0,
+	5, 4, 4, 3, 4, 4, 5, 5, 5, 5, 4, 5, 3, 4, 1, 5, 4, 4, 3, 5, 3, 3, 0, 4, 4, 5, 3, 4, 4, 4, 5,
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+/**
+ * rotations, mirrors and the distinct orientations of a piece, shared by the built in pieces of solver.cpp and the
+ * pieces of board files, a Shape has rows, cols and row major data, blankShape(shape, rows, cols) gives an empty one
+ */
+template<typename Shape>
+constexpr Shape rotatedShape(const Shape& blk)
+{
+	Shape out = blankShape(blk, blk.cols, blk.rows);
+	for(int r = 0; r < out.rows; ++r)
+	{
+		for(int c = 0; c < out.cols; ++c)
+		{
+			out.data[r * out.cols + c] = blk.data[(out.cols - 1 - c) * out.rows + r];
+		}
+	}
+	return out;
+}
+template<typename Shape>
+constexpr Shape mirroredShape(const Shape& blk)
+{
+	Shape out = blankShape(blk, blk.rows, blk.cols);
+	for(int r = 0; r < out.rows; ++r)
+	{
+		for(int c = 0; c < out.cols; ++c)
+		{
+			out.data[r * out.cols + c] = blk.data[r * blk.cols + blk.cols - c - 1];
+		}
+	}
+	return out;
+}
+template<typename Shape>
+constexpr bool sameShape(const Shape& a, const Shape& b)
+{
+	if(a.rows != b.rows || a.cols != b.cols)
+	{
+		return false;
+	}
+	for(int i = 0; i < a.rows * a.cols; ++i)
+	{
+		if(a.data[i] != b.data[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+/* without empty border rows and columns, 0x0 when no cell is set */
+template<typename Shape>
+constexpr Shape trimmedShape(const Shape& blk)
+{
+	int top = blk.rows;
+	int bottom = -1;
+	int left = blk.cols;
+	int right = -1;
+	for(int r = 0; r < blk.rows; ++r)
+	{
+		for(int c = 0; c < blk.cols; ++c)
+		{
+			if(0 != blk.data[r * blk.cols + c])
+			{
+				top = r < top ? r : top;
+				bottom = r > bottom ? r : bottom;
+				left = c < left ? c : left;
+				right = c > right ? c : right;
+			}
+		}
+	}
+	if(bottom < 0)
+	{
+		return blankShape(blk, 0, 0);
+	}
+	Shape out = blankShape(blk, bottom - top + 1, right - left + 1);
+	for(int r = 0; r < out.rows; ++r)
+	{
+		for(int c = 0; c < out.cols; ++c)
+		{
+			out.data[r * out.cols + c] = blk.data[(top + r) * blk.cols + left + c];
+		}
+	}
+	return out;
+}
+/* distinct orientations of the trimmed shape into out[8], four rotations then four rotations of the mirror */
+template<typename Shape>
+constexpr int shapeOrientations(const Shape& src, Shape* out)
+{
+	int num = 0;
+	Shape tmp = trimmedShape(src);
+	const Shape first = tmp;
+	for(int k = 0; k < 8; ++k)
+	{
+		if(4 == k)
+		{
+			tmp = mirroredShape(first);
+		}
+		bool found = false;
+		for(int b = 0; b < num && !found; ++b)
+		{
+			found = sameShape(out[b], tmp);
+		}
+		if(!found)
+		{
+			out[num++] = tmp;
+		}
+		tmp = rotatedShape(tmp);
+	}
+	return num;
+}
@@ -0,0 +1,4218 @@
+/* Generated by `moyuday-cli --gen-table solutions.h`, do not edit. */
+#pragma once
+
+#define SOLUTION_TABLE_HASH 0x6db6dad0837d3686ull
+
+static constexpr uint32_t gSolutionIndex[373] = {
+	0, 64, 173, 220, 323, 406, 430, 618, 697, 824, 901, 975,
+	1035, 1164, 1252, 1339, 1409, 1542, 1611, 1715, 1910, 2014, 2092, 2280,
+	2328, 2544, 2628, 2713, 2858, 2932, 3051, 3221, 3294, 3339, 3361, 3402,
+	3451, 3478, 3566, 3614, 3646, 3693, 3719, 3750, 3809, 3840, 3868, 3894,
+	3949, 3984, 4029, 4096, 4125, 4150, 4231, 4252, 4330, 4393, 4440, 4521,
+	4585, 4619, 4696, 4713, 4737, 4776, 4833, 4865, 4881, 4967, 5033, 5104,
+	5131, 5171, 5211, 5264, 5308, 5347, 5377, 5437, 5459, 5511, 5572, 5601,
+	5630, 5722, 5746, 5807, 5879, 5928, 6008, 6057, 6075, 6182, 6237, 6286,
+	6364, 6420, 6483, 6491, 6595, 6706, 6758, 6846, 6914, 6961, 7024, 7086,
+	7145, 7206, 7268, 7309, 7361, 7484, 7560, 7609, 7754, 7780, 7896, 7977,
+	8045, 8185, 8269, 8321, 8504, 8561, 8623, 8655, 8702, 8758, 8781, 8897,
+	8939, 8972, 9020, 9071, 9094, 9171, 9224, 9280, 9323, 9390, 9426, 9472,
+	9534, 9570, 9586, 9673, 9687, 9788, 9841, 9888, 10018, 10084, 10163, 10250,
+	10306, 10355, 10409, 10457, 10507, 10531, 10722, 10807, 10859, 10903, 10981, 11026,
+	11070, 11131, 11188, 11226, 11301, 11343, 11429, 11543, 11600, 11635, 11737, 11768,
+	11918, 11991, 12064, 12227, 12284, 12323, 12462, 12561, 12580, 12607, 12677, 12711,
+	12723, 12848, 12911, 12983, 13023, 13066, 13103, 13173, 13221, 13249, 13289, 13398,
+	13441, 13502, 13610, 13662, 13686, 13764, 13786, 13883, 13921, 13989, 14122, 14164,
+	14215, 14297, 14365, 14450, 14490, 14584, 14660, 14704, 14876, 14981, 15069, 15156,
+	15213, 15272, 15392, 15462, 15534, 15619, 15726, 15791, 15891, 16007, 16060, 16101,
+	16230, 16254, 16415, 16499, 16610, 16799, 16881, 16959, 17110, 17144, 17162, 17211,
+	17249, 17274, 17301, 17393, 17443, 17486, 17537, 17573, 17593, 17639, 17660, 17718,
+	17760, 17812, 17846, 17879, 17949, 17987, 18016, 18101, 18125, 18179, 18227, 18266,
+	18344, 18392, 18428, 18532, 18590, 18624, 18652, 18711, 18724, 18731, 18823, 18873,
+	18909, 18968, 18996, 19012, 19064, 19118, 19161, 19187, 19235, 19261, 19311, 19378,
+	19403, 19430, 19517, 19539, 19624, 19660, 19689, 19784, 19840, 19869, 19975, 20057,
+	20148, 20223, 20291, 20469, 20502, 20681, 20789, 20861, 20958, 21060, 21152, 21230,
+	21306, 21373, 21437, 21552, 21633, 21715, 21879, 21983, 22023, 22124, 22159, 22314,
+	22420, 22506, 22689, 22774, 22848, 22967, 22993, 23025, 23092, 23137, 23169, 23235,
+	23360, 23427, 23500, 23566, 23610, 23688, 23787, 23826, 23907, 23975, 24057, 24095,
+	24154, 24257, 24301, 24350, 24465, 24495, 24587, 24635, 24706, 24870, 24924, 24984,
+	25061,
+};
+static constexpr uint64_t gSolutionData[25061] = {
+	0x011000170f021008, 0x0110000620021008, 0x0101001809141008, 0x0002081816150b0a, 0x011000060210200d, 0x001f0d0f051d0013,
+	0x0304010317260013, 0x071f0d001d100513, 0x0806000924180513, 0x01000a0924180513, 0x0101001809100613, 0x0118180601020813,
+	0x03010d0701102413, 0x0402180027150017, 0x00020018150b0317, 0x0204010d0e021117, 0x01000a210b021018, 0x0009002302071118,
+	0x000420160602051b, 0x000806220602051b, 0x000407230602051b, 0x000e06240602051b, 0x000106230702051b, 0x0009000f14020a1b,
+	0x0708060119020b1b, 0x05000c0619020b1b, 0x0007100619020b1b, 0x0006130e19020b1b, 0x050c010b0310011c, 0x050c03010e00071c,
+	0x051903011500071c, 0x000420031605081c, 0x000803062205081c, 0x000407032305081c, 0x000e03062405081c, 0x0500030c190b081c,
+	0x00070310190b081c, 0x0000030f22120b1c, 0x00000a0323120b1c, 0x00000a031822101c, 0x00140e030926101c, 0x001507031626101c,
+	0x0000030f0e0a121c, 0x000303061a0a121c, 0x02000f0204091b1c, 0x0007030127091b1c, 0x0007030119092c1c, 0x0009000f11020a1e,
+	0x000c080d03150b1e, 0x0003000f03150b1e, 0x0001091c130b0920, 0x0d0600140c021022, 0x0806001324021022, 0x0806001902141022,
+	0x020008180e141022, 0x030600190e141022, 0x030400060f141022, 0x0006011d0f141022, 0x0001051b11020924, 0x000a1a030e150924,
+	0x0406051500230c26, 0x0b06011c09011026, 0x00060f0d1c051026, 0x0402071800091026, 0x0107102604181000, 0x13060113091e1000,
+	0x0d060117091e1000, 0x0107012600181100, 0x0500061b220d1005, 0x0005091b220d1005, 0x0500061b0c181005, 0x0005091b0c181005,
+	0x13060006111e1005, 0x0006080e220d1105, 0x0006080e0c181105, 0x0202190105070608, 0x0801021b05070608, 0x00280d0517050b08,
+	0x0118090526050b08, 0x011000170f041008, 0x0110000620041008, 0x0100111806051008, 0x0110001906051008, 0x0016020e16051008,
+	0x0001061b17051008, 0x00150617020d1008, 0x030218012705070a, 0x050016050605090a, 0x0003061716190b0a, 0x011000060410200d,
+	0x0406031a221e0012, 0x0406031a1e070112, 0x04061a00141e0512, 0x0406001a181e0512, 0x0a0305000d0a1a13, 0x000306160b091e13,
+	0x0100232804091017, 0x0204010d0e041117, 0x0115070615090018, 0x01000a210b041018, 0x0009002304071118, 0x000420160604051b,
+	0x000806220604051b, 0x000407230604051b, 0x000e06240604051b, 0x000106230704051b, 0x0009000f14040a1b, 0x0708060119040b1b,
+	0x05000c0619040b1b, 0x0007100619040b1b, 0x0006130e19040b1b, 0x00030602161b041e, 0x0009000f11040a1e, 0x0500000f0c050a1e,
+	0x0c01000f0f050a1e, 0x0005091903090b1e, 0x0305011a03090b1e, 0x0006052b03120b20, 0x0d0600140c041022, 0x0806001324041022,
+	0x090600170e051022, 0x0a00081a0e051022, 0x0f06001e0f051022, 0x0107001e0f051022, 0x000602200f051022, 0x0306010e1f051022,
+	0x0100090f1f051022, 0x0001131d0e071022, 0x0114000b14071022, 0x0009011d14071022, 0x00100017020d1022, 0x00000f23020d1022,
+	0x0001051b11040924, 0x0004190612090924, 0x0d06011109100125, 0x0d0600110d100425, 0x0304170101050825, 0x000c000504050825,
+	0x0001170504050825, 0x0c01000f20050b25, 0x0000130f25050b25, 0x080c00031e080b25, 0x0b060002181c0b25, 0x0006061718050c25,
+	0x0100061c100f0c25, 0x0006040606100c25, 0x0100060401200c25, 0x0103060422000e25, 0x010610051b001025, 0x010314051b001025,
+	0x0601011d0e101625, 0x0801050122001825, 0x00030602220b1a25, 0x000413060e091b25, 0x0009040614091b25, 0x0115070d04031d25,
+	0x0006001012052025, 0x0003001412052025, 0x0504060c061c0026, 0x0006170603180726, 0x0004060a061c0b26, 0x0a0305000d1b0c26,
+	0x00020621061c0e26, 0x0c0104060b000f26, 0x020b06050b001026, 0x010514090b001026, 0x0a0312050d001026, 0x0004072006051026,
+	0x030400060b121026, 0x0006011d0b121026, 0x0204010a03181026, 0x0004011c03181026, 0x0001091d03181026, 0x0517000602181007,
+	0x00150617040d1008, 0x0101001809101008, 0x0003061716170b0a, 0x00160109061a1011, 0x020024060d120513, 0x0204160706001014,
+	0x12041f0706001014, 0x0318010526051014, 0x010301050d1b1014, 0x0003001a1a0b0215, 0x0406031a221e0016, 0x0406031a1e070116,
+	0x04061a00141e0516, 0x0406001a181e0516, 0x020406060d150017, 0x001400031e091017, 0x00000306150b1517, 0x0004030615071717,
+	0x000403280f070919, 0x000400200f0b0919, 0x010000161a0b0919, 0x0000030719110b1b, 0x0000030612150b1b, 0x0001091c120b0920,
+	0x05071800041b0b20, 0x0515000b03071022, 0x0009022003071022, 0x0100110e1f071022, 0x01000b161f071022, 0x00100017040d1022,
+	0x00000f23040d1022, 0x0806001902101022, 0x020008180e101022, 0x030600190e101022, 0x030400060f101022, 0x0006011d0f101022,
+	0x010420040a010924, 0x020417060a010924, 0x0a0f100003090b25, 0x0f06040619001025, 0x0107040619001025, 0x010602041d001025,
+	0x0006011c21011625, 0x0600020e1d101625, 0x00090b0503091b25, 0x1306001106021026, 0x020a0b1e12060501, 0x02061a0a061e0501,
+	0x070d060e121e0501, 0x04061a03191e0501, 0x0406031a1e071101, 0x02001d1a10090002, 0x0000231909071102, 0x000917060b062304,
+	0x020a0b0013062304, 0x00000a1b0e0d2304, 0x00190115071a0e05, 0x000a22011c0d0e07, 0x0517000604181007, 0x0004072705181007,
+	0x000c0d1e051e1007, 0x0200180f2211000d, 0x02000a182311000d, 0x0a0b061e1201050d, 0x0009061719030b0f, 0x000a081a19030b0f,
+	0x00030619200f0b0f, 0x00050919051a0b0f, 0x0305011a051a0b0f, 0x0a01210119060b10, 0x00061a06021e1d10, 0x03000d07021d1011,
+	0x00030301160b1211, 0x00190115031a0512, 0x00080c23121a0512, 0x000919011c1a0512, 0x03011a011c1a0512, 0x0008200d121d0512,
+	0x00080c18121d0512, 0x0118010303150013, 0x09061606001e0513, 0x0806011d00102413, 0x000200181c0b0914, 0x0a01210119060b14,
+	0x010301051b250b14, 0x0a030101192c0b14, 0x0200180f22000c14, 0x02000a1823000c14, 0x1506150504000f14, 0x010409062a091b14,
+	0x01002a1d04091017, 0x010d14091e000f1c, 0x0007010610240f1c, 0x00000d030610161c, 0x000a082505120b20, 0x000c082705120b20,
+	0x0100082613120b20, 0x010008121e120b20, 0x0012130705000122, 0x00120f0706000122, 0x09060e1506000122, 0x050000051a070122,
+	0x00090e061a070122, 0x020608180e001022, 0x030606190e001022, 0x0f06010a1d001022, 0x0107010a1d001022, 0x0c01070d1d001022,
+	0x0c01080d1d001022, 0x0306060e20011022, 0x080600131e041022, 0x0600150b1c051022, 0x0606010e1c051022, 0x0001060620051022,
+	0x0b06000b20051022, 0x0006060e20051022, 0x0009000f20051022, 0x0114000b15071022, 0x0009011d15071022, 0x01000b111f071022,
+	0x0306001b0d0f1022, 0x0003061f0d0f1022, 0x030400060b141022, 0x0006011d0b141022, 0x0806001d02100a25, 0x010d14091f000f25,
+	0x0601011d09101625, 0x0600041e09101625, 0x0304000112091b25, 0x0009040615091b25, 0x0906010602071c25, 0x00061d04000c1c25,
+	0x13060501010c1c25, 0x01070d05040c1c25, 0x0a01050d090c1c25, 0x0006001012052225, 0x0003001412052225, 0x0006170612050726,
+	0x0906010602190726, 0x00061d0400190c26, 0x1306050101190c26, 0x01070d0504190c26, 0x0a01050d09190c26, 0x1306001106041026,
+	0x0204010a12051026, 0x0004011c12051026, 0x0001091d12051026, 0x0014000b13051026, 0x000607040d221026, 0x02041607060b0b00,
+	0x12041f07060b0b00, 0x0406031a1e071501, 0x0000231909071502, 0x030405071a010b0a, 0x0304050018070b0a, 0x0005021d18070b0a,
+	0x0405012018070b0a, 0x0105022218070b0a, 0x0100061c12190b0a, 0x020a23070003050f, 0x001000101803050f, 0x0002050c28061011,
+	0x0001091c28061011, 0x03000d07041d1011, 0x0403030116071811, 0x02121a0103070013, 0x0304010322160013, 0x0304000116280913,
+	0x0217010604091014, 0x0206051501221014, 0x0002050619221014, 0x0304092406130018, 0x03061b0115130018, 0x110f06010d01051b,
+	0x011107010d01051b, 0x000608062404051b, 0x0004010d2404051b, 0x010111061e05081c, 0x0100000d1e05081c, 0x0001042a0605101c,
+	0x020b06050f001022, 0x010514090f001022, 0x0305040911011022, 0x0806011711011022, 0x0603060a24011022, 0x0806011324011022,
+	0x080600121e041022, 0x00060f0d1c051022, 0x0002050c15061022, 0x0001091c15061022, 0x02020b0500071022, 0x0100140c00071022,
+	0x040c001c05071022, 0x00000c1d05071022, 0x00010c2205071022, 0x0002050c11071022, 0x0001091c11071022, 0x01000c011f071022,
+	0x010400171f071022, 0x0002050611091022, 0x0100091d11091022, 0x0002050615091022, 0x0003060d22131022, 0x00000c06021a1022,
+	0x010420040e010924, 0x020417060e010924, 0x0001041f04090924, 0x0004190617090924, 0x0806020018070525, 0x0009020918070525,
+	0x010111061f050825, 0x0100000d1f050825, 0x0806001d04100a25, 0x050008051a051025, 0x0002030a1a081025, 0x0305040900101625,
+	0x0806011700101625, 0x0201050d08101625, 0x020605010e101625, 0x0906010604071c25, 0x00090406060b1c25, 0x06020106210c1c25,
+	0x06010406230c1c25, 0x0906010604190726, 0x0009040606190b26, 0x0602010621190c26, 0x0601040623190c26, 0x04060515001f0c26,
+	0x0009060306010f26, 0x000205060a151026, 0x050006040a221026, 0x000509040a221026, 0x02041607060b0e00, 0x12041f07060b0e00,
+	0x04061a03141e0501, 0x0500160506030a0f, 0x0015051a07090513, 0x0204160706000b14, 0x12041f0706000b14, 0x020401061d080b14,
+	0x13060001101e0516, 0x0105100503010518, 0x0500052803090518, 0x000325010312051b, 0x020012030d05081c, 0x000718030626101c,
+	0x000605170e0c0425, 0x0f06040619000b25, 0x0107040619000b25, 0x010602041d000b25, 0x0200170505090b25, 0x060401060a0c1c25,
+	0x00090406060e1c25, 0x060401060a190c26, 0x0003060216230c26, 0x0009040606190e26, 0x020116071d0b0b00, 0x12011f071d0b0b00,
+	0x1000280d03160e00, 0x0110001116011700, 0x04061a09141e0501, 0x050118091a0d0801, 0x00061a02091e1001, 0x0406031a1e081501,
+	0x02001d1a19090002, 0x02031a010f091002, 0x0002061a0f091002, 0x0000231909081502, 0x00000a1b270d1604, 0x00000a1b0c0d2304,
+	0x00030c1a2a1a0005, 0x03001a0b2a1a0b05, 0x0406001a231e0b05, 0x050205271c0d0007, 0x010216260e180007, 0x010407261a180007,
+	0x0216210d21050008, 0x0802220d21050008, 0x0102161d2c090008, 0x0310040a16140008, 0x01011f1609140508, 0x0801021a1e040708,
+	0x020105211c13000a, 0x010216210317000a, 0x080102220317000a, 0x080c00230317000a, 0x04000a201301090a, 0x030400141807090a,
+	0x04000e201807090a, 0x080c00041f07090a, 0x0501001a1f07090a, 0x02000a180111090a, 0x080c00060317090a, 0x020718171b11000d,
+	0x021507182611000d, 0x010514171301080d, 0x000218221111080d, 0x000218171311080d, 0x030218012703060f, 0x0406001a031e2110,
+	0x00000a1b280d0111, 0x0200040616031211, 0x0403030116081811, 0x011515071a030112, 0x020011060d100513, 0x0006161700140513,
+	0x0310040a16000613, 0x01011f1609050613, 0x0305041700130813, 0x02001e040d1b0913, 0x020f052307000b13, 0x0212011a07000e13,
+	0x0215071829030014, 0x0201160709050114, 0x01121f0709050114, 0x0200160703120414, 0x00121f0703120414, 0x000218170d050814,
+	0x0006151702240b14, 0x0206051501250b14, 0x0002050619250b14, 0x020718171b000c14, 0x0215071826000c14, 0x0002182211080c14,
+	0x0002181713080c14, 0x01061c152c001014, 0x0106152c09011014, 0x0600151b2c051014, 0x0006151f2c051014, 0x0205280d01091b14,
+	0x0002050c2b091b14, 0x0001091c2b091b14, 0x0403011b0f042114, 0x02001d0116010215, 0x020105091b160915, 0x0115072618030116,
+	0x0007171c09180516, 0x0406001a151e0516, 0x00000d1c02180916, 0x01000a2618000e16, 0x0004012409041117, 0x0c071c1709010518,
+	0x00150619060d0518, 0x00060719280d0518, 0x000c0d1c02010918, 0x0400202201011018, 0x00011706170f0b19, 0x000014021c180b19,
+	0x0113061c0201031b, 0x080600182904041b, 0x0406001a031e041b, 0x000517030609051b, 0x0100110a1e05081c, 0x0001171b06180b1c,
+	0x0006192a0605101c, 0x0001171b0611101c, 0x0200001c0d01161c, 0x01000c011e091b1c, 0x010400171e091b1c, 0x0015151404030920,
+	0x010021091c000122, 0x0c000a0d20000122, 0x0806020924000122, 0x03000d1215080122, 0x0014001c15090122, 0x00000a1b150d0122,
+	0x0c01001b20050722, 0x060420190e010924, 0x0201171d0e010924, 0x0002160c1b040924, 0x000906171b040924, 0x020400171e040924,
+	0x0006191f04090924, 0x0002051d16090924, 0x0001191d17090924, 0x000216031b090924, 0x0002051d100d0924, 0x0301000d1b120924,
+	0x02000b0218150924, 0x010f061909050125, 0x0101071909050125, 0x000f061903120425, 0x0100071903120425, 0x001507131d030525,
+	0x000619161d030525, 0x0806020018080525, 0x0009020918080525, 0x0100110a1f050825, 0x0106020e21000b25, 0x0010001a0a020b25,
+	0x0304091812001025, 0x0204011915051025, 0x0304001a12081025, 0x010c010903181025, 0x0100031e0f181025, 0x07060401111d1025,
+	0x0100060c09111725, 0x0006021d1b031825, 0x02020b0500091b25, 0x0100140c00091b25, 0x040c001c05091b25, 0x00000c1d05091b25,
+	0x00010c2205091b25, 0x0002050c11091b25, 0x0001091c11091b25, 0x01000c011f091b25, 0x010400171f091b25, 0x02020b0506001c25,
+	0x0100140c06001c25, 0x0a0612040b001c25, 0x0a0612010a011c25, 0x010c010906051c25, 0x0114000b060b1c25, 0x0009011d060b1c25,
+	0x0201050d080c1c25, 0x00090002200c1c25, 0x0600040a230c1c25, 0x01000d02250c1c25, 0x0003061b030d1c25, 0x02020b0506190026,
+	0x0100140c06190026, 0x0a0612040b190026, 0x02020506091c0026, 0x03000d1215080126, 0x0a0612010a190126, 0x010c010906190526,
+	0x001000040d1c0726, 0x00020c1907020b26, 0x0114000b06190b26, 0x0009011d06190b26, 0x00000a1b040d0c26, 0x00020519060d0c26,
+	0x0201050d08190c26, 0x0009000220190c26, 0x0600040a23190c26, 0x01000d0225190c26, 0x0003061b19030d26, 0x0015070422030d26,
+	0x0004071b04000f26, 0x0202050009000f26, 0x0002050c12000f26, 0x0001091c12000f26, 0x01000c1618000028, 0x0105091600181028,
+	0x02120114030b1000, 0x050c0120030b1000, 0x01120125030b1000, 0x15060604170b1000, 0x13060113091d1000, 0x0d060117091d1000,
+	0x03060503160b1500, 0x00060310160b1500, 0x00030314160b1500, 0x0406031016071700, 0x0403031416071700, 0x13060006111d1005,
+	0x0c0601161e11000d, 0x0002260a0603050f, 0x001000261003050f, 0x000610052503050f, 0x000314052503050f, 0x000610051b03090f,
+	0x000314051b03090f, 0x0a0f100006030a0f, 0x0006101f19030b0f, 0x0003141f19030b0f, 0x0106012119030b0f, 0x0406031a221d0012,
+	0x0406031a1d070112, 0x04061a00141d0512, 0x0406001a181d0512, 0x03041424090a0013, 0x0306011517170013, 0x00001d0204102113,
+	0x0306000319102413, 0x0a060101192a0b14, 0x0c0601161e000c14, 0x030614000e031d14, 0x0306000310242014, 0x0d06270102110018,
+	0x0310040e09110018, 0x000128050d110918, 0x000601150311051b, 0x0001091c140b0920, 0x00000f2c020d0b20, 0x13060e011a000122,
+	0x0601161d0c001022, 0x0606040e23001022, 0x0606060121051022, 0x0600120e21051022, 0x00060e2302081022, 0x0601011d0e101022,
+	0x0806000220111022, 0x0306000e20111022, 0x05000507021a0026, 0x0007051b020a0b26, 0x000a091c020f0c26, 0x00000f25020a0e26,
+	0x0500000502000f26, 0x00090e0602000f26, 0x0f0606050c001026, 0x01061c0f0c001026, 0x020605150c001026, 0x0106021b0c001026,
+	0x0b06000c14041026, 0x000602240c051026, 0x00060e2302081026, 0x0701010a17091026, 0x00012102040a1026, 0x00060702140a1026,
+	0x0601011d0c121026, 0x0600041e0c121026, 0x00001d0204171026, 0x00020a0702181026, 0x00001c0702181026, 0x0010000d02181026,
+	0x060002200c181026, 0x04060701021f1026, 0x03060015021f1026, 0x0806000c02241026, 0x000607020d241026, 0x00090602000a1126,
+	0x000014020b0a1126, 0x0212010f030b1000, 0x01071026041a1000, 0x01070126001a1100, 0x0003030f160b1500, 0x0403030f16071700,
+	0x110e1e091c090002, 0x0e141e092d090002, 0x110e1e0013090802, 0x00000a2708091002, 0x0500061b1e0d1005, 0x0005091b1e0d1005,
+	0x0500061b0c1a1005, 0x0005091b0c1a1005, 0x0006080e1e0d1105, 0x0006080e0c1a1105, 0x0015051b040d0b07, 0x00150614040d1007,
+	0x00011c2c180d1007, 0x07021818000b0908, 0x0101121809001008, 0x0c0601161e13000d, 0x010012180803050f, 0x00030f052503050f,
+	0x00030f051b03090f, 0x00030f1f19030b0f, 0x0002081818160b0f, 0x0400200f220e0013, 0x04000a20230e0013, 0x01001e0f0e1a0513,
+	0x00001d0404102113, 0x0100031e0e102413, 0x00020d1803100114, 0x0002251804100114, 0x0002251800050814, 0x02000a1800221014,
+	0x0200181809221014, 0x0200181808261014, 0x00100018100d0516, 0x000021021e091017, 0x000706020c091117, 0x0d06270102130018,
+	0x0310040e09130018, 0x000128050d130918, 0x000601150313051b, 0x0500010f030d0a1b, 0x0000110f030d0a1b, 0x0000030719120b1b,
+	0x0500030f0c000a1e, 0x0000030f0e100a1e, 0x000303061a100a1e, 0x00000f2c040d0b20, 0x0006052b05120b20, 0x0504160024000122,
+	0x030400140a071022, 0x04000e200a071022, 0x0114000b17071022, 0x0009011d17071022, 0x020b00021b071022, 0x000106031e071022,
+	0x00060e2304081022, 0x0806000220131022, 0x0306000e20131022, 0x0304150118000025, 0x0307040218000025, 0x0004082012140b25,
+	0x010306041e000e25, 0x0307040018081025, 0x0400200b08101625, 0x0100031e0a101625, 0x080600031e101625, 0x080105011e001825,
+	0x000306021e0b1a25, 0x0009040617091b25, 0x0704200107001c25, 0x01071e030a011c25, 0x04042000000c1c25, 0x04032006010c1c25,
+	0x00042000070c1c25, 0x03040001090c1c25, 0x00021d01090c1c25, 0x04012001090c1c25, 0x01022201090c1c25, 0x040720000a0c1c25,
+	0x000408200b0c1c25, 0x04002008100c1c25, 0x00040920110c1c25, 0x00042006070e1c25, 0x0f10020109002225, 0x0009000f0d052225,
+	0x0001090d13082225, 0x0704200107190026, 0x05000507041a0026, 0x01071e030a190126, 0x0006170605180726, 0x0007051b040a0b26,
+	0x000a091c040f0c26, 0x0404200000190c26, 0x0403200601190c26, 0x0004200007190c26, 0x0304000109190c26, 0x00021d0109190c26,
+	0x0401200109190c26, 0x0102220109190c26, 0x040720000a190c26, 0x000408200b190c26, 0x0400200810190c26, 0x0004092011190c26,
+	0x00000f25040a0e26, 0x0004200607190e26, 0x0500000504000f26, 0x00090e0604000f26, 0x00060e2304081026, 0x030400140e091026,
+	0x04000e200e091026, 0x00012104040a1026, 0x00060704140a1026, 0x00001d0404171026, 0x00020a0704181026, 0x00001c0704181026,
+	0x0010000d04181026, 0x0204010a05181026, 0x0004011c05181026, 0x0001091d05181026, 0x000607030d1f1026, 0x000607040d241026,
+	0x00090604000a1126, 0x000014040b0a1126, 0x0a062215010b0e00, 0x02011b04040b1000, 0x01070318040b1000, 0x0517010809181000,
+	0x03070d02041d1000, 0x13060113081e1000, 0x0109061c081e1000, 0x0517180602180801, 0x0103160627181601, 0x0a0f230301090902,
+	0x050f230501090902, 0x0105160b180b0006, 0x0100160f180b0006, 0x0007160d05181007, 0x0016010913181007, 0x011f0d041d050008,
+	0x0012130525050008, 0x00120f0625050008, 0x090406091a001008, 0x02001d011003050f, 0x0103012119030b0f, 0x0f022301091a0012,
+	0x0f021801091d0012, 0x020f052311070013, 0x15061505040a0013, 0x020716001a080513, 0x12071f001a080513, 0x0103180101050814,
+	0x0a06221501000b14, 0x0a030101192a0b14, 0x000021041e091017, 0x001400051e091017, 0x000706040c091117, 0x0507050428090018,
+	0x050a050928090018, 0x0105100502010918, 0x0500052802090918, 0x0100081d090b1118, 0x0708060219010b1b, 0x000003061b0b181c,
+	0x00000e0612052c1c, 0x0004100612052c1c, 0x0001091c100b0920, 0x0611150123000122, 0x001101231a070122, 0x0101091d06001022,
+	0x0600060a23041022, 0x0500060c23041022, 0x0005090c23041022, 0x000f060d23041022, 0x0100070d23041022, 0x0806001123041022,
+	0x0009001523041022, 0x03000d1406051022, 0x060606011c051022, 0x0600120e1c051022, 0x0515000b05071022, 0x0009022005071022,
+	0x051500020f071022, 0x030400110f071022, 0x010c011c0f071022, 0x0500060323091022, 0x0005090323091022, 0x0300030d09101022,
+	0x0301011d0e101022, 0x000109041e040924, 0x0106190d1d000b25, 0x0a0f100005090b25, 0x00010d231a090b25, 0x0100061c0e181025,
+	0x0100061c0f101625, 0x00090b0505091b25, 0x00022001090c1c25, 0x030600031e0c1c25, 0x0002200109190c26, 0x030600031e190c26,
+	0x04030701021f1026, 0x0110011708061000, 0x0304021a08061000, 0x02012104040b1000, 0x0307041b040b1000, 0x03070d04041d1000,
+	0x00031a0509091502, 0x00031a05090b2602, 0x0016010917181007, 0x0104002618181007, 0x0101151809001008, 0x011000061e041008,
+	0x0100181006051008, 0x0016010912181008, 0x05170006021a1008, 0x010015180803050f, 0x00021a100903050f, 0x00030619240f0b0f,
+	0x0114000b28061011, 0x0009011d28061011, 0x03041424090e0013, 0x0118010305150013, 0x0207140409190013, 0x03041b0101050814,
+	0x00011b0504050814, 0x060415062c001014, 0x000904062b091b14, 0x0207140409002014, 0x0115060821090018, 0x05061d011c010518,
+	0x00000e02180b0919, 0x00041002180b0919, 0x0708060419010b1b, 0x00000d050610161c, 0x010400081e10161c, 0x00000e0603150b1e,
+	0x0004100603150b1e, 0x0306060e24011022, 0x0010090c23041022, 0x0406001323041022, 0x06000f0e1c051022, 0x0114000b15061022,
+	0x0009011d15061022, 0x04000f200f071022, 0x0114000b11071022, 0x0009011d11071022, 0x0100091623091022, 0x0806000222131022,
+	0x0306000e22131022, 0x020017050a040924, 0x000109041b040924, 0x050003051a000025, 0x0d06011009100125, 0x0b06012109100125,
+	0x0d0600100d100425, 0x0b0600210d100425, 0x000409200e181025, 0x0d06010109101325, 0x000409200f101625, 0x010400081f101625,
+	0x0009040611091b25, 0x04060301220c1c25, 0x04060301070d1c25, 0x0406030122190c26, 0x0306010616230c26, 0x0406030119070d26,
+	0x0500030501000f26, 0x0009040612000f26, 0x0305040912001026, 0x0806011712001026, 0x0004070317091026, 0x0804000919091026,
+	0x0701010919091026, 0x0305040900181026, 0x0806011700181026, 0x0110011d08061000, 0x0c00031e081e1000, 0x07061a011e060401,
+	0x0c000a0a181e0501, 0x0406071a181e0501, 0x0c0601160801100d, 0x000615052303040f, 0x0003031a1a0b0112, 0x02121a0105070013,
+	0x0212011a11070013, 0x0200030f1b0d0013, 0x030601151e160013, 0x0c06160100060413, 0x080600091b180513, 0x01000a091b180513,
+	0x0100180102050814, 0x01000f0a26180016, 0x01000a1126180016, 0x000003151a0b0919, 0x0000030613150b1b, 0x0100110f1e000b1c,
+	0x00000306100b121c, 0x0003030110100b1e, 0x0000031c130b0920, 0x0003051a0d140122, 0x0001050716140122, 0x0306001223041022,
+	0x0806001423041022, 0x030400140f071022, 0x04000e200f071022, 0x0701010d1e071022, 0x010d000723091022, 0x0806000422131022,
+	0x0204170005080025, 0x0100110f1f000b25, 0x080c000618040b25, 0x080c000618050f25, 0x0100031e0e181025, 0x0100031e0f101625,
+	0x030600031b101625, 0x00100c0505091b25, 0x0a0604030b001c25, 0x050604050b001c25, 0x0a0601030a011c25, 0x050601050a011c25,
+	0x0a0604000b0e1c25, 0x080c030109002225, 0x03060003100f2225, 0x0a0604030b190026, 0x050604050b190026, 0x05060507041c0026,
+	0x0a0601030a190126, 0x050601050a190126, 0x03180101021f0c26, 0x00000f0a04220c26, 0x00000a1104220c26, 0x0a0604000b190e26,
+	0x0007010306080f26, 0x0806011d12001026, 0x0806011d00181026, 0x050615051a0b0300, 0x0204060e06160b00, 0x0204011d06160b00,
+	0x07280d0123160e00, 0x0d060205081e1000, 0x0a0f1001060a0a01, 0x0406031a081e1001, 0x0000231908091002, 0x02031a010e091002,
+	0x0002061a0e091002, 0x00031a25090b1102, 0x0009170627061604, 0x000224091a0d1604, 0x000917060c062304, 0x01001f09240f1005,
+	0x01001e092a0f1005, 0x010701261a180007, 0x0016011b04180b07, 0x010006261a180e07, 0x0012160625050008, 0x0415072016010b0a,
+	0x0003061816170b0a, 0x02150718110b010d, 0x010200180803050f, 0x001000102303050f, 0x090301062503050f, 0x090301061b03090f,
+	0x04150720000f0b0f, 0x0100112309160b0f, 0x0015070218180b0f, 0x01150716001a0b0f, 0x0703041a001a0b0f, 0x0009170628060111,
+	0x011515070b1a0012, 0x011507061b1a0012, 0x001000030d102412, 0x0304062608160013, 0x000c232507120513, 0x00280d2508120513,
+	0x0003252809120513, 0x0403200119120513, 0x0006250d1d120513, 0x00061d15050b0014, 0x0100180104050814, 0x0f041509010b0914,
+	0x021507180b010c14, 0x0403200112052014, 0x0403011b0e042114, 0x011507090b022414, 0x0115070b26180016, 0x0107061b26180016,
+	0x13061806051e0016, 0x0006250c121e0516, 0x0100062613180816, 0x000a0c01060a1a16, 0x0402231809110018, 0x0402180025110018,
+	0x1306050626130018, 0x050c1d0102010918, 0x00090602280d0918, 0x0001240602130918, 0x00001302180b0919, 0x000a01061a0f0b19,
+	0x000609092404051b, 0x000325010512051b, 0x0708061801040b1b, 0x010400171e0b011c, 0x0100111e0910011c, 0x00180626060c041c,
+	0x020012050d05081c, 0x000718050626101c, 0x0200170605070a1e, 0x1015070c03010b1e, 0x0015071003090b1e, 0x0115070d03130b1e,
+	0x0000130603150b1e, 0x00011502120b0920, 0x0012070612000122, 0x0504160020000122, 0x0009170615060122, 0x0009170611070122,
+	0x0806021902001022, 0x020208180e001022, 0x030602190e001022, 0x030402060f001022, 0x0806020220011022, 0x0306020e20011022,
+	0x080602011e041022, 0x0806020023041022, 0x0009020923041022, 0x0602010e1c051022, 0x0006020e20051022, 0x0114020b00071022,
+	0x00021d0b05071022, 0x0102220b05071022, 0x030402000f071022, 0x0002021d0f071022, 0x040201200f071022, 0x010202220f071022,
+	0x000403131e071022, 0x01020b011f071022, 0x00100018040d1022, 0x00020b06021a1022, 0x0304011b11010924, 0x0001061418040924,
+	0x010400171f0b0125, 0x0100111f09100125, 0x0a0f10010c000725, 0x0a0f100100090b25, 0x000a01161a090b25, 0x0003061b12140b25,
+	0x0306170612001025, 0x040603011e101625, 0x0003061b0b0c1c25, 0x0504001e041a0026, 0x04042000101a0026, 0x04021800141a0026,
+	0x020400021a1a0026, 0x0019060e07020b26, 0x0019011d07020b26, 0x0003061b0b190c26, 0x03180101041f0c26, 0x0015070b04220c26,
+	0x0007061b04220c26, 0x00071b0104000f26, 0x0010000d04121026, 0x00061909041a0b27, 0x00071901161a0b27, 0x000719011a0e0e27,
+	0x0100140f22060e00, 0x07280d0223160e00, 0x0307042208061000, 0x010906171e0b1000, 0x010a081a1e0b1000, 0x0d060505081e1000,
+	0x00060e1a181e0501, 0x0406101a181e0501, 0x0501180b1a0d0801, 0x0a0f1002060a0a01, 0x00061a020b1e1001, 0x00031a2209071502,
+	0x0001211b06071204, 0x0100002618181007, 0x01011f160b140508, 0x0000230f021a0e08, 0x0001091f1e101008, 0x070304012216070a,
+	0x010500180803050f, 0x020016071203070f, 0x00121f071203070f, 0x020101061b03070f, 0x010301211b03070f, 0x0003010f191a0513,
+	0x01011f160b050613, 0x0003030119102413, 0x020116070b050114, 0x01121f070b050114, 0x0106152c0b011014, 0x0003010f1a052014,
+	0x0003030110242014, 0x0403200116070215, 0x0200040616070c15, 0x000a0c02060a1a16, 0x0001091e06101e16, 0x000306161c070617,
+	0x000401240b041117, 0x000a02061a0f0b19, 0x0100100f1e00071c, 0x010000081e10161c, 0x0806051902001022, 0x020508180e001022,
+	0x030605190e001022, 0x030405060f001022, 0x0806050220011022, 0x0306050e20011022, 0x080605011e041022, 0x0806050023041022,
+	0x0009050923041022, 0x0010080c23041022, 0x0006001323041022, 0x0605010e1c051022, 0x0006050e20051022, 0x0114050b00071022,
+	0x0100140f00071022, 0x00051d0b05071022, 0x0105220b05071022, 0x00001d0f05071022, 0x0001220f05071022, 0x030405000f071022,
+	0x0005021d0f071022, 0x040501200f071022, 0x010502220f071022, 0x01050b011f071022, 0x01000f011f071022, 0x0100081623091022,
+	0x00050b06021a1022, 0x00000f06021a1022, 0x0204170705070025, 0x010f06190b050125, 0x010107190b050125, 0x0a0f10020c000725,
+	0x0100100f1f000725, 0x0a0f100200090b25, 0x000a02161a090b25, 0x010c010b03181025, 0x000408200e181025, 0x000408200f101625,
+	0x010000081f101625, 0x0100060c0b111725, 0x010c010b06051c25, 0x000603011e0c1c25, 0x010c010b06190526, 0x0003061614070626,
+	0x000603011e190c26, 0x0000031219091026, 0x00071902161a0b27, 0x000719021a0e0e27, 0x01030221160b0900, 0x03180205260b0b00,
+	0x0302052610160b00, 0x0302011525160e00, 0x020e052108061000, 0x0903020616011700, 0x0517000606101b04, 0x050007061e101b04,
+	0x0000211e0c0f1005, 0x05000c041e1e1005, 0x000710041e1e1005, 0x0007060c0c0f1105, 0x000701001e1e1105, 0x000205160f1e1007,
+	0x00040702241e1007, 0x00001704041e1107, 0x0500010a041e1107, 0x000d010a041e1107, 0x0202190200070608, 0x0517002006051008,
+	0x0016011f09101008, 0x030218022700070a, 0x000218042707070a, 0x030201022216070a, 0x010a16030006090a, 0x010516050006090a,
+	0x051709181801050d, 0x001506170803050f, 0x010a160014060a0f, 0x0212020107160011, 0x0a0f23000e030513, 0x0a031a000e1a0513,
+	0x010a16002b090b14, 0x0016010906101e16, 0x070c230504130018, 0x0a050c2309130018, 0x000c230502130918, 0x051701030301051b,
+	0x010415092601051b, 0x0107060f2601051b, 0x010400122601051b, 0x010306132601051b, 0x000325020012051b, 0x0003000210100b1e,
+	0x0003001a03130b1e, 0x0306020e1f001022, 0x000e090a23041022, 0x05011d0c01071022, 0x00060e1f04071022, 0x0e00220b05071022,
+	0x000205120f071022, 0x0e0002220f071022, 0x00011d0e10071022, 0x00000c031b071022, 0x010407001d071022, 0x010400121d071022,
+	0x01000b131d071022, 0x010400161e071022, 0x0104031b1d000025, 0x0100111b09070025, 0x0104071d03100125, 0x010d18061d000725,
+	0x0118010c1d000725, 0x0002050616100a25, 0x0100091d16100a25, 0x0002160618040b25, 0x00000f2510050b25, 0x010a160011090b25,
+	0x000a010619110b25, 0x010018081d120b25, 0x000a010619150b25, 0x0100081d12170b25, 0x0002160618050f25, 0x00020506100f0f25,
+	0x0100091d100f0f25, 0x0103051b0b001325, 0x0504060c01091b25, 0x0011011f04091b25, 0x0007012404091b25, 0x0004060e10091b25,
+	0x00140206060e1c25, 0x0000150612052025, 0x0305010b12052025, 0x00001b0604042125, 0x03180201011f0c26, 0x0014020606190e26,
+	0x000a0106190f0b27, 0x01030421160b0900, 0x03180405260b0b00, 0x0304052610160b00, 0x0304011525160e00, 0x020c052108061000,
+	0x0206050c1b0f1000, 0x0a06050c0e0f1100, 0x0903040616011700, 0x0002240a13090802, 0x0306001a240f1005, 0x0007011722181006,
+	0x0504002905181007, 0x050c01010f181007, 0x0202190400070608, 0x0101171809001008, 0x030218042700070a, 0x030201042216070a,
+	0x00061a051404090a, 0x130614040e01100d, 0x011306190003050f, 0x010017180803050f, 0x0200072319030b0f, 0x0212040107160011,
+	0x0a030125190d0013, 0x130602061e160013, 0x0d06010222160013, 0x00150e0504050814, 0x0015050419081014, 0x0206050c1b011017,
+	0x0a06050c0e011117, 0x0507050427090018, 0x050a050927090018, 0x130625010a010518, 0x130616011c010518, 0x0500052702090918,
+	0x0016060d0301051b, 0x090601150301051b, 0x01060d220c01051b, 0x070601230c01051b, 0x000325040012051b, 0x0306051801040b1b,
+	0x0000050719120b1b, 0x0006020e19130b1b, 0x0500050f0c000a1e, 0x0000050f0e100a1e, 0x000305061a100a1e, 0x00060e1a03010b1e,
+	0x0406101a03010b1e, 0x0003000410100b1e, 0x0305010d03150b1e, 0x0906011d0f001022, 0x0306040e1f001022, 0x030600181e041022,
+	0x000c090a23041022, 0x0306001023041022, 0x0906000e20051022, 0x0c00220b05071022, 0x0c0002220f071022, 0x130600020b141022,
+	0x13060101190c0425, 0x0d0600050e181025, 0x0d0600050f101625, 0x040600021e101625, 0x1306000306101725, 0x0906020601071c25,
+	0x05041806070e0026, 0x0906020601190726, 0x03180401011f0c26, 0x1306001006021026, 0x000607050d1f1026, 0x01070518040b1000,
+	0x01071028041a1000, 0x0d060117091e1000, 0x01070128001a1100, 0x0310040a06100f01, 0x020b1a0508090002, 0x0200131a22090002,
+	0x0200131a09070102, 0x020a1a0501090902, 0x0200001a08091002, 0x02001a010b091002, 0x0000211a0b091002, 0x02071a0021091602,
+	0x0110000606101b04, 0x00000a200e0d2304, 0x0000211e150d1005, 0x080600142c0f1005, 0x05000c04261a1005, 0x00071004261a1005,
+	0x0007060c150d1105, 0x00070100261a1105, 0x050c011e000d1007, 0x011f0d0421050008, 0x01280d051b100008, 0x01001a19050b0908,
+	0x0110002006051008, 0x01041f061c13000a, 0x01011f040317000a, 0x000615050212090a, 0x010011050816090a, 0x011009181801050d,
+	0x0310040a1301080d, 0x011306170003050f, 0x02061b010903050f, 0x030400082c0f050f, 0x0001081d280d1011, 0x02001a030a1a0912,
+	0x03041422090e0013, 0x04060315221b0013, 0x040603151b070113, 0x02001b070d120513, 0x0008280d19120513, 0x040615001b140513,
+	0x02000d1a07180513, 0x040600151b180513, 0x06011501191c0513, 0x01280d051b000014, 0x0105180101050814, 0x0106150529000a14,
+	0x060415062a001014, 0x030400012b091b14, 0x0008280d12052014, 0x060115011c052014, 0x000600150b022414, 0x030406241a060016,
+	0x0304180625060016, 0x02041a0608090017, 0x000126050d130918, 0x0001050d060d1018, 0x01000821090b1118, 0x011001030301051b,
+	0x1008060a0301051b, 0x0500020719090b1b, 0x0003060f19120b1b, 0x0006040e19130b1b, 0x0104031b1e00001c, 0x0104071e0310011c,
+	0x010d18061e00071c, 0x0118010c1e00071c, 0x0100091e16100a1c, 0x010018081e120b1c, 0x0100081e12170b1c, 0x0100091e100f0f1c,
+	0x0306052b00120b20, 0x0003062712120b20, 0x010008111e120b20, 0x061115011f000122, 0x0706150124000122, 0x0011011f1a070122,
+	0x000701241a070122, 0x030602200f001022, 0x0806001623041022, 0x030400160f071022, 0x010407001f071022, 0x010400121f071022,
+	0x01000b131f071022, 0x05011d0c01081022, 0x0500060523091022, 0x0005090523091022, 0x01000f0723091022, 0x0001081d150d1022,
+	0x0304000a09101022, 0x0300050d09101022, 0x080600021f101022, 0x0306000e1f101022, 0x0200030e18150924, 0x0104031b1f000025,
+	0x0104071f03100125, 0x03040d0619000725, 0x0304010c19000725, 0x010d18061f000725, 0x0118010c1f000725, 0x0009061a02010925,
+	0x0100091f16100a25, 0x0106190d21000b25, 0x00010d1f1a090b25, 0x0304000819120b25, 0x010018081f120b25, 0x0100081f12170b25,
+	0x0100091f100f0f25, 0x0106051b0e001325, 0x000400241a011625, 0x040600041e101625, 0x03040e0100091b25, 0x0304000111091b25,
+	0x03040e0106001c25, 0x0906040601071c25, 0x030600051e0c1c25, 0x0605010e12052025, 0x0004071a04022125, 0x0004001a05022125,
+	0x03040e0106190026, 0x0306170612000726, 0x0306170600180726, 0x0906040601190726, 0x030600051e190c26, 0x03040103001a0e26,
+	0x0304000112000f26, 0x0002080e04070f26, 0x0d06011109011026, 0x05011d0c01081026, 0x03070400040e1026, 0x080e050118000028,
+	0x02010d1c08061000, 0x0501161c08061000, 0x13060117091e1000, 0x050c010200181100, 0x0402060916071700, 0x00061a0d141e0501,
+	0x00060c1a181e0501, 0x0206051a0c1e1601, 0x0306000d1e1e1005, 0x050c011b000d1007, 0x050c0101220d1007, 0x0517010901181007,
+	0x050c01010c181007, 0x020c050a001e1007, 0x000c1e0d051e1007, 0x0801051e040b0608, 0x0101111809001008, 0x0110011909001008,
+	0x0110010920011008, 0x020d001b0401070a, 0x0516001b0401070a, 0x030202012216070a, 0x010011180803050f, 0x011000190803050f,
+	0x0a0301032503050f, 0x050301052503050f, 0x0a0301031b03090f, 0x050301051b03090f, 0x050a160006030a0f, 0x0305021a001a0b0f,
+	0x0a061e010e120513, 0x0200010f02240b14, 0x0600021524240b14, 0x0012070504002c14, 0x050a002803090518, 0x000a0302280d0918,
+	0x00050502280d0918, 0x00001502180b0919, 0x0f0601150301051b, 0x010701150301051b, 0x0306051c02010b1b, 0x0500040719090b1b,
+	0x050c010601100a1c, 0x0000150603150b1e, 0x05011c0f010b0920, 0x0f06011d0f001022, 0x0107011d0f001022, 0x080600141e041022,
+	0x0501090a23041022, 0x0f06000e20051022, 0x0107000e20051022, 0x0c001c0b05071022, 0x01061e0e05071022, 0x0c00021c0f071022,
+	0x01000b171f071022, 0x050005051a000025, 0x0a0600170e0c0425, 0x020a170005090b25, 0x0106011c21001725, 0x01111e0105091b25,
+	0x02060501110c1c25, 0x0a010d01070e1c25, 0x0206050111190c26, 0x0a010d0107190e26, 0x0500050501000f26, 0x00020b0306070f26,
+	0x1306011109011026, 0x03060014021f1026, 0x0306001102241026, 0x01061a050a1e0b00, 0x04031a01271a0e00, 0x01031a06271a0e00,
+	0x0304022208061000, 0x0400200e1e0f1000, 0x050009021b181000, 0x05000c021e181000, 0x0100160e1e1a1000, 0x0c00051e081e1000,
+	0x0406121a181e0501, 0x0100141c060b1101, 0x0000231e150d1005, 0x0806001a240f1005, 0x00150600150d1105, 0x010403261a180007,
+	0x001506031c0d0e07, 0x010400261a180e07, 0x00150620050d1007, 0x01280d0517000b08, 0x0001051728090b08, 0x0001061a1e041008,
+	0x03000d101a051008, 0x0304001a0d0f1008, 0x030204012216070a, 0x050116050600090a, 0x000105061315090a, 0x000112050816090a,
+	0x000222100903050f, 0x0d0600142303050f, 0x0103011f19030b0f, 0x0305041a001a0b0f, 0x0003051a1a0b0112, 0x00150603190d0912,
+	0x0304141b090a0013, 0x0304062408160013, 0x04031e0119120513, 0x130600050e102413, 0x0101090525050814, 0x010109051b090814,
+	0x0600041524240b14, 0x04031e0112052014, 0x0114091026180016, 0x0104091c26180016, 0x0016090610180516, 0x0003230610180516,
+	0x0003061c1a180516, 0x0007061c1e180516, 0x0104002613180816, 0x01031a0522090017, 0x0400200e1e011017, 0x0d06002708041017,
+	0x00001f041e091017, 0x000900240b041117, 0x1306050624130018, 0x0c031c061a010518, 0x0c071c061e010518, 0x0015060a060d0518,
+	0x0007060a280d0518, 0x0007030611072418, 0x000005151a0b0919, 0x0806051801040b1b, 0x0000050613150b1b, 0x00180624060c041c,
+	0x000518050626101c, 0x00000506100b121c, 0x0204170005070a1e, 0x0003050110100b1e, 0x0000051c130b0920, 0x001506030d100221,
+	0x0500071a0d100221, 0x0500011e0d100221, 0x0000111e0d100221, 0x0d0614011c000122, 0x000703061b110722, 0x080600181e041022,
+	0x0c01000b23041022, 0x0806001023041022, 0x03000d1506051022, 0x030400170a071022, 0x030400100f071022, 0x0c00041c0f071022,
+	0x0001091123091022, 0x0001061718040924, 0x010605170e0b0125, 0x050108051a001025, 0x0100051e0e181025, 0x0d06011c01011625,
+	0x130600050a101625, 0x0100051e0f101625, 0x0101090d1e101625, 0x010e0d05071a0026, 0x010a0905081a0026, 0x010305160d1a0026,
+	0x0106050c111a0026, 0x0014091004220c26, 0x0004091c04220c26, 0x01140306001a0e26, 0x00032006051a0e26, 0x00041b0304000f26,
+	0x0500101e04091026, 0x030400170e091026, 0x0400201010091026, 0x0200181014091026, 0x020010021a091026, 0x0204050e06160b00,
+	0x0204012006160b00, 0x02001204160b1000, 0x0e001f05160b1000, 0x02160107170b1000, 0x03010d070d1d1000, 0x13060117061e1000,
+	0x13060116081e1000, 0x010d0128001a1100, 0x080c230106060401, 0x060f1a011e060401, 0x00040c24121e0501, 0x04061a0a141e0501,
+	0x03041a0106061001, 0x0304011d0c061001, 0x0406051a081e1001, 0x0d0605011a1e1601, 0x0200111a22090002, 0x0200111a09070102,
+	0x0009170527061604, 0x000917050c062304, 0x0116210123060b05, 0x0801220123060b05, 0x0001210423060b05, 0x05000100261a1105,
+	0x000d0100261a1105, 0x0517010601181007, 0x0016010d11181007, 0x010c0d1e001e1007, 0x0012160525050008, 0x03041a01180f0008,
+	0x021618012c110008, 0x000218042c110008, 0x0e162101021a0008, 0x080e2201021a0008, 0x000e2104021a0008, 0x0101111806001008,
+	0x0110011906001008, 0x011001170f011008, 0x0110010620011008, 0x0016011715091008, 0x010c011c18070b0a, 0x011001060110200d,
+	0x000a22100903050f, 0x090301052503050f, 0x000012211b03070f, 0x090301051b03090f, 0x00011917081a0b0f, 0x001601081b180b10,
+	0x0116210103062110, 0x0801220103062110, 0x0001210403062110, 0x0009170528060111, 0x0009011b28061011, 0x0001091f28061011,
+	0x03010d07011d1011, 0x030601161e160013, 0x0101160908190013, 0x0806010923190013, 0x080601091e1b0013, 0x0106010e1b1d0013,
+	0x0015061a07160513, 0x0000240404101e13, 0x01010c1803100114, 0x0002221804100114, 0x0806011b17100114, 0x0601150125080514,
+	0x0002221800050814, 0x0219010104080814, 0x08011b0104080814, 0x0101091f190b0814, 0x0601011524240b14, 0x0219010100031d14,
+	0x08011b0100031d14, 0x031801010c031d14, 0x0101160908002014, 0x0806010923002014, 0x0116210103062114, 0x0801220103062114,
+	0x0001210403062114, 0x03160101032c2114, 0x00030104032c2114, 0x001601021b180915, 0x000004021b180915, 0x0116010826180016,
+	0x0100040826180016, 0x0116210115060516, 0x0801220115060516, 0x0001210415060516, 0x03041a0119060017, 0x00090502280d0918,
+	0x0001240502130918, 0x00000f02180b0919, 0x011621010306041b, 0x080122010306041b, 0x000121040306041b, 0x000401162404051b,
+	0x001601081509051b, 0x0016010e0812051b, 0x05010c0619010b1b, 0x0106130e19010b1b, 0x0004011719040b1b, 0x0501010719090b1b,
+	0x0001110719090b1b, 0x0100060f19120b1b, 0x0106010e19130b1b, 0x011601111e00001c, 0x010004111e00001c, 0x0201120d0410011c,
+	0x0100141e0410011c, 0x020112000d05081c, 0x010014001e05081c, 0x010000161e05081c, 0x00010e2a0610161c, 0x0101080910100b1e,
+	0x00000f0603150b1e, 0x0100062712120b20, 0x0012070512000122, 0x0d06150124000122, 0x0009170515060122, 0x0515160100070122,
+	0x0500150400070122, 0x0009170511070122, 0x0016200117070122, 0x0000200417070122, 0x050001241a070122, 0x000d01241a070122,
+	0x0016010612180122, 0x0000040612180122, 0x090601170e001022, 0x0a01081a0e001022, 0x0f06011e0f001022, 0x0107011e0f001022,
+	0x0d0601140c011022, 0x0806011324011022, 0x0901090a23041022, 0x0001091423041022, 0x0009011b15061022, 0x0001091f15061022,
+	0x0515010b00071022, 0x0c01011c0f071022, 0x0101101e0f071022, 0x0009011b11071022, 0x0001091f11071022, 0x0001200b17071022,
+	0x01010f0d1e071022, 0x000405131e071022, 0x0501060023091022, 0x0301000d09101022, 0x0006010e1f101022, 0x0806010122131022,
+	0x0001090422131022, 0x00010b0612181022, 0x0114160112010924, 0x0100140412010924, 0x000c1c031a010924, 0x0001051418040924,
+	0x080c1b0104000025, 0x0114160115000025, 0x0100140415000025, 0x05011b011a000025, 0x011601111f000025, 0x010004111f000025,
+	0x0106010e210e0125, 0x0100141f04100125, 0x0c01090118080525, 0x0601130118080525, 0x010014001f050825, 0x010000161f050825,
+	0x0806011d01100a25, 0x080c011e06000f25, 0x0306170512001025, 0x040605011e101625, 0x0009000316101725, 0x030601001e0c1c25,
+	0x0000061a04022125, 0x080c030100082225, 0x0019050e07020b26, 0x0019012007020b26, 0x030601001e190c26, 0x01011809081f0c26,
+	0x0016010804220c26, 0x0000040804220c26, 0x05011b0101000f26, 0x000f010306080f26, 0x1306011106011026, 0x0009001016021026,
+	0x01010e0919091026, 0x01011e10040e1026, 0x001603011a001827, 0x000119021a001827, 0x000003041a001827, 0x0016010618011628,
+	0x0000040618011628, 0x00010b0618101628, 0x02160207170b1000, 0x03020d070d1d1000, 0x13060217061e1000, 0x13060216081e1000,
+	0x04061a0d141e0501, 0x04060c1a181e0501, 0x02030f1a090b0102, 0x00020c0427061604, 0x00020c040c062304, 0x0517020601181007,
+	0x0016020d11181007, 0x0310040216140008, 0x0102111806001008, 0x0110021906001008, 0x011002170f011008, 0x0110020620011008,
+	0x0016021715091008, 0x0501140121080b0a, 0x000a050616150b0a, 0x0514070401190b0a, 0x011002060110200d, 0x0203220f0003050f,
+	0x0603011f19030b0f, 0x0a03050118160b0f, 0x010d1407001a0b0f, 0x001602081b180b10, 0x00020c0428060111, 0x0009021b28061011,
+	0x03020d07011d1011, 0x0102160908190013, 0x0806020923190013, 0x080602091e1b0013, 0x0310040216000613, 0x01020c1803100114,
+	0x0806021b17100114, 0x0602011524240b14, 0x0102160908002014, 0x0806020923002014, 0x020305040d1c0017, 0x000a05120d0b0919,
+	0x00041502180b0919, 0x001602081509051b, 0x0016020e0812051b, 0x00020e2a0610161c, 0x051407040d0b001d, 0x050014020d0b091d,
+	0x000d14020d0b091d, 0x0306141203010b1e, 0x0806141403010b1e, 0x05001403060d0b1e, 0x000d1403060d0b1e, 0x0306140003130b1e,
+	0x0004150603150b1e, 0x020b06040f000122, 0x00020c0415060122, 0x02020b0400070122, 0x00020c0411070122, 0x0002040611090122,
+	0x0002040615090122, 0x090602170e001022, 0x0a02081a0e001022, 0x0f06021e0f001022, 0x0107021e0f001022, 0x0d0602140c011022,
+	0x0806021324011022, 0x0009021b15061022, 0x0515020b00071022, 0x0c02011c0f071022, 0x0102101e0f071022, 0x0009021b11071022,
+	0x0002200b17071022, 0x01020f0d1e071022, 0x0502060023091022, 0x0302000d09101022, 0x0006020e1f101022, 0x0806020122131022,
+	0x00020b0612181022, 0x02100c031a010924, 0x0002031a10090924, 0x02010d031a130924, 0x0806021d01100a25, 0x0a06050112140b25,
+	0x080c021e06000f25, 0x000203161a081025, 0x02010d0408011625, 0x020604010e011625, 0x020601030f0b1c25, 0x0a0605010b0c1c25,
+	0x030602001e0c1c25, 0x02061004050e0026, 0x02031404050e0026, 0x01021604070e0026, 0x01021104080e0026, 0x020305040d140026,
+	0x000204060a150126, 0x020601030f190b26, 0x0a0605010b190c26, 0x030602001e190c26, 0x01021809081f0c26, 0x0102091304011026,
+	0x1306021106011026, 0x0204010d12051026, 0x01020e0919091026, 0x00020b0618101628, 0x02010b191a0b0300, 0x0a02122108061000,
+	0x02120111030b1000, 0x0204020d0e0f1100, 0x00030311160b1500, 0x0403031116071700, 0x020109031b180901, 0x00021a0606061001,
+	0x0002061d0c061001, 0x02021a091a090002, 0x0200231922090002, 0x0200231909070102, 0x0216010901181007, 0x0204160615090008,
+	0x12041f0615090008, 0x00021a06180f0008, 0x02111601021a0008, 0x12111f01021a0008, 0x02001604021a0508, 0x00121f04021a0508,
+	0x0802021b00070608, 0x02011606021a0e08, 0x12011f06021a0e08, 0x0002061b17001008, 0x020114040401000a, 0x000c021c18070b0a,
+	0x0214000f0d01050d, 0x0201140d1301080d, 0x000311052503050f, 0x000311051b03090f, 0x0003111f19030b0f, 0x00021a0619060017,
+	0x0304060e1e150017, 0x0214000908041017, 0x0200022104091017, 0x0204020d0e011117, 0x01030d2221090018, 0x0703012321090018,
+	0x02150504060d0018, 0x02070504280d0018, 0x020a0509280d0018, 0x0214080603010518, 0x020128050d010918, 0x02000502280d0918,
+	0x02000a210b011018, 0x02000002180b0919, 0x000206230701051b, 0x031801011e0c041c, 0x0703011e01100a1c, 0x0c02000f0f000a1e,
+	0x0200000603150b1e, 0x0201091c000b0920, 0x0209000923041022, 0x0209011d00071022, 0x02001d0b05071022, 0x0200021d0f071022,
+	0x0200101e0f071022, 0x02000f0d1e071022, 0x02000b06021a1022, 0x0002051b11010924, 0x031801011f0c0425, 0x0703011f01100a25,
+	0x0200001e0e181025, 0x0200001e0f101625, 0x0002090d1e101625, 0x0209040600091b25, 0x0209040606001c25, 0x09020d0607001c25,
+	0x0209040606190026, 0x09020d0607190026, 0x0204020a12001026, 0x0004021c12001026, 0x0002091d12001026, 0x00021e10040e1026,
+	0x0204020a00181026, 0x0004021c00181026, 0x0002091d00181026, 0x0002220b07181026, 0x0a04122108061000, 0x02120113030b1000,
+	0x010021121e0d1000, 0x0f060605081e1000, 0x01061c0f081e1000, 0x02060515081e1000, 0x0106021b081e1000, 0x010706120c0d1100,
+	0x0204040d0e0f1100, 0x00030313160b1500, 0x0403031316071700, 0x020b061718060501, 0x0102240a130d0801, 0x0116010f1b180901,
+	0x0107160418100b01, 0x02010b1c06100f01, 0x020b040606061001, 0x00041a0606061001, 0x0004061d0c061001, 0x00060305061e1001,
+	0x01000a270c181601, 0x010427001a181601, 0x02010b0406012001, 0x02010b0406001b04, 0x0106040c1e1e0005, 0x0806011c1e1e0005,
+	0x0104072700181007, 0x0116000d11181007, 0x02010b0420050008, 0x020b0406180f0008, 0x00041a06180f0008, 0x01270d051b100008,
+	0x0c040d06181d0008, 0x0804021b00070608, 0x0218090526000b08, 0x0100051728090b08, 0x0101171a09001008, 0x0116020e16001008,
+	0x0004061b17001008, 0x0116001715091008, 0x01150617010d1008, 0x010005061315090a, 0x010012050816090a, 0x000c041c18070b0a,
+	0x02011b070003050f, 0x0100171a0803050f, 0x000313052503050f, 0x000313051b03090f, 0x0003131f19030b0f, 0x01050919001a0b0f,
+	0x01001917081a0b0f, 0x011600081b180b10, 0x0109001b28061011, 0x0100091f28061011, 0x0200090f22190013, 0x02000a0923190013,
+	0x02000a091e1b0013, 0x0a0f25000e030513, 0x0008270d19120513, 0x0a030500090a1a13, 0x01001d0104102113, 0x01270d051b000014,
+	0x0200091b2a070014, 0x0114000e1e100114, 0x0002090525050814, 0x000209051b090814, 0x0002091f190b0814, 0x0200090f22002014,
+	0x02000a0923002014, 0x0008270d12052014, 0x011601091b180016, 0x010a0c00060a1a16, 0x020b040619060017, 0x00041a0619060017,
+	0x00060305191e0017, 0x011400001e091017, 0x010021011e091017, 0x0204040d0e011117, 0x010706010c091117, 0x010a032506090018,
+	0x0105052506090018, 0x01150615060d0018, 0x01020f09280d0018, 0x01070615280d0018, 0x17061e0102130018, 0x01071e0102130018,
+	0x070c250504130018, 0x0a050c2509130018, 0x090612061e010518, 0x090600061e130518, 0x000c250502130918, 0x04000a210b011018,
+	0x0109002301071118, 0x010000151a0b0919, 0x010a00061a0f0b19, 0x110601150301051b, 0x010420160601051b, 0x010806220601051b,
+	0x010407230601051b, 0x010e06240601051b, 0x000406230701051b, 0x011600081509051b, 0x0116000e0812051b, 0x0109000f14010a1b,
+	0x0107100619010b1b, 0x0100110719090b1b, 0x0100000719120b1b, 0x0100000613150b1b, 0x010718060b09011c, 0x0101042a0600101c,
+	0x010718000626101c, 0x01000006100b121c, 0x01000d000610161c, 0x01000e2a0610161c, 0x0c04000f0f000a1e, 0x0109000f11010a1e,
+	0x0100000f0e100a1e, 0x010300061a100a1e, 0x0002080910100b1e, 0x0100001c130b0920, 0x01000f2c010d0b20, 0x0606061702001022,
+	0x0601141d0c001022, 0x1106011d0f001022, 0x0200090f1f001022, 0x1106000e20051022, 0x0109001b15061022, 0x0100091f15061022,
+	0x0109022000071022, 0x0400101e0f071022, 0x0109001b11071022, 0x0100091f11071022, 0x0100200b17071022, 0x04000f0d1e071022,
+	0x010400131e071022, 0x01060e2301081022, 0x0105090023091022, 0x0100091123091022, 0x01100017010d1022, 0x01000f23010d1022,
+	0x01000b0612181022, 0x0004051b11010924, 0x01090e061a000025, 0x0109001b15070025, 0x010a00161a090b25, 0x0400001e0e181025,
+	0x06011d0c01101625, 0x0400001e0f101625, 0x0004090d1e101625, 0x01090b0500091b25, 0x01090b0506001c25, 0x09040d0607001c25,
+	0x01090b0506190026, 0x09040d0607190026, 0x0107051b010a0b26, 0x010a091c010f0c26, 0x0a030500091b0c26, 0x02001809081f0c26,
+	0x01000f25010a0e26, 0x01090e0601000f26, 0x0a03120509001026, 0x0204040a12001026, 0x0004041c12001026, 0x0004091d12001026,
+	0x0114000b13001026, 0x0703010c18001026, 0x01060e2301081026, 0x02000e0919091026, 0x01012101040a1026, 0x01060701140a1026,
+	0x00041e10040e1026, 0x01001d0104171026, 0x0204040a00181026, 0x0004041c00181026, 0x0004091d00181026, 0x01020a0701181026,
+	0x01001c0701181026, 0x0110000d01181026, 0x010607000d1f1026, 0x010607010d241026, 0x000601110a041126, 0x01090601000a1126,
+	0x010014010b0a1126, 0x01071900161a0b27, 0x010719031a000e27, 0x010719001a0e0e27, 0x010019021a001827, 0x01000b0618101628,
+	0x05010b191a0b0300, 0x05021a091a090002, 0x0500231922090002, 0x0500231909070102, 0x0516010901181007, 0x0418090526000b08,
+	0x0400090f22190013, 0x04000a0923190013, 0x04000a091e1b0013, 0x02060511181d0013, 0x0400091b2a070014, 0x0004090525050814,
+	0x000409051b090814, 0x0004091f190b0814, 0x0400090f22002014, 0x04000a0923002014, 0x05150504060d0018, 0x05070504280d0018,
+	0x050a0509280d0018, 0x050128050d010918, 0x05000502280d0918, 0x05000002180b0919, 0x0005060f19120b1b, 0x0004080910100b1e,
+	0x0500000603150b1e, 0x0501091c000b0920, 0x0506052b00120b20, 0x0005062712120b20, 0x050602200f001022, 0x0400090f1f001022,
+	0x0509000923041022, 0x0600110e1c051022, 0x06000b161c051022, 0x0509011d00071022, 0x05001d0b05071022, 0x0500021d0f071022,
+	0x0506000e1f101022, 0x05000b06021a1022, 0x061801011d0c0425, 0x0706011d01100a25, 0x06000b0221101625, 0x0509040600091b25,
+	0x0509040606001c25, 0x0509040606190026, 0x0506170612000726, 0x0506170600180726, 0x04001809081f0c26, 0x04000e0919091026,
+	0x01022218040b1000, 0x010900171e181000, 0x010004280d1a1000, 0x010900141e1a1000, 0x0f02092322090002, 0x060f230924090002,
+	0x0f02092309070102, 0x0f00092308091002, 0x000f10060b091b04, 0x000124040d101b04, 0x03111a012a1a0005, 0x00031a042a1a0505,
+	0x03011a062a1a0e05, 0x00000c1e111a1005, 0x0000040d261a1005, 0x000e0d042a1a1005, 0x00140600150d1105, 0x050406271c0d0007,
+	0x010104260e180007, 0x01001617180b0907, 0x001406031c0d0e07, 0x00140620050d1007, 0x01000d2618181007, 0x000c220d051e1007,
+	0x01210d0421050008, 0x0101041d2c090008, 0x000a1a19050b0908, 0x000f1020050b0908, 0x010014180f0b0908, 0x01001612180b0908,
+	0x010421061c13000a, 0x010121040317000a, 0x110218091c11000d, 0x021418092d11000d, 0x110218001311080d, 0x011606170003050f,
+	0x0a0301052503050f, 0x0a0301051b03090f, 0x0000120f1f030a0f, 0x0114000f010f0a0f, 0x0000030f171a0a0f, 0x00010d061c1a0a0f,
+	0x0305011e1b030b0f, 0x00010c1d28061011, 0x0000021e0f181011, 0x01000428011a1011, 0x010028040b1a1011, 0x03011a061b1a0512,
+	0x00140603190d0912, 0x0100090f191a0513, 0x0114011500130813, 0x0020011505130813, 0x011201001e190913, 0x0114000f000a0a13,
+	0x0000200f050a0a13, 0x0f04230607000b13, 0x0100030919102413, 0x1201280d03100114, 0x110218000d050814, 0x110109011c050814,
+	0x0100140f190b0814, 0x020718001b1c0b14, 0x1106150002240b14, 0x0604150601250b14, 0x0004060619250b14, 0x110218091c000c14,
+	0x021418092d000c14, 0x1102180013080c14, 0x1206011500221014, 0x0601151d01221014, 0x0600151b04221014, 0x0006151f04221014,
+	0x00011d0619221014, 0x04280d0601091b14, 0x010014022b091b14, 0x00040c062b091b14, 0x0100090f1a052014, 0x0100030910242014,
+	0x010409061b160915, 0x01001419060b0917, 0x000021051e091017, 0x0100140b041c1017, 0x010025101d090018, 0x0106220921090018,
+	0x11020b1809110018, 0x0515011503010518, 0x051509011c010518, 0x0014060a060d0518, 0x0020011503130518, 0x000920011c130518,
+	0x000a0502280d0918, 0x0100140d0f0b0919, 0x0b0601150301051b, 0x000025100409051b, 0x0000170f030d0a1b, 0x00100c0819040b1b,
+	0x0005190702090b1b, 0x0100160819090b1b, 0x010919061e0e011c, 0x0107001d1e0c0a1c, 0x0100100f1e000b1c, 0x01000b1d1e080b1c,
+	0x0011010619110b1c, 0x010004001e10161c, 0x01000d081e10161c, 0x011101011e091b1c, 0x02010b1c000b0920, 0x00010b1c140b0920,
+	0x001406030d100221, 0x0000141e0d100221, 0x0114000f0f001022, 0x0b06011d0f001022, 0x020b000923041022, 0x0a01090a23041022,
+	0x01000e0a23041022, 0x1000000c23041022, 0x00060d1323041022, 0x0600150e1c051022, 0x0b06000e20051022, 0x00010c1d15061022,
+	0x0114060e00071022, 0x020b011d00071022, 0x00061d0e05071022, 0x0106220e05071022, 0x10000c1e05071022, 0x040010200f071022,
+	0x00010c1d11071022, 0x0114000e15071022, 0x01060e011f071022, 0x01000e111f071022, 0x00011d0611091022, 0x00011d0615091022,
+	0x0100001623091022, 0x00060e06021a1022, 0x000f10021b040924, 0x00010c041b040924, 0x0004061d16090924, 0x000103041b090924,
+	0x0004061d100d0924, 0x0114000f0c0e0125, 0x010919061f0e0125, 0x00000d1a10070525, 0x010014160c050825, 0x0107001d1f0c0a25,
+	0x0100100f1f000b25, 0x01000b1d1f080b25, 0x0114000f01150b25, 0x0100141207150b25, 0x0100140415100e25, 0x0000031a0b161025,
+	0x0100140403181025, 0x011400090e181025, 0x040000200e181025, 0x01010d1d08101625, 0x120601000e101625, 0x06011d010e101625,
+	0x06001b040e101625, 0x00061f040e101625, 0x011400090f101625, 0x040000200f101625, 0x010004001f101625, 0x01000d081f101625,
+	0x0206011c21001725, 0x0114110100091b25, 0x020b040600091b25, 0x00111d0105091b25, 0x0111220105091b25, 0x0100140211091b25,
+	0x00040c0611091b25, 0x011101011f091b25, 0x0114110106001c25, 0x020b040606001c25, 0x060b04050b001c25, 0x060b01050a011c25,
+	0x0100140406051c25, 0x12060401000c1c25, 0x01040d06080c1c25, 0x0100030d1e0c1c25, 0x01140106060e1c25, 0x0114110106190026,
+	0x020b040606190026, 0x060b04050b190026, 0x02040606091c0026, 0x060b01050a190126, 0x0100140406190526, 0x00040619060d0c26,
+	0x1206040100190c26, 0x01040d0608190c26, 0x0100030d1e190c26, 0x0114010606190e26, 0x0204000609000f26, 0x0100140212000f26,
+	0x00040c0612000f26, 0x0507002401051026, 0x001201100a091026, 0x05001e04040e1026, 0x00042010040e1026, 0x00021814040e1026,
+	0x0200021a040e1026, 0x0100140b04141026, 0x00011d060a151026, 0x0000042304181026, 0x0012010f07181026, 0x02070007021f1026,
+	0x00000410021f1026, 0x00000f040a221026, 0x000104040f221026, 0x00000a130b041126, 0x0114000f010f0b27, 0x01001412070f0b27,
+	0x0000030f121a0b27, 0x010014040f100e27, 0x0111160118000028, 0x0107160018180b28, 0x0107160300181028, 0x0107160011181028,
+	0x02061a050a1e0b00, 0x02031a06271a0e00, 0x0c011e08091e1000, 0x0512010200181100, 0x0c181e06021e0801, 0x000a270118180904,
+	0x000a270118001204, 0x020d000606101b04, 0x0516000606101b04, 0x000a270118011606, 0x000a270112180107, 0x0512011b000d1007,
+	0x05120101220d1007, 0x051201010c181007, 0x010a1b011e140008, 0x02280d0517000b08, 0x0002051728090b08, 0x020d002006051008,
+	0x0516002006051008, 0x01011f0922131008, 0x050216050600090a, 0x000205061315090a, 0x000212050816090a, 0x020d09181801050d,
+	0x051609181801050d, 0x021400072303050f, 0x020201061b03070f, 0x030201211b03070f, 0x0703011f19030b0f, 0x02171a0105070013,
+	0x0201171a11070013, 0x02142104090a0013, 0x02142109050d0013, 0x0023190107060413, 0x020918010d180513, 0x02001b060d180513,
+	0x010a1b011e000613, 0x011001001e190913, 0x1001280d03100114, 0x0201090525050814, 0x020109051b090814, 0x1006011500221014,
+	0x0006011b1f221014, 0x010a012601180916, 0x02031a0522090017, 0x020d01030301051b, 0x051601030301051b, 0x000a0125060c041c,
+	0x000a01061409051c, 0x011101011e05081c, 0x0512010601100a1c, 0x00012a060910131c, 0x021407011c000122, 0x030a0f0120000122,
+	0x0014011c13080122, 0x000a012006140122, 0x0101131e0f071022, 0x040014200f071022, 0x0002091123091022, 0x040a200118010924,
+	0x020a180100110924, 0x020605170e0b0125, 0x0601122109100125, 0x060012210d100425, 0x011101011f050825, 0x050208051a001025,
+	0x100601000e101625, 0x0201090d1e101625, 0x010e1e0105091b25, 0x10060401000c1c25, 0x00060102200c1c25, 0x06040101230c1c25,
+	0x06010102250c1c25, 0x020e0d05071a0026, 0x020a0905081a0026, 0x020305160d1a0026, 0x0206050c111a0026, 0x0014011c13080126,
+	0x1006040100190c26, 0x0006010220190c26, 0x0604010123190c26, 0x0601010225190c26, 0x001001100a091026, 0x0010010f07181026,
+	0x03061c0603160e00, 0x03060603181e0e00, 0x0d060605081e1000, 0x050317031b180901, 0x00160c0627061604, 0x00160c060c062304,
+	0x020c0d1e001e1007, 0x080e05061a000708, 0x020c011c18070b0a, 0x021901060703040f, 0x08011b060703040f, 0x010600180803050f,
+	0x070301052503050f, 0x070301051b03090f, 0x00021917081a0b0f, 0x0207040607160011, 0x00160c0628060111, 0x0002091f28061011,
+	0x00160e0504050814, 0x0201091f190b0814, 0x0016050419081014, 0x0318010504261014, 0x13060006101e0516, 0x0801060206072416,
+	0x031605060d1c0017, 0x01100d0502010918, 0x00070502280d0918, 0x05020c0619010b1b, 0x0206130e19010b1b, 0x0502010719090b1b,
+	0x0002110719090b1b, 0x0200060f19120b1b, 0x0206010e19130b1b, 0x0202120d0410011c, 0x020212000d05081c, 0x0201080910100b1e,
+	0x0200062712120b20, 0x0b0616060f000122, 0x00160c0615060122, 0x020b160600070122, 0x00160c0611070122, 0x0016060611090122,
+	0x0016060615090122, 0x0806061902001022, 0x020608180e001022, 0x030606190e001022, 0x030406060f001022, 0x0806060220011022,
+	0x0306060e20011022, 0x080606011e041022, 0x0806060023041022, 0x0009060923041022, 0x0701090a23041022, 0x0606010e1c051022,
+	0x0006060e20051022, 0x0002091f15061022, 0x0114060b00071022, 0x00061d0b05071022, 0x0106220b05071022, 0x030406000f071022,
+	0x0006021d0f071022, 0x040601200f071022, 0x010602220f071022, 0x0002091f11071022, 0x01060b011f071022, 0x00060b06021a1022,
+	0x050706041a010025, 0x0500061a02010925, 0x000d061a02010925, 0x01160d0608011625, 0x061606010e011625, 0x0d06040601071c25,
+	0x06010504100c1c25, 0x06161006050e0026, 0x03161406050e0026, 0x01161606070e0026, 0x01161106080e0026, 0x031605060d140026,
+	0x001606060a150126, 0x0801060212090726, 0x0d06040601190726, 0x0601050410190c26, 0x0507060401010f26, 0x02011e10040e1026,
+	0x000219021a001827, 0x0403201a0e0f0500, 0x0103161a0e1a0500, 0x05060307101a0700, 0x15061f15010b0e00, 0x0103091704181000,
+	0x01030914041a1000, 0x0d060905081e1000, 0x0103140406040a01, 0x0114160706040a01, 0x02030b0406012001, 0x020b160706012001,
+	0x050f230924090002, 0x0009190709081502, 0x03011a0709081502, 0x02030b0406001b04, 0x020b160706001b04, 0x00030c0423060b05,
+	0x00160c0723060b05, 0x00030c04111a1005, 0x00030c04071a1105, 0x00150720050d1007, 0x01000a2618181007, 0x00030a0404181107,
+	0x02030b0420050008, 0x020b160720050008, 0x010314040b140008, 0x011416070b140008, 0x00030c03181a0b08, 0x0001071a1e041008,
+	0x050315040401000a, 0x051516070401000a, 0x000320040413000a, 0x001620070413000a, 0x000317040419000a, 0x001617070419000a,
+	0x000307122216070a, 0x0f1002070006080a, 0x030218040811000d, 0x021618070811000d, 0x010314041601090d, 0x011416071601090d,
+	0x030b06040101200d, 0x0b0616070101200d, 0x030301041f03040f, 0x031601071f03040f, 0x02031b070003050f, 0x03040c170003050f,
+	0x010900180803050f, 0x010d00180903050f, 0x030f01071b03080f, 0x0403011f19030b0f, 0x0103140406000e10, 0x0114160706000e10,
+	0x00030c0403062110, 0x00160c0703062110, 0x000302040f181011, 0x00030c031b1a0912, 0x00030c2407120513, 0x010314040b000613,
+	0x011416070b000613, 0x0015000d04061a13, 0x15061f1501000b14, 0x1506150116010b14, 0x1506150014040b14, 0x1506001518040b14,
+	0x0302180408000c14, 0x0216180708000c14, 0x0103140406000e14, 0x0114160706000e14, 0x1506031522000f14, 0x1506031507010f14,
+	0x1506150014050f14, 0x1506001518050f14, 0x001200070e031d14, 0x00060e150e031d14, 0x00030c0403062114, 0x00160c0703062114,
+	0x00120c0705002c14, 0x00030c0415060516, 0x00160c0715060516, 0x0403201a0e010517, 0x0003210504091017, 0x0115150921090018,
+	0x0105220921090018, 0x0115001221090018, 0x05011f0928090018, 0x05090509280d0018, 0x00150319060d0518, 0x00070319280d0518,
+	0x001503060d071118, 0x000307280d071118, 0x000e070218010919, 0x001503150d070919, 0x00030c040306041b, 0x00160c070306041b,
+	0x000908092404051b, 0x0111000e1e05081c, 0x01000a081e10161c, 0x000e07060315011e, 0x0801070212010920, 0x001507030d100221,
+	0x000314040d100221, 0x0806091902001022, 0x020908180e001022, 0x030609190e001022, 0x030409060f001022, 0x0806090220011022,
+	0x0306090e20011022, 0x080609011e041022, 0x0806090023041022, 0x0009090923041022, 0x1000070c23041022, 0x00060a1323041022,
+	0x0609010e1c051022, 0x0006090e20051022, 0x0114090b00071022, 0x00091d0b05071022, 0x0109220b05071022, 0x030409000f071022,
+	0x0009021d0f071022, 0x040901200f071022, 0x010902220f071022, 0x000c00031b071022, 0x01090b011f071022, 0x0100071623091022,
+	0x00090b06021a1022, 0x000917031b040924, 0x020307170f070025, 0x0001100018080525, 0x0111000e1f050825, 0x040007200e181025,
+	0x040007200f101625, 0x01000a081f101625, 0x01020d09210c1c25, 0x0103070d220c1c25, 0x0604000e230c1c25, 0x0103070d070d1c25,
+	0x0001001d01151d25, 0x01020d0921190c26, 0x0103070d22190c26, 0x0604000e23190c26, 0x0103070d19070d26, 0x050e070d01051026,
+	0x00081909041a0b27, 0x0001001d010f1d27, 0x06010b191a0b0300, 0x020e052108061000, 0x090406071a0b1000, 0x06021a091a090002,
+	0x0600231922090002, 0x0600231909070102, 0x010d000606101b04, 0x0616010901181007, 0x080526011a140008, 0x010d002006051008,
+	0x010d09181801050d, 0x010201061b03070f, 0x0a0f0f0006030a0f, 0x0101072119030b0f, 0x000a072319030b0f, 0x01171a0105070013,
+	0x0101171a11070013, 0x001f210f05090013, 0x0a0f070125090013, 0x01142104090a0013, 0x01142109050d0013, 0x071f210009100513,
+	0x0f0301061b140513, 0x010918010d180513, 0x01001b060d180513, 0x080526011a000613, 0x000407051a090014, 0x00001e0504050814,
+	0x0800031e1e080b14, 0x0a010701192a0b14, 0x000407051a002c14, 0x06150504060d0018, 0x06070504280d0018, 0x060a0509280d0018,
+	0x060128050d010918, 0x06000502280d0918, 0x06000002180b0919, 0x010d01030301051b, 0x0004070c19120b1b, 0x0002080d13150b1b,
+	0x0102042a0d00001c, 0x020518090d0b001c, 0x0002080d100b121c, 0x00022a0d0410131c, 0x0600000603150b1e, 0x0601091c000b0920,
+	0x01010b1c000b0920, 0x040207200c001022, 0x0609000923041022, 0x010b000923041022, 0x000e090a23041022, 0x0609011d00071022,
+	0x010b011d00071022, 0x06001d0b05071022, 0x0e00220b05071022, 0x0600021d0f071022, 0x0e0002220f071022, 0x0101071d0e101022,
+	0x06000b06021a1022, 0x000205180d150924, 0x000a030e18150924, 0x0609040600091b25, 0x010b040600091b25, 0x0609040606001c25,
+	0x010b040606001c25, 0x0f02140109002225, 0x0609040606190026, 0x010b040606190026, 0x01040606091c0026, 0x0104000609000f26,
+	0x0100021a040e1026, 0x0101081d09121026, 0x01070007021f1026, 0x04010707021f1026, 0x0027180307160b00, 0x08052301081a0b00,
+	0x08051801081d0b00, 0x0427180003160e00, 0x08092306041a0e00, 0x08091806041d0e00, 0x0210052108061000, 0x07012718030b1000,
+	0x020021121e0d1000, 0x020706120c0d1100, 0x0202240a130d0801, 0x0216010f1b180901, 0x0207160418100b01, 0x02000a270c181601,
+	0x020427001a181601, 0x011e230408090002, 0x001e230f18090002, 0x00001e2309100f02, 0x0204072700181007, 0x0216000d11181007,
+	0x0200051728090b08, 0x0216020e16001008, 0x0216001715091008, 0x02150617010d1008, 0x020005061315090a, 0x020012050816090a,
+	0x030714040e01100d, 0x02050919001a0b0f, 0x02001917081a0b0f, 0x021600081b180b10, 0x0209001b28061011, 0x0200091f28061011,
+	0x000820250e120513, 0x02001d0104102113, 0x0214000e1e100114, 0x021601091b180016, 0x020a0c00060a1a16, 0x021400001e091017,
+	0x020021011e091017, 0x020706010c091117, 0x020a032506090018, 0x0205052506090018, 0x02150615060d0018, 0x02020f09280d0018,
+	0x02070615280d0018, 0x030725010a010518, 0x030716011c010518, 0x0209002301071118, 0x020000151a0b0919, 0x020a00061a0f0b19,
+	0x020420160601051b, 0x020806220601051b, 0x020407230601051b, 0x020e06240601051b, 0x021600081509051b, 0x0216000e0812051b,
+	0x0209000f14010a1b, 0x0207100619010b1b, 0x0200110719090b1b, 0x0200000719120b1b, 0x0200000613150b1b, 0x020718060b09011c,
+	0x0201042a0600101c, 0x020718000626101c, 0x02000006100b121c, 0x02000d000610161c, 0x02000e2a0610161c, 0x0209000f11010a1e,
+	0x0200000f0e100a1e, 0x020300061a100a1e, 0x0200001c130b0920, 0x02000f2c010d0b20, 0x0010090a23041022, 0x0209001b15061022,
+	0x0200091f15061022, 0x0209022000071022, 0x1000220b05071022, 0x100002220f071022, 0x0209001b11071022, 0x0200091f11071022,
+	0x0200200b17071022, 0x020400131e071022, 0x02060e2301081022, 0x0205090023091022, 0x0200091123091022, 0x02100017010d1022,
+	0x02000f23010d1022, 0x030700020b141022, 0x02000b0612181022, 0x02090e061a000025, 0x0209001b15070025, 0x03070101190c0425,
+	0x020a00161a090b25, 0x0307000306101725, 0x02090b0500091b25, 0x02090b0506001c25, 0x02090b0506190026, 0x0207051b010a0b26,
+	0x020a091c010f0c26, 0x02000f25010a0e26, 0x02090e0601000f26, 0x0214000b13001026, 0x0307001006021026, 0x02060e2301081026,
+	0x02012101040a1026, 0x02060701140a1026, 0x02001d0104171026, 0x02020a0701181026, 0x02001c0701181026, 0x0210000d01181026,
+	0x020607000d1f1026, 0x020607010d241026, 0x02090601000a1126, 0x020014010b0a1126, 0x02071900161a0b27, 0x020719031a000e27,
+	0x020719001a0e0e27, 0x020019021a001827, 0x02000b0618101628, 0x04010b191a0b0300, 0x011a0d05091d0b00, 0x14060d0603160e00,
+	0x04120113030b1000, 0x01130419040b1000, 0x0400210c1e0f1000, 0x0407060c0c0f1100, 0x040b061718060501, 0x1013040a06100f01,
+	0x0216040a06100f01, 0x0016041c06100f01, 0x04010b1c06100f01, 0x040b040606061001, 0x04010b0406012001, 0x04021a091a090002,
+	0x0400231922090002, 0x0400231909070102, 0x04010b0406001b04, 0x170c000606101b04, 0x0c0007061e101b04, 0x01060d04241d0005,
+	0x000700142c0f1005, 0x000c0c041e1e1005, 0x0416010901181007, 0x040e002905181007, 0x0c0e01010f181007, 0x000c010a041e1107,
+	0x04010b0420050008, 0x0012160525050008, 0x040b0406180f0008, 0x09040d06181d0008, 0x0012021a140b0908, 0x0c01010e1e040e08,
+	0x011901151e040e08, 0x1506040d17001008, 0x170c002006051008, 0x0304001a22131008, 0x120100171404070a, 0x011807051404090a,
+	0x0a0104051807090a, 0x000b071c14040b0a, 0x0009041c18070b0a, 0x0105041e18070b0a, 0x000b071703170b0a, 0x0105061d03170b0a,
+	0x170c09181801050d, 0x1013040a1301080d, 0x0216040a1301080d, 0x04011b070003050f, 0x120100191003050f, 0x130400082c0f050f,
+	0x0101082119030b0f, 0x000b0724050f0b0f, 0x00040619240f0b0f, 0x0a01012719060b10, 0x0c01011d01061d10, 0x00091a0d181d0512,
+	0x13041422090e0013, 0x0022060d19120513, 0x09010608161e0513, 0x0012021a0b090613, 0x0000250605102013, 0x04060d0615002113,
+	0x00040d23190b0814, 0x0a01012719060b14, 0x0a010801192a0b14, 0x130400012b091b14, 0x0014070d0e031d14, 0x0c01011d01061d14,
+	0x0022060d12052014, 0x130406241a060016, 0x1304180625060016, 0x040b040619060017, 0x0b0704060b1c0017, 0x0400210c1e011017,
+	0x0100210d1e041017, 0x0407060c0c011117, 0x0107060d0c041117, 0x0e07050427090018, 0x0a0e050927090018, 0x04150504060d0018,
+	0x04070504280d0018, 0x040a0509280d0018, 0x040128050d010918, 0x000e052702090918, 0x04000502280d0918, 0x0001240502130918,
+	0x04000002180b0919, 0x0c0101180704041b, 0x170c01030301051b, 0x0010070a0301051b, 0x010b070b13010b1b, 0x0112070d0c000a1e,
+	0x0e00050f0c000a1e, 0x010b070d0f000a1e, 0x0904000f0f000a1e, 0x0400000603150b1e, 0x0401091c000b0920, 0x01000d1c140b0920,
+	0x120b07050c000122, 0x0b070b050f000122, 0x0012070512000122, 0x1201060d15001022, 0x01060d1d16001022, 0x1000040d17001022,
+	0x00040d0f23001022, 0x0406060e24011022, 0x01000f0c1e041022, 0x07010d0723041022, 0x0401070823041022, 0x0409000923041022,
+	0x0801000b23041022, 0x0001091423041022, 0x0007001623041022, 0x0409011d00071022, 0x0c011d0c01071022, 0x04001d0b05071022,
+	0x0f0106050f071022, 0x01011c0f0f071022, 0x020105150f071022, 0x130400160f071022, 0x0101021b0f071022, 0x0400021d0f071022,
+	0x01011d0c12071022, 0x1201060d00101022, 0x01060d1d01101022, 0x00060d1b04101022, 0x00060d1f04101022, 0x1304000a09101022,
+	0x1300050d09101022, 0x0101081d0e101022, 0x000700021f101022, 0x0001090422131022, 0x0400060e22131022, 0x04000b06021a1022,
+	0x0001051418040924, 0x0113070118080525, 0x0701080118080525, 0x13040d0619000725, 0x1304010c19000725, 0x010101190a100725,
+	0x1304000819120b25, 0x0b07040615000e25, 0x0b07040615001025, 0x0b07040600171025, 0x0104180608171025, 0x13040e0100091b25,
+	0x0409040600091b25, 0x0c04060c01091b25, 0x1304000111091b25, 0x0104060c12091b25, 0x13040e0106001c25, 0x0409040606001c25,
+	0x01011e01090c1c25, 0x000b070c04031d25, 0x000b070203152125, 0x0e041806070e0026, 0x0b0704060b140026, 0x04060d0615170026,
+	0x13040e0106190026, 0x0409040606190026, 0x01011e0109190c26, 0x0101140a091f0c26, 0x0401060616230c26, 0x13040103001a0e26,
+	0x1304000112000f26, 0x07130400040e1026, 0x04010708021f1026, 0x0b0704060f000e27, 0x000b0702030f2127, 0x0105180b1b060003,
+	0x000f231816070003, 0x03100d0a17070003, 0x01140c1809170003, 0x15061515061b0003, 0x05062215061b0003, 0x080c091c061b0003,
+	0x010023090f1b0003, 0x08060209181b0003, 0x0806020922240003, 0x0a0f100b09260003, 0x0806020924070103, 0x03050d1b060b0103,
+	0x0202190107060603, 0x0801021b07060603, 0x00280d05170b0603, 0x01180905260b0603, 0x0100111806100603, 0x0110001906100603,
+	0x0016020e16100603, 0x0001061b17100603, 0x03100d0a01130803, 0x0a280d0318010903, 0x05280d0518010903, 0x02120f0100190903,
+	0x0212010117190903, 0x09010a0626190903, 0x0001140626190903, 0x050016050d280903, 0x000a090517280903, 0x0806000924081003,
+	0x01000a0924081003, 0x01091818010c1603, 0x0100181b060c1603, 0x01141809010f1603, 0x02091901061d1603, 0x02011607061d1603,
+	0x12011f07061d1603, 0x0801091b061d1603, 0x060801061c0a1a03, 0x00060806200a1a03, 0x0004010d200a1a03, 0x00001d1404102103,
+	0x0100041a00102403, 0x0300140d07102403, 0x000e200d07102403, 0x000e0c1807102403, 0x06000e0a1c102403, 0x000306172604210b,
+	0x0004031423070916, 0x110604001c120b16, 0x000a091a03240b16, 0x040218031b00001d, 0x010c0d051b00001d, 0x040207180310011d,
+	0x05041f160100071d, 0x05011f160600071d, 0x020d18180600071d, 0x021818010c00071d, 0x050403160107091d, 0x0002091816100a1d,
+	0x0500091618040b1d, 0x050716001f050b1d, 0x0002030a1a090b1d, 0x0200181808120b1d, 0x0002081812170b1d, 0x0500091618050f1d,
+	0x00020918100f0f1d, 0x01030f051b00101d, 0x01001a0204091b1d, 0x000b03050e091b1d, 0x000c080d1205201d, 0x0003000f1205201d,
+	0x02071603101a0003, 0x12071f03101a0003, 0x021601091b1a0003, 0x06170f060b1d0003, 0x0006051a171d0003, 0x06021611201d0003,
+	0x04060a1b241d0003, 0x00000d2306100f03, 0x040600241d100f03, 0x000600051d041a03, 0x0a0b06000b0a1a03, 0x0204010a0b0a1a03,
+	0x0100060b160b1a03, 0x0200150d04101e03, 0x00001d0f04102103, 0x000205061b10140d, 0x000a05060e11140d, 0x0006052b12051e0d,
+	0x0100061c0b111e0d, 0x000c1f031c09230d, 0x0a0b06000305290d, 0x0204010a0305290d, 0x030400081105290d, 0x0004030f23070916,
+	0x060401061d150b16, 0x0007012006240b16, 0x06040f061d000e16, 0x020400060d001816, 0x0004032c06071816, 0x0007012c06011d16,
+	0x020700030d032116, 0x061101011d032116, 0x00060f021d032116, 0x01000d0f220c041a, 0x01000a0d230c041a, 0x01010d0d2205081a,
+	0x0701010d2305081a, 0x0006052b12050c1a, 0x0100061c0b110c1a, 0x0006011c2801161a, 0x000603011b0b181a, 0x0200140204091b1a,
+	0x0100250204091b1a, 0x00060e0112052c1a, 0x0406100112052c1a, 0x02021a091a090003, 0x0200231922090003, 0x00060d1a1e110003,
+	0x0116180109150003, 0x0118010315150003, 0x0c000a0d1e1c0003, 0x0200231909070103, 0x001400131e100b03, 0x05140704010e210b,
+	0x020416070600100f, 0x12041f070600100f, 0x031801052605100f, 0x010301050d1b100f, 0x0306050005052918, 0x0100060d0d052918,
+	0x0100060403250b1a, 0x060006030e19101a, 0x060006190322101a, 0x0009000f030a121a, 0x00140e03091e0b1e, 0x00150703161e0b1e,
+	0x000103040a09231e, 0x02121a0112070003, 0x050f23061c070003, 0x00061715161b0003, 0x01101d0100190903, 0x090109061b190903,
+	0x00061605000d1003, 0x0101001809101406, 0x0400200f2200150d, 0x04000a202300150d, 0x01001e0f1a05150d, 0x0100031e1024150d,
+	0x0306001b2710160d, 0x0003061f2710160d, 0x000200181c0b090f, 0x0a01210119060b0f, 0x010301051b250b0f, 0x0a030101192c0b0f,
+	0x0200180f22000c0f, 0x02000a1823000c0f, 0x1506150504000f0f, 0x010409062a091b0f, 0x0d06000511240b16, 0x0100061c12240b16,
+	0x00030f061c021d16, 0x0006061724020b18, 0x050307011a09001a, 0x020d070019050b1a, 0x0516070019050b1a, 0x051104001a090b1a,
+	0x080c00030622101a, 0x030608061700261a, 0x080605001205261a, 0x000905091205261a, 0x0010080c1205261a, 0x000600131205261a,
+	0x0001051b0617101d, 0x00140e03091b0b1e, 0x00150703161b0b1e, 0x00030f0602181d1e, 0x000c080d12051e1e, 0x0003000f12051e1e,
+	0x050f230624070003, 0x020d001e0f0e0003, 0x0516001e0f0e0003, 0x0118010316150003, 0x0209190f06170003, 0x1506151506190003,
+	0x0506221506190003, 0x080c091c06190003, 0x010023090f190003, 0x0806020918190003, 0x00011a06101b0903, 0x0001130516280903,
+	0x00010f0616280903, 0x00010608160c1003, 0x02000f010d1e1603, 0x0004270013061a03, 0x0105100900102003, 0x0806021a00102003,
+	0x000f0c2307102003, 0x000f280d08102003, 0x03000f2809102003, 0x020a09010d102003, 0x02000e010d102003, 0x06000f0d1d102003,
+	0x00041f1201052906, 0x0509050006052906, 0x00011f1206052906, 0x000403121b072906, 0x000306221604210b, 0x000619260405210d,
+	0x00140e060e05210d, 0x000306041a27210d, 0x021701060409100f, 0x020605150122100f, 0x000205061922100f, 0x0504002901011d16,
+	0x0004011c020b1818, 0x01060f1c090b001a, 0x08060500180b051a, 0x00090509180b051a, 0x0010080c180b051a, 0x00060013180b051a,
+	0x020405002305081a, 0x020009170522101a, 0x020417000300261a, 0x000303061a162a1a, 0x020405001805081d, 0x0504160003001e1e,
+	0x000103040e09231e, 0x02121a0117070003, 0x020a0517070d0003, 0x06181005260e0003, 0x03181405260e0003, 0x00060514181d0003,
+	0x0105100500130803, 0x020a05010d130803, 0x03180105260e1603, 0x0006160500271603, 0x0307000d03052906, 0x0001140e03052906,
+	0x00001d1003052906, 0x0204160706000b0f, 0x12041f0706000b0f, 0x020401061d080b0f, 0x0504002901021d16, 0x000906031b280b1a,
+	0x000906031a290b1a, 0x020014031808101a, 0x010025031808101a, 0x000f06031926101a, 0x010007031926101a, 0x020017030700261a,
+	0x0001041f06050b1d, 0x0001051b06180b1d, 0x0001051b0611101d, 0x0500160307001e1e, 0x00060d1a21110003, 0x0c000a0d25170003,
+	0x0c000a0d211c0003, 0x01001813150d0903, 0x0100181506140903, 0x0a0f122307000b03, 0x090606181d000e03, 0x01001117171e0b06,
+	0x000403121b082906, 0x000a09250506210b, 0x000c09270506210b, 0x010009261306210b, 0x010009121e06210b, 0x030409182700130d,
+	0x04000a202200140d, 0x010006240911140d, 0x040720171b00150d, 0x041507202600150d, 0x000420221108150d, 0x000420171308150d,
+	0x0304001227091b0d, 0x060306170f00210d, 0x021507182903000f, 0x020116070905010f, 0x01121f070905010f, 0x020016070312040f,
+	0x00121f070312040f, 0x000218170d05080f, 0x0006151702240b0f, 0x0206051501250b0f, 0x0002050619250b0f, 0x020718171b000c0f,
+	0x0215071826000c0f, 0x0002182211080c0f, 0x0002181713080c0f, 0x01061c152c00100f, 0x0106152c0901100f, 0x0600151b2c05100f,
+	0x0006151f2c05100f, 0x0205280d01091b0f, 0x0002050c2b091b0f, 0x0001091c2b091b0f, 0x0403011b0f04210f, 0x0015060419060b16,
+	0x000209181c150b16, 0x00000d1b04001816, 0x00020a2404001816, 0x00001c2404001816, 0x0002050b1c001816, 0x040200181c001816,
+	0x0010002c04011816, 0x00000d03060f1d16, 0x05100a0701032116, 0x05000d0801032116, 0x0512000e01032116, 0x0506092501032116,
+	0x0200001609032116, 0x020000100d032116, 0x0306002312032116, 0x0500060b1c032116, 0x0005090b1c032116, 0x000c090d1c032116,
+	0x0403000f1c032116, 0x03060023020b1a18, 0x10000a0c0509001a, 0x000617170e0c041a, 0x000613221803051a, 0x0500071a0f09051a,
+	0x030600121809051a, 0x080600141809051a, 0x0200171705090b1a, 0x0200091705250b1a, 0x01000a0d2201161a, 0x0701010d22091b1a,
+	0x080600030610261a, 0x000306170315261a, 0x000718060312041d, 0x050019060302241d, 0x0002091815180b1e, 0x00021603081b0b1e,
+	0x00000a03131b0b1e, 0x0002050b1800181e, 0x040200181800181e, 0x0500060b0318211e, 0x0005090b0318211e, 0x000c090d0318211e,
+	0x0403000f0318211e, 0x000603190e09231e, 0x0110010317170003, 0x1008060a17170003, 0x10000c0f22170003, 0x10000a0c23170003,
+	0x070d060d150b0103, 0x0007280117190903, 0x0c01001c09071a03, 0x0a0615000c0a1a03, 0x0106010c160b1a03, 0x0d06150115002103,
+	0x070d060215002103, 0x0b06000c17102103, 0x090606010c102403, 0x0306001217102403, 0x0806001417102403, 0x030424011c001406,
+	0x0201050d1b101406, 0x0a01050d0e111406, 0x0304170101052906, 0x000c000504052906, 0x0001170504052906, 0x0007032c0206210b,
+	0x00140e08020e210b, 0x0a060101192a0b0f, 0x0c0601161e000c0f, 0x030614000e031d0f, 0x030600031024200f, 0x0009060223010916,
+	0x000604061c150b16, 0x000904061c001816, 0x0504002902001d16, 0x000611011c032116, 0x000907031c032116, 0x0004070204232116,
+	0x0004000205232116, 0x0004082012170b1e, 0x0006040615180b1e, 0x0c01000f031e0b1e, 0x0304011c0700141e, 0x0004200e0410141e,
+	0x080600041710141e, 0x000904061800181e, 0x0f10020109001e1e, 0x0009000f0d051e1e, 0x0001090d13081e1e, 0x000611010318211e,
+	0x000907030318211e, 0x020017030e09231e, 0x050c010e1b060003, 0x051901151b060003, 0x0c001c0f220e0003, 0x0c000a1c230e0003,
+	0x0c000d0f22190003, 0x0c000a0d23190003, 0x0c000a0d1e1b0003, 0x000928060e190903, 0x0016020716100b03, 0x0000211c070b1103,
+	0x0007032c0406210b, 0x00140e08040e210b, 0x00020d180310010f, 0x000225180410010f, 0x000225180005080f, 0x02000a180022100f,
+	0x020018180922100f, 0x020018180826100f, 0x0009060423010916, 0x0504002904001d16, 0x0004070404232116, 0x0004000405232116,
+	0x0006080603052918, 0x0004010d03052918, 0x000306170428101a, 0x030600021a10131a, 0x0306110123001c1a, 0x0003060423051c1a,
+	0x00032806020c1c1a, 0x0100060b0b0d1c1a, 0x0003060e0b0d1c1a, 0x03060106230e1c1a, 0x0a0f122311070003, 0x15061506150a0003,
+	0x0201041d060d0003, 0x130606241a110003, 0x1306180625110003, 0x0118010318150003, 0x0c000d0f22170003, 0x0c000a0d23170003,
+	0x0006130d1e1d0003, 0x021116011a000603, 0x12111f011a000603, 0x0200161a04050603, 0x00121f1a04050603, 0x020116061a0e0603,
+	0x12011f061a0e0603, 0x0100180115130903, 0x00011907160b0a03, 0x0a0f230307000e03, 0x050f230507000e03, 0x0a0f2300070e0e03,
+	0x0019012b07071003, 0x00031b06130a1a03, 0x020104060d001e03, 0x020105091b101406, 0x0a0105090e111406, 0x0004190904222106,
+	0x0307030d00052906, 0x01001d1100052906, 0x03040506190b000d, 0x0c0601161e00150d, 0x010318010105080f, 0x0a06221501000b0f,
+	0x0a030101192a0b0f, 0x0002050613240b16, 0x0100060405250b1a, 0x060006050e19101a, 0x060006190522101a, 0x0009000f050a121a,
+	0x030600041a10131a, 0x010600091a10131a, 0x0f1002010900261a, 0x0009000f0d05261a, 0x0001090d1308261a, 0x00011d0e0610161d,
+	0x0002081812170b1e, 0x0002180e0410141e, 0x050016030e09231e, 0x02121a0119070003, 0x0d14280d09190003, 0x150615060f190003,
+	0x0d06150624190003, 0x0006130d1b1d0003, 0x00032106130a1a03, 0x1306001106102103, 0x0403070119102403, 0x02051901051e0b06,
+	0x0801051b051e0b06, 0x070d06000205290d, 0x03041b010105080f, 0x00011b050405080f, 0x060415062c00100f, 0x000904062b091b0f,
+	0x020714040900200f, 0x080c00050622101a, 0x050007021a22101a, 0x020317060200261a, 0x020017060208261a, 0x08060003100f261a,
+	0x000403061007121d, 0x00000e061205201d, 0x000410061205201d, 0x0503160602001e1e, 0x0500160602081e1e, 0x0200150f1e0d0003,
+	0x0118010312150003, 0x011001031e160003, 0x1008060a1e160003, 0x08060209221b0003, 0x09060611181d0003, 0x080602091b070103,
+	0x0a0f230307000b03, 0x050f230507000b03, 0x0a0f2300070e0b03, 0x000c230507061003, 0x00280d0508061003, 0x0003052809061003,
+	0x0006050d1d061003, 0x080600091b081003, 0x01000a091b081003, 0x0c06160100081503, 0x0200000f0d1d1603, 0x02000f010d211603,
+	0x00000a281805150d, 0x01001e0f1b05150d, 0x010018010205080f, 0x00000d03060e1d16, 0x0801050b020b0918, 0x080c000624020b18,
+	0x050007041a22101a, 0x000603010b0d1c1a, 0x020317060400261a, 0x020417000500261a, 0x0503160604001e1e, 0x0504160005001e1e,
+	0x050c012119060003, 0x02121a0113070003, 0x05021326090e0003, 0x0c06160121120003, 0x03100d0916150003, 0x0504231609170003,
+	0x0504160025170003, 0x03180f0626170003, 0x0102160908190003, 0x0806020923190003, 0x080602091e1b0003, 0x05041600211c0003,
+	0x0606061a171d0003, 0x021715060d000603, 0x011f060e160b0603, 0x011f011d160b0603, 0x0001061316280903, 0x00010608160d1003,
+	0x0000171a070b1103, 0x01150709190b1103, 0x001000100a102403, 0x0307000d05052906, 0x0001140e05052906, 0x00001d1005052906,
+	0x05001903170b090b, 0x030617062700130d, 0x041507200b01150d, 0x11011e011308150d, 0x060306170e00210d, 0x00061d15050b000f,
+	0x010018010405080f, 0x0f041509010b090f, 0x021507180b010c0f, 0x040320011205200f, 0x0403011b0e04210f, 0x011507090b02240f,
+	0x00150a0604001816, 0x0004270013032116, 0x0100061229020b18, 0x0006100603052918, 0x0003140603052918, 0x020417000509001a,
+	0x02041707050b001a, 0x020d070119000b1a, 0x0516070119000b1a, 0x000906051b280b1a, 0x000906051a290b1a, 0x020014051808101a,
+	0x010025051808101a, 0x000f06051926101a, 0x010007051926101a, 0x000907012c0c1c1a, 0x04060101290e1c1a, 0x01060106290e1c1a,
+	0x020017050700261a, 0x020717010a00261a, 0x000013061205201d, 0x0500160507001e1e, 0x050716010a001e1e, 0x0201221b060d0003,
+	0x0105160908190003, 0x0806050923190003, 0x080605091e1b0003, 0x02011b060d070103, 0x0201000d16100603, 0x000401121e101e03,
+	0x0101091f1e101406, 0x001515140407090b, 0x01011e081e10140d, 0x010006240b11140d, 0x11011e021308150d, 0x020116070b05010f,
+	0x01121f070b05010f, 0x0106152c0b01100f, 0x0003010f1a05200f, 0x000303011024200f, 0x0106010e1e101418, 0x0106110e1e10011a,
+	0x020d070219000b1a, 0x0516070219000b1a, 0x0100061c24150b1a, 0x0100061e15100e1a, 0x010601091e10131a, 0x000401031e10171a,
+	0x000907022c0c1c1a, 0x04060102290e1c1a, 0x020717020a00261a, 0x0100060b100f261a, 0x0003060e100f261a, 0x050716020a001e1e,
+	0x02001d1a100e0003, 0x0016020b16100603, 0x001400101e100b03, 0x000023190e071103, 0x00031b06120a1a03, 0x00001d1104102103,
+	0x0002192b0507090b, 0x0016021b0507090d, 0x000021021e10140d, 0x000706020c11140d, 0x00000a271805150d, 0x001507020422210d,
+	0x00020f090205290d, 0x000706150205290d, 0x010a16002b090b0f, 0x0004031123070916, 0x0002050612240b16, 0x00010b19170b0918,
+	0x0007161207020b18, 0x0002160624020b18, 0x0007160402100e18, 0x00010b190b031418, 0x00010b19140b091a, 0x050c010601100a1a,
+	0x00000a150422101a, 0x000701170722101a, 0x00000d040310131a, 0x000025040410131a, 0x00060d1a1e100003, 0x130606241a120003,
+	0x1306180625120003, 0x0a00090f22190003, 0x0a000a0923190003, 0x0a000a091e1b0003, 0x000f180d091c0003, 0x1013060a00100f03,
+	0x0216060a00100f03, 0x0016061c00100f03, 0x00000d1b07100f03, 0x00020a2407100f03, 0x00001c2407100f03, 0x000305250d181603,
+	0x00150a06071a1603, 0x00001d1304102103, 0x00150e050405080f, 0x001505041908100f, 0x0004031323070916, 0x000305030d091816,
+	0x0406020329001c1a, 0x000600020b0d1c1a, 0x04060200290e1c1a, 0x00061a0d0200261a, 0x0103051b0d00131d, 0x0305010d1205201d,
+	0x140e280d09190003, 0x1507280d16190003, 0x0406201516190003, 0x0608150622190003, 0x0a00090f22190003, 0x0a000a0923190003,
+	0x0406071523190003, 0x060e150624190003, 0x0a000a091e1b0003, 0x040607151e1b0003, 0x0006051a171d0003, 0x060819061b1d0003,
+	0x090615061b010103, 0x000926060e190903, 0x080101121e1c0903, 0x080101101e1f0903, 0x020a1a0507000e03, 0x02000d1a07081003,
+	0x040600151b081003, 0x00060015190b1103, 0x0806180500091503, 0x00061505250e1603, 0x02011a0607211603, 0x01001f1209071a03,
+	0x0009061a07072403, 0x08061805000b2603, 0x0307040a00052906, 0x0307050d00052906, 0x010011061c052906, 0x001507290404210b,
+	0x01280d051b00000f, 0x010518010105080f, 0x0106150529000a0f, 0x060415062a00100f, 0x030400012b091b0f, 0x0008280d1205200f,
+	0x060115011c05200f, 0x000600150b02240f, 0x0200090318240b16, 0x0100050c1e001816, 0x000403040d062116, 0x00040f040e062116,
+	0x01001f0f12020b18, 0x00000e1a020b091a, 0x0004101a020b091a, 0x0103060400250b1a, 0x060306000e19101a, 0x060306190022101a,
+	0x000602280910161a, 0x0406040329001c1a, 0x00032606020c1c1a, 0x030601062c0c1c1a, 0x000600040b0d1c1a, 0x04060400290e1c1a,
+	0x01030604000b261a, 0x021706010d0b0803, 0x011e011510130803, 0x01001e0f100a0a03, 0x0217010608070f03, 0x0200160904101e03,
+	0x0200100d04101e03, 0x0206010e08102003, 0x02000f010d102003, 0x0201010d171e0b06, 0x080e0005231e0b06, 0x01011e1c100b090b,
+	0x01011e1c110b090d, 0x0200010f02240b0f, 0x0600021524240b0f, 0x0012070504002c0f, 0x000a120306240b16, 0x050c010306001d16,
+	0x020d000f01020b18, 0x0516000f01020b18, 0x02000d1207020b18, 0x0500161207020b18, 0x02000d0402100e18, 0x0500160402100e18,
+	0x0106011c28001418, 0x000604280910161a, 0x020217010900261a, 0x08060005100f261a, 0x0002050616100a1d, 0x0002160618040b1d,
+	0x000a010619110b1d, 0x0002160618050f1d, 0x00020506100f0f1d, 0x000015061205201d, 0x00001b060404211d, 0x0502160109001e1e,
+	0x01141518090a0003, 0x03180f0624170003, 0x00060513181d0003, 0x001510060a190903, 0x01001f0a160b1003, 0x0015061a07011103,
+	0x0006160500091503, 0x01140018090e1603, 0x00150f06071a1603, 0x000900121e101e03, 0x0007061c13072403, 0x0d0600140a102403,
+	0x0d0600110e102403, 0x03000d0614102403, 0x0106070919102403, 0x00061605000b2603, 0x03041b011c001406, 0x0305000d05052906,
+	0x000412011c052906, 0x000112061c052906, 0x010613051909000d, 0x010109052505080f, 0x010109051b09080f, 0x0600041524240b0f,
+	0x04031e011205200f, 0x001506040a060b16, 0x0c01001c24020b18, 0x0c01001e02100e18, 0x0406100003052918, 0x0403140003052918,
+	0x020d02061900071a, 0x051602061900071a, 0x00010903190b081a, 0x000109280e18101a, 0x0001091a0e23101a, 0x000109280f10161a,
+	0x000900031e10171a, 0x000602062c0c1c1a, 0x000605010b0d1c1a, 0x020417010900261a, 0x020109171100261a, 0x000109031b09261a,
+	0x0101090a100f261a, 0x0504160109001e1e, 0x0501091611001e1e, 0x0509062519060003, 0x0906160625120003, 0x0606051a171d0003,
+	0x09060617181d0003, 0x021715050d000603, 0x011f050e160b0603, 0x011f0120160b0603, 0x011e012d10190903, 0x0001051316280903,
+	0x00010508160d1003, 0x00001b1304102103, 0x0016010e14101406, 0x030617052700130d, 0x01010c180310010f, 0x000222180410010f,
+	0x0806011b1710010f, 0x060115012508050f, 0x000222180005080f, 0x021901010408080f, 0x08011b010408080f, 0x0101091f190b080f,
+	0x0601011524240b0f, 0x0219010100031d0f, 0x08011b0100031d0f, 0x031801010c031d0f, 0x010116090800200f, 0x080601092300200f,
+	0x011621010306210f, 0x080122010306210f, 0x000121040306210f, 0x03160101032c210f, 0x00030104032c210f, 0x00150a0504001816,
+	0x00001903060e1d16, 0x0116210102001818, 0x0801220102001818, 0x0001210402001818, 0x020114021800001a, 0x010125021800001a,
+	0x020108170f0b001a, 0x010f06190b09011a, 0x010107190b09011a, 0x030601101a10011a, 0x020d04061900071a, 0x051604061900071a,
+	0x010906001b280b1a, 0x010906001a290b1a, 0x020114001808101a, 0x010125001808101a, 0x080c01000622101a, 0x050107011a22101a,
+	0x010f06001926101a, 0x010107001926101a, 0x030601011a10131a, 0x010601280910161a, 0x010c01060b091c1a, 0x000604062c0c1c1a,
+	0x0101080d0b0d1c1a, 0x020108170b00261a, 0x020117081000261a, 0x010c0104100b261a, 0x08060100100f261a, 0x00090109100f261a,
+	0x00000f061205201d, 0x0000030e1610141e, 0x050108160b001e1e, 0x0501160810001e1e, 0x1008060b1e160003, 0x00020b041c130903,
+	0x0016020e14101406, 0x000a051c130b090b, 0x00140e03170b090b, 0x03041414000b090d, 0x020a0517000b090d, 0x04140e20000b090d,
+	0x01020c180310010f, 0x0806021b1710010f, 0x0602011524240b0f, 0x010216090800200f, 0x080602092300200f, 0x0002240204001816,
+	0x0510070201032116, 0x08061404120b001a, 0x030602101a10011a, 0x00060903190b081a, 0x080c02000622101a, 0x050207011a22101a,
+	0x030602011a10131a, 0x020217081000261a, 0x000609031b09261a, 0x08060200100f261a, 0x00090209100f261a, 0x000a050612170b1d,
+	0x000415061205201d, 0x00041b060404211d, 0x0502160810001e1e, 0x0012220619070003, 0x001206221e070003, 0x020114040b000603,
+	0x0214080600130803, 0x0200141004100b03, 0x0214000f000e0e03, 0x0003061c1e181603, 0x0003050c1e041a03, 0x02001d0104102103,
+	0x11021e091c00150d, 0x02141e092d00150d, 0x11021e001308150d, 0x020014031b09150d, 0x0204030123070916, 0x070301031e001d16,
+	0x040300031e0e1d16, 0x02000903190b081a, 0x000c02060b091c1a, 0x0002080d0b0d1c1a, 0x080210010900261a, 0x020009031b09261a,
+	0x000c0204100b261a, 0x0002090a100f261a, 0x0201051b0600101d, 0x020000061205201d, 0x0200170f0a180003, 0x0200100f0f180003,
+	0x0503062519180003, 0x140e270d09190003, 0x1507270d16190003, 0x0200120f0a1a0003, 0x02071409171a0003, 0x000f1a0d091c0003,
+	0x020b1706000b0803, 0x0013061c000b1103, 0x0003250018181603, 0x0200150904101e03, 0x02000b1204101e03, 0x1706001206101e03,
+	0x0107001206101e03, 0x020b000f00102003, 0x090606000e102403, 0x0403070018102403, 0x0116000e14101406, 0x0101140e00052906,
+	0x01001d1000052906, 0x010012061c052906, 0x0107032c0106210b, 0x01140e08010e210b, 0x020417060800140d, 0x020417060800150d,
+	0x11041e091c00150d, 0x020003171e00150d, 0x01000a281e00150d, 0x04141e092d00150d, 0x020000171805150d, 0x11041e001308150d,
+	0x000619020422210d, 0x01270d051b00000f, 0x0200091b2a07000f, 0x0114000e1e10010f, 0x000209052505080f, 0x000209051b09080f,
+	0x0002091f190b080f, 0x0200090f2200200f, 0x02000a092300200f, 0x0008270d1205200f, 0x0109060123010916, 0x03000f0318240b16,
+	0x0204000609001816, 0x0006062911021d16, 0x0207000309032116, 0x1706000112032116, 0x0107000112032116, 0x0104070104232116,
+	0x0104000105232116, 0x17060001020b1a18, 0x01070001020b1a18, 0x17060101190c041a, 0x01070101190c041a, 0x03180101230c041a,
+	0x06180101280c041a, 0x0703012301100a1a, 0x0706012801100a1a, 0x000605051b280b1a, 0x000605051a290b1a, 0x010009280e18101a,
+	0x0100091a0e23101a, 0x0109000f000a121a, 0x0c0601000a10161a, 0x010009280f10161a, 0x02000b030410171a, 0x170600030610171a,
+	0x010700030610171a, 0x000c04060b091c1a, 0x02000b03060b1c1a, 0x010907002c0c1c1a, 0x0004080d0b0d1c1a, 0x080410010900261a,
+	0x0109000f1500261a, 0x000c0404100b261a, 0x01090009100f261a, 0x0004090a100f261a, 0x03180101180c041d, 0x0703011801100a1d,
+	0x08050d0506001e1e, 0x0a061211181d0003, 0x0a0603181d000e03, 0x050605181d000e03, 0x0a0600181d0e0e03, 0x05001d0104102103,
+	0x0400091b2a07000f, 0x000409052505080f, 0x000409051b09080f, 0x0004091f190b080f, 0x0400090f2200200f, 0x04000a092300200f,
+	0x0504030123070916, 0x05000903190b081a, 0x0105060400250b1a, 0x060506000e19101a, 0x060506190022101a, 0x050601062c0c1c1a,
+	0x050009031b09261a, 0x01050604000b261a, 0x0501051b0600101d, 0x050000061205201d, 0x010f1f230b070003, 0x05110b1609170003,
+	0x12061501191b0003, 0x0515011500130803, 0x0501152001130803, 0x001d011510130803, 0x0122011510130803, 0x001410060a190903,
+	0x0515000f000a0a03, 0x05000f20010a0a03, 0x00001d0f100a0a03, 0x0100220f100a0a03, 0x0f0b230507000b03, 0x0014061a07011103,
+	0x00140f06071a1603, 0x0100211209071a03, 0x0200040018102403, 0x01111100171e0b06, 0x01001911231e0b06, 0x0501151c000b090b,
+	0x05011c20010b090b, 0x00011d1c100b090b, 0x0101221c100b090b, 0x00011d1c110b090d, 0x0101221c110b090d, 0x110420091c00150d,
+	0x041420092d00150d, 0x110420001308150d, 0x1201280d0310010f, 0x110218000d05080f, 0x110109011c05080f, 0x0100140f190b080f,
+	0x020718001b1c0b0f, 0x1106150002240b0f, 0x0604150601250b0f, 0x0004060619250b0f, 0x110218091c000c0f, 0x021418092d000c0f,
+	0x1102180013080c0f, 0x120601150022100f, 0x0601151d0122100f, 0x0600151b0422100f, 0x0006151f0422100f, 0x00011d061922100f,
+	0x04280d0601091b0f, 0x010014022b091b0f, 0x00040c062b091b0f, 0x0100090f1a05200f, 0x010003091024200f, 0x001406040a060b16,
+	0x00040b061c001816, 0x0011030c06032116, 0x00070b031c032116, 0x0100210f12020b18, 0x0006220412170b18, 0x0206011c28001418,
+	0x110600170e0c041a, 0x060019230e0c041a, 0x02000b03190b081a, 0x0211170005090b1a, 0x0006220412140b1a, 0x0006040b1d290b1a,
+	0x0200020423091b1a, 0x000622040b0c1c1a, 0x040102062c0c1c1a, 0x11010d01070e1c1a, 0x020017030a09261a, 0x02000b031b09261a,
+	0x060519050e002c1a, 0x0200020418091b1d, 0x00010304081b0b1e, 0x0000030f181b0b1e, 0x0000031a0b05141e, 0x00040b061800181e,
+	0x00000b0f0d051e1e, 0x00010b0d13081e1e, 0x050016030a091e1e, 0x00070b030318211e, 0x02051a0513070003, 0x021d1a0119070003,
+	0x0114241a090a0003, 0x0202221b060d0003, 0x02141b09110d0003, 0x020f010317170003, 0x030a0f0125170003, 0x02091409171a0003,
+	0x10061501191b0003, 0x030a0f01211c0003, 0x02021b060d070103, 0x020a27011a000603, 0x0202000d16100603, 0x0200150d17100603,
+	0x021805010d0f0803, 0x021805010d120903, 0x00090526101b0903, 0x00190526070b0b03, 0x020918010d081003, 0x02001b060d081003,
+	0x0023190107081503, 0x0e000d2107102003, 0x0a00092108102003, 0x020006160d102003, 0x030021160d102003, 0x0600210c11102003,
+	0x0e000d2107102403, 0x0a00092108102403, 0x021400070a102403, 0x030021160d102403, 0x0600210c11102403, 0x022104011c001406,
+	0x0014050e05052906, 0x000212061c052906, 0x0f061404000e210b, 0x01071404000e210b, 0x020613051909000d, 0x030600172710130d,
+	0x01011e071024150d, 0x1001280d0310010f, 0x020109052505080f, 0x020109051b09080f, 0x100601150022100f, 0x0006011b1f22100f,
+	0x0512010306001d16, 0x0006051229020b18, 0x060a13010509001a, 0x00070903190b081a, 0x000601230e18101a, 0x000209280e18101a,
+	0x0006011b1522101a, 0x0002091a0e23101a, 0x1306011c0101161a, 0x060a01012201161a, 0x000601230f10161a, 0x000209280f10161a,
+	0x020209171100261a, 0x000709031b09261a, 0x0201090a100f261a, 0x00011f060910171d, 0x051901020600201d, 0x0502091611001e1e,
+	0x000a03011809231e, 0x02121a0617070003, 0x02190612070d0003, 0x0106160908190003, 0x0806060923190003, 0x08060906191b0003,
+	0x080606091e1b0003, 0x0d0615061b010103, 0x00160b061c130903, 0x05062d0f01190903, 0x050026060e190903, 0x000d26060e190903,
+	0x00190616070e0b03, 0x08061a0600061003, 0x0806061d000c1003, 0x0018060f060c1003, 0x03062306001a1603, 0x00160a06071a1603,
+	0x010c2306071a1603, 0x01280d06081a1603, 0x03010628091a1603, 0x0601060d1d1a1603, 0x080c060600072403, 0x0507061a01072403,
+	0x0500061a07072403, 0x000d061a07072403, 0x00160e050405080f, 0x0201091f190b080f, 0x001605041908100f, 0x031801050426100f,
+	0x020214021800001a, 0x010225021800001a, 0x020208170f0b001a, 0x020f06190b09011a, 0x010207190b09011a, 0x020906001b280b1a,
+	0x020906001a290b1a, 0x020214001808101a, 0x010225001808101a, 0x020f06001926101a, 0x010207001926101a, 0x020601280910161a,
+	0x020c01060b091c1a, 0x0201080d0b0d1c1a, 0x020208170b00261a, 0x020c0104100b261a, 0x0018050406120b1d, 0x050208160b001e1e,
+	0x0e08061622160003, 0x0109160908190003, 0x010d160909190003, 0x0806090712190003, 0x0806090923190003, 0x080609091e1b0003,
+	0x09061211181d0003, 0x050315040b000603, 0x051516070b000603, 0x010e100216000603, 0x00181207160e0903, 0x010e090719190903,
+	0x00090720101b0903, 0x00190720070b0b03, 0x090603181d000e03, 0x090600181d0e0e03, 0x05060c01030b1a03, 0x0107070919102403,
+	0x010314040f001406, 0x011416070f001406, 0x01011f090e111406, 0x0014020e0e111406, 0x090218000d052906, 0x0002180a0d052906,
+	0x090109011c052906, 0x030420040800140d, 0x041620070800140d, 0x030420040800150d, 0x041620070800150d, 0x030401241205150d,
+	0x030608170e00210d, 0x15061f1501000b0f, 0x1506150116010b0f, 0x1506150014040b0f, 0x1506001518040b0f, 0x0302180408000c0f,
+	0x0216180708000c0f, 0x0103140406000e0f, 0x0114160706000e0f, 0x1506031522000f0f, 0x1506031507010f0f, 0x1506150014050f0f,
+	0x1506001518050f0f, 0x001200070e031d0f, 0x00060e150e031d0f, 0x00030c040306210f, 0x00160c070306210f, 0x00120c0705002c0f,
+	0x050107011f010916, 0x0015030419060b16, 0x050f000306240b16, 0x0003030604061d16, 0x0001220012032116, 0x0304010212032116,
+	0x030b060402000e18, 0x0b06160702000e18, 0x00030c0402001818, 0x00160c0702001818, 0x00012200020b1a18, 0x03040102020b1a18,
+	0x050707041a01001a, 0x00040903190b081a, 0x0500071a0201091a, 0x000d071a0201091a, 0x0015001a0a020b1a, 0x000303161a08101a,
+	0x0003031a0e16101a, 0x000613050e19101a, 0x000613190522101a, 0x03010d040801161a, 0x01160d070801161a, 0x030604010e01161a,
+	0x061607010e01161a, 0x0d06040701071c1a, 0x030601030f0b1c1a, 0x15060004110c1c1a, 0x00011a01060e1c1a, 0x00012401070e1c1a,
+	0x000409031b09261a, 0x0007030a1b1b0b1e, 0x000903091c1b0b1e, 0x01051a0513070003, 0x081f062416070003, 0x011d1a0119070003,
+	0x0102221b060d0003, 0x0a0f0325070d0003, 0x050f0525070d0003, 0x01141b09110d0003, 0x010f010317170003, 0x000c0f0f22170003,
+	0x000a0c0f23170003, 0x08260111081a0003, 0x00152616081a0003, 0x01091409171a0003, 0x08060624171a0003, 0x0806050b241a0003,
+	0x01021b060d070103, 0x08060523090b0103, 0x0701181a0b090603, 0x0102000d16100603, 0x0100150d17100603, 0x020f010a1b050803,
+	0x011805010d0f0803, 0x0a0f032809010903, 0x050f052809010903, 0x011805010d120903, 0x0118010f1a280903, 0x010918010d081003,
+	0x01001b060d081003, 0x080600241a0c1603, 0x01000a241a0c1603, 0x040100241a1a1603, 0x01010809160b1a03, 0x010006160d102003,
+	0x06001d0104102103, 0x0100040018102403, 0x0805001e051e0b06, 0x012104011c001406, 0x02050c011b101406, 0x0a050c010e111406,
+	0x0f050201190b090b, 0x000407051a09000f, 0x00001e050405080f, 0x0800031e1e080b0f, 0x0a010701192a0b0f, 0x000407051a002c0f,
+	0x0604030123070916, 0x000a090318240b16, 0x06000903190b081a, 0x01000b03190b081a, 0x0111170005090b1a, 0x0100020423091b1a,
+	0x010017030a09261a, 0x060009031b09261a, 0x01000b031b09261a, 0x020218090d07001d, 0x0601051b0600101d, 0x00021f0d0410171d,
+	0x0002050d070b1a1d, 0x000205160d091b1d, 0x0100020418091b1d, 0x02140e090d00201d, 0x021507160d00201d, 0x060000061205201d,
+	0x0f020f0109001e1e, 0x0216222311070003, 0x03141425090e0003, 0x140e2025090e0003, 0x15072025160e0003, 0x030706241a120003,
+	0x0307180625120003, 0x0818062406140003, 0x0823180109140003, 0x071f180310150003, 0x0c00090f22190003, 0x0c000a0923190003,
+	0x0c000a091e1b0003, 0x0310070a00100f03, 0x000d1e2307100f03, 0x00182718080e1603, 0x00002306071a1603, 0x0216000e14101406,
+	0x0201140e00052906, 0x02001d1000052906, 0x020012061c052906, 0x0207032c0106210b, 0x02140e08010e210b, 0x02000a281e00150d,
+	0x0214000e1e10010f, 0x0209060123010916, 0x0204070104232116, 0x0204000105232116, 0x020009280e18101a, 0x0200091a0e23101a,
+	0x0209000f000a121a, 0x020009280f10161a, 0x020907002c0c1c1a, 0x0209000f1500261a, 0x02090009100f261a, 0x00130d0f22170003,
+	0x000a130d23170003, 0x0400170f0a180003, 0x0400100f0f180003, 0x1000090f22190003, 0x00100d0f22190003, 0x10000a0923190003,
+	0x000a100d23190003, 0x0400120f0a1a0003, 0x04071409171a0003, 0x08120109241a0003, 0x10000a091e1b0003, 0x000a100d1e1b0003,
+	0x040b1706000b0803, 0x0001051316280903, 0x010b0700160b0a03, 0x0b07012b00071003, 0x13000d00150b1003, 0x00010508160d1003,
+	0x0007180500091503, 0x000b07120b091e03, 0x0400150904101e03, 0x04000b1204101e03, 0x040b000f00102003, 0x0b060d0515002103,
+	0x04001d0104102103, 0x00071805000b2603, 0x0205010d1b101406, 0x0a05010d0e111406, 0x0713040a00052906, 0x0713050d00052906,
+	0x00031b0d16052906, 0x01140704100e210b, 0x040417060800140d, 0x040417060800150d, 0x040003171e00150d, 0x0b0704062a00150d,
+	0x040000171805150d, 0x011407040e11210d, 0x00040d23190b080f, 0x0a01012719060b0f, 0x0a010801192a0b0f, 0x130400012b091b0f,
+	0x0014070d0e031d0f, 0x0c01011d01061d0f, 0x0022060d1205200f, 0x0404030123070916, 0x0404000609001816, 0x00040d061c001816,
+	0x0407000309032116, 0x00070d031c032116, 0x0801001c24020b18, 0x0801001e02100e18, 0x010607270d10041a, 0x04000903190b081a,
+	0x0c0c010601100a1a, 0x010101191e09111a, 0x000b07030b09171a, 0x04000b030410171a, 0x000904060b091c1a, 0x04000b03060b1c1a,
+	0x040f1a010900261a, 0x030414091600261a, 0x04041a001900261a, 0x07041a010008261a, 0x0404001a0e08261a, 0x040009031b09261a,
+	0x000b07030b0b261a, 0x00090404100b261a, 0x0004091a0c16261a, 0x0401051b0600101d, 0x040000061205201d, 0x04060d061c00141e,
+	0x00040d061800181e, 0x00000d0f0d051e1e, 0x01000d0d13081e1e, 0x00070d030318211e, 0x02041607060d0011, 0x12041f07060d0011,
+	0x02032218061b0011, 0x02081801151b0011, 0x03061901151b0011, 0x0f02180109260011, 0x00120705042a0011, 0x0008280d12240511,
+	0x060115011c240511, 0x001f0d0f051d0012, 0x0304010317260012, 0x071f0d001d100512, 0x0806000924180512, 0x01000a0924180512,
+	0x0101001809100612, 0x0118180601020812, 0x03010d0701102412, 0x000a092518180509, 0x000c092718180509, 0x0106001828101c09,
+	0x0b06000229101c09, 0x0110000602102009, 0x000a12061b10030d, 0x00020f060e11030d, 0x030400230716190d, 0x000606171805270d,
+	0x0100061c100f270d, 0x000604060610270d, 0x010006040120270d, 0x0a0305000d0a1a12, 0x000306160b091e12, 0x02041607060d0013,
+	0x12041f07060d0013, 0x02032218061b0013, 0x02081801151b0013, 0x03061901151b0013, 0x0f02180109260013, 0x00120705042a0013,
+	0x0008280d12240513, 0x060115011c240513, 0x0801020206070c1c, 0x01140c1809021601, 0x0216010709101b01, 0x0202190108070c04,
+	0x0801021b08070c04, 0x011000060f101c04, 0x0806001b14101c04, 0x0200040115101c04, 0x00030d0115101c04, 0x0306001c15101c04,
+	0x02000d0117101c04, 0x000f060a28101c04, 0x0100070a28101c04, 0x000c070d28101c04, 0x000c080d28101c04, 0x0500060b2c101c04,
+	0x0005090b2c101c04, 0x000c090d2c101c04, 0x0403000f2c101c04, 0x02000d03191e0909, 0x05001603191e0909, 0x000604062c0b1709,
+	0x0103060428001b09, 0x0110000603101c09, 0x0110000604102009, 0x000306160b091b11, 0x0304010716002311, 0x020024060d120512,
+	0x0009061a0b090318, 0x00060d010d100318, 0x080600240d100318, 0x00060c011b100318, 0x0501090d1b100318, 0x0406200104110318,
+	0x040615010e110318, 0x0601080d0e110318, 0x050416002400031e, 0x000c0d1f0410031e, 0x050016031f090c1e, 0x000403031709191e,
+	0x020a0b1e12060501, 0x01050c1812070501, 0x060f15011c200501, 0x090615061e200501, 0x020e18011e1c0901, 0x01140c1809041601,
+	0x00061d15030b2201, 0x0307030d04102201, 0x01001d1104102201, 0x02280d0a06180004, 0x020a1a0909180004, 0x1000280d10180004,
+	0x000a2303190a0904, 0x00052305190a0904, 0x010009210b181004, 0x0306010e2a101c04, 0x0100090f2a101c04, 0x0903010618072404,
+	0x0202190107060306, 0x0801021b07060306, 0x00280d05170b0306, 0x01180905260b0306, 0x0100111806100306, 0x0110001906100306,
+	0x0016020e16100306, 0x0001061b17100306, 0x0400200f22160009, 0x04000a2023160009, 0x011506081f180009, 0x0a0b061e12010509,
+	0x01001e0f1a160509, 0x02000d03191b0909, 0x05001603191b0909, 0x0604120628001709, 0x060410062a001709, 0x030414062a001709,
+	0x0100031e16102409, 0x0400200f2200100d, 0x04000a202300100d, 0x01001e0f1a05100d, 0x0100031e1024100d, 0x0118010303150012,
+	0x09061606001e0512, 0x0806011d00102412, 0x0008280d121e0513, 0x060115011c1e0513, 0x0008200d12280513, 0x00080c1812280513,
+	0x0002050c0e062315, 0x0001091c0e062315, 0x030600151a100318, 0x0006001012052718, 0x0003001412052718, 0x010709050416161c,
+	0x0300030d0816161c, 0x0a0105090916161c, 0x0500160503090c1e, 0x0200040f1e0c1601, 0x020a09040c102001, 0x02000e040c102001,
+	0x05170001191e0904, 0x00161501191e0904, 0x00071602191e0904, 0x010109042a1e0904, 0x0200010f1e0d1604, 0x0509280d01101c04,
+	0x0201010d07101c04, 0x0200040116101c04, 0x00030d0116101c04, 0x0306001c16101c04, 0x0009280d17101c04, 0x0600060a2b101c04,
+	0x0500060c2b101c04, 0x0005090c2b101c04, 0x000f060d2b101c04, 0x0100070d2b101c04, 0x080600112b101c04, 0x000900152b101c04,
+	0x020a09010d102004, 0x02000e010d102004, 0x0306002b12101c09, 0x0706010122101c09, 0x0d06000422101c09, 0x0906010601192309,
+	0x02121a0103070012, 0x0304010322160012, 0x0304000116280912, 0x0006011c280b0318, 0x030201062116161c, 0x1506150509110501,
+	0x060e15011e240501, 0x020a0405130c0801, 0x0106150517052301, 0x0012130705240004, 0x00120f0706240004, 0x09060e1506240004,
+	0x020a0105130d0804, 0x0f06040619240009, 0x0107040619240009, 0x010602041d240009, 0x0906010602192309, 0x0015051a07090512,
+	0x0006011c280e0318, 0x030401060a16161c, 0x00031a030e1a161c, 0x02001d0f1c010201, 0x00120607192a0501, 0x03021a0d1a050901,
+	0x05000d1620050901, 0x00020d180d1c0901, 0x020c050d1b1c0901, 0x00020c181b1c0901, 0x0215071829031201, 0x0201160709051301,
+	0x01121f0709051301, 0x0006171526041601, 0x0402180714112301, 0x1000280d19180004, 0x01020c1800180804, 0x0002120f06180804,
+	0x01000c180f180804, 0x01000c1812180904, 0x08002609181b0904, 0x07011809281b0904, 0x0002160b2c1b0904, 0x050400162c1b0904,
+	0x0e00210b191e0904, 0x060109192a1e0904, 0x0200170118070f04, 0x020615010f0d1004, 0x0006001509241004, 0x0200011b11071c04,
+	0x0000121b2a071c04, 0x0806020900062504, 0x0602150b01062504, 0x0102180909062504, 0x00020b0619062504, 0x03021a0d1a000306,
+	0x05000d1620000306, 0x0302000d0c110306, 0x020a00090f110306, 0x020116090f110306, 0x050f150003170306, 0x000218170d161906,
+	0x010514171b060009, 0x040720171b160009, 0x0415072026160009, 0x0106020e21240009, 0x0105141713010809, 0x0004202211160809,
+	0x0004201713160809, 0x0304091828001309, 0x0100061c290b1709, 0x050009291a011c09, 0x00000a1322011c09, 0x0c000a1c2200030d,
+	0x040720171b00100d, 0x041507202600100d, 0x000420221108100d, 0x000420171308100d, 0x01000a1b1e0d0011, 0x0115071e22030111,
+	0x08060016192a0511, 0x0310040a16000911, 0x030400160d2a0911, 0x01000a1e22000e11, 0x020011060d100512, 0x0006161700140512,
+	0x0310040a16000612, 0x01011f1609050612, 0x0305041700130812, 0x02001e040d1b0912, 0x020f052307000b12, 0x0212011a07000e12,
+	0x0301000d1b290913, 0x0402180700112313, 0x000208180a112313, 0x000306190a112313, 0x0517000602180915, 0x0002050c27061615,
+	0x0001091c27061615, 0x0002050c0c062315, 0x0001091c0c062315, 0x000109090d062315, 0x0f10000229090c18, 0x001507151a03021c,
+	0x0002050c100f091c, 0x0001091c100f091c, 0x00000c03101a091c, 0x020105090816161c, 0x010009022516161c, 0x030602231c070201,
+	0x0110180602220801, 0x000c1a061a050901, 0x080614040e221001, 0x0b06012809101b01, 0x00060d101e180004, 0x020004141e180004,
+	0x00030d141e180004, 0x010004251e180004, 0x0212140100180804, 0x050c200100180804, 0x0112250100180804, 0x000109042c1b0904,
+	0x0003200627181604, 0x000320061b221604, 0x0009000f23221604, 0x00060d1000101c04, 0x0200041400101c04, 0x00030d1400101c04,
+	0x0100042500101c04, 0x02000d1408101c04, 0x01000d2508101c04, 0x00060d0118101c04, 0x0806002418101c04, 0x0306020025101c04,
+	0x0606060128101c04, 0x0600120e28101c04, 0x0600060a29101c04, 0x0500060c29101c04, 0x0005090c29101c04, 0x000f060d29101c04,
+	0x0100070d29101c04, 0x0806001129101c04, 0x0009001529101c04, 0x0600100e2a101c04, 0x0300140e2a101c04, 0x000c1a061a000306,
+	0x0a01120d1b100306, 0x0000232004110306, 0x0000172604110306, 0x050026010a110306, 0x000d26010a110306, 0x000c00060c110306,
+	0x000117060c110306, 0x02010f0d0e110306, 0x03041424090a0012, 0x0306011517170012, 0x00001d0204102112, 0x0306000319102412,
+	0x060201151d1b0013, 0x0406031a22280013, 0x0406031a28070113, 0x04061a0014280513, 0x0406001a18280513, 0x0015051a09020913,
+	0x0a0600040e132313, 0x000220010916161c, 0x030600031e16161c, 0x0d0615011c00031e, 0x070d06021c00031e, 0x000c1c0e0410031e,
+	0x080600111410031e, 0x080602011610031e, 0x000210061610031e, 0x000e01060a11031e, 0x01011e031a090c1e, 0x05000d1618070501,
+	0x05031606142c0501, 0x00020d1807100f01, 0x00020d1803101301, 0x0002251804101301, 0x0702181004102201, 0x0702180100112201,
+	0x0702180100102301, 0x01111a091c0d0004, 0x01141a092d0d0004, 0x0200040f1e180004, 0x00030d0f1e180004, 0x0109191a06240004,
+	0x01111a00130d0804, 0x02120f0100180804, 0x01000a180e180804, 0x0200040f00101c04, 0x00030d0f00101c04, 0x02000d0f08101c04,
+	0x03000f0e2a101c04, 0x0504160000062504, 0x0500161f0b090306, 0x0002251800161906, 0x0c0601161e120009, 0x0400200f22150009,
+	0x04000a2023150009, 0x01001e0f1a150509, 0x0400200f22001609, 0x04000a2023001609, 0x030405000b031709, 0x0005021d0b031709,
+	0x040501200b031709, 0x010502220b031709, 0x01041f06080b1709, 0x00012805090b1709, 0x0103060427001b09, 0x000409200e192309,
+	0x0100031e15102409, 0x010a091c1e0f0011, 0x010a001e130f0811, 0x0400200f220e0012, 0x04000a20230e0012, 0x01001e0f0e1a0512,
+	0x00001d0404102112, 0x0100031e0e102412, 0x00021a09020d1615, 0x0110011c07000318, 0x011306021c000318, 0x0106040c26000318,
+	0x0806011c26000318, 0x0204170027000318, 0x020000170b030318, 0x00000d060d100318, 0x00000c061b100318, 0x0004200604110318,
+	0x000415060e110318, 0x0600060d0e110318, 0x000c1f031c090c18, 0x0006011503161918, 0x0f10020109002718, 0x0009000f0d052718,
+	0x0001090d13082718, 0x02001818080b161c, 0x040218000016161c, 0x020318060116161c, 0x000218000716161c, 0x020118010916161c,
+	0x020718000a16161c, 0x000208180b16161c, 0x020018081016161c, 0x000209181116161c, 0x01280d0423050901, 0x0206150a02052301,
+	0x00061d150b240004, 0x021101011d1b0904, 0x0200040118101c04, 0x00030d0118101c04, 0x0306001c18101c04, 0x01280d0423000306,
+	0x01000c180d100306, 0x0a0112091b100306, 0x02010f090e110306, 0x0103180101161906, 0x0c0601161e160009, 0x0106190d1d240009,
+	0x001505041a081609, 0x000502200b031709, 0x0110000605101c09, 0x0c0601161e00100d, 0x020f052311070012, 0x15061505040a0012,
+	0x020716001a080512, 0x12071f001a080512, 0x0f02180109280013, 0x0005060602182315, 0x000a250e04100318, 0x000c270e04100318,
+	0x000a1a0e0410031e, 0x060f15011c240501, 0x090615061e240501, 0x050f180602260801, 0x0206150a04052301, 0x0016010f191e0904,
+	0x000615050d091504, 0x000f280d08101c04, 0x0001061b09101c04, 0x0500060b29101c04, 0x0005090b29101c04, 0x000c090d29101c04,
+	0x0403000f29101c04, 0x000106062b101c04, 0x0b06000b2b101c04, 0x0006060e2b101c04, 0x0009000f2b101c04, 0x0903010610012504,
+	0x000615050d0b2604, 0x00011b051b0b0306, 0x0001061b14100306, 0x03041b0101161906, 0x00011b0504161906, 0x0304142409150009,
+	0x02001403181e0909, 0x01002503181e0909, 0x0304142409001609, 0x00060406290b1709, 0x0a0b0600040a1a09, 0x0204010a040a1a09,
+	0x01000616040b1a09, 0x0003062812101c09, 0x03041424090e0012, 0x0118010305150012, 0x0207140409190012, 0x0009040627061615,
+	0x000904060c062315, 0x090301061601021c, 0x00090406100f091c, 0x040303012216161c, 0x0500160505090c1e, 0x060e15011c240501,
+	0x00060315240b1101, 0x0200040f210c1601, 0x01180102061c1601, 0x0306021c22180004, 0x0306021c18070104, 0x021201010b180804,
+	0x01000c180e180804, 0x0200040108181004, 0x00030d0108181004, 0x0306001c08181004, 0x0200010f210d1604, 0x00031b0619221604,
+	0x0009000f1f221604, 0x000e280d08101c04, 0x0200040112101c04, 0x00030d0112101c04, 0x0306001c12101c04, 0x0100180102161906,
+	0x0100110f1f240009, 0x00000a2818160509, 0x01001e0f1b160509, 0x0c06011608011009, 0x00000a281805100d, 0x01001e0f1b05100d,
+	0x01000f0a1e220011, 0x01000a111e220011, 0x02121a0105070012, 0x0212011a11070012, 0x0200030f1b0d0012, 0x030601151e160012,
+	0x0c06160100060412, 0x080600091b180512, 0x01000a091b180512, 0x000603151e0b0113, 0x030600151b100318, 0x080c030109002718,
+	0x03060003100f2718, 0x00000f0a0218161c, 0x00000a110218161c, 0x050615061a240501, 0x0a0f1001060a0a01, 0x00061d15050b1201,
+	0x01180104061c1601, 0x0406150127201601, 0x0106150627201601, 0x0100112c09101b01, 0x0100112309102201, 0x0306021c1e180004,
+	0x0002120e06180804, 0x021201010f180804, 0x0c0117062b0a0904, 0x0212010112180904, 0x00011419080b0c04, 0x020615010e0d1004,
+	0x000615250d0b1104, 0x020017010c181604, 0x0306021c00101c04, 0x0201280d08101c04, 0x0016020e09101c04, 0x02000d0118101c04,
+	0x0302010e2a101c04, 0x010018011b0b0306, 0x0016020e14100306, 0x020a00090e110306, 0x020116090e110306, 0x070118090b150306,
+	0x0100180104161906, 0x04150720160b0109, 0x11011e0113160809, 0x0306170628001309, 0x01000617040b1a09, 0x041507200b01100d,
+	0x11011e011308100d, 0x0115070b1e220011, 0x0107061b1e220011, 0x0003250d12260511, 0x0100061e13220811, 0x0304062608160012,
+	0x000c232507120512, 0x00280d2508120512, 0x0003252809120512, 0x0403200119120512, 0x0006250d1d120512, 0x0006191c0a0b0213,
+	0x000c15000b030318, 0x000115170b030318, 0x0200140109100318, 0x0100250109100318, 0x0015070b0218161c, 0x0007061b0218161c,
+	0x00031a050e1a161c, 0x01001a010910031e, 0x0403200f1c070201, 0x0a0f1002060a0a01, 0x020116070b051301, 0x01121f070b051301,
+	0x0406150227201601, 0x010011071e101b01, 0x0306051c1e180004, 0x00031e0f0f240004, 0x0007161908070c04, 0x0200160717070c04,
+	0x00121f0717070c04, 0x000600150b241004, 0x000615220d071504, 0x0306051c00101c04, 0x0501280d08101c04, 0x0016050e09101c04,
+	0x000f060a25101c04, 0x0100070a25101c04, 0x000c070d25101c04, 0x000c080d25101c04, 0x000c080d29101c04, 0x0003000f29101c04,
+	0x0305010e2a101c04, 0x0003130110072504, 0x0016050e14100306, 0x02001204070c1906, 0x000e1f05070c1906, 0x11011e0213160809,
+	0x000f061a04071a09, 0x0100071a04071a09, 0x0100061e10101b09, 0x11011e021308100d, 0x0006191d0a070211, 0x000420061c070211,
+	0x000401031e101b11, 0x0003010f191a0512, 0x01011f160b050612, 0x0003030119102412, 0x000906021e070c15, 0x0001090b0d062315,
+	0x000401141e100318, 0x001507120d07021c, 0x000313011607021c, 0x000303011e16161c, 0x021702060b0f0801, 0x0212020119110901,
+	0x021202011a071601, 0x0200020f0f102001, 0x0302021016102201, 0x030e02010a112201, 0x030e02010a102301, 0x0503131706240004,
+	0x00021c0a05180804, 0x0517000a09101c04, 0x0517000a14100306, 0x0016020f16100306, 0x050c011e06180009, 0x050114092a1d0009,
+	0x0016021b07070209, 0x0000231911070209, 0x0517091818010509, 0x0a0f230003150509, 0x0a031a001a150509, 0x00000a2718160509,
+	0x0500092818180509, 0x0107032328001709, 0x01070023280e1709, 0x050c010006101c09, 0x0007160404101e09, 0x0002020610072509,
+	0x001400171e10030d, 0x00000a271805100d, 0x000a03021a09190d, 0x000505021a09190d, 0x010a091c1d0f0011, 0x010a001d130f0811,
+	0x0a0f23000e030512, 0x0a031a000e1a0512, 0x0209190206230013, 0x000303061e0e1b15, 0x07031a0127000318, 0x00031a06270e0318,
+	0x010a16000a06161c, 0x0100090f1a240501, 0x021704060b0f0801, 0x0212040119110901, 0x021204011a071601, 0x0200040f0f102001,
+	0x0302041016102201, 0x030e04010a112201, 0x030e04010a102301, 0x0100030924102401, 0x0114090600180804, 0x0015060e09101c04,
+	0x0306001b18101c04, 0x00150e051b0b0306, 0x0300240d0d100306, 0x0015060e14100306, 0x00150e0504161906, 0x130614040e011009,
+	0x0006020519091209, 0x0906020627001709, 0x0906020600192309, 0x000602050f192309, 0x0a030125190d0012, 0x130602061e160012,
+	0x0d06010222160012, 0x0209190406230013, 0x0500011e02180915, 0x000d011e02180915, 0x000201091818161c, 0x03070d010410031e,
+	0x03000d070d10031e, 0x0006150d142c0501, 0x00060c15182c0501, 0x010e18011a050901, 0x01280d041f050901, 0x01280d051b180901,
+	0x0310040a06100f01, 0x01280d051b001201, 0x000a280d1e041601, 0x00060d151e041601, 0x020605150c2c1601, 0x060415060a0b2201,
+	0x06021506210e2201, 0x05061b1506240004, 0x0906150607240004, 0x09280d0600180804, 0x00280d050f180804, 0x00280d0512180904,
+	0x0009280d08181004, 0x0110000a09101c04, 0x0009280d12101c04, 0x080600132b101c04, 0x0706150100062504, 0x010e18011a000306,
+	0x01280d041f000306, 0x0110000a14100306, 0x0801050a0b150306, 0x0105180101161906, 0x0310040a1b060009, 0x0304142209150009,
+	0x0106190d21240009, 0x0110091818010509, 0x0200092318180509, 0x0310040a13010809, 0x0006040519091209, 0x0304142209001609,
+	0x0906040627001709, 0x00012605090b1709, 0x0003062815101c09, 0x0906040600192309, 0x000604050f192309, 0x01030604001b280d,
+	0x03041422090e0012, 0x04060315221b0012, 0x040603151b070112, 0x02001b070d120512, 0x0008280d19120512, 0x040615001b140512,
+	0x02000d1a07180512, 0x040600151b180512, 0x06011501191c0512, 0x060201151c1b0013, 0x03060115201b0013, 0x0304000127061615,
+	0x00040806270d1615, 0x0d060101021e1615, 0x030400010c062315, 0x000408060c0d2315, 0x0106040c28000318, 0x0806011c28000318,
+	0x03040001100f091c, 0x021704060b0c0801, 0x0200040f0c102001, 0x021701060b0d0804, 0x080119011e170904, 0x02060a0108101c04,
+	0x0517000e09101c04, 0x0200010f0d102004, 0x0517000e14100306, 0x000a0b120e110306, 0x0a061e0112150509, 0x0a060101270e1709,
+	0x0200020823101c09, 0x02000d0404101e09, 0x0500160404101e09, 0x020605010e192309, 0x01001e0f220e030d, 0x01011e0d1323060d,
+	0x0a061e010e120512, 0x060401151c1b0013, 0x0106011c1c002213, 0x13060101021e1615, 0x020305011116161c, 0x0108280d12240501,
+	0x0006150d1a240501, 0x0f0318060d260501, 0x001207060a2a0501, 0x011518011c050901, 0x01280d0517120901, 0x000e0506192a0901,
+	0x0109280d20100f01, 0x0100141c060b1101, 0x00060515240b1101, 0x060215062c0e1b01, 0x06021506230e2201, 0x02060a15040e2301,
+	0x00061c15040e2301, 0x05031e1606240004, 0x150a090600180804, 0x000c1c0600180804, 0x0016021908070c04, 0x031801010a241004,
+	0x02010d0108101c04, 0x0806001b18101c04, 0x0007120610012504, 0x011518011c000306, 0x010518090b150306, 0x0101090525161906,
+	0x020f100927040009, 0x0106010519091209, 0x0200040823101c09, 0x0c01001e04101e09, 0x010601050f192309, 0x1306000515102409,
+	0x0c0100240b11030d, 0x0d0600230216190d, 0x011409101e220011, 0x0104091c1e220011, 0x0104001e13220811, 0x000900031e101b11,
+	0x0304141b090a0012, 0x0304062408160012, 0x04031e0119120512, 0x130600050e102412, 0x0202160706230013, 0x12021f0706230013,
+	0x000605151e0b0113, 0x0b06011c28000318, 0x0000130e1e100318, 0x000900141e100318, 0x000712061601021c, 0x010109050d16091c,
+	0x001409100218161c, 0x0004091c0218161c, 0x0501160500090c1e, 0x080c230106060401, 0x080c1c0107060401, 0x1506150616110501,
+	0x0f0218010b260801, 0x080c1c0124050901, 0x01010c1807100f01, 0x090409092c100f01, 0x03041a0106061001, 0x0304011d0c061001,
+	0x01010c1803101301, 0x0002221804101301, 0x0806011b17101301, 0x0106152c04051b01, 0x060415062c0e1b01, 0x010c0d2804101b01,
+	0x010a092c04101b01, 0x0106152304052201, 0x06041506230e2201, 0x010a092304102201, 0x0509060619022301, 0x0a060a15040e2301,
+	0x00061a15040e2301, 0x0006150404172301, 0x0004120e16180804, 0x0c0117052b0a0904, 0x02190101171b0904, 0x08011b01171b0904,
+	0x0003190108181004, 0x0100092118071504, 0x0003190112101c04, 0x0d06150100062504, 0x0018120109062504, 0x0100140910072504,
+	0x080c1c0124000306, 0x00041f120e110306, 0x0002221800161906, 0x0a0f100927040009, 0x0306170528001309, 0x0110010600101c09,
+	0x0100062815101c09, 0x0201010823101c09, 0x0110010601102009, 0x010c0104101b280d, 0x011601081e220011, 0x010004081e220011,
+	0x030601161e160012, 0x0101160908190012, 0x0806010923190012, 0x080601091e1b0012, 0x0106010e1b1d0012, 0x0015061a07160512,
+	0x0000240404101e12, 0x0204160706230013, 0x12041f0706230013, 0x010c01060b091b15, 0x080c030100082718, 0x0009001b0f07021c,
+	0x010014091607021c, 0x001601080218161c, 0x000004080218161c, 0x01031a000e1a161c, 0x02060f150a0b0201, 0x0608280d12240501,
+	0x02280d0416050901, 0x010211041b0a0901, 0x01020c1807100f01, 0x01020c1803101301, 0x0806021b17101301, 0x02061a150b041601,
+	0x02060f150d0b0104, 0x020119090e180804, 0x020319010c181604, 0x02060d0108101c04, 0x02280d0416000306, 0x00020b042c0b0306,
+	0x0200280d04110306, 0x0201210413040909, 0x000a05130b031709, 0x0110020600101c09, 0x0202010823101c09, 0x0110020601102009,
+	0x020401240411030d, 0x0310040216000911, 0x0102160908190012, 0x0806020923190012, 0x080602091e1b0012, 0x0310040216000612,
+	0x0106140b1c2c0013, 0x01140e0d0b030318, 0x0a0305010b16161c, 0x020114040f050901, 0x00021a0606061001, 0x0002061d0c061001,
+	0x020004111e180004, 0x00030d111e180004, 0x0212110100180804, 0x0200041100101c04, 0x00030d1100101c04, 0x02000d1108101c04,
+	0x0216000e09101c04, 0x0300110e2a101c04, 0x020114040f000306, 0x0216000e14100306, 0x0214000f18040009, 0x0201140d1b060009,
+	0x11021e091c160009, 0x02141e092d160009, 0x0214000f0d010509, 0x0201140d13010809, 0x11021e0013160809, 0x020014031b160909,
+	0x020014170410030d, 0x11021e091c00100d, 0x02141e092d00100d, 0x11021e001308100d, 0x020014031b09100d, 0x000c0204101b280d,
+	0x0802091b06230013, 0x000c02060b091b15, 0x020b061718060501, 0x01270d041f050901, 0x0218090526120901, 0x01270d051b180901,
+	0x02010b1c06100f01, 0x020b040606061001, 0x00041a0606061001, 0x0004061d0c061001, 0x01270d051b001201, 0x0200091b2a071201,
+	0x0114000e1e101301, 0x000a270d1e041601, 0x02010b0406012001, 0x020709051b0b2201, 0x0200090f250e2201, 0x0102092104102201,
+	0x0206070914102201, 0x0902090600112201, 0x020014090b112201, 0x01020a0619052301, 0x0902090600102301, 0x020014090b102301,
+	0x020004131e180004, 0x00030d131e180004, 0x000613170d240004, 0x0212130100180804, 0x09270d0600180804, 0x00270d050f180804,
+	0x00270d0512180904, 0x0009270d08181004, 0x0200041300101c04, 0x00030d1300101c04, 0x02000d1308101c04, 0x0100120909101c04,
+	0x0009270d12101c04, 0x0207000718101c04, 0x0300130e2a101c04, 0x01270d041f000306, 0x010021090d100306, 0x0100120914100306,
+	0x0805000d0b150306, 0x0002090525161906, 0x0204170608160009, 0x11041e091c160009, 0x020003171e160009, 0x01000a281e160009,
+	0x04141e092d160009, 0x02030a0223180009, 0x0703011e23180009, 0x02060a0228180009, 0x0706011e28180009, 0x0a0f250003150509,
+	0x0200001718160509, 0x03000f2318180509, 0x06000f2818180509, 0x11041e0013160809, 0x0106001a1d101309, 0x0c06011801101c09,
+	0x1706000215101c09, 0x0107000215101c09, 0x0703010023101c09, 0x03000e0523101c09, 0x0706010028101c09, 0x06000e0528101c09,
+	0x020b17050800030d, 0x020417060800100d, 0x11041e091c00100d, 0x020003171e00100d, 0x01000a281e00100d, 0x04141e092d00100d,
+	0x020000171805100d, 0x11041e001308100d, 0x000c0404101b280d, 0x000300181c0b0211, 0x02000b0304101b11, 0x1706000306101b11,
+	0x0107000306101b11, 0x0200090f22190012, 0x02000a0923190012, 0x02000a091e1b0012, 0x0a0f25000e030512, 0x0008270d19120512,
+	0x0a030500090a1a12, 0x01001d0104102112, 0x0804091b06230013, 0x000602021e070c15, 0x000c04060b091b15, 0x02000b03060b1b15,
+	0x02000b1404100318, 0x1706001406100318, 0x0107001406100318, 0x000209050d16091c, 0x0418090526120901, 0x0400091b2a071201,
+	0x040709051b0b2201, 0x0400090f250e2201, 0x0104092104102201, 0x0406070914102201, 0x0904090600112201, 0x040014090b112201,
+	0x0904090600102301, 0x040014090b102301, 0x0516000e09101c04, 0x0516000e14100306, 0x0004090525161906, 0x00060323280b1709,
+	0x0005062815101c09, 0x01050604001b280d, 0x0006001d12240511, 0x0400090f22190012, 0x04000a0923190012, 0x04000a091e1b0012,
+	0x02060511181d0012, 0x05060115201b0013, 0x0d06011c28000318, 0x000409050d16091c, 0x060815061a240501, 0x0a00090f1a240501,
+	0x061015011c240501, 0x021118011b1c0901, 0x0c040d061b1c0901, 0x1201280d07100f01, 0x1201280d03101301, 0x12061501030e2201,
+	0x0112110100112201, 0x1206150112012301, 0x010900190b0d2301, 0x0112110100102301, 0x0a00030924102401, 0x0c001e0d0f240004,
+	0x140a090600180804, 0x00010b042c1b0904, 0x00000b0f23221604, 0x00280d0f01101c04, 0x0010280d08101c04, 0x0000150b29101c04,
+	0x0c00000d29101c04, 0x00030d0f29101c04, 0x00000c0f2b101c04, 0x0100130910072504, 0x06011b090e110306, 0x110218000d161906,
+	0x110109011c161906, 0x110420091c160009, 0x041420092d160009, 0x0100100f1f240009, 0x1104200013160809, 0x00001d0f220e030d,
+	0x0100220f220e030d, 0x00011d0d1323060d, 0x0101220d1323060d, 0x110420091c00100d, 0x041420092d00100d, 0x110420001308100d,
+	0x0100090f191a0512, 0x0114011500130812, 0x0020011505130812, 0x011201001e190912, 0x0114000f000a0a12, 0x0000200f050a0a12,
+	0x0f04230607000b12, 0x0100030919102412, 0x11060e1501230013, 0x060115061b1e0513, 0x0206011c1c002213, 0x0100140227061615,
+	0x00040c0627061615, 0x010014020c062315, 0x00040c060c062315, 0x0100140d0e062315, 0x0106011a0b090318, 0x010013091607021c,
+	0x01001402100f091c, 0x00040c06100f091c, 0x00110301101a091c, 0x010409060816161c, 0x010003091e16161c, 0x0708280d12240501,
+	0x061415011c240501, 0x021804050f0c0801, 0x02180f0602220801, 0x01241a011c050901, 0x02180405120c0901, 0x02280d0517120901,
+	0x1001280d07100f01, 0x0209280d20100f01, 0x02091804080c1001, 0x1001280d03101301, 0x10061501030e2201, 0x0110110100112201,
+	0x1006150112012301, 0x0110110100102301, 0x021801050f0d0804, 0x021701010b180804, 0x020501050f180804, 0x02180105120d0904,
+	0x0205010512180904, 0x00140519080b0c04, 0x02091801080d1004, 0x0205090108181004, 0x0014062419081604, 0x0014090619221604,
+	0x02070d0108101c04, 0x0014280d08101c04, 0x020d000a09101c04, 0x0516000a09101c04, 0x001f160d09101c04, 0x0011280d09101c04,
+	0x0205090112101c04, 0x0209000718101c04, 0x01241a011c000306, 0x020d000a14100306, 0x0516000a14100306, 0x001f160d14100306,
+	0x0011280d14100306, 0x021401010a110306, 0x0201090525161906, 0x020d091818010509, 0x0516091818010509, 0x0206010519091209,
+	0x0306001728101309, 0x00060517040b1a09, 0x1306001504101c09, 0x0600132105101c09, 0x020601050f192309, 0x01011e0716102409,
+	0x01011e071024100d, 0x061901021d240011, 0x010a1b011e000911, 0x010a011e01220911, 0x02171a0105070012, 0x0201171a11070012,
+	0x02142104090a0012, 0x02142109050d0012, 0x0023190107060412, 0x020918010d180512, 0x02001b060d180512, 0x010a1b011e000612,
+	0x011001001e190912, 0x02180106021e0813, 0x0214011c07000318, 0x0125011c07000318, 0x1306011c15000318, 0x0806011c28000318,
+	0x020109050d16091c, 0x000a01020d18091c, 0x030101022516161c, 0x011a011c0700031e, 0x0502160500090c1e, 0x060e15061e240501,
+	0x16280d0616050901, 0x011611061b0a0901, 0x0207040619110901, 0x020704061a071601, 0x040609061a2c1601, 0x0206152c04051b01,
+	0x020c0d2804101b01, 0x020a092c04101b01, 0x0206152304052201, 0x08060906030e2201, 0x020a092304102201, 0x0804090600112201,
+	0x0806090612012301, 0x0804090600102301, 0x03061c0619180004, 0x0306061c1e180004, 0x0d06150607240004, 0x030614060e240004,
+	0x0d280d0600180804, 0x021209010c181604, 0x0306061c00101c04, 0x0601280d08101c04, 0x0016060e09101c04, 0x0306010e2a101c04,
+	0x030e010610012504, 0x16280d0616000306, 0x021901060d070306, 0x08011b060d070306, 0x00160e051b0b0306, 0x00160b062c0b0306,
+	0x0016060e14100306, 0x00160e0504161906, 0x0116210613040909, 0x0801220613040909, 0x0d06040627001709, 0x00060603280e1709,
+	0x0200062815101c09, 0x0d06040600192309, 0x020c0104101b280d, 0x08060504162a0011, 0x03130600021e1615, 0x020c01060b091b15,
+	0x0006061c280e0318, 0x030e01061601021c, 0x03180105040b161c, 0x030105041016161c, 0x02031a000e1a161c, 0x03010f061007031e,
+	0x1007280d12240501, 0x0408280d12240501, 0x00120703192a0501, 0x050315040f050901, 0x051516070f050901, 0x0103140406040a01,
+	0x0114160706040a01, 0x001203072a071101, 0x060215070f081501, 0x02030b0406012001, 0x020b160706012001, 0x0306091c1e180004,
+	0x0118090716170904, 0x060115070d081504, 0x0d06150700071c04, 0x0018120709071c04, 0x0306091c00101c04, 0x020a0a0108101c04,
+	0x02040d0108101c04, 0x0901280d08101c04, 0x0016090e09101c04, 0x0c00070d29101c04, 0x00030a0f29101c04, 0x0309010e2a101c04,
+	0x050315040f000306, 0x051516070f000306, 0x0018120714070306, 0x0016090e14100306, 0x05011b090e110306, 0x030d000d0e110306,
+	0x00010e190e110306, 0x030b06041d040009, 0x0b0616071d040009, 0x0304200408160009, 0x0416200708160009, 0x011500191f180009,
+	0x0304012412160509, 0x010d071f00180809, 0x0115001f0e180809, 0x0103140416010909, 0x0114160716010909, 0x000314031a1e0909,
+	0x0103140406001309, 0x0114160706001309, 0x030420001a071609, 0x030b060400011c09, 0x0b06160700011c09, 0x0003130408011c09,
+	0x0016130708011c09, 0x030b060404001e09, 0x0b06160704001e09, 0x030b060401012009, 0x0b06160701012009, 0x030c1c040800030d,
+	0x0c161c070800030d, 0x090420001323060d, 0x0004200a1323060d, 0x030420040800100d, 0x041620070800100d, 0x030401241205100d,
+	0x010314040b000911, 0x011416070b000911, 0x00030c2407120512, 0x010314040b000612, 0x011416070b000612, 0x0015000d04061a12,
+	0x00011a01060e1b15, 0x080c000701030318, 0x0801170701030318, 0x0306011a04050318, 0x0003131a0e050318, 0x0601100710070318,
+	0x0301140710070318, 0x0006100d0e110318, 0x0003140d0e110318, 0x000313031a090c18, 0x0f0409000016161c, 0x010209092116161c,
+	0x010307092216161c, 0x000218090d16191e, 0x011804050f0c0801, 0x01180f0602220801, 0x01180405120c0901, 0x01091804080c1001,
+	0x000407051a091201, 0x001e0504061c1601, 0x000407051a0f2301, 0x011801050f0d0804, 0x011701010b180804, 0x010501050f180804,
+	0x01180105120d0904, 0x0105010512180904, 0x01091801080d1004, 0x0105090108181004, 0x01070d0108101c04, 0x010d000a09101c04,
+	0x0616000e09101c04, 0x0006001e09101c04, 0x0105090112101c04, 0x0109000718101c04, 0x00010d0718101c04, 0x00001e051b0b0306,
+	0x010d000a14100306, 0x0616000e14100306, 0x0006001e14100306, 0x0a120c011b100306, 0x011401010a110306, 0x020f0c010e110306,
+	0x00001e0504161906, 0x010d091818010509, 0x000a092318180509, 0x080526011a000911, 0x00040c1a04102211, 0x01171a0105070012,
+	0x0101171a11070012, 0x001f210f05090012, 0x0a0f070125090012, 0x01142104090a0012, 0x01142109050d0012, 0x071f210009100512,
+	0x0f0301061b140512, 0x010918010d180512, 0x01001b060d180512, 0x080526011a000612, 0x0c0407010e230013, 0x0419070115230013,
+	0x01180106021e0813, 0x0114011c07000318, 0x0f02140109002718, 0x080318011e170901, 0x0214000e1e101301, 0x02020a0619052301,
+	0x0f27180109180004, 0x0427180019180004, 0x0809151806240004, 0x0c000f180f240004, 0x0727180100180804, 0x040027180e180804,
+	0x080018011e170904, 0x000927180c181604, 0x000c181a0b090306, 0x02000a281e160009, 0x0008202512150509, 0x030714040e011009,
+	0x02000a281e00100d, 0x000820250e120512, 0x02001d0104102112, 0x040b061718060501, 0x0f040d061b1c0901, 0x1013040a06100f01,
+	0x0216040a06100f01, 0x0016041c06100f01, 0x04010b1c06100f01, 0x040b040606061001, 0x04010b0406012001, 0x04060d061d0b2201,
+	0x1201060d0d102201, 0x17060d06040b2301, 0x1201060d11102401, 0x14060d0619180004, 0x1406060d1e180004, 0x040004131e180004,
+	0x0f12150706240004, 0x0c03131706240004, 0x0213070d0a240004, 0x0f001e0d0f240004, 0x0412130100180804, 0x01000d042c1b0904,
+	0x0b0701061f221604, 0x010313061f221604, 0x00000d0f23221604, 0x1406060d00101c04, 0x0400041300101c04, 0x04000d1308101c04,
+	0x170c000a09101c04, 0x0416000e09101c04, 0x00060d2811101c04, 0x00060d2815101c04, 0x0407000718101c04, 0x00010d0818101c04,
+	0x0002070d25101c04, 0x0f00000d29101c04, 0x0000150d29101c04, 0x000700132b101c04, 0x09011b061c0e0306, 0x0000241a0d100306,
+	0x170c000a14100306, 0x0416000e14100306, 0x0a12010d1b100306, 0x020f010d0e110306, 0x1013040a1b060009, 0x0216040a1b060009,
+	0x1304142209150009, 0x0404170608160009, 0x040003171e160009, 0x0b0704062a160009, 0x0c0c011e06180009, 0x010c14092a1d0009,
+	0x170c091818010509, 0x0400001718160509, 0x000c092818180509, 0x1013040a13010809, 0x0216040a13010809, 0x010418061b110909,
+	0x1304142209001609, 0x01000f221e051609, 0x01000a231e051609, 0x0101051e0b031709, 0x0c0c010006101c09, 0x0004062812101c09,
+	0x0801001e04101e09, 0x0b07040600042509, 0x0104180608042509, 0x040b17050800030d, 0x080100240b11030d, 0x010206180717030d,
+	0x00041a050912060d, 0x09041a060023060d, 0x00041a050f23060d, 0x040417060800100d, 0x040003171e00100d, 0x0b0704062a00100d,
+	0x040000171805100d, 0x000b07030b1b280d, 0x00090404101b280d, 0x000b07030b091b11, 0x04000b0304101b11, 0x13041422090e0012,
+	0x0022060d19120512, 0x09010608161e0512, 0x0012021a0b090612, 0x0000250605102012, 0x04060d0615002112, 0x16040306201b0013,
+	0x01140d09212a0013, 0x00091a0d18280513, 0x000e011e02180915, 0x1304000127061615, 0x000904060b091b15, 0x04000b03060b1b15,
+	0x130400010c062315, 0x000b07140b090318, 0x000b2502080b0318, 0x000b0702290b0318, 0x0007250104100318, 0x04000b1404100318,
+	0x000025070d100318, 0x000b250317090c18, 0x13040001100f091c, 0x0b060d051c00031e, 0x000b1a02080b031e, 0x00071a010410031e,
+	0x00001a070d10031e, 0x000b1a0317090c1e, 0x0012130705280100, 0x00120f0706280100, 0x09060e1506280100, 0x0512000318070600,
+	0x001f0d0f051d0c00, 0x0304010317260c00, 0x0a280d0118070e00, 0x04060720260d1000, 0x0301230d06131000, 0x0101180609141000,
+	0x020608180e281000, 0x030606190e281000, 0x0f06010a1d281000, 0x0107010a1d281000, 0x0c01070d1d281000, 0x0c01080d1d281000,
+	0x0906150601270705, 0x00061a06251f0c05, 0x01000a1813061005, 0x010018060d101005, 0x0014000b13231005, 0x02040f060b150008,
+	0x0402180329150008, 0x010c0d0529150008, 0x00020018150b0d08, 0x0402180029150e08, 0x000c0d1c01021008, 0x01000318160c1008,
+	0x0301230d06001010, 0x0101180609011010, 0x040600291c051010, 0x00020d1800091010, 0x0c06011c010f1010, 0x0806001902291010,
+	0x020008180e291010, 0x030600190e291010, 0x030400060f291010, 0x0006011d0f291010, 0x0100091b2a070311, 0x0200040102102011,
+	0x00030d0102102011, 0x0306001c02102011, 0x040006091b102411, 0x0d0615011c02001b, 0x070d06021c02001b, 0x020718030e15001b,
+	0x03040f060e15001b, 0x0002020b1507031b, 0x020718000e150e1b, 0x000c1c0e0402101b, 0x080600111402101b, 0x080602011602101b,
+	0x000210061602101b, 0x000e01060a02111b, 0x0002091816100d1d, 0x0006160503270b00, 0x05170001191e0107, 0x00161501191e0107,
+	0x00071602191e0107, 0x010109042a1e0107, 0x0101090527180b07, 0x010109051b220b07, 0x020700041e180c07, 0x000a0d1a01021007,
+	0x01000a1816021007, 0x02011a01040a1007, 0x02120101160a1007, 0x051500022b0a1007, 0x030400112b0a1007, 0x010c011c2b0a1007,
+	0x0101001809171007, 0x0517000e021b1007, 0x020012040e1b1007, 0x0e001f050e1b1007, 0x02070004151b1007, 0x0d00280d031e1007,
+	0x00000d12031e1007, 0x001505041a090c08, 0x000419062a090c08, 0x000c0d1c01041008, 0x0106001828102309, 0x0b06000229102309,
+	0x000205061b10150d, 0x000a05060e11150d, 0x020406060d1c0010, 0x020400060d000f10, 0x0004032c06070f10, 0x00000d2006051010,
+	0x0006011d0a041110, 0x000003061c0b1510, 0x000403061c071710, 0x0100091b2a070313, 0x0200040102102013, 0x00030d0102102013,
+	0x0306001c02102013, 0x040006091b102413, 0x010601040e01241a, 0x0d0615011c04001b, 0x070d06021c04001b, 0x000c1c0e0404101b,
+	0x080600111404101b, 0x080602011604101b, 0x000210061604101b, 0x000e01060a04111b, 0x020b05060d1b0100, 0x0212010709121000,
+	0x0d06011109231000, 0x020216070e070301, 0x12021f070e070301, 0x020d000a1b070301, 0x0516000a1b070301, 0x001f160d1b070301,
+	0x0011280d1b070301, 0x03050d061a0b0301, 0x0d06011409102a01, 0x011000060f102304, 0x0806001b14102304, 0x0200040115102304,
+	0x00030d0115102304, 0x0306001c15102304, 0x02000d0117102304, 0x000f060a28102304, 0x0100070a28102304, 0x000c070d28102304,
+	0x000c080d28102304, 0x0500060b2c102304, 0x0005090b2c102304, 0x000c090d2c102304, 0x0403000f2c102304, 0x09031a0601250705,
+	0x0207001d0d1d0c05, 0x01001e1e0f141005, 0x03040e01231a0007, 0x04042003291a0007, 0x01100c05291a0007, 0x0202190105070607,
+	0x0801021b05070607, 0x0500160503090807, 0x00280d0517050b07, 0x0118090526050b07, 0x01010a05271a0b07, 0x00040328221a0c07,
+	0x000904062a1a0c07, 0x000403281a070d07, 0x000400201a0b0d07, 0x04042000291a0e07, 0x000a0d1a01041007, 0x01000a1816041007,
+	0x0100111806051007, 0x0110001906051007, 0x0016020e16051007, 0x0001061b17051007, 0x0100031816091007, 0x01001118020f1007,
+	0x01100019020f1007, 0x0304001b140f1007, 0x02120101150f1007, 0x0201011d160f1007, 0x02000f182c0f1007, 0x0110000603102309,
+	0x00060b051b012809, 0x0100031e12102809, 0x0004092016102809, 0x080600190210240f, 0x020008180e10240f, 0x030600190e10240f,
+	0x030400060f10240f, 0x0006011d0f10240f, 0x0200001b0d070311, 0x0003051a0d090311, 0x0001050716090311, 0x00160109061a1014,
+	0x000106060310241a, 0x0b06000b0310241a, 0x0006060e0310241a, 0x0009000f0310241a, 0x0504060c0615001b, 0x0004060a06150b1b,
+	0x0002062106150e1b, 0x070420100401101b, 0x000114030409101b, 0x070420010001111b, 0x0118010303150c00, 0x0200180f220c0c01,
+	0x02000a18230c0c01, 0x15061505040c0f01, 0x01001609080c1e04, 0x0100090f220c1e04, 0x08060009230c1e04, 0x01000a09230c1e04,
+	0x0306010e2a102304, 0x0100090f2a102304, 0x0101001809101506, 0x000a2303190f0107, 0x00052305190f0107, 0x000a0d1a02011007,
+	0x01011318010a1007, 0x01001618040a1007, 0x02010521130a1007, 0x00011c2c140a1007, 0x01001618050e1007, 0x0201011d110f1007,
+	0x0001121d2a0f1007, 0x0100111b2c0f1007, 0x0100111f2c0f1007, 0x0101001809111007, 0x01000c1802121007, 0x010003180d121007,
+	0x000e0d1e05231007, 0x01000d1a05281007, 0x05000316010b1207, 0x01001d001e150c08, 0x000c0d1c02011008, 0x02000317010b1208,
+	0x0400200f220c010d, 0x04000a20230c010d, 0x0100180115080110, 0x030400060b291010, 0x0006011d0b291010, 0x00060301190b1210,
+	0x0200030d04102411, 0x0200040102102213, 0x00030d0102102213, 0x0306001c02102213, 0x03000d07021d1014, 0x00030301160b1214,
+	0x0102210b06070315, 0x000a0c0306090315, 0x00050c0506090315, 0x0009051b060b0315, 0x00060d0102101218, 0x0806002402101218,
+	0x01000d0f220c021a, 0x01000a0d230c021a, 0x010601040901241a, 0x050007011a01241a, 0x0d0600030e10241a, 0x011403061b010e1b,
+	0x02041a06070b0b00, 0x02041607060e0b00, 0x12041f07060e0b00, 0x02121a0103070c00, 0x0304010322160c00, 0x020b06050b281000,
+	0x010514090b281000, 0x0a0312050d281000, 0x0509280d01102304, 0x0201010d07102304, 0x0200040116102304, 0x00030d0116102304,
+	0x0306001c16102304, 0x0009280d17102304, 0x0600060a2b102304, 0x0500060c2b102304, 0x0005090c2b102304, 0x000f060d2b102304,
+	0x0100070d2b102304, 0x080600112b102304, 0x000900152b102304, 0x0209190106200c05, 0x0201160706200c05, 0x12011f0706200c05,
+	0x0801091b06200c05, 0x03040001251a0b07, 0x00042006271a0c07, 0x000a0d1a04011007, 0x02011a01040f1007, 0x02120101160f1007,
+	0x051500022b0f1007, 0x030400112b0f1007, 0x010c011c2b0f1007, 0x01000c1804121007, 0x08040009241e1007, 0x07010109241e1007,
+	0x0504031601071807, 0x010106231e150c08, 0x000c0d1c04011008, 0x0204031701071808, 0x0306002b12102309, 0x0706010122102309,
+	0x0d06000422102309, 0x0406030119071810, 0x0200040104102213, 0x00030d0104102213, 0x0306001c04102213, 0x0002050c28061014,
+	0x0001091c28061014, 0x03000d07041d1014, 0x0403030116071814, 0x0009022b06070315, 0x00090406060b2a15, 0x00060d0104101218,
+	0x0806002404101218, 0x0010090c0510241a, 0x040600130510241a, 0x0003060d1210241a, 0x0304011c07010b1b, 0x0009040619060b1b,
+	0x0004060e06150b1b, 0x00041f01060c181d, 0x00011f06060c181d, 0x02041a06070b0e00, 0x02041607060e0e00, 0x12041f07060e0e00,
+	0x03040001251a0e07, 0x00090406060e2a15, 0x0304011c07010e1b, 0x0009040619060e1b, 0x0004060e06150e1b, 0x0306021b16280700,
+	0x02011a1d070b0b00, 0x020116071d0e0b00, 0x12011f071d0e0b00, 0x011000071e180e00, 0x05000d1623000301, 0x0a15071a29030301,
+	0x020718171b0c0c01, 0x02150718260c0c01, 0x0201160709051101, 0x01121f0709051101, 0x0207020400112401, 0x010709171b0c1e04,
+	0x01150709260c1e04, 0x0200011b11072304, 0x0000121b2a072304, 0x0202190d07210005, 0x00030c1a1c250005, 0x0300180d27210b05,
+	0x03001a0b1c250b05, 0x020016070a200c05, 0x12001f070a200c05, 0x0806000925200c05, 0x01000a0925200c05, 0x0403001a1d250c05,
+	0x00060f1d19031205, 0x05000d1623050007, 0x00020d181a100007, 0x0307040d251a0007, 0x01000a181b160107, 0x02060a01181e0107,
+	0x0016021917050707, 0x0100191a05090807, 0x0102091901230b07, 0x03050417001a0c07, 0x00011d17051a0c07, 0x02010521101a0c07,
+	0x0504031601081807, 0x05011900090c1a07, 0x0002050b06101a07, 0x0402001806101a07, 0x010a121e0b150008, 0x01000a181b110108,
+	0x0100181d27090b08, 0x01000a231e150c08, 0x0204031701081808, 0x0304091828001109, 0x050009291a012309, 0x00000a1322012309,
+	0x040720171b0c010d, 0x04150720260c010d, 0x000c091c061a040d, 0x0500061d061a040d, 0x0005091d061a040d, 0x0a01091e061a040d,
+	0x01000e1e061a040d, 0x05010922061a040d, 0x04000a202200150d, 0x010006240911150d, 0x030409182500160d, 0x000c091c1901240d,
+	0x0500061d1901240d, 0x0005091d1901240d, 0x0a01091e1901240d, 0x01000e1e1901240d, 0x050109221901240d, 0x00000d1b04000f10,
+	0x00020a2404000f10, 0x00001c2404000f10, 0x0002050b1c000f10, 0x040200181c000f10, 0x0010002c04010f10, 0x001000041c011710,
+	0x0406030119081810, 0x00000a1b04021a10, 0x0002051906021a10, 0x0305040900061a10, 0x0806011700061a10, 0x0003061603122c11,
+	0x00000a1b280d0114, 0x0200040616031214, 0x0403030116081814, 0x0004072718000315, 0x000c0d1e1e000315, 0x0009022b06080315,
+	0x02020b0506002a15, 0x0100140c06002a15, 0x010c010906052a15, 0x0114000b060b2a15, 0x0009011d060b2a15, 0x01070d171b0c021a,
+	0x0115070d260c021a, 0x0102160d0801241a, 0x060216010e01241a, 0x02020b051906001b, 0x0100140c1906001b, 0x01000a161d09001b,
+	0x010c01091906051b, 0x0114000b19060b1b, 0x0009011d19060b1b, 0x01000a001d090b1b, 0x010018091d090b1b, 0x00011d0e06150b1b,
+	0x050002060312181d, 0x03041424090a0c00, 0x0306011517170c00, 0x00060d1317021000, 0x00060d1019021000, 0x0200041419021000,
+	0x00030d1419021000, 0x0100042519021000, 0x0201141d080a1000, 0x0101251d080a1000, 0x02120114030e1000, 0x050c0120030e1000,
+	0x01120125030e1000, 0x15060604170e1000, 0x030504091c131000, 0x080601171c131000, 0x000616051a090301, 0x0c0601161e0c0c01,
+	0x00060d1002102001, 0x0200041402102001, 0x00030d1402102001, 0x0100042502102001, 0x0d06011509102a01, 0x00060d1001101e04,
+	0x0200041401101e04, 0x00030d1401101e04, 0x0100042501101e04, 0x020014040b101e04, 0x010025040b101e04, 0x00060d1000102304,
+	0x0200041400102304, 0x00030d1400102304, 0x0100042500102304, 0x02000d1408102304, 0x01000d2508102304, 0x00060d0118102304,
+	0x0806002418102304, 0x0306020025102304, 0x0606060128102304, 0x0600120e28102304, 0x0600060a29102304, 0x0500060c29102304,
+	0x0005090c29102304, 0x000f060d29102304, 0x0100070d29102304, 0x0806001129102304, 0x0009001529102304, 0x0600100e2a102304,
+	0x0300140e2a102304, 0x00061a06251c0c05, 0x01000d0f22200c05, 0x01000a0d23200c05, 0x030424011c001506, 0x0201050d1b101506,
+	0x0a01050d0e111506, 0x030424011c110007, 0x00011a061b160107, 0x02001402181e0107, 0x01002502181e0107, 0x0200170505090807,
+	0x0015051b040b0b07, 0x020d011d0a011007, 0x0516011d0a011007, 0x01100117000a1007, 0x0304021a000a1007, 0x1101121e050a1007,
+	0x0101191e050a1007, 0x02010521110a1007, 0x02020501230a1007, 0x00150614040b1007, 0x00011c2c180b1007, 0x02120114000f1007,
+	0x050c0120000f1007, 0x01120125000f1007, 0x0201141d010f1007, 0x0101251d010f1007, 0x0200141b040f1007, 0x0100251b040f1007,
+	0x0200141f040f1007, 0x0100251f040f1007, 0x03040024180f1007, 0x05150002290f1007, 0x03040011290f1007, 0x010c011c290f1007,
+	0x0201050d1b111007, 0x00040d2001161007, 0x0304000623161007, 0x0307040d00281007, 0x0304000613281007, 0x0a01050d0e111107,
+	0x0009040606101a07, 0x00011a061b110108, 0x00040d2001111008, 0x0304000623111008, 0x000603010b12180f, 0x0601011d0e10240f,
+	0x000904061c000f10, 0x030504091c001010, 0x080601171c001010, 0x00001d2802081010, 0x030400240a091010, 0x000021021e0a1010,
+	0x00060d01021f1010, 0x08060024021f1010, 0x000706020c0a1110, 0x0d06010109102a13, 0x0304011c0711001b, 0x0004200e0411101b,
+	0x080600041711101b, 0x0304011c0700151e, 0x0004200e0410151e, 0x080600041710151e, 0x000e1a06071b0100, 0x0006160505270b00,
+	0x0400200f220e0c00, 0x04000a20230e0c00, 0x02000f020d1e0e00, 0x0200040f19021000, 0x00030d0f19021000, 0x02010f1d080a1000,
+	0x0212010f030e1000, 0x05170107091f1000, 0x0c000d1b2a070301, 0x00020d1803101101, 0x0002251804101101, 0x0200040f02102001,
+	0x00030d0f02102001, 0x0200040f01101e04, 0x00030d0f01101e04, 0x02000f040b101e04, 0x0200040f00102304, 0x00030d0f00102304,
+	0x02000d0f08102304, 0x03000f0e2a102304, 0x0014000b13251005, 0x02000f02181e0107, 0x07021818000b0907, 0x0101121809001007,
+	0x01001812020a1007, 0x0212010f000f1007, 0x02010f1d010f1007, 0x02000f1b040f1007, 0x02000f1f040f1007, 0x00020d1801121007,
+	0x000f030107191a07, 0x00011a061b130108, 0x00040d2001131008, 0x0304000623131008, 0x0006130519090309, 0x00001d2804081010,
+	0x000021041e0a1010, 0x000706040c0a1110, 0x00000d0602102011, 0x00060d130110021a, 0x030600180210241a, 0x0304011c0713001b,
+	0x0007051b02090b1b, 0x00000f2502090e1b, 0x000121020409101b, 0x000607021409101b, 0x0004200e0413101b, 0x080600041713101b,
+	0x000906020009111b, 0x000014020b09111b, 0x020f052311070c00, 0x15061505040a0c00, 0x0a062215010e0e00, 0x02000f040d1e0e00,
+	0x0200040f17021000, 0x00030d0f17021000, 0x02011b04040e1000, 0x01070318040e1000, 0x02011c060d131000, 0x0102160909070301,
+	0x0200040118102304, 0x00030d0118102304, 0x0306001c18102304, 0x020716001a0c0c05, 0x12071f001a0c0c05, 0x0100160908200c05,
+	0x0100090f22200c05, 0x0806000923200c05, 0x01000a0923200c05, 0x0207001d0d210c05, 0x020105091b101506, 0x0a0105090e111506,
+	0x0500160505090807, 0x000a0c01251a0c07, 0x090406091a001007, 0x01001812040a1007, 0x05150002260a1007, 0x03040011260a1007,
+	0x010c011c260a1007, 0x01011318000e1007, 0x01001812050e1007, 0x02020120020f1007, 0x02120101180f1007, 0x020105091b111007,
+	0x01000c1802151007, 0x010003180d151007, 0x00020d1801161007, 0x0001140d05231007, 0x0a0105090e111107, 0x020d011d0a011008,
+	0x0516011d0a011008, 0x00020d1801111008, 0x0006100519090309, 0x0003140519090309, 0x0110000605102309, 0x0100061c13102809,
+	0x0c0601161e0c010d, 0x00060b05061a040d, 0x00060617081a040d, 0x00060b051901240d, 0x000303010b12180f, 0x0300030d0910240f,
+	0x0301011d0e10240f, 0x02011c060d001010, 0x021201010a091010, 0x02000401021f1010, 0x00030d01021f1010, 0x0306001c021f1010,
+	0x0517000118000315, 0x0016150118000315, 0x0007160218000315, 0x00050b06180b0315, 0x00000f06180b0315, 0x00060d100110021a,
+	0x020004140110021a, 0x00030d140110021a, 0x010004250110021a, 0x020014040b10021a, 0x010025040b10021a, 0x030600180410241a,
+	0x000106060510241a, 0x0b06000b0510241a, 0x0006060e0510241a, 0x0009000f0510241a, 0x010600180910241a, 0x0b0600020f10241a,
+	0x0007051b04090b1b, 0x00000f2504090e1b, 0x080602021601101b, 0x0100061a0804101b, 0x000121040409101b, 0x000114050409101b,
+	0x000607041409101b, 0x0002180e0411101b, 0x000906040009111b, 0x000014040b09111b, 0x000906060207181d, 0x0002180e0410151e,
+	0x03041424090e0c00, 0x0118010305150c00, 0x0207140409190c00, 0x02012104040e1000, 0x0307041b040e1000, 0x0d06011109251000,
+	0x000e1a0619000301, 0x0c000d1b28070301, 0x0602150e2c070301, 0x0a00091b2c070301, 0x02071404090c2001, 0x0200040112101e04,
+	0x00030d0112101e04, 0x0306001c12101e04, 0x000f280d08102304, 0x0001061b09102304, 0x0500060b29102304, 0x0005090b29102304,
+	0x000c090d29102304, 0x0403000f29102304, 0x000106062b102304, 0x0b06000b2b102304, 0x0006060e2b102304, 0x0009000f2b102304,
+	0x021600070d201005, 0x000e1a0619050007, 0x03040e01251a0007, 0x02110101181e0107, 0x00011419050b0907, 0x00042006251a0c07,
+	0x0101151809001007, 0x00020d1812011007, 0x01000a1813041007, 0x0100181506051007, 0x0100031813091007, 0x04000f20260a1007,
+	0x02020120040f1007, 0x01001802150f1007, 0x02000f18290f1007, 0x0c01011d2b0f1007, 0x0304001b0d151007, 0x00040d2012011008,
+	0x0003062812102309, 0x0304000712102809, 0x0004092013102809, 0x02000917081a040d, 0x020017050903060d, 0x0c01001b0703280d,
+	0x030400240e091010, 0x00000d0317091010, 0x0207000419091010, 0x0114000b28061014, 0x0009011d28061014, 0x00060d011210021a,
+	0x080600241210021a, 0x070601010a10241a, 0x0d0600040a10241a, 0x0d0600050e10241a, 0x080600021210241a, 0x0306000e1210241a,
+	0x020403170107031b, 0x080602041601101b, 0x000c091c0804101b, 0x0500061d0804101b, 0x0005091d0804101b, 0x0a01091e0804101b,
+	0x01000e1e0804101b, 0x050109220804101b, 0x02121a0105070c00, 0x0212011a11070c00, 0x0200030f1b0d0c00, 0x030601151e160c00,
+	0x02000f040d1f0e00, 0x0212010709131000, 0x050c010619080301, 0x0517010719080301, 0x0200010f0b0e1e04, 0x0200040116101e04,
+	0x00030d0116101e04, 0x0306001c16101e04, 0x000e280d08102304, 0x0200040112102304, 0x00030d0112102304, 0x0306001c12102304,
+	0x0806180525140005, 0x00020d1816011007, 0x0212010f000a1007, 0x02120101170a1007, 0x03040014260a1007, 0x04000e20260a1007,
+	0x02120101120f1007, 0x01001804150f1007, 0x02000e18290f1007, 0x010a031e0b150008, 0x0105051e0b150008, 0x010510051b010108,
+	0x050005281b090108, 0x010a001e0b150e08, 0x00040d2016011008, 0x0100031e13102809, 0x0304000716102809, 0x00061305061a040d,
+	0x000613051901240d, 0x0003050d1b280110, 0x0003051a0d290110, 0x0001050716290110, 0x0212010709001010, 0x000c0a051e000315,
+	0x0009000f2c0c021a, 0x00060d011610021a, 0x080600241610021a, 0x080600041210241a, 0x0400200f0e010e1b, 0x040320061a010e1b,
+	0x00000f1f04090e1b, 0x0304062608160c00, 0x02000d0f17021000, 0x0306021c19021000, 0x0110000c1e131000, 0x030402060b281000,
+	0x150a09061b000301, 0x000c1c061b000301, 0x0c170d0628000301, 0x0a1709062c000301, 0x00061715120b0301, 0x000b061b1f0b0301,
+	0x021507180b0d0c01, 0x0306021c02102001, 0x120400090d102401, 0x040206091b102401, 0x011507090b0d1e04, 0x0306021c01101e04,
+	0x0306021c00102304, 0x0201280d08102304, 0x0016020e09102304, 0x02000d0118102304, 0x0302010e2a102304, 0x0318010626200c05,
+	0x0010000f13251005, 0x150a09061b050007, 0x000c1c061b050007, 0x0c170d0628050007, 0x0a1709062c050007, 0x03041301251a0007,
+	0x0c0117062b0f0107, 0x00011419050b0607, 0x03040626011a0c07, 0x03040200260a1007, 0x0002021d260a1007, 0x04020120260a1007,
+	0x01020222260a1007, 0x0202011b040f1007, 0x02020118290f1007, 0x0500160e040b1207, 0x011017011b010108, 0x0304020623011008,
+	0x0906010619090309, 0x0306170628001109, 0x0304020701102809, 0x041507200b0d010d, 0x01021e2d0910040d, 0x030617062500160d,
+	0x0c0117060003280d, 0x00150a0604000f10, 0x0110000c1e001010, 0x02000d01021f1010, 0x0110001e01100c11, 0x011507091b0b0313,
+	0x1204000901102213, 0x0009170628060114, 0x0007270118000315, 0x000c00061e000315, 0x0115070d0b0d021a, 0x02000d140110021a,
+	0x080602240110021a, 0x01000d250110021a, 0x080602041701101b, 0x0100131e0804101b, 0x0306051c19021000, 0x010906171e0e1000,
+	0x010a081a1e0e1000, 0x030405060b281000, 0x0c15070d29070301, 0x020116070b051101, 0x01121f070b051101, 0x0306051c02102001,
+	0x040506091b102401, 0x010109061e102401, 0x0306051c01101e04, 0x0306051c00102304, 0x0501280d08102304, 0x0016050e09102304,
+	0x000f060a25102304, 0x0100070a25102304, 0x000c070d25102304, 0x000c080d25102304, 0x000c080d29102304, 0x0003000f29102304,
+	0x0305010e2a102304, 0x0101091f1e101506, 0x0007161905070607, 0x01011a1e0b011007, 0x000a1e0b13041007, 0x0101092a16051007,
+	0x000a1e04140a1007, 0x03040500260a1007, 0x0005021d260a1007, 0x04050120260a1007, 0x01050222260a1007, 0x0205011b040f1007,
+	0x02050118290f1007, 0x0101091f1e111007, 0x000109201e171007, 0x050119000b0c1a07, 0x0304050623011008, 0x0106012119070309,
+	0x0304050701102809, 0x0004082013102809, 0x010f061e1f10010d, 0x0101071e1f10010d, 0x010306162310010d, 0x01051e2d0910040d,
+	0x02000817081a040d, 0x020017220703060d, 0x01011e081e10150d, 0x010006240b11150d, 0x020024060d051010, 0x00010b1907081a10,
+	0x020016070a070313, 0x00121f070a070313, 0x010c010b06052a15, 0x0001091e06101218, 0x0106010e1e101518, 0x080605240110021a,
+	0x010c010b1906051b, 0x080605041701101b, 0x000f061b0804101b, 0x0100071b0804101b, 0x000c081c0804101b, 0x0100061f0804101b,
+	0x03180205260e0b00, 0x02020220080a1000, 0x05001c051b000301, 0x020004020d102401, 0x00030d020d102401, 0x00030c021b102401,
+	0x0403200204112401, 0x040315020e112401, 0x0517000a09102304, 0x05001c051b050007, 0x0202190200070607, 0x01090626011a0707,
+	0x0517001f06051007, 0x0002051c170a1007, 0x00020512260a1007, 0x0e000222260a1007, 0x02020220010f1007, 0x0002051c120f1007,
+	0x0200021e170f1007, 0x051700021f0f1007, 0x0016012009171007, 0x05040029051f1007, 0x050c01010f1f1007, 0x02041a060b130008,
+	0x000e1a061b010108, 0x051701091f011008, 0x01031a0529001509, 0x050c010601101e09, 0x050c010006102309, 0x000705041c0c2809,
+	0x000a05091c0c2809, 0x0e001e2d0910040d, 0x000021021e10150d, 0x000706020c11150d, 0x0200040201102213, 0x00030d0201102213,
+	0x020002040b102213, 0x0212020107160014, 0x050000051e000315, 0x00090e061e000315, 0x00140206060e2a15, 0x0016010906101218,
+	0x00010b190b031518, 0x02071a030b00021a, 0x04031a032900021a, 0x0003001a0b0d021a, 0x02071a000b0e021a, 0x04031a00290e021a,
+	0x051700060610021a, 0x00090c231610021a, 0x050c010601100d1a, 0x050009040110241a, 0x0100160b0810241a, 0x010d00070a10241a,
+	0x070301000b10241a, 0x03000e050b10241a, 0x03041a060e13001b, 0x0014020619060e1b, 0x0e00001e0804101b, 0x0d06150116280100,
+	0x070d060216280100, 0x03180405260e0b00, 0x0a030125190d0c00, 0x130602061e160c00, 0x0d06010222160c00, 0x02020420080a1000,
+	0x0d06011009231000, 0x0906011d0b281000, 0x0a00091b2a070301, 0x0506050719090301, 0x020004040d102401, 0x00030d040d102401,
+	0x00030c041b102401, 0x0403200404112401, 0x040315040e112401, 0x0015060e09102304, 0x0306001b18102304, 0x0202190400070607,
+	0x0101171809001007, 0x02020501250a1007, 0x0c000222260a1007, 0x02020420010f1007, 0x0200041e170f1007, 0x0300240d02151007,
+	0x01010d1801161007, 0x000205160f231007, 0x0004070224231007, 0x0301130d00281007, 0x03000d1205281007, 0x0000170404231107,
+	0x0500010a04231107, 0x000d010a04231107, 0x000f050107191a07, 0x000c1a061b010108, 0x01010d1801111008, 0x0d06000513102809,
+	0x01061a05270b010d, 0x130601251210010d, 0x0c001e2d0910040d, 0x06000f1a081a040d, 0x000305030d090f10, 0x021201000d091010,
+	0x0306001b021f1010, 0x130600020b291010, 0x1306000306102a11, 0x0200040401102213, 0x00030d0401102213, 0x020004040b102213,
+	0x0212040107160014, 0x00030306180e2a15, 0x00060d0201101218, 0x06000e020a10241a, 0x050418060809001b, 0x00061a050a040b1b,
+	0x0003030619180e1b, 0x130601130901101b, 0x0d0601170901101b, 0x130600170604101b, 0x130600160804101b, 0x0c00001e0804101b,
+	0x020b1a05070a0100, 0x0109061e03180700, 0x0104001c1e180b00, 0x03041422090e0c00, 0x04060315221b0c00, 0x040603151b070d00,
+	0x01070518040e1000, 0x030602200b281000, 0x0218280d09070301, 0x0602150e2a070301, 0x0a00091b2a070301, 0x000e050719090301,
+	0x01061505270b0f01, 0x0406150329001e04, 0x000600150b0d1e04, 0x04061500290e1e04, 0x0200010f0a101e04, 0x020101040f101e04,
+	0x0009280d16101e04, 0x0110000a09102304, 0x0009280d12102304, 0x080600132b102304, 0x0006251500200c05, 0x0018280d08200c05,
+	0x0200000d131d1005, 0x01041f06101a0c07, 0x02010f1d0a011007, 0x0110001f06051007, 0x03040016260a1007, 0x0201011d130f1007,
+	0x011000021f0f1007, 0x030400132b0f1007, 0x0201011d0a121007, 0x010005180d151007, 0x00000d03141e1007, 0x0109061e01150708,
+	0x011001091f011008, 0x01001f1b10070309, 0x0003062815102309, 0x0106150529000d0f, 0x0304000a0910240f, 0x0300050d0910240f,
+	0x080600021f10240f, 0x0306000e1f10240f, 0x02041a06070e0010, 0x0100050c1e000f10, 0x030400220e091010, 0x000600151b0b0313,
+	0x0001081d280d1014, 0x01021f0e06070315, 0x03040e0106002a15, 0x00060d0401101218, 0x011000060610021a, 0x080600221210021a,
+	0x0306060e0010241a, 0x06000e040a10241a, 0x070601000e10241a, 0x06000e050e10241a, 0x080600021510241a, 0x0306000e1510241a,
+	0x03040e011906001b, 0x0806180505010b1b, 0x02050c2307161000, 0x0205280d08161000, 0x0203052809161000, 0x0206050d1d161000,
+	0x0f06011d0b281000, 0x0107011d0b281000, 0x00120705040c2c01, 0x02060a0108102304, 0x0517000e09102304, 0x0806001725141005,
+	0x03041501251a0007, 0x03070402251a0007, 0x0a010a01251a0c07, 0x0101111809001007, 0x0110011909001007, 0x0100051813091007,
+	0x0c00021c260a1007, 0x0201011d170f1007, 0x0a00021a290f1007, 0x020e050a00231007, 0x000e1e0d05231007, 0x000205160c231007,
+	0x01001a0d05281007, 0x00020516280d1008, 0x0a06010319090309, 0x0506010519090309, 0x0200020823102309, 0x0002050616102809,
+	0x030704042310010d, 0x01071e03061a040d, 0x01071e031901240d, 0x0106011c1d002411, 0x000c1e021e000315, 0x0106011c28001518,
+	0x030600150410241a, 0x0600130b0510241a, 0x010600150910241a, 0x060002130f10241a, 0x0100151e0804101b, 0x000e1e050409101b,
+	0x0002050616100d1d, 0x0100111e0b180500, 0x0304141b090a0c00, 0x0304062408160c00, 0x0201040d041f1000, 0x0500230519000301,
+	0x000e220619000301, 0x1506150612010301, 0x0507160629010301, 0x0500050619090301, 0x020101040b101e04, 0x02010d0108102304,
+	0x0806001b18102304, 0x0000190b14250505, 0x0016140e09200c05, 0x0318010624200c05, 0x03041b011c001506, 0x0500230519050007,
+	0x000e220619050007, 0x03041b011c110007, 0x010a09051a270007, 0x02010102181e0107, 0x0016021905070607, 0x0501160500090807,
+	0x01280d0517000b07, 0x03040624011a0c07, 0x0300230d13041007, 0x03000d151a051007, 0x03040010260a1007, 0x0c00041c260a1007,
+	0x0201011f040f1007, 0x0304001b180f1007, 0x0a00041a290f1007, 0x0115062101091008, 0x0200040823102309, 0x03041409010c2809,
+	0x0100051e13102809, 0x0d0600271810040d, 0x010c2305071a0010, 0x01280d05081a0010, 0x01030528091a0010, 0x0106050d1d1a0010,
+	0x1506040601190710, 0x0304001b0a091010, 0x0806001b021f1010, 0x0004270318000315, 0x060004130f10241a, 0x0006160505010b1b,
+	0x0001051707090b1b, 0x0104200e0401101b, 0x00011f040409101b, 0x0004011c060c181d, 0x0001061c060c181d, 0x030601161e160c00,
+	0x0101160908190c00, 0x0806010923190c00, 0x080601091e1b0c00, 0x0106010e1b1d0c00, 0x02001405160b1000, 0x01002505160b1000,
+	0x01011806140d1000, 0x02001204160e1000, 0x0e001f05160e1000, 0x02160107170e1000, 0x02011609041c1000, 0x0201100d041c1000,
+	0x0f06011e0b281000, 0x0107011e0b281000, 0x150a09051b000301, 0x000c1c051b000301, 0x0c170d0528000301, 0x0a1709052c000301,
+	0x01010c1803101101, 0x0002221804101101, 0x0806011b17101101, 0x01011609080c2001, 0x08060109230c2001, 0x0306011c0d102401,
+	0x0d0601140d102c01, 0x080c1c0107001e04, 0x0003190116101e04, 0x0003190112102304, 0x0016010e14101506, 0x150a09051b050007,
+	0x000c1c051b050007, 0x0c170d0528050007, 0x0a1709052c050007, 0x03041a01141a0007, 0x03040f01251a0007, 0x0c0117052b0f0107,
+	0x01162101131e0107, 0x08012201131e0107, 0x00012104131e0107, 0x0101111806001007, 0x0110011906001007, 0x01010a1816011007,
+	0x0002191816011007, 0x0101001813091007, 0x01011812010a1007, 0x0c01011c260a1007, 0x0101101e260a1007, 0x01011618000e1007,
+	0x01011801150f1007, 0x0201011e170f1007, 0x010c01281f0f1007, 0x0a01011a290f1007, 0x0c01011b2b0f1007, 0x010c011f2b0f1007,
+	0x0016010e14111007, 0x01010c1801121007, 0x010100180d151007, 0x0101210b131e1007, 0x010e0d1e00231007, 0x01010d1a00281007,
+	0x011416012a010c08, 0x010014042a010c08, 0x0004192016011008, 0x0000132119070309, 0x0906010519090309, 0x0306170528001109,
+	0x0110010600102309, 0x0100062815102309, 0x0201010823102309, 0x02010d041f10010d, 0x050116041f10010d, 0x030617052500160d,
+	0x0c0117050003280d, 0x0301000d0910240f, 0x0006010e1f10240f, 0x03041a0106190010, 0x0304240107190010, 0x00150a0504000f10,
+	0x0101091f042b1010, 0x0009000316102a11, 0x0306011c01102213, 0x020101040b102213, 0x0009170528060114, 0x0009011b28061014,
+	0x0001091f28061014, 0x03010d07011d1014, 0x000c00051e000315, 0x0c01012b06080315, 0x0806012401101218, 0x021914010700021a,
+	0x011925010700021a, 0x001606001a0c021a, 0x000619011610021a, 0x000109241610021a, 0x0b0616010001241a, 0x000b06040001241a,
+	0x001613010801241a, 0x000013040801241a, 0x0b06010b0010241a, 0x000c09040110241a, 0x030601180110241a, 0x0001130b0810241a,
+	0x000601150910241a, 0x06010e010a10241a, 0x0d0601000e10241a, 0x0c0101090f10241a, 0x060101130f10241a, 0x080601011210241a,
+	0x000109041210241a, 0x0006010e1510241a, 0x0c161c010804001b, 0x000c1c040804001b, 0x010c1c0e0401101b, 0x080601111401101b,
+	0x01000f1e0804101b, 0x0c01001f0804101b, 0x000900171604101b, 0x000123160409101b, 0x00012304100d101b, 0x0000030e1611101b,
+	0x0101091f0412101b, 0x0000030e1610151e, 0x020b06040b280100, 0x0102160908190c00, 0x0806020923190c00, 0x080602091e1b0c00,
+	0x01021806140d1000, 0x02160207170e1000, 0x020a2505040f1000, 0x020c2705040f1000, 0x01022613040f1000, 0x0102121e040f1000,
+	0x0206040d041f1000, 0x0f06021e0b281000, 0x0107021e0b281000, 0x02280d0411000301, 0x01020c1803101101, 0x0806021b17101101,
+	0x01021609080c2001, 0x08060209230c2001, 0x0306021c0d102401, 0x0d0602140d102c01, 0x020601040b101e04, 0x02060d0108102304,
+	0x000215040f251005, 0x00020c0414251005, 0x00020f040f271005, 0x0016020e14101506, 0x02280d0411050007, 0x010211040e270007,
+	0x02060102181e0107, 0x0102111806001007, 0x0110021906001007, 0x01020a1816011007, 0x0102001813091007, 0x01021812010a1007,
+	0x0c02011c260a1007, 0x0102101e260a1007, 0x01021618000e1007, 0x0206011f040f1007, 0x01021801150f1007, 0x0202011e170f1007,
+	0x0a02011a290f1007, 0x0c01021b2b0f1007, 0x0016020e14111007, 0x01020c1801121007, 0x010200180d151007, 0x0102210b131e1007,
+	0x00020a0404231107, 0x0201210410000309, 0x0110020600102309, 0x0202010823102309, 0x0302000d0910240f, 0x0006020e1f10240f,
+	0x0002240204000f10, 0x0306021c01102213, 0x000203040f102613, 0x00020c0428060114, 0x0009021b28061014, 0x03020d07011d1014,
+	0x0806022401101218, 0x030614000b0d021a, 0x0b06020b0010241a, 0x030602180110241a, 0x0002130b0810241a, 0x000602150910241a,
+	0x06020e010a10241a, 0x0d0602000e10241a, 0x0c0102090f10241a, 0x060201130f10241a, 0x080602011210241a, 0x0006020e1510241a,
+	0x02100c040804001b, 0x010216040809001b, 0x0604200e0401101b, 0x080602111401101b, 0x00061f040409101b, 0x000203040f10121e,
+	0x04031f011e180e00, 0x01031f061e180e00, 0x0200041119021000, 0x00030d1119021000, 0x0201161d070a1000, 0x0201111d080a1000,
+	0x02120111030e1000, 0x02001e101e0f1000, 0x0200041102102001, 0x00030d1102102001, 0x0200041101101e04, 0x00030d1101101e04,
+	0x020011040b101e04, 0x0200041100102304, 0x00030d1100102304, 0x02000d1108102304, 0x0216000e09102304, 0x0300110e2a102304,
+	0x00001e0b13251005, 0x00021a06141a0007, 0x00021305251a0007, 0x00020f06251a0007, 0x02001102181e0107, 0x0802021b00070607,
+	0x0002061b17001007, 0x0200021d260a1007, 0x0200101e260a1007, 0x02120111000f1007, 0x0201111d010f1007, 0x0200111b040f1007,
+	0x0200111f040f1007, 0x000c02281f0f1007, 0x0c02001b2b0f1007, 0x000c021f2b0f1007, 0x0200210b131e1007, 0x021411011b010108,
+	0x0200001e13102809, 0x021407031b01010d, 0x11021e091c0c010d, 0x02141e092d0c010d, 0x021400091810040d, 0x00021a0606190010,
+	0x0002240607190010, 0x0209040606002a15, 0x000206060010241a, 0x0c0200090f10241a, 0x020904061906001b, 0x0204060e0615001b,
+	0x02001f040409101b, 0x0003250318180b00, 0x0200090f22190c00, 0x02000a0923190c00, 0x02000a091e1b0c00, 0x0200041118021000,
+	0x00030d1118021000, 0x0200041319021000, 0x00030d1319021000, 0x0201131d080a1000, 0x02000f021a0a1000, 0x02120113030e1000,
+	0x0201021a040f1000, 0x04001e101e0f1000, 0x17060112091c1000, 0x01070112091c1000, 0x17060110091f1000, 0x01070110091f1000,
+	0x1106011d0b281000, 0x0703010d18281000, 0x02010b041f000301, 0x0218270d09070301, 0x001f0d1b15070301, 0x000614051a090301,
+	0x0114000e1e101101, 0x0200090f220c2001, 0x02000a09230c2001, 0x0200041302102001, 0x00030d1302102001, 0x050209091b102401,
+	0x060208090e112401, 0x0200041301101e04, 0x00030d1301101e04, 0x020013040b101e04, 0x0009270d16101e04, 0x0200041300102304,
+	0x00030d1300102304, 0x02000d1308102304, 0x0100120909102304, 0x0009270d12102304, 0x0207000718102304, 0x0300130e2a102304,
+	0x0018270d08200c05, 0x0200041801101005, 0x00030d1801101005, 0x020018040b101005, 0x00060d2201141005, 0x0116000e14101506,
+	0x02010b041f050007, 0x020b0406141a0007, 0x00041a06141a0007, 0x00041305251a0007, 0x00040f06251a0007, 0x011f0d04011e0107,
+	0x02001302181e0107, 0x0804021b00070607, 0x0218090526000b07, 0x0101171a09001007, 0x0116020e16001007, 0x0004061b17001007,
+	0x0400101e260a1007, 0x02120113000f1007, 0x0201131d010f1007, 0x0200131b040f1007, 0x0200131f040f1007, 0x000c04281f0f1007,
+	0x0c04001b2b0f1007, 0x000c041f2b0f1007, 0x0116000e14111007, 0x0100210902151007, 0x01010d1a01161007, 0x0c000d2b051d1007,
+	0x01000913021e1007, 0x0400210b131e1007, 0x010f000107191a07, 0x020b17050a010108, 0x020b0b051b010108, 0x020003180b150b08,
+	0x01010d1a01111008, 0x0006120519090309, 0x0106001a1d101109, 0x0703012301101e09, 0x0706012801101e09, 0x0c06011801102309,
+	0x1706000215102309, 0x0107000215102309, 0x0703010023102309, 0x03000e0523102309, 0x0706010028102309, 0x06000e0528102309,
+	0x0706012201102809, 0x0400001e13102809, 0x02041706080c010d, 0x11041e091c0c010d, 0x020003171e0c010d, 0x01000a281e0c010d,
+	0x04141e092d0c010d, 0x020417060800150d, 0x020b040606190010, 0x00041a0606190010, 0x0004240607190010, 0x02040606091c0010,
+	0x0204000609000f10, 0x01001d2801081010, 0x010021011e0a1010, 0x0200021a040e1010, 0x02070007021f1010, 0x0002091f042b1010,
+	0x010706010c0a1110, 0x001f0d1b01070313, 0x0109001b28061014, 0x0100091f28061014, 0x0602010e1e070315, 0x01090b0506002a15,
+	0x02010b040600021a, 0x000606241a0c021a, 0x00060d120110021a, 0x00090c251610021a, 0x0703012301100d1a, 0x0706012801100d1a,
+	0x0106040c0101241a, 0x0806011c0101241a, 0x0006011c1601241a, 0x000406060010241a, 0x0109000f0010241a, 0x0100130b0810241a,
+	0x0c0400090f10241a, 0x01090b051906001b, 0x010b050e0615001b, 0x0107051b01090b1b, 0x0100051707090b1b, 0x0003030e18150b1b,
+	0x090605061c010e1b, 0x01000f2501090e1b, 0x010210061601101b, 0x010114000409101b, 0x010121010409101b, 0x010023160409101b,
+	0x010607011409101b, 0x01002304100d101b, 0x0002091f0412101b, 0x010e01060a01111b, 0x010906010009111b, 0x010014010b09111b,
+	0x0703011801100d1d, 0x0100061c060c181d, 0x0400090f22190c00, 0x04000a0923190c00, 0x04000a091e1b0c00, 0x02060511181d0c00,
+	0x050602200b281000, 0x0602160b2b070301, 0x0400090f220c2001, 0x04000a09230c2001, 0x050409091b102401, 0x060408090e112401,
+	0x0516000e09102304, 0x0418090526000b07, 0x0500021d260a1007, 0x0006160519090309, 0x0005062815102309, 0x0a061600050c2809,
+	0x0506000e1f10240f, 0x0004091f042b1010, 0x0509040606002a15, 0x00060d160110021a, 0x0506060e0010241a, 0x0506000e1510241a,
+	0x050904061906001b, 0x0504060e0615001b, 0x05001f040409101b, 0x0004091f0412101b, 0x0100141e0b180500, 0x01022218040e1000,
+	0x05001e041e0f1000, 0x040020101e0f1000, 0x020018141e0f1000, 0x0200021a1e0f1000, 0x0114000f0b281000, 0x0b06011d0b281000,
+	0x030205200d281000, 0x1406150612010301, 0x00280d1b11070301, 0x110218091c0c0c01, 0x021418092d0c0c01, 0x1201280d03101101,
+	0x000622150b0c1e04, 0x110109091c0c1e04, 0x07280d001d0c1e04, 0x011409092d0c1e04, 0x0000121e0f101e04, 0x00280d0f01102304,
+	0x0010280d08102304, 0x0000150b29102304, 0x0c00000d29102304, 0x00030d0f29102304, 0x00000c0f2b102304, 0x03111a011c250005,
+	0x00031a041c250505, 0x03011a061c250e05, 0x000e0d041c251005, 0x0500161c040b0907, 0x00011b19050b0907, 0x000f101f050b0907,
+	0x00021819170b0907, 0x010014141a0b0907, 0x01140115001a0c07, 0x01042106101a0c07, 0x0201180619240c07, 0x0100140d1a0b0d07,
+	0x11021218000a1007, 0x01021918000a1007, 0x0114002b130a1007, 0x00120110220a1007, 0x04001020260a1007, 0x02001018290f1007,
+	0x1201280d01121007, 0x02070003251e1007, 0x0001210d05231007, 0x000e220d05231007, 0x0007022405231007, 0x00040b0606101a07,
+	0x010b051e0b150008, 0x011201001e150c08, 0x0114062101091008, 0x0100211b10070309, 0x0a06010519090309, 0x0605011e190b0309,
+	0x0114000f000c2809, 0x0114000913102809, 0x0400002013102809, 0x0100140414102809, 0x0100140410102a09, 0x110420091c0c010d,
+	0x041420092d0c010d, 0x0c001c2d0910040d, 0x00071d03061a040d, 0x01072203061a040d, 0x0f100009081a040d, 0x02000017081a040d,
+	0x020017010b1a040d, 0x000f101c0b03060d, 0x00071d031901240d, 0x010722031901240d, 0x1406040601190710, 0x01001406190b0910,
+	0x00040b061c000f10, 0x001201260e091010, 0x0000041e0f221010, 0x0100140f042b1010, 0x0004061906021a10, 0x0206011c1d002411,
+	0x00010c1d28061014, 0x0000021e0f181014, 0x01000428011a1014, 0x010028040b1a1014, 0x00111b030d000315, 0x000c22021e000315,
+	0x0102210e06070315, 0x0114110106002a15, 0x020b040606002a15, 0x0100140406052a15, 0x01140106060e2a15, 0x0206011c28001518,
+	0x000f10060b09021a, 0x11010d091c0c021a, 0x01140d092d0c021a, 0x0000131e0f10021a, 0x000004261210021a, 0x01010d040801241a,
+	0x010604010e01241a, 0x020600150910241a, 0x000003130a10241a, 0x011411011906001b, 0x020b04061906001b, 0x010014041906051b,
+	0x0000031a0b11051b, 0x0114010619060e1b, 0x051500090804101b, 0x0c00001c0804101b, 0x0000151d0804101b, 0x010015220804101b,
+	0x000121050409101b, 0x000e22050409101b, 0x0100131d0409101b, 0x0100140f0412101b, 0x000016040b09111b, 0x0000031a0b05151e,
+	0x02171a0105070c00, 0x0201171a11070c00, 0x02142104090a0c00, 0x02142109050d0c00, 0x0201170709131000, 0x0207040d041f1000,
+	0x1001280d03101101, 0x020701040b101e04, 0x0205090116101e04, 0x02070d0108102304, 0x0014280d08102304, 0x020d000a09102304,
+	0x0516000a09102304, 0x001f160d09102304, 0x0011280d09102304, 0x0205090112102304, 0x0209000718102304, 0x0216070101200c05,
+	0x121f070101200c05, 0x0201010317200c05, 0x030a010125200c05, 0x022104011c001506, 0x022104011c110007, 0x020a09051a270007,
+	0x02150101181e0107, 0x02070102181e0107, 0x000a1201241e0107, 0x00140519050b0607, 0x0502160500090807, 0x02280d0517000b07,
+	0x020d001f06051007, 0x0516001f06051007, 0x0102092a16051007, 0x0c000d2817051007, 0x0a00092c17051007, 0x0201170f000a1007,
+	0x02011701170a1007, 0x00100110220a1007, 0x0101131e260a1007, 0x04001420260a1007, 0x0207011f040f1007, 0x02011701120f1007,
+	0x02001821140f1007, 0x02002104180f1007, 0x020d00021f0f1007, 0x051600021f0f1007, 0x02001418290f1007, 0x1001280d01121007,
+	0x0c000d21031b1007, 0x011001001e150c08, 0x010101231e150c08, 0x020d01091f011008, 0x051601091f011008, 0x0602012119070309,
+	0x0306001728101109, 0x1306001504102309, 0x0600132105102309, 0x030602162310010d, 0x030600172510160d, 0x020c2305071a0010,
+	0x02280d05081a0010, 0x02030528091a0010, 0x0206050d1d1a0010, 0x000a012006290110, 0x0201170709001010, 0x0200060d14041010,
+	0x020021040a091010, 0x020021050d091010, 0x001001260e091010, 0x02090007021f1010, 0x0301011f092b1010, 0x020004060d102213,
+	0x0c001e011e000315, 0x020d00060610021a, 0x051600060610021a, 0x0002051707090b1b, 0x0704200e0401101b, 0x0006021f0804101b,
+	0x00071f040409101b, 0x0301011f0912101b, 0x0002061c060c181d, 0x08061a06101b0100, 0x0b0616060b280100, 0x0806130516280100,
+	0x08060f0616280100, 0x010d061e03180700, 0x0306061c19021000, 0x02021609041c1000, 0x0202100d041c1000, 0x0303041004231000,
+	0x030406060b281000, 0x080c1c060d000301, 0x16280d0611000301, 0x0b0602062b071b01, 0x0306061c02102001, 0x040606091b102401,
+	0x0306061c01101e04, 0x0306061c00102304, 0x0601280d08102304, 0x0016060e09102304, 0x0306010e2a102304, 0x0009190613250705,
+	0x03011a0613250705, 0x000919060b250c05, 0x03011a060b250c05, 0x080c1c060d050007, 0x16280d0611050007, 0x011611060e270007,
+	0x080e05061a000707, 0x0219010602150707, 0x08011b0602150707, 0x03040006251a0e07, 0x03040600260a1007, 0x0006021d260a1007,
+	0x04060120260a1007, 0x01060222260a1007, 0x0206011b040f1007, 0x020c01281f0f1007, 0x02060118290f1007, 0x020c011f2b0f1007,
+	0x020e0d1e00231007, 0x01020d1a00281007, 0x010d061e01150708, 0x0304060623011008, 0x0116210610000309, 0x0801220610000309,
+	0x0706010519090309, 0x0200062815102309, 0x0304060701102809, 0x02020d041f10010d, 0x050216041f10010d, 0x01061e2d0910040d,
+	0x0201091f042b1010, 0x0006062b03071b11, 0x020201040b102213, 0x0207040607160014, 0x00160c0628060114, 0x0002091f28061014,
+	0x080606240110021a, 0x10160c060804001b, 0x011616060809001b, 0x0b0602061001071b, 0x0304061c07010e1b, 0x020c1c0e0401101b,
+	0x030304170401101b, 0x080606041701101b, 0x000223160409101b, 0x00022304100d101b, 0x0201091f0412101b, 0x0d06150719020700,
+	0x03040706101b0700, 0x030305040d1d0b00, 0x031605070d1d0b00, 0x15061f15010e0e00, 0x0306091c19021000, 0x05031e04040f1000,
+	0x03042010040f1000, 0x03021814040f1000, 0x0203021a040f1000, 0x0204040d041f1000, 0x030409060b281000, 0x0503130219000301,
+	0x050e170219000301, 0x02030b041f000301, 0x020b16071f000301, 0x0806090716080301, 0x00120c07180b0301, 0x03021804080c0c01,
+	0x02161807080c0c01, 0x15060315220c0f01, 0x15060315070d0f01, 0x0d06150702072001, 0x0306091c02102001, 0x08060907030e2401,
+	0x040906091b102401, 0x0804090700112401, 0x080409090e112401, 0x00120c07050c2c01, 0x0d06150701071e04, 0x08060907000c1e04,
+	0x03010904080c1e04, 0x01160907080c1e04, 0x15060015110c1e04, 0x0306091c01101e04, 0x020401040b101e04, 0x000312040f101e04,
+	0x0d06150700072304, 0x0018120709072304, 0x0306091c00102304, 0x020a0a0108102304, 0x02040d0108102304, 0x0901280d08102304,
+	0x0016090e09102304, 0x0c00070d29102304, 0x00030a0f29102304, 0x0309010e2a102304, 0x0303001a0d1d0c05, 0x021607000e200c05,
+	0x121f07000e200c05, 0x010314040f001506, 0x011416070f001506, 0x01011f090e111506, 0x0014020e0e111506, 0x030c0d041c040007,
+	0x0c160d071c040007, 0x0503130219050007, 0x050e170219050007, 0x02030b041f050007, 0x020b16071f050007, 0x030218040e100007,
+	0x021618070e100007, 0x010314040f110007, 0x011416070f110007, 0x030a1a040a010107, 0x0a161a070a010107, 0x00030c04131e0107,
+	0x00160c07131e0107, 0x00030b04151e0107, 0x00160b07151e0107, 0x02040102181e0107, 0x00031b1904050507, 0x03040007131a0707,
+	0x00021d07131a0707, 0x04012007131a0707, 0x01022207131a0707, 0x00030b041d040c07, 0x00160b071d040c07, 0x030400070b1a0c07,
+	0x00021d070b1a0c07, 0x040120070b1a0c07, 0x010222070b1a0c07, 0x00031a0b13041007, 0x00031a04140a1007, 0x03040900260a1007,
+	0x0009021d260a1007, 0x04090120260a1007, 0x01090222260a1007, 0x0209011b040f1007, 0x0204011f040f1007, 0x02090118290f1007,
+	0x01011f090e111107, 0x0014020e0e111107, 0x030c1c040a010108, 0x0c161c070a010108, 0x01000e231e150c08, 0x0304090623011008,
+	0x0115072101091008, 0x0115002116091008, 0x060f010719080309, 0x0103140406001109, 0x0114160706001109, 0x0103140406001509,
+	0x0114160706001509, 0x030b060400012309, 0x0b06160700012309, 0x0003130408012309, 0x0016130708012309, 0x09061600050c2809,
+	0x01021e091a0c2809, 0x0304090701102809, 0x0400072013102809, 0x03042004080c010d, 0x04162007080c010d, 0x01091e2d0910040d,
+	0x02000717081a040d, 0x080110070803060d, 0x020117070803060d, 0x030420040800150d, 0x041620070800150d, 0x000304040f221010,
+	0x0006051600081a10, 0x030301040a012213, 0x031601070a012213, 0x000302040f181014, 0x030604040b001218, 0x061604070b001218,
+	0x030601040a011218, 0x061601070a011218, 0x02030b040600021a, 0x020b16070600021a, 0x03010d04080c021a, 0x01160d07080c021a,
+	0x000124091c0c021a, 0x080609240110021a, 0x000313040f10021a, 0x0404200e0401101b, 0x080609041701101b, 0x0c00071c0804101b,
+	0x00041f040409101b, 0x01171a0105070c00, 0x0101171a11070c00, 0x001f210f05090c00, 0x0a0f070125090c00, 0x01142104090a0c00,
+	0x01142109050d0c00, 0x0a0f012809070e00, 0x090406071a0e1000, 0x0100021a1e0f1000, 0x0101170709131000, 0x0107040d041f1000,
+	0x020208200d281000, 0x000407051a0c2c01, 0x0f0406070d102c01, 0x0f030106290e1e04, 0x010701040b101e04, 0x0105090116101e04,
+	0x01070d0108102304, 0x010d000a09102304, 0x0616000e09102304, 0x0006001e09102304, 0x0105090112102304, 0x0109000718102304,
+	0x00010d0718102304, 0x0116070101200c05, 0x0101010317200c05, 0x000c010f22200c05, 0x000a0c0123200c05, 0x00061e07011c1005,
+	0x00090a1e131c1005, 0x00061f0701251005, 0x00090a1f13251005, 0x012104011c001506, 0x02050c011b101506, 0x0a050c010e111506,
+	0x012104011c110007, 0x01150101181e0107, 0x01070102181e0107, 0x0401031b251e0107, 0x0f0502011b0b0807, 0x0401032225180c07,
+	0x0401032518070d07, 0x010d001f06051007, 0x0002221e13091007, 0x0101170f000a1007, 0x000f1c1e050a1007, 0x01011701170a1007,
+	0x020a0501250a1007, 0x02010513250a1007, 0x0600021d260a1007, 0x0e000222260a1007, 0x0107011f040f1007, 0x01011701120f1007,
+	0x01002104180f1007, 0x010d00021f0f1007, 0x02050c011b111007, 0x000c1e0d051d1007, 0x01070003251e1007, 0x04010703251e1007,
+	0x0a050c010e111107, 0x000e1a061b010108, 0x010d01091f011008, 0x0e001e2d0910040d, 0x01000017081a040d, 0x010017010b1a040d,
+	0x000103070b12180f, 0x0101071d0e10240f, 0x0101170709001010, 0x0100060d14041010, 0x010021040a091010, 0x010021050d091010,
+	0x01090007021f1010, 0x00010d07021f1010, 0x010004060d102213, 0x00040c2504102413, 0x0609040606002a15, 0x010b040606002a15,
+	0x010d00060610021a, 0x060904061906001b, 0x010b04061906001b, 0x0604060e0615001b, 0x0202010d1507031b, 0x0e00001e0804101b,
+	0x06001f040409101b, 0x011e2304070a0100, 0x03072505040b1000, 0x07012718030e1000, 0x0305092505161000, 0x042718031b000301,
+	0x0c00091b2a070301, 0x0214000e1e101101, 0x0216000e14101506, 0x042718031b050007, 0x0805180101220b07, 0x0800182304090c07,
+	0x042718001b050e07, 0x0216020e16001007, 0x10000222260a1007, 0x07012718000f1007, 0x000e2718050f1007, 0x0216000e14111007,
+	0x020f000107191a07, 0x00101a061b010108, 0x03010d2501131008, 0x02000a281e0c010d, 0x030701251210010d, 0x10001e2d0910040d,
+	0x02001d2801081010, 0x020021011e0a1010, 0x030700020b291010, 0x020706010c0a1110, 0x0307000306102a11, 0x0209001b28061014,
+	0x0200091f28061014, 0x02090b0506002a15, 0x0209000f0010241a, 0x0200130b0810241a, 0x02090b051906001b, 0x020b050e0615001b,
+	0x0207051b01090b1b, 0x0200051707090b1b, 0x02000f2501090e1b, 0x030701130901101b, 0x020210061601101b, 0x030700170604101b,
+	0x030700160804101b, 0x1000001e0804101b, 0x020114000409101b, 0x020121010409101b, 0x020023160409101b, 0x020607011409101b,
+	0x02002304100d101b, 0x020e01060a01111b, 0x020906010009111b, 0x020014010b09111b, 0x0200061c060c181d, 0x0b070b050b280100,
+	0x13041422090e0c00, 0x0400041118021000, 0x1406060d19021000, 0x0400041319021000, 0x0401131d080a1000, 0x04000f021a0a1000,
+	0x04120113030e1000, 0x01130419040e1000, 0x0401021a040f1000, 0x1201060d1b121000, 0x03040508160b1200, 0x000c1c051b000301,
+	0x04010b041f000301, 0x00120d1b28070301, 0x02060d1d28070301, 0x0206160d29070301, 0x1000091b2a070301, 0x00100d1b2a070301,
+	0x060e050719090301, 0x0b07050e1f0b0301, 0x1406060d02102001, 0x0400041302102001, 0x0c0601090d102401, 0x1406060d01101e04,
+	0x0400041301101e04, 0x040013040b101e04, 0x1406060d00102304, 0x0400041300102304, 0x04000d1308102304, 0x170c000a09102304,
+	0x0416000e09102304, 0x00060d2811102304, 0x00060d2815102304, 0x0407000718102304, 0x00010d0818102304, 0x0002070d25102304,
+	0x0f00000d29102304, 0x0000150d29102304, 0x000700132b102304, 0x01060d04251c0005, 0x11060d0017200c05, 0x00010d0f22200c05,
+	0x000a010d23200c05, 0x0019060d23200c05, 0x0400041801101005, 0x040018040b101005, 0x0205010d1b101506, 0x0a05010d0e111506,
+	0x000c1c051b050007, 0x04010b041f050007, 0x040b0406141a0007, 0x0d041501251a0007, 0x070d0402251a0007, 0x04001302181e0107,
+	0x000b1a0212280107, 0x0c01160d1e010c07, 0x09010506251a0e07, 0x1506040d17001007, 0x170c001f06051007, 0x0b000d2817051007,
+	0x000f241a050a1007, 0x02010527130a1007, 0x0f010605260a1007, 0x01011c0f260a1007, 0x02010515260a1007, 0x13040016260a1007,
+	0x0101021b260a1007, 0x0400021d260a1007, 0x04120113000f1007, 0x0401131d010f1007, 0x0400131b040f1007, 0x0400131f040f1007,
+	0x170c00021f0f1007, 0x000904281f0f1007, 0x130400132b0f1007, 0x0904001b2b0f1007, 0x0101121d2b0f1007, 0x0009041f2b0f1007,
+	0x0205010d1b111007, 0x0000241a02151007, 0x01000d211a171007, 0x09000d2b051d1007, 0x040c0029051f1007, 0x0c0c01010f1f1007,
+	0x01031a0d00281007, 0x0001131a00281007, 0x00001a1205281007, 0x03000d1b12281007, 0x00030d1f12281007, 0x0a05010d0e111107,
+	0x000e010a04231107, 0x030405011a0b1207, 0x00040d0606101a07, 0x040b17050a010108, 0x040b0b051b010108, 0x040003180b150b08,
+	0x00040d1a1e010c08, 0x170c01091f011008, 0x0c0c010601101e09, 0x0c0c010006102309, 0x0004062812102309, 0x0b07040614002809,
+	0x0b07040610002a09, 0x04041706080c010d, 0x040003171e0c010d, 0x0b0704062a0c010d, 0x070d04042310010d, 0x040417060800150d,
+	0x0100121b0703280d, 0x0102061d0703280d, 0x000103080b12180f, 0x1201060d0010240f, 0x01060d1d0110240f, 0x00060d1b0410240f,
+	0x00060d1f0410240f, 0x1304000a0910240f, 0x1300050d0910240f, 0x0101081d0e10240f, 0x000700021f10240f, 0x040b040606190010,
+	0x04040606091c0010, 0x120407060c2b0010, 0x0b0704060f2b0010, 0x0404000609000f10, 0x00040d061c000f10, 0x130400220e091010,
+	0x0400021a040e1010, 0x04070007021f1010, 0x00010d08021f1010, 0x00040d23042b1010, 0x001a0d0507090313, 0x0c06010901102213,
+	0x04060d0618002a13, 0x000c00051e000315, 0x01020b2706070315, 0x13040e0106002a15, 0x0409040606002a15, 0x04010b040600021a,
+	0x0b0701062c0c021a, 0x010313062c0c021a, 0x170c00060610021a, 0x000700221210021a, 0x000109241610021a, 0x0c0c010601100d1a,
+	0x0b0711010001241a, 0x011118010801241a, 0x000b07021101241a, 0x000c09040110241a, 0x0a0109040f10241a, 0x01000e040f10241a,
+	0x010113070f10241a, 0x070101080f10241a, 0x090400090f10241a, 0x000109041210241a, 0x0400060e1210241a, 0x000700021510241a,
+	0x13040e011906001b, 0x040904061906001b, 0x0e0418060809001b, 0x04060d061c11001b, 0x120407060c12001b, 0x0b0704060f12001b,
+	0x0404060e0615001b, 0x09041a060101031b, 0x0007180505010b1b, 0x0407051b0c010b1b, 0x011807050a040b1b, 0x0107051b0d040b1b,
+	0x000b07021b040b1b, 0x04000f250c010e1b, 0x01000f250d040e1b, 0x0104210c0401101b, 0x0406070c1401101b, 0x0101210d0404101b,
+	0x0106070d1404101b, 0x04001f040409101b, 0x00040d230412101b, 0x0904060c0001111b, 0x0400140c0b01111b, 0x0901060d0004111b,
+	0x0100140d0b04111b, 0x04060d061c00151e, 0x0105180b1b060300, 0x000f231816070300, 0x03100d0a17070300, 0x01140c1809170300,
+	0x15061515061b0300, 0x05062215061b0300, 0x080c091c061b0300, 0x010023090f1b0300, 0x08060209181b0300, 0x0806020922240300,
+	0x0a0f100b09260300, 0x0006150527040e05, 0x02120f0100150308, 0x0100221a0b150308, 0x0a0f1000020a0b08, 0x00020018150b0f08,
+	0x000a081a03150b0a, 0x020416070600040e, 0x12041f070600040e, 0x020401061808040e, 0x00010506291a040e, 0x010003180812050e,
+	0x0a06150011050a0e, 0x0c01000f1f050a0e, 0x0002030a1a070a0e, 0x010a110018080a0e, 0x0205011810070b0e, 0x0002081819150b0e,
+	0x0003061919150b0e, 0x03040507011a0b0e, 0x00040820131a0b0e, 0x060101151c1b0310, 0x00060115201b0310, 0x0209190106230310,
+	0x0201160706230310, 0x12011f0706230310, 0x0801091b06230310, 0x0100031808050a11, 0x0100160908032011, 0x0100090f22032011,
+	0x0806000923032011, 0x01000a0923032011, 0x0009000f200a0212, 0x0001090d200a0816, 0x0004201606020519, 0x0008062206020519,
+	0x0004072306020519, 0x000e062406020519, 0x0001062307020519, 0x0009000f14020a19, 0x0708060119020b19, 0x05000c0619020b19,
+	0x0007100619020b19, 0x0006130e19020b19, 0x01071a001d030d1d, 0x0300120d0803181d, 0x00030f061c03181d, 0x02071603101a0300,
+	0x12071f03101a0300, 0x021601091b1a0300, 0x06170f060b1d0300, 0x0006051a171d0300, 0x06021611201d0300, 0x04060a1b241d0300,
+	0x03060806160a1e00, 0x0212010119180307, 0x0d00280d1e180307, 0x00000d121e180307, 0x0a0f230015090308, 0x001506151a090308,
+	0x000b19052a090308, 0x0a0f1000040a0b08, 0x020714001d031e09, 0x010725001d031e09, 0x0a06150016050a0a, 0x0000120f1f050a0a,
+	0x0000100f23050a0a, 0x0305180114050b0a, 0x0005022010070b0a, 0x030400230705110d, 0x11011e091c03120d, 0x00000a281e03120d,
+	0x01141e092d03120d, 0x0c0104061800220d, 0x0a0f100003080a0e, 0x0001210619020b0e, 0x00030617161b0b0e, 0x0009000f030a1b10,
+	0x01001f1609070212, 0x0100031808050a13, 0x0100160908032013, 0x0100090f22032013, 0x0806000923032013, 0x01000a0923032013,
+	0x001601091b180314, 0x020400060d040816, 0x0c0104060b002216, 0x0004201606040519, 0x0008062206040519, 0x0004072306040519,
+	0x000e062406040519, 0x0001062307040519, 0x0009000f14040a19, 0x0708060119040b19, 0x05000c0619040b19, 0x0007100619040b19,
+	0x0006130e19040b19, 0x020714001d030d1a, 0x010725001d030d1a, 0x000625100003181a, 0x000325140003181a, 0x0000260d0603181a,
+	0x110f06000d03181a, 0x011107000d03181a, 0x040620011603181a, 0x060801062203181a, 0x040607012303181a, 0x030600152303181a,
+	0x060e01062403181a, 0x02021a091a090300, 0x0200231922090300, 0x00060d1a1e110300, 0x0116180109150300, 0x0118010315150300,
+	0x0c000a0d1e1c0300, 0x0100090f1f0a1404, 0x00031a0525040e05, 0x050c1d01001a0307, 0x02000d1b0b1a0307, 0x0500161b0b1a0307,
+	0x1101121e111a0307, 0x0101191e111a0307, 0x011e0115181a0307, 0x000407281e1a0307, 0x00090b052a1a0307, 0x011e01112d1a0307,
+	0x000403281a070f07, 0x000400201a0b0f07, 0x0101090d1f0a1707, 0x01011e0408032809, 0x01001e0f18032809, 0x0a0f100003070a0a,
+	0x0a0f1000020a070d, 0x11011e091c03160d, 0x00000a281e03160d, 0x01141e092d03160d, 0x0001210619040b0e, 0x0009000f020f0a17,
+	0x0000030719110b19, 0x0000030612150b19, 0x0009000f030a171a, 0x02121a0112070300, 0x050f23061c070300, 0x00061715161b0300,
+	0x0a001a0f22030c01, 0x0a000a1a23030c01, 0x1506150615030f01, 0x00031b06190a1404, 0x0009000f1f0a1404, 0x080c00230f1f0307,
+	0x010409062a041707, 0x0001090d1f0a1707, 0x050028051a010308, 0x02011b000d150308, 0x080c002306031e09, 0x020416070600040a,
+	0x12041f070600040a, 0x0a030f0019050a0a, 0x0c01000f20050a0a, 0x010a160013080a0a, 0x0c001c0f2203010d, 0x0c000a1c2303010d,
+	0x0a0f1000040a070d, 0x010301051b26040e, 0x000209190525070e, 0x0302011a0525070e, 0x0002081819130b0e, 0x0003061919130b0e,
+	0x0003061920140b0e, 0x03000d08152c0310, 0x02000d0102071c13, 0x0100160908032213, 0x0100090f22032213, 0x0806000923032213,
+	0x01000a0923032213, 0x0103010d22160217, 0x0703010123160217, 0x0009000f040f0a17, 0x030518010d030b17, 0x000f060a19030b17,
+	0x0100070a19030b17, 0x000c070d19030b17, 0x000c080d19030b17, 0x0000031209160b17, 0x01000d0f22031218, 0x01000a0d23031218,
+	0x080c002306030d1a, 0x050416000306001e, 0x050f230624070300, 0x020d001e0f0e0300, 0x0516001e0f0e0300, 0x0118010316150300,
+	0x0209190f06170300, 0x1506151506190300, 0x0506221506190300, 0x080c091c06190300, 0x010023090f190300, 0x0806020918190300,
+	0x0110001118050a01, 0x1506151506032001, 0x0506221506032001, 0x080c091c06032001, 0x010023090f032001, 0x0806020918032001,
+	0x01141a061c010307, 0x0516011525010307, 0x000c1c06271a0307, 0x00051d06271a0307, 0x0a011e06271a0307, 0x05012206271a0307,
+	0x0001091c130b1c07, 0x0217011525010308, 0x0100061c121b0b0e, 0x0006011520190310, 0x0601011525190310, 0x02091901061f0310,
+	0x02011607061f0310, 0x12011f07061f0310, 0x0801091b061f0310, 0x02000d0104071c13, 0x07280d0023160314, 0x0301011525160314,
+	0x00031a06271a0314, 0x0009060306012216, 0x0200040b06160217, 0x020d070a00030517, 0x0516070a00030517, 0x071f160d00030517,
+	0x0711280d00030517, 0x040323010a030517, 0x000325010b030517, 0x00030e011b030b17, 0x040310011b030b17, 0x0001091c080f0b17,
+	0x110f06010d010519, 0x011107010d010519, 0x0006080624040519, 0x0004010d24040519, 0x110f06000c03181a, 0x011107000c03181a,
+	0x020300062303181a, 0x00051b060603181d, 0x000906070603181d, 0x020300061803181d, 0x02121a0117070300, 0x020a0517070d0300,
+	0x06181005260e0300, 0x03181405260e0300, 0x00060514181d0300, 0x0516052610010307, 0x00280d0517150307, 0x0118090526150307,
+	0x01051005001a0307, 0x00011a06121a0307, 0x09010a06251a0307, 0x00011406251a0307, 0x000e0a051b230307, 0x050016050c240307,
+	0x0001090420240307, 0x0217052610010308, 0x0200170505070a0a, 0x0601052610190310, 0x03180105260b0314, 0x0301052610160314,
+	0x00061a050a1e0314, 0x0003250103120519, 0x0007011c0603181d, 0x00060d1a21110300, 0x0c000a0d25170300, 0x0c000a0d211c0300,
+	0x030704161a030600, 0x0310040a16040600, 0x020f052307040b00, 0x0212011a07040e00, 0x0307040816032400, 0x050f0f1817030701,
+	0x02001b0411050a01, 0x0a071a171b030c01, 0x0a15071a26030c01, 0x0215071829031601, 0x0207020407061a01, 0x020013040c061a01,
+	0x040206092c061a01, 0x02001d0110011404, 0x0100091b2a061404, 0x020013010d061a04, 0x0403001a25041e05, 0x0703180120032405,
+	0x0006111520032405, 0x0500081620032405, 0x050403162c060006, 0x000218170d051106, 0x050f181700090307, 0x0100181a17090307,
+	0x0100181a110e0307, 0x0000172614180307, 0x0a011221101a0307, 0x00011717121a0307, 0x00040728211a0307, 0x000c0a171b1f0307,
+	0x0201010417031707, 0x0205280d01041707, 0x0002050c2b041707, 0x0001091c2b041707, 0x0207020400061707, 0x0002020b29061707,
+	0x0f00021809042107, 0x0002050c1a042107, 0x0001091c1a042107, 0x030704011a032407, 0x0304091828040109, 0x01001e111a032809,
+	0x020009171d032809, 0x020021041c00040a, 0x000205062a15040a, 0x00000a1b041b040a, 0x00020519061b040a, 0x020012041b00060a,
+	0x0e001f051b00060a, 0x04000a202204000d, 0x0c001f1b0206000d, 0x0c071c171b03010d, 0x0c15071c2603010d, 0x00000a282103160d,
+	0x01000a1b1e00040e, 0x000205061c25040e, 0x020605150126040e, 0x000205061926040e, 0x011000121e01050e, 0x000208180324180f,
+	0x000306190324180f, 0x000208181b03220f, 0x000306191b03220f, 0x020016070a1f0310, 0x12001f070a1f0310, 0x08060009251f0310,
+	0x01000a09251f0310, 0x0006042319032410, 0x040303011b061a12, 0x02000d0104081c13, 0x010709171b032213, 0x0115070926032213,
+	0x1000280d00160314, 0x00280d0123160314, 0x000023190b1a0314, 0x00000d1b04040816, 0x00020a2404040816, 0x00001c2404040816,
+	0x0002050b1c040816, 0x040200181c040816, 0x0004071b04002216, 0x0202050009002216, 0x0002050c12002216, 0x0001091c12002216,
+	0x0200041406160217, 0x0103011714160217, 0x0703040126160217, 0x0200160712030317, 0x00121f0712030317, 0x020101061b030317,
+	0x010301211b030317, 0x0406001523030417, 0x020d000a01030517, 0x0516000a01030517, 0x001f160d01030517, 0x0011280d01030517,
+	0x00030f170d030517, 0x02000d0112030517, 0x0003250114030517, 0x0403070125030517, 0x040307011b030917, 0x01070d171b031218,
+	0x0115070d26031218, 0x0002160c02002218, 0x0009061702002218, 0x0113061c02010319, 0x0806001829040419, 0x0406001a031e0419,
+	0x0005170306090519, 0x0009061a0324021a, 0x0d0600250e03181a, 0x0002050b1804081e, 0x040200181804081e, 0x0110010317170300,
+	0x1008060a17170300, 0x10000c0f22170300, 0x10000a0c23170300, 0x0a07250504050a01, 0x0c07270504050a01, 0x0a0a052509050a01,
+	0x0a0c052709050a01, 0x0a000a251e030f01, 0x0c000a271e030f01, 0x000616051a032c01, 0x030424011c040006, 0x0a0f101e0b010307,
+	0x080c001e2c0e0307, 0x0a0f10000c240307, 0x0006042319130b0e, 0x080105012200220f, 0x01000d0f221f0310, 0x01000a0d231f0310,
+	0x0306001e152c0310, 0x0a0604000b0a1c13, 0x01000a0a1e032613, 0x000904061c040816, 0x0500000502002216, 0x00090e0602002216,
+	0x0006251000030517, 0x0003251400030517, 0x0000260d06030517, 0x110f06000d030517, 0x011107000d030517, 0x0406200116030517,
+	0x0608010622030517, 0x0406070123030517, 0x0306001523030517, 0x060e010624030517, 0x0000130719030b17, 0x0006160c19030b17,
+	0x0706011019030b17, 0x0006011503110519, 0x0304011c0704001e, 0x000904061804081e, 0x01000a0a1e03121e, 0x050c010e1b060300,
+	0x051901151b060300, 0x0c001c0f220e0300, 0x0c000a1c230e0300, 0x0c000d0f22190300, 0x0c000a0d23190300, 0x0c000a0d1e1b0300,
+	0x010701171e060600, 0x0c000d0f22032001, 0x0c000a0d23032001, 0x0002251800051106, 0x0001030e160b1707, 0x11011e091c031509,
+	0x00000a281e031509, 0x01141e092d031509, 0x0002081810100b0a, 0x0a0f100005080a0e, 0x0009002322190310, 0x0009000f050a1b10,
+	0x010400171e060111, 0x0118010106160314, 0x001601091b1a0314, 0x0500000504002216, 0x00090e0604002216, 0x0003250f00030517,
+	0x0009000f110a0518, 0x0001090d180a0818, 0x0006011503051118, 0x0006011503130519, 0x0500010f030d0a19, 0x0000110f030d0a19,
+	0x0000030719120b19, 0x0c01000f0a0b021a, 0x0a0f122311070300, 0x15061506150a0300, 0x0201041d060d0300, 0x130606241a110300,
+	0x1306180625110300, 0x0118010318150300, 0x0c000d0f22170300, 0x0c000a0d23170300, 0x0006130d1e1d0300, 0x0006171516032c01,
+	0x0009000f140a1e05, 0x0103180101051106, 0x00001b0d1b230307, 0x0a0a0900020a1707, 0x0001090d1a0a1e07, 0x0a0f101e0b010308,
+	0x010006041d032809, 0x0106150d23000a0a, 0x0100110f23000a0a, 0x00000f2314050a0a, 0x0a0f100005070a0a, 0x00010d231a070a0a,
+	0x0a06150002100a0a, 0x0c01000f0a1b040d, 0x010003180813050e, 0x01001609081f0310, 0x0100090f221f0310, 0x08060009231f0310,
+	0x01000a09231f0310, 0x03000d08152a0310, 0x020116061a030711, 0x12011f061a030711, 0x1204000901071c13, 0x000a0b091c032613,
+	0x020a0300090a0816, 0x0403200116030517, 0x0308010622030517, 0x0403070123030517, 0x030e010624030517, 0x0806050901030b17,
+	0x0100090619030b17, 0x0000120719030b17, 0x0703011019030b17, 0x0004011c050f0b17, 0x0708060219010b19, 0x0009000f050a171a,
+	0x0d0600230e03181a, 0x000a0b091c03121e, 0x02121a0119070300, 0x0d14280d09190300, 0x150615060f190300, 0x0d06150624190300,
+	0x0006130d1b1d0300, 0x03040516060b0600, 0x01021a1109050a01, 0x0d14280d09032001, 0x150615060f032001, 0x0d06150624032001,
+	0x03041b0101051106, 0x00011b0504051106, 0x05000d161e010307, 0x000c1c06251a0307, 0x00051d06251a0307, 0x0a011e06251a0307,
+	0x05012206251a0307, 0x080e001e0f230307, 0x0000210d1b230307, 0x000904062b041707, 0x0a0a0900040a1707, 0x000904061a042107,
+	0x02000d171e010308, 0x000906191d0b0409, 0x070d06001c032809, 0x0a06150004100a0a, 0x01020a061e01050e, 0x011000101e01050e,
+	0x0304001b0813050e, 0x0103061616000b0e, 0x0003061924140b0e, 0x00060d011e190310, 0x080600241e190310, 0x03040103160a0111,
+	0x020004011e160314, 0x00030d011e160314, 0x0306001c1e160314, 0x00031a06251a0314, 0x0306001e181e0314, 0x0500030501002216,
+	0x0009040612002216, 0x0201090700030517, 0x0708061b00030517, 0x0216070101030517, 0x0001061b08030517, 0x02000d0110030517,
+	0x0001090402002218, 0x0708060419010b19, 0x000403061007171d, 0x050416000506001e, 0x0403030f1007001e, 0x0200150f1e0d0300,
+	0x0118010312150300, 0x011001031e160300, 0x1008060a1e160300, 0x08060209221b0300, 0x09060611181d0300, 0x0100180102051106,
+	0x011a01151d010307, 0x0a280d001d120307, 0x000928060b1a0307, 0x0a012103101a0307, 0x05012105101a0307, 0x0a0c0d0019240307,
+	0x0200000f0d230310, 0x0007010306082216, 0x0200041606160217, 0x0003250116030517, 0x0003030118160b17, 0x03060503100b0018,
+	0x00060310100b0018, 0x00030314100b0018, 0x0009000f2c031218, 0x0000030613150b19, 0x050c012119060300, 0x02121a0113070300,
+	0x05021326090e0300, 0x0c06160121120300, 0x03100d0916150300, 0x0504231609170300, 0x0504160025170300, 0x03180f0626170300,
+	0x0102160908190300, 0x0806020923190300, 0x080602091e1b0300, 0x05041600211c0300, 0x0606061a171d0300, 0x0a0f10010b0a0600,
+	0x0102031808050a01, 0x0110001123050a01, 0x021507180b0f0c01, 0x0a0f1001060a0e01, 0x00061d15050b1601, 0x0102160908032001,
+	0x0806020923032001, 0x011507090b0f1e04, 0x0a0f10010f0a0006, 0x0100180104051106, 0x00072801211a0307, 0x0a0a0901010a1707,
+	0x0a010901130a1707, 0x000a0b01140a1707, 0x00021806140a1707, 0x050019030f0b1c07, 0x05001606040a1e07, 0x050f15280b010308,
+	0x050f28061b010308, 0x0a0f1001010a0b08, 0x0306170628040109, 0x0a0f1001060a0109, 0x0a06150116000a0a, 0x0a0f100100070a0a,
+	0x000a01161a070a0a, 0x0a06150101100a0a, 0x000a010619100a0a, 0x0c15071c03010b0a, 0x020a1701080a000d, 0x041507200b0f010d,
+	0x0a0f1001010a070d, 0x02001725050b070d, 0x010211091e01050e, 0x010200091e16050e, 0x0a0f100100080a0e, 0x000a01180f080a0e,
+	0x000a011906170a0e, 0x0103061617000b0e, 0x0415072000140b0e, 0x00030617101e0b0e, 0x0200280d0903180f, 0x0006190b1d1e0310,
+	0x03180106261f0310, 0x000a0b01060a1c13, 0x00021806060a1c13, 0x0200170111160314, 0x000a0c01060a1315, 0x00150a0604040816,
+	0x020a0001090a0816, 0x000a0c01120a0816, 0x00071b0104002216, 0x0016020e08030517, 0x0004231209030517, 0x0004120025030517,
+	0x0703010125030517, 0x000412001b030917, 0x070301011b030917, 0x0500160606030a17, 0x000412071b030b17, 0x0006090924040519,
+	0x0003250105120519, 0x0708061801040b19, 0x0115070d0b0f021a, 0x0201221b060d0300, 0x0105160908190300, 0x0806050923190300,
+	0x080605091e1b0300, 0x0a0f10020b0a0600, 0x020116070d070401, 0x01121f070d070401, 0x0105031808050a01, 0x0a0f1002060a0e01,
+	0x0105160908032001, 0x0806050923032001, 0x0403200110071404, 0x000e15051b070006, 0x0a0f10020f0a0006, 0x0504201622010307,
+	0x050019220c230307, 0x0a0a0902010a1707, 0x0a010902130a1707, 0x000a0b02140a1707, 0x0500160e04072407, 0x0204201722010308,
+	0x000f102322010308, 0x05001922280d0308, 0x0a0f1002010a0b08, 0x0a0f1002060a0109, 0x0500192206032809, 0x010006221b032809,
+	0x0a06150216000a0a, 0x0a0f100200070a0a, 0x000a02161a070a0a, 0x0a06150201100a0a, 0x000a020619100a0a, 0x020a1702080a000d,
+	0x0a0f1002010a070d, 0x000306172807110d, 0x000619222603160d, 0x000306171507220d, 0x011507160025070e, 0x0703041a0025070e,
+	0x070304011026070e, 0x0a0f100200080a0e, 0x000a02180f080a0e, 0x000a021906170a0e, 0x0406200122190310, 0x000a0b02060a1c13,
+	0x0403200122160314, 0x000a0c02060a1315, 0x020a0002090a0816, 0x000a0c02120a0816, 0x0200041006160217, 0x0016050e08030517,
+	0x0003250110030517, 0x0500192206030d1d, 0x02001d1a100e0300, 0x010701171d060600, 0x02001d0210050a01, 0x01030221190b0a01,
+	0x000927060b1a0307, 0x000a2303101a0307, 0x00052305101a0307, 0x050101151b1f0307, 0x001101151b1f0307, 0x010005261a040e07,
+	0x02121a0100130308, 0x00011419060b0409, 0x00000f1f040a1409, 0x0100081d100b1409, 0x00021a091a031509, 0x0000231922031509,
+	0x00020f091c032809, 0x000706151c032809, 0x050014091d032c09, 0x000d14091d032c09, 0x000023190313070a, 0x010a160015060a0a,
+	0x010a160011070a0a, 0x0305180214000b0a, 0x0105011d10070b0a, 0x0005180414070b0a, 0x110e1e091c03010d, 0x0e141e092d03010d,
+	0x010005261a04070d, 0x010a1600170a070d, 0x010a1600120a080d, 0x000302052513050e, 0x030201021026070e, 0x000302051b13090e,
+	0x0001190516080b0e, 0x0003021f19130b0e, 0x000a1c091c030d0f, 0x000a0b1c0903180f, 0x010400171d060111, 0x02000d0201071c13,
+	0x0517000a08030517, 0x00160102070f0517, 0x0000140719030b17, 0x0000031c090f0b17, 0x0003000218160b17, 0x01031a0d0e0a0018,
+	0x0100160f0e0a0018, 0x010316061a0a0018, 0x0517010303010519, 0x0104150926010519, 0x0107060f26010519, 0x0104001226010519,
+	0x0103061326010519, 0x0003250200120519, 0x0003001a0b0f021a, 0x000023160603181a, 0x00060d1a1e100300, 0x130606241a120300,
+	0x1306180625120300, 0x0a00090f22190300, 0x0a000a0923190300, 0x0a000a091e1b0300, 0x000f180d091c0300, 0x02001d07190b0401,
+	0x0713060a190b0401, 0x02001d0410050a01, 0x01030421190b0a01, 0x0a00090f22032001, 0x0a000a0923032001, 0x00150e0504051106,
+	0x010d18061d010307, 0x0118010c1d010307, 0x00040a1b20230307, 0x0001050e160b1707, 0x0006020519091609, 0x0305180414000b0a,
+	0x110c1e091c03010d, 0x0c141e092d03010d, 0x000304052513050e, 0x030201041026070e, 0x000304051b13090e, 0x0003041f19130b0e,
+	0x00021a0e0903180f, 0x0d06010116032c11, 0x0a0300190d0a0212, 0x02000d0401071c13, 0x0015060e08030517, 0x0009060f19030b17,
+	0x0003000418160b17, 0x0006020d1a0a0018, 0x0006020e190b1118, 0x0016060d03010519, 0x0906011503010519, 0x01060d220c010519,
+	0x070601230c010519, 0x0003250400120519, 0x0306051801040b19, 0x0000050719120b19, 0x0006020e19130b19, 0x140e280d09190300,
+	0x1507280d16190300, 0x0406201516190300, 0x0608150622190300, 0x0a00090f22190300, 0x0a000a0923190300, 0x0406071523190300,
+	0x060e150624190300, 0x0a000a091e1b0300, 0x040607151e1b0300, 0x0006051a171d0300, 0x060819061b1d0300, 0x040603151b070f00,
+	0x0106150529040a01, 0x01111a091c030c01, 0x01141a092d030c01, 0x01280d051b001601, 0x140e280d09032001, 0x1507280d16032001,
+	0x0406201516032001, 0x0608150622032001, 0x0a00090f22032001, 0x0a000a0923032001, 0x0406071523032001, 0x060e150624032001,
+	0x000600150b0f1e04, 0x0105180101051106, 0x00000d1e14180307, 0x010b1f05101a0307, 0x01011a0619240307, 0x030400012b041707,
+	0x030400011a042107, 0x0100051e15040e08, 0x0100081f100b1409, 0x00000a261e031509, 0x0006040519091609, 0x0106150d1f000a0a,
+	0x0100110f1f000a0a, 0x00000f1f14050a0a, 0x00010d1f1a070a0a, 0x0105011f10070b0a, 0x0200081803150b0a, 0x030704002c05070d,
+	0x01020f091e01050e, 0x010706151e01050e, 0x010005180813050e, 0x030400082c14050e, 0x0102011e1007070e, 0x080600221e190310,
+	0x00062515001f0310, 0x0018280d081f0310, 0x00061505250b0314, 0x0100050c1e040816, 0x020a0500090a0816, 0x0304000112002216,
+	0x0002080e04072216, 0x01001f0f050f0217, 0x0110000a08030517, 0x0000100719030b17, 0x0006040d1a0a0018, 0x0006040e190b1118,
+	0x0110010303010519, 0x1008060a03010519, 0x0500020719090b19, 0x0003060f19120b19, 0x0006040e19130b19, 0x080105011500221a,
+	0x07080619190b0401, 0x0012070615032c01, 0x050a1e160b010307, 0x0a280d0017150307, 0x0801190624150307, 0x011e0115181a0307,
+	0x0a0e0a001b230307, 0x050a16000c240307, 0x020a1e170b010308, 0x01001e0f050a1409, 0x01001e0f18032809, 0x020a170005070a0a,
+	0x08010502240b070d, 0x0302021a0025070e, 0x030202011026070e, 0x0a061e010b190310, 0x010600231c050a13, 0x0a031e010b160314,
+	0x0a061a000a1e0314, 0x0500050501002216, 0x00020b0306072216, 0x0517000e08030517, 0x02060e0109030517, 0x0003230116030517,
+	0x0306001423030517, 0x000f060f19030b17, 0x0100070f19030b17, 0x0305010b1b030b17, 0x0003010f1b030b17, 0x0106011c28040018,
+	0x0f06011503010519, 0x0107011503010519, 0x0306051c02010b19, 0x0500040719090b19, 0x030600231003181a, 0x0005061c0603181d,
+	0x01141518090a0300, 0x03180f0624170300, 0x00060513181d0300, 0x0102221109050a01, 0x1506150619030f01, 0x150606151e030f01,
+	0x0314150d09032c01, 0x03041b011c040006, 0x0101090525051106, 0x010109051b091106, 0x010016091e120307, 0x00042803211a0307,
+	0x04021800140a1707, 0x05041600040a1e07, 0x0517001e19090308, 0x0500181e28090308, 0x0106010519091609, 0x0d0600230205110d,
+	0x0d0600231c03160d, 0x010301052513050e, 0x000105250616050e, 0x0302041a0025070e, 0x030204011026070e, 0x010301051b13090e,
+	0x000105061b16090e, 0x1506150600030d0f, 0x0016140e091f0310, 0x03180106241f0310, 0x0300181e0d280310, 0x02031806190a0113,
+	0x04021800060a1c13, 0x01140018090b0314, 0x0f032306001a0314, 0x0f031806001d0314, 0x03140d09011d0314, 0x00041b0304002216,
+	0x0201040006160217, 0x0403010325030517, 0x040301031b030917, 0x0504160006030a17, 0x0100060f19030b17, 0x0003050118160b17,
+	0x00060510100b0018, 0x00030514100b0018, 0x0806051801040b19, 0x0000050613150b19, 0x0509062519060300, 0x0906160625120300,
+	0x0606051a171d0300, 0x09060617181d0300, 0x02001b07190b0401, 0x00040c17190b0401, 0x010a221109050a01, 0x02001b0410050a01,
+	0x00061501160b1404, 0x00000619160b1404, 0x0002221800051106, 0x0219010104081106, 0x08011b0104081106, 0x0101091f190b1106,
+	0x011a01161d010307, 0x01001101160b1707, 0x00001002160b1707, 0x051516012a010308, 0x050015042a010308, 0x001620012a130308,
+	0x000020042a130308, 0x0306170528040109, 0x01001e101a032809, 0x0c0100221b032809, 0x01011e08190b110d, 0x010100180813050e,
+	0x0103011f19130b0e, 0x00011f0619160b0e, 0x001606170003180f, 0x01001f160d070411, 0x00001906160b0212, 0x00040120190b0413,
+	0x000601231c050a13, 0x00150a0504040816, 0x00001704160b0816, 0x05011b0101002216, 0x000f010306082216, 0x0219010107030417,
+	0x08011b0107030417, 0x0003220f00030517, 0x0101080918160b17, 0x061601012a040518, 0x000601042a040518, 0x0116210102040818,
+	0x0801220102040818, 0x0001210402040818, 0x0106010e190b1118, 0x001606001a031218, 0x0116210103060419, 0x0801220103060419,
+	0x0001210403060419, 0x0004011624040519, 0x0016010815090519, 0x0016010e08120519, 0x05010c0619010b19, 0x0106130e19010b19,
+	0x0004011719040b19, 0x0501010719090b19, 0x0001110719090b19, 0x0100060f19120b19, 0x0106010e19130b19, 0x0009061c0603181d,
+	0x1008060b1e160300, 0x0310040216040600, 0x02040e0e190b0401, 0x0502191611010307, 0x00020b042a160307, 0x00021a0b14180307,
+	0x000212040d230307, 0x00140e030f0b1c07, 0x0202191711010308, 0x02020b042a010308, 0x00020b042a110308, 0x101306001a031509,
+	0x021606001a031509, 0x020613001a032809, 0x0a03050110100b0a, 0x00020f0603150b0a, 0x020b06042a03010d, 0x03041414000b070d,
+	0x020a0517000b070d, 0x04140e20000b070d, 0x010204011e07040e, 0x010200180813050e, 0x05140704011b0b0e, 0x100806190003180f,
+	0x0206190111190310, 0x0204010b190b0411, 0x000602231c050a13, 0x0203190111160314, 0x0002240204040816, 0x0206040006160217,
+	0x0403230116030517, 0x0600060f19030b17, 0x0403010f1b030b17, 0x0016020815090519, 0x0016020e08120519, 0x030614000b0f021a,
+	0x0012220619070300, 0x001206221e070300, 0x02140806001a0307, 0x02140106121a0307, 0x02000b1d21090308, 0x0302011e0315070a,
+	0x0214000f1503010d, 0x02000a281e03010d, 0x00021e08190b110d, 0x0214000f0003160d, 0x02001f1609070111, 0x0003251100030517,
+	0x0216000e08030517, 0x0200000719030b17, 0x0002062307010519, 0x0200061c0603181d, 0x0200170f0a180300, 0x0200100f0f180300,
+	0x0503062519180300, 0x140e270d09190300, 0x1507270d16190300, 0x0200120f0a1a0300, 0x02071409171a0300, 0x000f1a0d091c0300,
+	0x01011907160b0b00, 0x0109000f120a1e00, 0x01031b06190a1301, 0x0109000f1f0a1301, 0x01270d051b001601, 0x0200091b2a071601,
+	0x0200090f1f0a1701, 0x140e270d09032001, 0x1507270d16032001, 0x000614051a032c01, 0x02051809140b0006, 0x0002090525051106,
+	0x000209051b091106, 0x0002091f190b1106, 0x010d1a061d010307, 0x011a010c1d010307, 0x0802230d22010307, 0x0a020900130a1707,
+	0x010a0b00140a1707, 0x0101000e160b1707, 0x000612191d0b0409, 0x020013170301070a, 0x0100120f1f000a0a, 0x0100100f23000a0a,
+	0x010a00161a070a0a, 0x010a000619100a0a, 0x0305011803150b0a, 0x020417060804000d, 0x020b17050803010d, 0x020013172203010d,
+	0x00041e08190b110d, 0x01030d221801050e, 0x070301231801050e, 0x010005250616050e, 0x010209190025070e, 0x010005061b16090e,
+	0x010a00180f080a0e, 0x010a001906170a0e, 0x0101210619010b0e, 0x01001f0619160b0e, 0x000617062403180f, 0x0018270d081f0310,
+	0x0109000f000a1b10, 0x04001f1609070111, 0x0207001d18030c11, 0x0109000f200a0113, 0x010a0b00060a1c13, 0x08000d2306032013,
+	0x010a0c00060a1315, 0x0204000609040816, 0x010a0c00120a0816, 0x01090e0601002216, 0x0717060a00030517, 0x0107070a00030517,
+	0x0003251300030517, 0x0100120908030517, 0x0109000f010f0a17, 0x0006140c19030b17, 0x0011060f19030b17, 0x0002080918160b17,
+	0x0100130f0e0a0018, 0x0109000f140a0018, 0x010313061a0a0018, 0x0006011c26040518, 0x000606241a031218, 0x1106011503010519,
+	0x0104201606010519, 0x0108062206010519, 0x0104072306010519, 0x010e062406010519, 0x0004062307010519, 0x0116000815090519,
+	0x0116000e08120519, 0x0109000f14010a19, 0x0107100619010b19, 0x0100110719090b19, 0x0100000719120b19, 0x0100000613150b19,
+	0x0109000f000a171a, 0x0a061211181d0300, 0x0400091b2a071601, 0x0400090f1f0a1701, 0x04051809140b0006, 0x0004090525051106,
+	0x000409051b091106, 0x0004091f190b1106, 0x0a040900130a1707, 0x05000a281e03010d, 0x0516000e08030517, 0x0500000719030b17,
+	0x0004080918160b17, 0x0005060f19120b19, 0x0500061c0603181d, 0x010f1f230b070300, 0x05110b1609170300, 0x12061501191b0300,
+	0x0f04230607040b00, 0x0114000f100a0b00, 0x0100161309072100, 0x051e160115030701, 0x110a1a091c030c01, 0x0a141a092d030c01,
+	0x1406150619030f01, 0x140606151e030f01, 0x0114000f0f0a1701, 0x00000d0f19072405, 0x110218000d051106, 0x110109011c051106,
+	0x0100140f190b1106, 0x0207001e25180307, 0x05150115001a0307, 0x010b2105101a0307, 0x001d0115181a0307, 0x01220115181a0307,
+	0x11010a03211a0307, 0x110c0a001b1f0307, 0x0a011a0619240307, 0x0f10010620240307, 0x0100140d1a0b0f07, 0x04280d0601041707,
+	0x010014022b041707, 0x00040c062b041707, 0x010014021a042107, 0x00040c061a042107, 0x0200220b18150308, 0x05001519060b0409,
+	0x0114000f000a1409, 0x00001d0f050a1409, 0x0100220f050a1409, 0x01000f011f0a1409, 0x0207001d23031e09, 0x0515000f00032809,
+	0x00001d0f18032809, 0x0100220f18032809, 0x000406062a15040a, 0x00040619061b040a, 0x0f1000230301070a, 0x0114000f11010a0a,
+	0x0114000f170a000d, 0x110c1c091c03010d, 0x0f1000232203010d, 0x0c141c092d03010d, 0x000f1024050b070d, 0x01001419110b070d,
+	0x00042008190b110d, 0x000406061c25040e, 0x060415060126040e, 0x000406061926040e, 0x01001d101e01050e, 0x110301011c13050e,
+	0x0011011c0616050e, 0x0114000f01140a0e, 0x1406150600030d0f, 0x000004261e190310, 0x0114000f0b0a0111, 0x0114000f000a0e12,
+	0x0000200f050a0e12, 0x020600231c050a13, 0x000622150b032213, 0x110109091c032213, 0x07280d001d032213, 0x011409092d032213,
+	0x00040b061c040816, 0x0204000609002216, 0x0100140212002216, 0x00040c0612002216, 0x0100210f050f0217, 0x1103010117160217,
+	0x030501052d160217, 0x00110b1209030517, 0x11030f000d030517, 0x0100250910030517, 0x0207000723030517, 0x0000041023030517,
+	0x0000100f0b030a17, 0x0103010d0e160a17, 0x0104010f19030b17, 0x000b060f19030b17, 0x00051905090d0b17, 0x0206011c28040018,
+	0x11010d091c031218, 0x01140d092d031218, 0x000f100202002218, 0x00010c0402002218, 0x0b06011503010519, 0x0000251004090519,
+	0x0000170f030d0a19, 0x00100c0819040b19, 0x0005190702090b19, 0x0100160819090b19, 0x0207001d23030d1a, 0x0207001d18030d1d,
+	0x000a061c0603181d, 0x00040b061804081e, 0x02051a0513070300, 0x021d1a0119070300, 0x0114241a090a0300, 0x0202221b060d0300,
+	0x02141b09110d0300, 0x020f010317170300, 0x030a0f0125170300, 0x02091409171a0300, 0x10061501191b0300, 0x030a0f01211c0300,
+	0x010a1b011e040600, 0x05180103040a1e00, 0x060a100105092000, 0x030a140105092000, 0x010a160107092000, 0x010a110108092000,
+	0x020216070d070401, 0x12021f070d070401, 0x0114210909032c01, 0x0301011b2a061404, 0x000a010610092005, 0x000a010614092005,
+	0x022104011c040006, 0x021204011b060006, 0x0e1f05011b060006, 0x0201090525051106, 0x020109051b091106, 0x0516062421010307,
+	0x000a030116092007, 0x0217062421010308, 0x000a030111092008, 0x0206010519091609, 0x000602221b032809, 0x020301052513050e,
+	0x000205250616050e, 0x020301051b13090e, 0x000205061b16090e, 0x0306051617000b0e, 0x0601062421190310, 0x02160701011f0310,
+	0x121f0701011f0310, 0x02010103171f0310, 0x030a0101251f0310, 0x0301062421160314, 0x00280d0823160314, 0x0207040006160217,
+	0x020d000a08030517, 0x0516000a08030517, 0x001f160d08030517, 0x0011280d08030517, 0x0700060f19030b17, 0x020d010303010519,
+	0x0516010303010519, 0x02121a0617070300, 0x02190612070d0300, 0x0106160908190300, 0x0806060923190300, 0x08060906191b0300,
+	0x080606091e1b0300, 0x080c1c0607030701, 0x0106031808050a01, 0x0115181606030c01, 0x0106160908032001, 0x0806060923032001,
+	0x080e05061b010006, 0x00160e0504051106, 0x0201091f190b1106, 0x051606160a010307, 0x0115181601090307, 0x00160b062a160307,
+	0x011000060b1a0307, 0x000f28060b1a0307, 0x00090616121a0307, 0x001612060d230307, 0x080e06000f230307, 0x021706160a010308,
+	0x020b16062a010308, 0x00160b062a110308, 0x0b0616062a03010d, 0x02011e08190b110d, 0x011606011e07040e, 0x0203011f19130b0e,
+	0x00021f0619160b0e, 0x0806240600190310, 0x060106160a190310, 0x03061c0600160314, 0x030106160a160314, 0x0212090111160314,
+	0x03060600181e0314, 0x0507060401012216, 0x0016060e08030517, 0x0201080918160b17, 0x0206010e190b1118, 0x05020c0619010b19,
+	0x0206130e19010b19, 0x0502010719090b19, 0x0002110719090b19, 0x0200060f19120b19, 0x0206010e19130b19, 0x0007061c0603181d,
+	0x0e08061622160300, 0x0109160908190300, 0x010d160909190300, 0x0806090712190300, 0x0806090923190300, 0x080609091e1b0300,
+	0x09061211181d0300, 0x010314040b040600, 0x011416070b040600, 0x0109031808050a01, 0x010d031809050a01, 0x1506031516070a01,
+	0x0d06150704080a01, 0x030a1a0408030c01, 0x0a161a0708030c01, 0x01141a091c030c01, 0x0103140406040e01, 0x0114160706040e01,
+	0x150607151e030f01, 0x15060315070f0f01, 0x0806090703061301, 0x001203071b071701, 0x020b020706061a01, 0x0804090707061a01,
+	0x0109160908032001, 0x010d160909032001, 0x0806090712032001, 0x0806090923032001, 0x0012180716032c01, 0x0806090700061404,
+	0x0615070b01061404, 0x0118090709061404, 0x00070b0619061404, 0x010314040f040006, 0x011416070f040006, 0x0c011c070b1a0307,
+	0x01101e070b1a0307, 0x080c07000f1f0307, 0x0c170d0021240307, 0x0804090700061707, 0x0111070b01061707, 0x0010070b02061707,
+	0x010e090705061707, 0x09040900130a1707, 0x00030b0404041e07, 0x00160b0704041e07, 0x030f101f0b010308, 0x0215001118150308,
+	0x0103140401040b08, 0x0114160701040b08, 0x0103140406040109, 0x0114160706040109, 0x0b06020701061a09, 0x080c070006031e09,
+	0x010314040007040a, 0x011416070007040a, 0x00031d040507040a, 0x030122040507040a, 0x00161d070507040a, 0x011622070507040a,
+	0x010304011f07040a, 0x011607011f07040a, 0x00030406021a040a, 0x00160706021a040a, 0x030420040804000d, 0x041620070804000d,
+	0x030c1c040803010d, 0x0c161c070803010d, 0x010314040104070d, 0x011416070104070d, 0x00031704041b000e, 0x00161707041b000e,
+	0x000304061c04040e, 0x001607061c04040e, 0x010314040008040e, 0x011416070008040e, 0x000320040508040e, 0x001620070508040e,
+	0x000307121026070e, 0x0001031d0607220f, 0x021607000e1f0310, 0x121f07000e1f0310, 0x0e08060016032c11, 0x00070b1906060212,
+	0x00011b0004081c13, 0x0012000925032013, 0x0806090700032213, 0x0301090408032213, 0x0116090708032213, 0x1506001511032213,
+	0x01280d0923160314, 0x000919070b1a0314, 0x03011a070b1a0314, 0x0017070b04060816, 0x0500070d04060816, 0x000d070d04060816,
+	0x0115110000160217, 0x0303010b04160217, 0x030f010705160217, 0x0204040006160217, 0x00030b0406030417, 0x00160b0706030417,
+	0x03040e0e00030517, 0x0016090e08030517, 0x020a0e0109030517, 0x020d010a09030517, 0x0516010a09030517, 0x011f160d09030517,
+	0x0111280d09030517, 0x00160d0e09030517, 0x0001151b09030517, 0x00011b0012030517, 0x0400060f19030b17, 0x00030c0402040818,
+	0x00160c0702040818, 0x03010d0408031218, 0x01160d0708031218, 0x000124091c031218, 0x0009170302002218, 0x00030c0403060419,
+	0x00160c0703060419, 0x0009080924040519, 0x080c070006030d1a, 0x030401160c03181a, 0x030614000e03181a, 0x030600160e03181a,
+	0x02000e092303181a, 0x02000e091803181d, 0x0c03070d1007001e, 0x000218090d05111e, 0x01051a0513070300, 0x081f062416070300,
+	0x011d1a0119070300, 0x0102221b060d0300, 0x0a0f0325070d0300, 0x050f0525070d0300, 0x01141b09110d0300, 0x010f010317170300,
+	0x000c0f0f22170300, 0x000a0c0f23170300, 0x08260111081a0300, 0x00152616081a0300, 0x01091409171a0300, 0x08060624171a0300,
+	0x0806050b241a0300, 0x080526011a040600, 0x010216070d070401, 0x000a1d07190b0401, 0x000407051a091601, 0x012104011c040006,
+	0x011204011b060006, 0x00001e0504051106, 0x0a0f1e0f0b010307, 0x08001e1e11090307, 0x011e1e001a090307, 0x0a0f1e010b120307,
+	0x0107001e25180307, 0x0401071e25180307, 0x0a0f0f000c240307, 0x0401032518070f07, 0x0100220b18150308, 0x0107001d23031e09,
+	0x000a081803150b0a, 0x110e1e091c03010d, 0x06000a281e03010d, 0x0e141e092d03010d, 0x0a0f140005080a0e, 0x01160701011f0310,
+	0x01010103171f0310, 0x000c010f221f0310, 0x000a0c01231f0310, 0x0a0f0700090a0212, 0x0107050425050a13, 0x0a01050925050a13,
+	0x08001e1e06030f13, 0x0806001e25030f13, 0x01000a1e25030f13, 0x0a0a0500090a0816, 0x0104000609002216, 0x0107040006160217,
+	0x010d000a08030517, 0x0616000e08030517, 0x0006001e08030517, 0x0401200716030517, 0x0108070622030517, 0x0107000723030517,
+	0x0401070723030517, 0x010e070624030517, 0x0600000719030b17, 0x0701071019030b17, 0x010d010303010519, 0x0004070c19120b19,
+	0x0002080d13150b19, 0x0107001d23030d1a, 0x0107001d18030d1d, 0x0600061c0603181d, 0x0216222311070300, 0x03141425090e0300,
+	0x140e2025090e0300, 0x15072025160e0300, 0x030706241a120300, 0x0307180625120300, 0x0818062406140300, 0x0823180109140300,
+	0x071f180310150300, 0x0c00090f22190300, 0x0c000a0923190300, 0x0c000a091e1b0300, 0x02011907160b0b00, 0x0209000f120a1e00,
+	0x0307070a190b0401, 0x0d18271806030701, 0x182718010c030701, 0x02031b06190a1301, 0x0209000f1f0a1301, 0x0c00090f22032001,
+	0x0c000a0923032001, 0x080523180b010307, 0x1827180101150307, 0x0800180624150307, 0x020a0b00140a1707, 0x0201000e160b1707,
+	0x0200120f1f000a0a, 0x0200100f23000a0a, 0x020a00161a070a0a, 0x020a000619100a0a, 0x11101e091c03010d, 0x10141e092d03010d,
+	0x020005250616050e, 0x020209190025070e, 0x020005061b16090e, 0x020a00180f080a0e, 0x020a001906170a0e, 0x0201210619010b0e,
+	0x02001f0619160b0e, 0x0420250000190310, 0x0320250601190310, 0x0020250007190310, 0x0300250109190310, 0x0120250109190310,
+	0x072025000a190310, 0x000820250b190310, 0x0020250810190310, 0x0009202511190310, 0x0209000f000a1b10, 0x0209000f200a0113,
+	0x020a0b00060a1c13, 0x00182718080b0314, 0x0427180000160314, 0x0327180601160314, 0x0027180007160314, 0x0127180109160314,
+	0x072718000a160314, 0x000827180b160314, 0x0027180810160314, 0x0009271811160314, 0x020a0c00060a1315, 0x020a0c00120a0816,
+	0x02090e0601002216, 0x0209000f010f0a17, 0x0200130f0e0a0018, 0x0209000f140a0018, 0x020313061a0a0018, 0x0204201606010519,
+	0x0208062206010519, 0x0204072306010519, 0x020e062406010519, 0x0216000815090519, 0x0216000e08120519, 0x0209000f14010a19,
+	0x0207100619010b19, 0x0200110719090b19, 0x0200000719120b19, 0x0200000613150b19, 0x0209000f000a171a, 0x00130d0f22170300,
+	0x000a130d23170300, 0x0400170f0a180300, 0x0400100f0f180300, 0x1000090f22190300, 0x00100d0f22190300, 0x10000a0923190300,
+	0x000a100d23190300, 0x0400120f0a1a0300, 0x04071409171a0300, 0x08120109241a0300, 0x10000a091e1b0300, 0x000a100d1e1b0300,
+	0x030402161a070600, 0x120802061a0a0600, 0x04060d0615042100, 0x0304020816072400, 0x04041a0010062600, 0x00040d0f230a1701,
+	0x1000090f22032001, 0x00100d0f22032001, 0x10000a0923032001, 0x000a100d23032001, 0x0f1207060f032c01, 0x00040d23190b1106,
+	0x0c0101151b1f0307, 0x0001130d20240307, 0x130400012b041707, 0x000b0917020b1c07, 0x130400011a042107, 0x030402011a072407,
+	0x07041a0101062608, 0x000c14091d032c09, 0x040013170301070a, 0x010b071f03010b0a, 0x040417060804000d, 0x040b17050803010d,
+	0x04000a281e03010d, 0x040013172203010d, 0x0b070b052a03010d, 0x01000f0f0a1b040d, 0x00041a050916060d, 0x011304002005070d,
+	0x071304002c05070d, 0x00041a051209070d, 0x130400082c14050e, 0x120100160215070e, 0x0104061616000b0e, 0x000b072405140b0e,
+	0x0004061924140b0e, 0x000700221e190310, 0x11060d00171f0310, 0x00010d0f221f0310, 0x000a010d231f0310, 0x0019060d231f0310,
+	0x0407001d18030c11, 0x1200022509070113, 0x00020d0f1d0a0113, 0x00140d0921032c13, 0x14060d0600160314, 0x0404000609040816,
+	0x00040d061c040816, 0x1304000112002216, 0x170c000a08030517, 0x0416000e08030517, 0x0401200816030517, 0x0108080622030517,
+	0x0401070823030517, 0x010e080624030517, 0x0519060d01030b17, 0x0400000719030b17, 0x0701081019030b17, 0x00060d1619030b17,
+	0x010b070b000f0b17, 0x0b0701062c031218, 0x010313062c031218, 0x0c01011807040419, 0x170c010303010519, 0x0010070a03010519,
+	0x010b070b13010b19, 0x040115092703181a, 0x0107060f2703181a, 0x040100122703181a, 0x010306132703181a, 0x0400061c0603181d,
+	0x04060d061c04001e, 0x00040d061804081e, 0x001f0d0f051d1400, 0x0304010317261400, 0x0301230d060e1a00, 0x06140e0c0e1f0105,
+	0x030614110e1f0105, 0x060e15010a270105, 0x0906150600270a05, 0x000615050f270a05, 0x00061505270a0e05, 0x030614010e1f1105,
+	0x00061a06251f1405, 0x0601150107271505, 0x02120f0100061a05, 0x01000a180e061a05, 0x0014000b0e231a05, 0x0a0f100b0e020108,
+	0x0402201804150108, 0x0a0c050d0e150108, 0x040215180e150108, 0x0204160706000a0e, 0x12041f0706000a0e, 0x0204010618080a0e,
+	0x00010506291a0a0e, 0x000a05060e1a0d0e, 0x020116070d00160e, 0x01121f070d00160e, 0x020012040f00160e, 0x0e001f050f00160e,
+	0x0200010f1105160e, 0x0000120f2a05160e, 0x0201010d1808160e, 0x0204160706020011, 0x12041f0706020011, 0x0601150107250511,
+	0x0219010107040811, 0x08011b0107040811, 0x00280d0517050811, 0x0118090526050811, 0x010109050d1b0811, 0x0301000d1b220811,
+	0x080600091e042511, 0x01000a091e042511, 0x04021800001c2511, 0x02031806011c2511, 0x00021800071c2511, 0x02011801091c2511,
+	0x020718000a1c2511, 0x000208180b1c2511, 0x02001808101c2511, 0x00020918111c2511, 0x04060515001d2512, 0x0500091608040a1d,
+	0x0500160503070a1d, 0x0215071804010d1d, 0x0000030f0e16171d, 0x000303061a16171d, 0x00061605030d1500, 0x01041b001e0b1a00,
+	0x060306160e091e00, 0x000a0b1c0e021107, 0x020700041e181407, 0x010109050d181507, 0x000e05061a002507, 0x010109051b0c2507,
+	0x0a0a090004132507, 0x0a0f100b0e040108, 0x001505041a091408, 0x000419062a091408, 0x010610051b002909, 0x010314051b002909,
+	0x020016070405150a, 0x00121f070405150a, 0x0200010f1605160a, 0x030414140e03000d, 0x020a05170e03000d, 0x04140e200e03000d,
+	0x0a0b06000325190d, 0x0204010a0325190d, 0x030400081125190d, 0x000604060618270d, 0x0200000f0d160212, 0x0003060216202512,
+	0x0204160706020013, 0x12041f0706020013, 0x0601150107250513, 0x0219010107040813, 0x08011b0107040813, 0x00280d0517050813,
+	0x0118090526050813, 0x010109050d1b0813, 0x0301000d1b220813, 0x080600091e042513, 0x01000a091e042513, 0x04021800001c2513,
+	0x02031806011c2513, 0x00021800071c2513, 0x02011801091c2513, 0x020718000a1c2513, 0x000208180b1c2513, 0x02001808101c2513,
+	0x00020918111c2513, 0x020400060d0a0816, 0x0201000d0d160816, 0x060b01051d030a16, 0x0007012c06011e16, 0x030614140e210501,
+	0x060f150107230501, 0x080c1c010a020901, 0x0006171516022501, 0x0d061401021a2501, 0x0012070601191404, 0x050000051a082504,
+	0x0012130705002904, 0x00120f0706002904, 0x09060e1506002904, 0x050000051a082904, 0x030f0101071b2904, 0x03140e0d0e1d0105,
+	0x030e1a010a250105, 0x09031a0600250a05, 0x00031a050f250a05, 0x00031a05250a0e05, 0x0207001d0d1d1405, 0x0009190107251505,
+	0x03011a0107251505, 0x04042020041a0107, 0x01001423041a0107, 0x0a10050c0e1a0107, 0x040415200e1a0107, 0x000a0b1c0e041107,
+	0x00040328221a1407, 0x000904062a1a1407, 0x01010a050d1a1507, 0x000e050601191707, 0x03060b0506280009, 0x0306061708280009,
+	0x0415072004012809, 0x0f06040619002909, 0x0107040619002909, 0x010602041d002909, 0x051118000408160e, 0x0006150602231b0f,
+	0x000603051d060011, 0x0306012b16070011, 0x0103051a0d0d0011, 0x03040008160e2511, 0x00041b0004191a12, 0x00000a1b040c2512,
+	0x00020519060c2512, 0x00041b00041a2512, 0x030614000e021518, 0x0306050005251918, 0x0100060d0d251918, 0x000e01060a15021b,
+	0x0018010f06051b1d, 0x0500030f0c16001e, 0x00140e03091d0f1e, 0x00150703161d0f1e, 0x000e03010a09191e, 0x0118010303151400,
+	0x080c1c010a040901, 0x04022018041c0901, 0x0a0c050d0e1c0901, 0x040215180e1c0901, 0x0200180f22140c01, 0x02000a1823140c01,
+	0x1506150504140f01, 0x0006171516042501, 0x0c070d05041c2501, 0x0a0c050d091c2501, 0x04021518091c2501, 0x020718060f1c2501,
+	0x04021800121c2501, 0x02031806131c2501, 0x0100090f2a161404, 0x010009210b181804, 0x0100160908141e04, 0x0100090f22141e04,
+	0x0806000923141e04, 0x01000a0923141e04, 0x010409062a0a1707, 0x0101090d2a161707, 0x0901090603191707, 0x01001d001e151408,
+	0x0a0f100003072509, 0x0204160706000a0a, 0x12041f0706000a0a, 0x020116070d00160a, 0x01121f070d00160a, 0x020012040f00160a,
+	0x0e001f050f00160a, 0x051104001a07160a, 0x0c001f0f0216000d, 0x0400200f2214010d, 0x04000a202314010d, 0x00042022040f070d,
+	0x010301051b260a0e, 0x0806000903221b0f, 0x01000a0903221b0f, 0x00061605030d0011, 0x0200180b19220813, 0x00030f061c021e16,
+	0x06140e010e050f18, 0x030614000e11021a, 0x01000d0f2214021a, 0x01000a0d2314021a, 0x00030f0602181e1e, 0x0304130116190600,
+	0x02121a0103071400, 0x0304010322161400, 0x1306250111011a00, 0x040a1a001c011a00, 0x030614140e1c0501, 0x060e15010a250501,
+	0x020f10050f220801, 0x011402160f220801, 0x09061506030a2501, 0x0106150d250a2501, 0x0100110f250a2501, 0x040a1a00031c2501,
+	0x0002180b071c2501, 0x02031806121c2501, 0x03020f06211c2501, 0x00020a0a19082504, 0x00020a0a19082904, 0x0209190106201405,
+	0x0201160706201405, 0x12011f0706201405, 0x0801091b06201405, 0x00041f1201251906, 0x0509050006251906, 0x00011f1206251906,
+	0x00042006271a1407, 0x010106231e151408, 0x020003140b190009, 0x010003250b190009, 0x0a0f100107012509, 0x0c01000f23052509,
+	0x0002030a1a082509, 0x050008051a052909, 0x0002030a1a082909, 0x030414140e00060d, 0x020a05170e00060d, 0x04140e200e00060d,
+	0x080102180413070d, 0x000615022c051b0f, 0x0406051500261b0f, 0x00020621061c2511, 0x00041f0106182512, 0x00011f0606182512,
+	0x00071b0104190816, 0x0504002901011e16, 0x030614000e15021a, 0x00041f010614181d, 0x00011f060614181d, 0x0004031b06051b1d,
+	0x0500160505070f1e, 0x0110030116160600, 0x1306250111021a00, 0x040a1a001c021a00, 0x01030f051c051a00, 0x01061505140a2501,
+	0x010711051b0a2501, 0x01061503210a2501, 0x00061d1503172501, 0x03070d03061c2501, 0x000a1a03071c2501, 0x020718030a1c2501,
+	0x03040f060a1c2501, 0x04021800171c2501, 0x00061505100d2504, 0x0307000d03251906, 0x0001140e03251906, 0x00001d1003251906,
+	0x0501160500052507, 0x01011e031a072509, 0x000c1f031c13070d, 0x00060f031d19130e, 0x0004060a061c2511, 0x00030602161d2512,
+	0x0504002901021e16, 0x0310040a160a0600, 0x0212011a070f0a00, 0x020f0523070a0b00, 0x0212011a070a0e00, 0x020603150a0f1100,
+	0x010209130f031a00, 0x0110000c1e0b1a00, 0x02120107090f1a00, 0x001206070d1c0501, 0x0006151309250501, 0x0006151109270501,
+	0x0310110d19050801, 0x020c220d19050801, 0x0214280d19050801, 0x0f0406090d1b0801, 0x0802260901210801, 0x010c0d28091a0901,
+	0x010a092c091a0901, 0x020218100c1c0901, 0x020718171b140c01, 0x0215071826140c01, 0x02011607090c1101, 0x01121f07090c1101,
+	0x0106152c09061301, 0x0006031509171701, 0x00021814071c2501, 0x020c050d081c2501, 0x00020c18081c2501, 0x020718090a1c2501,
+	0x0200180c0a1c2501, 0x0c000d02251c2501, 0x0006031509112c01, 0x0009001b1f191404, 0x020615010f0d1804, 0x0006001509241804,
+	0x02010106110a1e04, 0x01030121110a1e04, 0x010709171b141e04, 0x0115070926141e04, 0x03000d1a15082504, 0x080600191a172504,
+	0x0309180d15002904, 0x02040e0a19002904, 0x0500091b19002904, 0x00040e1c19002904, 0x000e091d19002904, 0x0c000a0d23002904,
+	0x00040e1909012904, 0x03000d1a15082904, 0x0014001907102904, 0x0006001509132904, 0x0202190d00210105, 0x0302180d0c210105,
+	0x020016070a201405, 0x12001f070a201405, 0x0806000925201405, 0x01000a0925201405, 0x0403001a1d251405, 0x0300180d0d211505,
+	0x01001e011a141a05, 0x0010000f0b251a05, 0x0403001a250a1e05, 0x0501190009220a06, 0x01001117171d0f06, 0x0202190103210f06,
+	0x0801021b03210f06, 0x050119090c230107, 0x0307230d11010407, 0x040a201a11010407, 0x0102182111010a07, 0x03050417001a1407,
+	0x00011d17051a1407, 0x02010521101a1407, 0x010c012b09061707, 0x0205280d010a1707, 0x0002050c2b0a1707, 0x0001091c2b0a1707,
+	0x0504031601191d07, 0x010c01091a062107, 0x0f000218090a2107, 0x0002050c1a0a2107, 0x0001091c1a0a2107, 0x08020d0221002507,
+	0x0501190009082507, 0x08000d02210f2507, 0x00001d0514112507, 0x070104091b112507, 0x0102181d0c090108, 0x05011909280d0108,
+	0x0100111e09150108, 0x040c201c11010408, 0x0500152311010408, 0x0000232011130408, 0x0000172611130408, 0x0104202111010a08,
+	0x01000a231e151408, 0x0100181d0d091508, 0x0204031701191d08, 0x0200031407190009, 0x0100032507190009, 0x03040918280a0109,
+	0x0801020121280809, 0x0006061720042509, 0x0304001a17072509, 0x0304001a12082509, 0x0501190609012809, 0x010c0109031a2809,
+	0x0100031e0f1a2809, 0x0304091812002909, 0x0204011915052909, 0x0304001a12082909, 0x010c010903182909, 0x0100031e0f182909,
+	0x07060401111d2909, 0x020021041c000a0a, 0x000205062a150a0a, 0x00000a1b041b0a0a, 0x00020519061b0a0a, 0x020017170507160a,
+	0x0c01001b2005190a, 0x04000a20220a000d, 0x070d06271104010d, 0x040720171b14010d, 0x041507202614010d, 0x020117220900060d,
+	0x000420221112060d, 0x000420171312060d, 0x030400160d0f070d, 0x010619260901160d, 0x010c01240909190d, 0x00000a280f031b0d,
+	0x0006132211031b0d, 0x0006131713031b0d, 0x0306061700271b0d, 0x0003061110271b0d, 0x020b06050600280d, 0x010514090600280d,
+	0x010c01091a09280d, 0x050119000926030e, 0x01000a1b1e000a0e, 0x000205061c250a0e, 0x0206051501260a0e, 0x0002050619260a0e,
+	0x0001190907250d0e, 0x000019021625130e, 0x0306021b1600190e, 0x00060015092b0210, 0x0406030119191d10, 0x020016051a010011,
+	0x12001f051a010011, 0x01000a1b1e020011, 0x01001f1601120411, 0x080600160d1c0511, 0x0310040a16000811, 0x030400160d0a0811,
+	0x0100001e09180912, 0x020116070a090013, 0x01121f070a090013, 0x0403200111042213, 0x0403030116191d14, 0x0010002c010d1215,
+	0x010c0109060c2a15, 0x00000d1b040a0816, 0x00020a24040a0816, 0x00001c24040a0816, 0x0002050b1c0a0816, 0x040200181c0a0816,
+	0x000a091a1c030a16, 0x00000d03060f1e16, 0x0406001523030a17, 0x0009001b040f1917, 0x030602001b190518, 0x000a092503180a18,
+	0x000c092703180a18, 0x0406200111041218, 0x0806001829040a19, 0x0406001a031e0a19, 0x01060121110a021a, 0x01070d171b14021a,
+	0x0115070d2614021a, 0x06000f1a03280a1a, 0x000b061b0901021b, 0x000600150912021b, 0x010c010919060c1b, 0x05011900090b091c,
+	0x0501190609010d1d, 0x0002050b180a081e, 0x04020018180a081e, 0x000a091a03180a1e, 0x02000a180f010f1e, 0x02000f1806080f1e,
+	0x03061403190e1100, 0x03041424090a1400, 0x0306011517171400, 0x030504091c0e1a00, 0x080601171c0e1a00, 0x0606152804210501,
+	0x030614150e210501, 0x0219140107040801, 0x0119250107040801, 0x030424011c170801, 0x0c0601161e140c01, 0x130605011b191701,
+	0x080614040e221801, 0x030614030e112001, 0x0d060102151a2501, 0x000c0504061c2501, 0x05150201091c2501, 0x03041101091c2501,
+	0x020b0605111c2501, 0x01051409111c2501, 0x01140306141c2501, 0x030606170c222501, 0x0206011a0e091404, 0x050006200c182504,
+	0x000509200c182504, 0x000320061b112904, 0x0009000f23112904, 0x06140e0c0e1c0105, 0x030614110e1c0105, 0x030614010e1c1105,
+	0x030614000e201105, 0x00061a06251c1405, 0x01000d0f22201405, 0x01000a0d23201405, 0x030424011c0a0006, 0x030417011b190006,
+	0x030400240e1a0f06, 0x0304170101251906, 0x000c000504251906, 0x0001170504251906, 0x01140e1f0e0d0107, 0x0004062c060b1207,
+	0x01010d050d191207, 0x01101d0100041a07, 0x0201210a05041a07, 0x0500010f021b160a, 0x0000110f021b160a, 0x030614000e031e0f,
+	0x0009000f1c160212, 0x00000f2c02160e12, 0x0604062c0e060013, 0x030614031b0e0013, 0x010400171f190113, 0x01000a210b180513,
+	0x030614000e1d0513, 0x030614010e210513, 0x030614030e012213, 0x0d060102011a2513, 0x000214020e090816, 0x000904061c0a0816,
+	0x0501011502160816, 0x0011011502160816, 0x0001090d1c160816, 0x0501060e02190816, 0x0011060e02190816, 0x0501011d02190816,
+	0x0011011d02190816, 0x00060b051c030a16, 0x050001020b270a16, 0x000011020b270a16, 0x0504002902001e16, 0x030614000e030d17,
+	0x0009001b0b11021b, 0x0304011c070a001e, 0x0009000f1116051e, 0x00090406180a081e, 0x0001090d1816081e, 0x00060b0503180a1e,
+	0x0415072004000f1e, 0x0c01040606080f1e, 0x0f10000208080f1e, 0x030400070e1a0f1e, 0x0c01000f031d0f1e, 0x0103060400200f1e,
+	0x0009001b0b02151e, 0x0400200f220e1400, 0x04000a20230e1400, 0x00061605050d1500, 0x02190f0107040801, 0x0c180d0526050801,
+	0x040218030d1b0801, 0x010c0d050d1b0801, 0x0402180f0e1b0801, 0x0301120d1b220801, 0x0702180107191a01, 0x0c000a0d1e042501,
+	0x070218011a072501, 0x000a091a0c182504, 0x0014000b0e251a05, 0x0702180100191707, 0x010613050d190009, 0x03060b0506270009,
+	0x0306061708270009, 0x030414140e000909, 0x020a05170e000909, 0x04140e200e000909, 0x0207170504002509, 0x0304141409002509,
+	0x020a051709002509, 0x04140e2009002509, 0x0415072016002509, 0x0307040018082509, 0x0307040018082909, 0x0500010f041b160a,
+	0x0000110f041b160a, 0x0100110f1e00160e, 0x00000f2c04160e12, 0x02001818080e2512, 0x0500010b270d0515, 0x0000110b270d0515,
+	0x00020a06020d2515, 0x00100010020d2515, 0x000214040e090816, 0x0501011504160816, 0x0011011504160816, 0x0501060e04190816,
+	0x0011060e04190816, 0x0501011d04190816, 0x0011011d04190816, 0x050001040b270a16, 0x000011040b270a16, 0x0504002904001e16,
+	0x0006080603251918, 0x0004010d03251918, 0x030614120e01021a, 0x080614140e01021a, 0x0009001b0b13021b, 0x020f0523070e0a00,
+	0x020f052311071400, 0x15061505040a1400, 0x0f02230107071500, 0x02011c060d0e1a00, 0x080c1c0107040801, 0x020a05091d220801,
+	0x0203011a0e091404, 0x00061d1500172504, 0x03140e0d0e210105, 0x0006011d0a191105, 0x020716001a0c1405, 0x12071f001a0c1405,
+	0x0100160908201405, 0x0100090f22201405, 0x0806000923201405, 0x01000a0923201405, 0x0207001d0d211405, 0x0f04150904170006,
+	0x021201010e1a0f06, 0x0307030d00251906, 0x01001d1100251906, 0x000106020c1a1107, 0x010109050d191207, 0x000a0c01251a1407,
+	0x0208010602161707, 0x01140e1d0e090108, 0x010610050d190009, 0x010314050d190009, 0x0100061c0e1a2809, 0x0100061c0e182909,
+	0x0200010f0210160a, 0x0c0601161e14010d, 0x110f060013031b0d, 0x0111070013031b0d, 0x0500060308250f0e, 0x0005090308250f0e,
+	0x000605051d19130e, 0x0600150b02221b0f, 0x0200030f0d160111, 0x00011c19070c2512, 0x030614030e011218, 0x080101020a0f091c,
+	0x0215071804000f1e, 0x03041424090e1400, 0x0118010305151400, 0x0207140409191400, 0x060f150107250501, 0x0301150d1b220801,
+	0x0200041c0b061201, 0x02000a040b101201, 0x0012070602191701, 0x0207140409142001, 0x020f10050c062501, 0x011402160c062501,
+	0x0206150a020a2501, 0x01000a111e0a2501, 0x070601151e0a2501, 0x0a031a06021c2501, 0x020f1801091c2501, 0x04021800191c2501,
+	0x0403030f221c2501, 0x021901010a170904, 0x08011b010a170904, 0x021901010a031404, 0x08011b010a031404, 0x0009000f2b161404,
+	0x0204001800281a05, 0x0009000f14162105, 0x02051901051d0f06, 0x0801051b051d0f06, 0x021901010a021506, 0x08011b010a021506,
+	0x021901010a110207, 0x08011b010a110207, 0x000106040c1a1107, 0x00042006251a1407, 0x000904062b0a1707, 0x0208010604161707,
+	0x0001090d2b161707, 0x0901090605191707, 0x02120f0100041a07, 0x01000a180e041a07, 0x010003180e091a07, 0x000904061a0a2107,
+	0x0001090d1a162107, 0x0115152104090108, 0x010d14210e090108, 0x0100171e04150108, 0x010d011e0a150108, 0x0100060420042509,
+	0x0a0f100005072509, 0x000409200e1a2809, 0x000409200e182909, 0x0200010f0410160a, 0x020117050d00060d, 0x01100003080f070d,
+	0x030414070e01160d, 0x070d06000225190d, 0x0103060400271b0d, 0x0100091608250f0e, 0x00000f2c0f05160e, 0x0600150b04221b0f,
+	0x0806000905221b0f, 0x01000a0905221b0f, 0x0006150602251b0f, 0x0306011516160111, 0x0306060e16190111, 0x0306011d16190111,
+	0x00040322061c2511, 0x03060106161d2512, 0x02000a040b160114, 0x0000240d04160816, 0x000413001b190518, 0x070601011b190518,
+	0x1506150404000f18, 0x0d0614040e000f18, 0x07060101221b0f18, 0x0d060004221b0f18, 0x030614150e01021a, 0x080101040a0f091c,
+	0x00090306091b0f1e, 0x0212011a070e0a00, 0x02121a0105071400, 0x0212011a11071400, 0x0200030f1b0d1400, 0x030601151e161400,
+	0x040218001c0b1a00, 0x02120107090e1a00, 0x060e150107250501, 0x0012070604191701, 0x0104110020191a01, 0x0806020922042501,
+	0x0206150a040a2501, 0x09061506050a2501, 0x0a031a06041c2501, 0x040a1a00051c2501, 0x00021816071c2501, 0x020e1801091c2501,
+	0x01000a110c202501, 0x070601150c202501, 0x010411001a202501, 0x0200040108181804, 0x00030d0108181804, 0x0306001c08181804,
+	0x00031b0619112904, 0x0009000f1f112904, 0x08000d02210e2507, 0x01001d1e04150108, 0x0c06011608100009, 0x0c06011608011809,
+	0x0a0604001d112509, 0x0100031e0e1a2809, 0x0100031e0e182909, 0x00000a280812040d, 0x00070128080f070d, 0x00000a280e031b0d,
+	0x010d001e08060f0e, 0x010d000708250f0e, 0x0016010219081b0f, 0x0318010102261b0f, 0x050c010c08060015, 0x00030f051c030a16,
+	0x00000d03060e1e16, 0x0009000f2c14021a, 0x00030f0503180a1e, 0x02000a180e010f1e, 0x020603150a0e1100, 0x0304062608161400,
+	0x010209130e031a00, 0x0110000c1e0e1a00, 0x040218001c0f1a00, 0x09280d0617050801, 0x080602091e042501, 0x0a061501180a2501,
+	0x01061505210a2501, 0x0a061501100f2501, 0x00061d1505172501, 0x03070d05061c2501, 0x000a1a05071c2501, 0x0a071a010a1c2501,
+	0x02021808101c2501, 0x04021800131c2501, 0x020615010e0d1804, 0x0504160023002904, 0x0318010626201405, 0x0010000f0e251a05,
+	0x0307000d05251906, 0x0001140e05251906, 0x00001d1005251906, 0x03040626011a1407, 0x000a0b0111132507, 0x0002180611132507,
+	0x03061706280a0109, 0x0a0f100100072509, 0x01011e051a072509, 0x0306170612002909, 0x11011e011312060d, 0x080102230413070d,
+	0x000c1f051c13070d, 0x00060f051d19130e, 0x000719011225130e, 0x0016010419081b0f, 0x0318010104261b0f, 0x011f060e16050811,
+	0x011f011d16050811, 0x00150a06040a0816, 0x0006100603251918, 0x0003140603251918, 0x0004011b06111b1d, 0x0001061b06111b1d,
+	0x0100170f1e160600, 0x000615130b250501, 0x000615110b270501, 0x010c0d280b1a0901, 0x010a092c0b1a0901, 0x020116070b0c1101,
+	0x01121f070b0c1101, 0x0106152c0b061301, 0x000603150b171701, 0x080605091e042501, 0x0100140f10062501, 0x0a061502180a2501,
+	0x01150711220a2501, 0x07060415220a2501, 0x0a061502100f2501, 0x00021810071c2501, 0x0a071a020a1c2501, 0x02051808101c2501,
+	0x0003030f1e1c2501, 0x000603150b112c01, 0x000600150b241804, 0x00040e190b012904, 0x000600150b132904, 0x050119000b220a06,
+	0x0501190b0c230107, 0x010c012b0b061707, 0x000a1e0b0e041a07, 0x010c010b1a062107, 0x050119000b082507, 0x000a0b0211132507,
+	0x0501190b280d0108, 0x0100111e0b150108, 0x0a0f100200072509, 0x050119060b012809, 0x010c010b031a2809, 0x000408200e1a2809,
+	0x010c010b03182909, 0x000408200e182909, 0x020117220b00060d, 0x11011e021312060d, 0x080105230413070d, 0x010619260b01160d,
+	0x010c01240b09190d, 0x010c010b1a09280d, 0x050119000b26030e, 0x0001190b07250d0e, 0x0100081608250f0e, 0x000719021225130e,
+	0x000600150b2b0210, 0x0000031e061c2511, 0x0100001e0b180912, 0x020116070a0b0013, 0x01121f070a0b0013, 0x0109060b081e0015,
+	0x010c010b060c2a15, 0x000b061b0b01021b, 0x000600150b12021b, 0x010c010b19060c1b, 0x050119000b0b091c, 0x050119060b010d1d,
+	0x0004021b06111b1d, 0x0a03051a0e0e1100, 0x080e1b0107040801, 0x021902010a160801, 0x02120201051b0801, 0x021902010a130901,
+	0x0212020100101201, 0x010a12160c062501, 0x01140e1c0e0d0107, 0x010e01260a1a0107, 0x00140e0e0a1f0207, 0x01090626001a0a07,
+	0x010005260f1a0a07, 0x010005261a0a0e07, 0x01010126071a1507, 0x0208020601161707, 0x010016210b190009, 0x051407040e210009,
+	0x0015150402210909, 0x0500140e02210909, 0x000d140e02210909, 0x0a03051a0e011509, 0x010018081d172509, 0x0500140902212509,
+	0x000d140902212509, 0x000705041c142809, 0x000a05091c142809, 0x0200020f1600160a, 0x0200020f0110160a, 0x00000a270812040d,
+	0x010005261a0a070d, 0x00070127080f070d, 0x080e00230413070d, 0x00010d221c13070d, 0x000701231c13070d, 0x00020f020e09190d,
+	0x00020f090225190d, 0x000706150225190d, 0x00000a270e031b0d, 0x010509160800280d, 0x0100110f1d00160e, 0x0318020101261b0f,
+	0x010400171c190113, 0x0212020100160114, 0x051701040a060015, 0x010209170e060015, 0x050701040a1e0015, 0x00001704021e0915,
+	0x0500010a021e0915, 0x000d010a021e0915, 0x000411001b190518, 0x0115150704000f18, 0x010d14070e000f18, 0x02001a0204090f18,
+	0x010d0007221b0f18, 0x0403201a0401021a, 0x15070c230401021a, 0x0403151a0e01021a, 0x0a030125190d1400, 0x130602061e161400,
+	0x0d06010222161400, 0x080c1b0107040801, 0x0a18090526050801, 0x021904010a160801, 0x02120401051b0801, 0x010a09050d1b0801,
+	0x0301170d1b220801, 0x021904010a130901, 0x130618062b021201, 0x0212040100101201, 0x0a000a091e042501, 0x0000171619082504,
+	0x0000171619082904, 0x0506060119092904, 0x1306250100141a05, 0x00041b000b251a05, 0x0208040601161707, 0x050f180600022507,
+	0x130614040e100009, 0x130614040e011809, 0x0d0600050e1a2809, 0x0d0600050e182909, 0x0200040f1600160a, 0x0200040f0110160a,
+	0x01061a050d15010d, 0x080c00230413070d, 0x090604060600280d, 0x0318040101261b0f, 0x0f00180b03220813, 0x0212040100160114,
+	0x0004070423180515, 0x0004000523180515, 0x00000d0602182515, 0x06140e020e000f18, 0x06000e02221b0f18, 0x030614170e01021a,
+	0x03041422090e1400, 0x04060315221b1400, 0x0006251504120401, 0x0a18090526050801, 0x010a09050d1b0801, 0x01061505290a0a01,
+	0x0a0605150e0d0a01, 0x010615050d150f01, 0x030401032b131201, 0x04061f15011d1201, 0x01061f15061d1201, 0x0304130106191a01,
+	0x1507280d04022401, 0x0406201504022401, 0x040615150e022401, 0x0a000a091e042501, 0x040607151e042501, 0x030413011a062501,
+	0x04061f1501162501, 0x01061f1506162501, 0x0009280d08181804, 0x1507280d04011e04, 0x0406201504011e04, 0x040615150e011e04,
+	0x000615061c172504, 0x090615060d002904, 0x000e060119092904, 0x0006251500201405, 0x0018280d08201405, 0x0200000d0e1d1a05,
+	0x0307040a00251906, 0x0307050d00251906, 0x010011061c251906, 0x01041f06101a1407, 0x030400012b0a1707, 0x030400011a0a2107,
+	0x01140e210e090108, 0x010e011e0a150108, 0x0109061e00150a08, 0x0100051e0f150a08, 0x0100051e150a0e08, 0x0101011e07151508,
+	0x0304000819172509, 0x010018081f172509, 0x0500020f011b160a, 0x03060b050600280d, 0x030606170800280d, 0x01000f1e08060f0e,
+	0x0500060508250f0e, 0x0005090508250f0e, 0x01000f0708250f0e, 0x01001f0f0514130e, 0x00000f2a0f05160e, 0x010615050d010a0f,
+	0x0a0605150e010d0f, 0x0200050f0d160111, 0x030414000e0f0912, 0x0004002304191a12, 0x03040918000c2512, 0x00000a23040c2512,
+	0x03041409000f2512, 0x00040023041a2512, 0x011001040a060015, 0x030704000e062515, 0x0100050c1e0a0816, 0x0502011501160816,
+	0x0000220d04160816, 0x0502060e01190816, 0x0502011d01190816, 0x0009060d04190816, 0x050002010b270a16, 0x06140e040e000f18,
+	0x06000e04221b0f18, 0x0306002b0e1c0f18, 0x030614050e011218, 0x0a280d0317050801, 0x05280d0517050801, 0x0301110d1b220801,
+	0x010a111c0e0a0901, 0x0a060e15011d1201, 0x0a061501170a2501, 0x010a11091c0a2501, 0x06020215220a2501, 0x0012070504132501,
+	0x0a060e1501162501, 0x0a021a01091c2501, 0x0203050f111c2501, 0x05020918111c2501, 0x02031806141c2501, 0x0012070504142c01,
+	0x0a061500100d2504, 0x0a0312010c182504, 0x080e05010a170006, 0x0201010d171d0f06, 0x080e0005231d0f06, 0x0002011c07231207,
+	0x0a010a01251a1407, 0x010005180e091a07, 0x0500040f011b160a, 0x01100005080f070d, 0x0801050508271b0d, 0x0f0604060600280d,
+	0x010704060600280d, 0x0604060f1d060011, 0x00020511061c2511, 0x0106141c0e010f13, 0x060002150c1e2513, 0x0504011501160816,
+	0x0504060e01190816, 0x0504011d01190816, 0x050004010b270a16, 0x050c010306001e16, 0x0106011c280a0018, 0x010600280e1a0f18,
+	0x030614110e01021a, 0x0002160608040a1d, 0x0500021608080f1e, 0x0100111e0b180c00, 0x130614050e0e1100, 0x0304141b090a1400,
+	0x0304062408161400, 0x0103160613162100, 0x03041b011c170801, 0x0314030d0e170901, 0x011403062b131201, 0x01061505130a2501,
+	0x06020415220a2501, 0x0314030d09172501, 0x03050d05061c2501, 0x0a041a01091c2501, 0x010208180b1c2501, 0x010a091a111c2501,
+	0x02031806181c2501, 0x0314000d0e170904, 0x0314000d0e031404, 0x020615010e091404, 0x000206190e091404, 0x031801010a241804,
+	0x031401100e111e04, 0x0403011c0e111e04, 0x0314000d09172504, 0x031801010a132904, 0x0000190b14250c05, 0x0016140e09201405,
+	0x0318010624201405, 0x0e070d0600251a05, 0x03041b011c0a0006, 0x0304001b0e1a0f06, 0x0314000d0e021506, 0x0305000d05251906,
+	0x000412011c251906, 0x000112061c251906, 0x0314030d0e120107, 0x0314000d0e110207, 0x021418100e011107, 0x0402181c0e011107,
+	0x0004011c07231207, 0x03040624011a1407, 0x010211010e091707, 0x000210020e091707, 0x0300230d0e041a07, 0x0001061d13012507,
+	0x0402180011132507, 0x041420100e011108, 0x0404201c0e011108, 0x1506040605190009, 0x030414170e000909, 0x1506040600191209,
+	0x130614050e011509, 0x0304141709002509, 0x0304140901142809, 0x0100051e0e1a2809, 0x050108051a002909, 0x0100051e0e182909,
+	0x000703061b11190a, 0x0001092808140f0e, 0x0001091108250f0e, 0x031801010a2b0210, 0x1506040600190a10, 0x000219060e090212,
+	0x030414000e0b0912, 0x03041409000b2512, 0x0004011c06182512, 0x0001061c06182512, 0x00020b030e190813, 0x00020b1903220813,
+	0x060004150c1e2513, 0x010c090a081e0015, 0x00150605060d0515, 0x000217040e090816, 0x0015060405060a16, 0x0406100003251918,
+	0x0403140003251918, 0x080614170e01021a, 0x061401100e11021a, 0x0406011c0e11021a, 0x050019010b09021b, 0x031801010a12021b,
+	0x0004011c0614181d, 0x0001061c0614181d, 0x050019030b000f1e, 0x0501160500070f1e, 0x0500041608080f1e, 0x0304011316190600,
+	0x03040108160c1100, 0x030601161e161400, 0x0101160908191400, 0x0806010923191400, 0x080601091e1b1400, 0x0106010e1b1d1400,
+	0x09280d0517050801, 0x080c1c011c050801, 0x080126090e1e0801, 0x090616062b021201, 0x03041a0106061801, 0x0304011d0c061801,
+	0x0515020106191a01, 0x0304110106191a01, 0x0101160908142001, 0x0806010923142001, 0x080c1c0100022401, 0x051502011a062501,
+	0x030411011a062501, 0x06010e151e0a2501, 0x01061516250a2501, 0x0207180a0a1c2501, 0x010a081a0b1c2501, 0x0a011a08101c2501,
+	0x09020918111c2501, 0x06010f150c202501, 0x0a0615010e091404, 0x000a06190e091404, 0x0003190108181804, 0x080c1c0100011e04,
+	0x0500130019082504, 0x0b0616011f002904, 0x000b06041f002904, 0x0500130019082904, 0x0219010100201105, 0x08011b0100201105,
+	0x031801010c201105, 0x021818010c160107, 0x030401110c1a0107, 0x030401010c1a1107, 0x010a11010e091707, 0x000a10020e091707,
+	0x0101092a04151707, 0x010100180e091a07, 0x01191a0105002507, 0x021818010c110108, 0x011416012a011408, 0x010014042a011408,
+	0x03061705280a0109, 0x0801010e1e280809, 0x0801011e11072509, 0x0306170512002909, 0x020116070400150a, 0x01121f070400150a,
+	0x01100100080f070d, 0x00010f28080f070d, 0x010c1f001c13070d, 0x0501060008250f0e, 0x01060f001d19130e, 0x010615022c001b0f,
+	0x0806010900221b0f, 0x0601150b01221b0f, 0x0101180909221b0f, 0x00010b0619221b0f, 0x0101180908261b0f, 0x0219010100031e0f,
+	0x08011b0100031e0f, 0x031801010c031e0f, 0x0304240100190110, 0x130605010c190110, 0x0306011b16190111, 0x011f050e16050811,
+	0x011f012016050811, 0x000a19060e090212, 0x0806010924080013, 0x02190101001d0513, 0x08011b01001d0513, 0x031801010c1d0513,
+	0x000a0b030e190813, 0x000a0b1903220813, 0x060101150c1e2513, 0x02010d0d08060015, 0x0501160d08060015, 0x03060110081e0015,
+	0x00040e0002182515, 0x000a17040e090816, 0x00150a05040a0816, 0x0504011e01190816, 0x00001903060e1e16, 0x0219010107030a17,
+	0x08011b0107030a17, 0x0219010100030d17, 0x08011b0100030d17, 0x031801010c030d17, 0x061601012a0a0518, 0x000601042a0a0518,
+	0x060e01011b190518, 0x01162101020a0818, 0x08012201020a0818, 0x00012104020a0818, 0x000601280e1a0f18, 0x06010e01221b0f18,
+	0x0006012b0e1c0f18, 0x0116210103060a19, 0x0801220103060a19, 0x0001210403060a19, 0x021914010001021a, 0x011925010001021a,
+	0x061810010c01021a, 0x031814010c01021a, 0x001606001a14021a, 0x010109250416091c, 0x0501011608080f1e, 0x0310041604060600,
+	0x03100402160a0600, 0x0102160908191400, 0x0806020923191400, 0x080602091e1b1400, 0x080226090e1e0801, 0x0102160908142001,
+	0x0806020923142001, 0x0206150b040a2501, 0x01021104080a2501, 0x06020e151e0a2501, 0x0207180d0a1c2501, 0x0a03050f0b1c2501,
+	0x060208180b1c2501, 0x0a021a08101c2501, 0x06020f150c202501, 0x00020a1619082504, 0x02040e0219002904, 0x00020a1619082904,
+	0x02061501040d2904, 0x00020619040d2904, 0x00020c0403251a05, 0x010200180e091a07, 0x0801020e1e280809, 0x0801021e11072509,
+	0x000203161a082509, 0x000203161a082909, 0x020603150400170a, 0x0002031a0407170a, 0x031004170400060d, 0x00022802040f070d,
+	0x01100200080f070d, 0x00020f28080f070d, 0x010204011e070a0e, 0x0502060008250f0e, 0x0201210403060a0f, 0x02030104032c0a0f,
+	0x0806020900221b0f, 0x0602150b01221b0f, 0x0102180909221b0f, 0x00020b0619221b0f, 0x0102180908261b0f, 0x0310040216000811,
+	0x000a050b061c2511, 0x0806020924080013, 0x0006140b1c042513, 0x060201150c1e2513, 0x03060210081e0015, 0x00020c0427060515,
+	0x0002240404060816, 0x00022402040a0816, 0x000602280e1a0f18, 0x06020e01221b0f18, 0x0006022b0e1c0f18, 0x00021b060409021b,
+	0x0502011608080f1e, 0x0002031a04090f1e, 0x02081f0616160600, 0x0002061316190600, 0x00020608160c1100, 0x020900190b100501,
+	0x0219110107040801, 0x08021b010a160801, 0x08021b010a130901, 0x00021a0606061801, 0x0002061d0c061801, 0x0002110606191a01,
+	0x000211061a062501, 0x0c000b1b0b250105, 0x00001e0b0e251a05, 0x000206110c1a0107, 0x000206010c1a1107, 0x0802000e1e280809,
+	0x0802001e11072509, 0x01021e001a072509, 0x0c02001b0b012809, 0x0200001e0e1a2809, 0x0200001e0e182909, 0x11021e091c14010d,
+	0x02141e092d14010d, 0x11021e001312060d, 0x0002240600190110, 0x02070d060c190110, 0x0c02012b07060015, 0x00020c2108060015,
+	0x070301031e001e16, 0x040300031e0e1e16, 0x02140e0d0e030018, 0x0209001b0b01021b, 0x080201010a0f091c, 0x0200030f0e16001e,
+	0x020303061a16001e, 0x04081f0616160600, 0x0004061316190600, 0x00040608160c1100, 0x0200090f22191400, 0x02000a0923191400,
+	0x02000a091e1b1400, 0x0219130107040801, 0x08041b010a160801, 0x0602091f0e190801, 0x0c010d1d1a220801, 0x060209191f220801,
+	0x08041b010a130901, 0x020709060c101201, 0x0200090f2a161301, 0x020b040606061801, 0x00041a0606061801, 0x0004061d0c061801,
+	0x0004110606191a01, 0x0902090607191a01, 0x0200090f22142001, 0x02000a0923142001, 0x1507270d04022401, 0x000411061a062501,
+	0x090209061a072501, 0x0009270d08181804, 0x1507270d04011e04, 0x020b001b0b140105, 0x0018270d08201405, 0x0101140e00251906,
+	0x01001d1000251906, 0x010012061c251906, 0x000406110c1a0107, 0x010a0b1c0e011107, 0x000406010c1a1107, 0x0101011c07231207,
+	0x0002092a04151707, 0x0902090600191707, 0x050f1a0600022507, 0x010a0b0011132507, 0x010013210b190009, 0x010612050d190009,
+	0x0804000e1e280809, 0x0804001e11072509, 0x01041e001a072509, 0x0c04001b0b012809, 0x0400001e0e1a2809, 0x0400001e0e182909,
+	0x0100110f011b160a, 0x02041706080a000d, 0x0201170d0816000d, 0x0f0615020417000d, 0x020417060814010d, 0x11041e091c14010d,
+	0x020003171e14010d, 0x01000a281e14010d, 0x04141e092d14010d, 0x020000170812040d, 0x020017010b12040d, 0x11041e001312060d,
+	0x01000f28080f070d, 0x020000170e031b0d, 0x110604060600280d, 0x0100092808140f0e, 0x0105090008250f0e, 0x0100091108250f0e,
+	0x010719001225130e, 0x0116010119081b0f, 0x02000a0900221b0f, 0x0200180909221b0f, 0x01000b0619221b0f, 0x0200180908261b0f,
+	0x0004240600190110, 0x060605060c190110, 0x04070d060c190110, 0x0200000f09160212, 0x01000f2c01160e12, 0x0100061c06182512,
+	0x0109180902080013, 0x02000a0924080013, 0x0f001a0b03220813, 0x08000d1e06042513, 0x020709060c160114, 0x0c04012b07060015,
+	0x00040c2108060015, 0x010214010e090816, 0x02040006090a0816, 0x0111011501160816, 0x0201000d09160816, 0x0111060e01190816,
+	0x0111011d01190816, 0x010011010b270a16, 0x0006062911021e16, 0x04140e0d0e030018, 0x0006011c260a0518, 0x15070c250401021a,
+	0x000606241a14021a, 0x0106010403280a1a, 0x080401010a0f091c, 0x000209250416091c, 0x0100061c0614181d, 0x0104031b06001b1d,
+	0x0104001b06111b1d, 0x020605181d0e0a00, 0x0400090f22191400, 0x04000a0923191400, 0x04000a091e1b1400, 0x02060511181d1400,
+	0x060201181d071500, 0x0604091f0e190801, 0x060409191f220801, 0x040709060c101201, 0x0400090f2a161301, 0x0904090607191a01,
+	0x0400090f22142001, 0x04000a0923142001, 0x090409061a072501, 0x0004092a04151707, 0x0904090600191707, 0x010616050d190009,
+	0x0a06160005142809, 0x05060b050600280d, 0x050606170800280d, 0x04000a0900221b0f, 0x0400180909221b0f, 0x0400180908261b0f,
+	0x02060516000c2512, 0x04000a0924080013, 0x040709060c160114, 0x0506002b0e1c0f18, 0x0509001b0b01021b, 0x000409250416091c,
+	0x0500030f0e16001e, 0x050303061a16001e, 0x0f042306070a0b00, 0x010f230d07160b00, 0x0100141e0b180c00, 0x0200030f09162100,
+	0x0610150107250501, 0x0a280d0517050801, 0x0106140f0e190801, 0x010614190f220801, 0x0f10011d0f220801, 0x110218091c140c01,
+	0x021418092d140c01, 0x1206150103191301, 0x0112110107191a01, 0x1206150119042501, 0x011406170c062501, 0x010f101c0c062501,
+	0x011211011a072501, 0x02111801081c2501, 0x0c040d06081c2501, 0x02101801091c2501, 0x0a020918111c2501, 0x02000e18111c2501,
+	0x0c00030d1e1c2501, 0x00280d0f01161404, 0x0615011501161404, 0x0001150619161404, 0x00000c0f2b161404, 0x00000a190b171404,
+	0x1206150100191404, 0x0615060e01191404, 0x0615011d01191404, 0x00060e0619191404, 0x00011d0619191404, 0x000622150b141e04,
+	0x110109091c141e04, 0x07280d001d141e04, 0x011409092d141e04, 0x000615161e0d2504, 0x0006150b210d2504, 0x00000b0f23112904,
+	0x1206150100142904, 0x00000a190b162904, 0x00031a041c250c05, 0x0000280b06141a05, 0x00030d041a1d1a05, 0x0000110b06251a05,
+	0x00000c0f14162105, 0x011911010a170006, 0x01111100171d0f06, 0x01001911231d0f06, 0x0106140d0e1a0107, 0x01140115001a1407,
+	0x01042106101a1407, 0x0201180619241407, 0x0100142b04061707, 0x04280d06010a1707, 0x010014022b0a1707, 0x00040c062b0a1707,
+	0x01280d0d01161707, 0x0111011501161707, 0x0010011502161707, 0x00010c0d2b161707, 0x0112110100191707, 0x0111060e01191707,
+	0x0111011d01191707, 0x0010060e02191707, 0x0010011d02191707, 0x010014041a062107, 0x010014021a0a2107, 0x00040c061a0a2107,
+	0x00010c0d1a162107, 0x011201001e151408, 0x1406040605190009, 0x1406040600191209, 0x0000031a0b171409, 0x0114000f10012509,
+	0x010420001a072509, 0x0114000f00142809, 0x01001404031a2809, 0x011400090e1a2809, 0x040000200e1a2809, 0x0000031a0b162909,
+	0x0100140403182909, 0x011400090e182909, 0x040000200e182909, 0x000406062a150a0a, 0x00040619061b0a0a, 0x021117000507160a,
+	0x0000030f2a11160a, 0x00010d062a15160a, 0x0000170f041b160a, 0x00010d19061b160a, 0x110420091c14010d, 0x041420092d14010d,
+	0x110420001312060d, 0x010014240409190d, 0x1106130013031b0d, 0x011407030600280d, 0x0b0604060600280d, 0x010014041a09280d,
+	0x000406061c250a0e, 0x0604150601260a0e, 0x0004060619260a0e, 0x000028020b140f0e, 0x0100001608250f0e, 0x010016010b250f0e,
+	0x000011020b250f0e, 0x0107001d1e10130e, 0x0100210f0514130e, 0x0100170f1e00160e, 0x0000030f1725160e, 0x00010d061c25160e,
+	0x0106150d0126160e, 0x0100110f0126160e, 0x0000100f0226160e, 0x00010d061926160e, 0x1406040600190a10, 0x0001151906160212,
+	0x00000b0f1c160212, 0x00060e1906190212, 0x00011d1906190212, 0x0200180e19220813, 0x0206141c0e010f13, 0x0c000a020b1e0015,
+	0x00140605060d0515, 0x0000240b100d0515, 0x0000170b270d0515, 0x01001404060c2a15, 0x00040b061c0a0816, 0x0017011504160816,
+	0x00010b0d1c160816, 0x0017060e04190816, 0x0017011d04190816, 0x0014060405060a16, 0x000024040b100a16, 0x000017040b270a16,
+	0x0206011c280a0018, 0x020600280e1a0f18, 0x00000313221b0f18, 0x11010d091c14021a, 0x01140d092d14021a, 0x020b001b0b01021b,
+	0x00000b1b0b11021b, 0x0100140419060c1b, 0x0000031a0b110c1b, 0x00000b0f1116051e, 0x00040b06180a081e, 0x00010b0d1816081e,
+	0x00000b1b0b02151e, 0x0000031a0b0c151e, 0x010a1b011e0a0600, 0x0201171a070e0a00, 0x02171a0105071400, 0x0201171a11071400,
+	0x02142104090a1400, 0x02142109050d1400, 0x02011707090e1a00, 0x0614150107250501, 0x022104011c170801, 0x011411210e0a0901,
+	0x1006150103191301, 0x020818011b191701, 0x030619011b191701, 0x02091804080c1801, 0x0110110107191a01, 0x1006150119042501,
+	0x011011011a072501, 0x02061505130a2501, 0x06051505210a2501, 0x01141109210a2501, 0x02141801091c2501, 0x070208180b1c2501,
+	0x020a091a111c2501, 0x030f0102251c2501, 0x0014140e0e170904, 0x0014140e0e031404, 0x1006150100191404, 0x0006011b1f191404,
+	0x02091801080d1804, 0x0205090108181804, 0x0014011119082504, 0x0014140e09172504, 0x030a0f0123002904, 0x0014011119082904,
+	0x0c01011b1f092904, 0x0014090619112904, 0x1006150100142904, 0x0216070101201405, 0x121f070101201405, 0x0201010317201405,
+	0x030a010125201405, 0x022104011c0a0006, 0x020021040e1a0f06, 0x0014140e0e021506, 0x0014050e05251906, 0x000212061c251906,
+	0x0014140e0e110207, 0x0203010107191207, 0x0110110100191707, 0x021d0f0100041a07, 0x020a1801000f2507, 0x001414030e091108,
+	0x011001001e151408, 0x010101231e151408, 0x01051e051a072509, 0x050208051a002909, 0x0c010123080f070d, 0x0006012308140f0e,
+	0x0002092808140f0e, 0x0002091108250f0e, 0x010a1b011e000811, 0x00010225061c2511, 0x0002061c06182512, 0x0614040f1c0e0013,
+	0x0009011b20220813, 0x020d01040a060015, 0x051601040a060015, 0x020c090a081e0015, 0x0c01010729060515, 0x0512010306001e16,
+	0x0006011b040f1917, 0x0002061c0614181d, 0x0502160500070f1e, 0x0110030616160600, 0x1306250611021a00, 0x07280d0517050801,
+	0x02070406051b0801, 0x0207040600101201, 0x0806090603191301, 0x020b020606191a01, 0x0804090607191a01, 0x0806090619042501,
+	0x080606091e042501, 0x030415160b062501, 0x020b02061a062501, 0x080409061a072501, 0x060f1506050a2501, 0x01161106080a2501,
+	0x02061516250a2501, 0x05060b06051c2501, 0x020a081a0b1c2501, 0x030f0504101c2501, 0x02061808101c2501, 0x07020918111c2501,
+	0x011809060c170904, 0x011809060c031404, 0x0806090600191404, 0x0615060b01191404, 0x0118090609191404, 0x00060b0619191404,
+	0x0d0615060d002904, 0x0806090600142904, 0x000919060b251405, 0x03011a060b251405, 0x080c1c0600020f06, 0x011809060c021506,
+	0x011809060c110207, 0x0201092a04151707, 0x0804090600191707, 0x0111060b01191707, 0x0010060b02191707, 0x010e090605191707,
+	0x010d061e00150a08, 0x0b06020601191a09, 0x0618100504002509, 0x0318140504002509, 0x1306150516002509, 0x0b0602061a012509,
+	0x0304151601072509, 0x0801061204072509, 0x0801060400112809, 0x020216070400150a, 0x02121f070400150a, 0x0d0615020417000d,
+	0x080106230413070d, 0x020c1f001c13070d, 0x011606011e070a0e, 0x02060f001d19130e, 0x0116210603060a0f, 0x0801220603060a0f,
+	0x03160106032c0a0f, 0x020615022c001b0f, 0x08061a0603060011, 0x0806061d030c0011, 0x00050410061c2511, 0x00060b1906190212,
+	0x03180105040e2512, 0x0207040600160114, 0x02020d0d08060015, 0x0502160d08060015, 0x0017060b04190816, 0x0500060d04190816,
+	0x000d060d04190816, 0x020109250416091c, 0x001510020418091c, 0x000e0306091b0f1e, 0x010314040b0a0600, 0x011416070b0a0600,
+	0x001207030d1c0501, 0x0012070f0e1c0501, 0x010314040f170801, 0x011416070f170801, 0x0105140f0e190801, 0x0f0409030d1b0801,
+	0x0f04090f0e1b0801, 0x08160d0701210801, 0x010514190f220801, 0x020d18100e1c0901, 0x0c020d210e1c0901, 0x0302180408140c01,
+	0x0216180708140c01, 0x01031404060a0e01, 0x01141607060a0e01, 0x1506031522140f01, 0x001203070e151701, 0x080609091e042501,
+	0x00120c0705132501, 0x021007180b1c2501, 0x040208180b1c2501, 0x02091808101c2501, 0x020d1809101c2501, 0x0c020d09211c2501,
+	0x0c03070d221c2501, 0x00120c0705142c01, 0x0d061507000a1e04, 0x150600150e0a1e04, 0x0806090700141e04, 0x0301090408141e04,
+	0x0116090708141e04, 0x1506001511141e04, 0x001200070e1c2904, 0x030d180d0e210105, 0x001200070e201105, 0x00060e150e201105,
+	0x0303001a0d1d1405, 0x021607000e201405, 0x121f07000e201405, 0x0215001805061a05, 0x030e070d001d1a05, 0x0301070d0b1d1a05,
+	0x0207001805281a05, 0x010314040f0a0006, 0x011416070f0a0006, 0x090218000d251906, 0x0002180a0d251906, 0x090109011c251906,
+	0x0105140d0e1a0107, 0x0501160e16010a07, 0x00031b1904050c07, 0x0401200e0e1a1107, 0x00030b041d041407, 0x00160b071d041407,
+	0x030400070b1a1407, 0x00021d070b1a1407, 0x040120070b1a1407, 0x010222070b1a1407, 0x000218140e091707, 0x00031a0b0e041a07,
+	0x00030b0417041a07, 0x0500160e04091e07, 0x00030b04040a1e07, 0x00160b07040a1e07, 0x010d181d0e090108, 0x0201170e16010a08,
+	0x01031404010a0b08, 0x01141607010a0b08, 0x01000e231e151408, 0x03061a0204210009, 0x01031404060a0109, 0x01141607060a0109,
+	0x0003201b04050909, 0x0106010e16191209, 0x0006170320042509, 0x0906160005142809, 0x01021e091a142809, 0x040007200e1a2809,
+	0x040007200e182909, 0x0103140400070a0a, 0x0114160700070a0a, 0x00031d0405070a0a, 0x0301220405070a0a, 0x00161d0705070a0a,
+	0x0116220705070a0a, 0x010304011f070a0a, 0x011607011f070a0a, 0x00030406021a0a0a, 0x00160706021a0a0a, 0x03042004080a000d,
+	0x04162007080a000d, 0x030420040814010d, 0x041620070814010d, 0x01031404010a070d, 0x01141607010a070d, 0x03042001040f070d,
+	0x000420170e0f070d, 0x080107120413070d, 0x080109230413070d, 0x0114031b0e01160d, 0x0306170300271b0d, 0x0306170011271b0d,
+	0x000304061c040a0e, 0x001607061c040a0e, 0x0103140400080a0e, 0x0114160700080a0e, 0x0003200405080a0e, 0x0016200705080a0e,
+	0x040320010e140f0e, 0x0100071608250f0e, 0x00031a060404120e, 0x1506001508040a0f, 0x020318010e1c0a0f, 0x010903190e011b0f,
+	0x0103090019081b0f, 0x001200070e031e0f, 0x00060e150e031e0f, 0x0114030a0e190110, 0x0106010e16190a10, 0x010314040b000811,
+	0x011416070b000811, 0x03040716000f0811, 0x001200070e1d0513, 0x00060e150e1d0513, 0x0002180e06091c13, 0x0103010e16160a14,
+	0x01150700051a1a14, 0x030504170e060015, 0x0e030a020e180015, 0x010903150e180015, 0x00030a0402180915, 0x000e000602182515,
+	0x0506220004160816, 0x0003030604061e16, 0x0500160e06030917, 0x00030b0406030a17, 0x00160b0706030a17, 0x001200070e030d17,
+	0x00060e150e030d17, 0x00030603040d0f17, 0x00150703040d0f17, 0x00150003050d0f17, 0x01030a020e0f0f17, 0x000c00001b190518,
+	0x000117001b190518, 0x00030c04020a0818, 0x00160c07020a0818, 0x0906011a0e050f18, 0x0906011c0e050f18, 0x00030c0403060a19,
+	0x00160c0703060a19, 0x0001071804041819, 0x0001001805041819, 0x0001001810041919, 0x0f10030a0e01021a, 0x03010d040814021a,
+	0x01160d070814021a, 0x000124091c14021a, 0x0003061a04020a1a, 0x0015071a04020a1a, 0x0015001a05020a1a, 0x080526011a0a0600,
+	0x0101171a070e0a00, 0x01171a0105071400, 0x0101171a11071400, 0x001f210f05091400, 0x0a0f070125091400, 0x01142104090a1400,
+	0x01142109050d1400, 0x01011707090e1a00, 0x0100030f09162100, 0x080e1b0107040801, 0x08151e0107040801, 0x012104011c170801,
+	0x08031e010a170901, 0x01091804080c1801, 0x000407051a132501, 0x000407051a142c01, 0x08001e010a170904, 0x0a0f0b010e170904,
+	0x08001e010a031404, 0x0a0f0b010e031404, 0x0201071a0e091404, 0x01091801080d1804, 0x0105090108181804, 0x0a0f0b0109172504,
+	0x0116070101201405, 0x0101010317201405, 0x000c010f22201405, 0x000a0c0123201405, 0x00090a1e0e1c1a05, 0x00090a1f0e251a05,
+	0x012104011c0a0006, 0x010021040e1a0f06, 0x0805001e051d0f06, 0x08001e010a021506, 0x0a0f0b010e021506, 0x08031e010a120107,
+	0x080401250a180107, 0x08001e010a110207, 0x0a0f0b010e110207, 0x0103010107191207, 0x010c01050d191207, 0x0401032225181407,
+	0x011d0f0100041a07, 0x0002221e0e091a07, 0x02020f0d0e150108, 0x011117000507160a, 0x0f0415070400170a, 0x080e00230413070d,
+	0x010706090c1c0210, 0x080526011a000811, 0x010d01040a060015, 0x0609001b0b01021b, 0x010b001b0b01021b, 0x0600030f0e16001e,
+	0x060303061a16001e, 0x0f00020f08080f1e, 0x08101b0107040801, 0x182718010f050801, 0x0c18090526050801, 0x010c09050d1b0801,
+	0x030112091b220801, 0x030718062b021201, 0x0c000a091e042501, 0x0307250100141a05, 0x0201140e00251906, 0x02001d1000251906,
+	0x020012061c251906, 0x020a0b1c0e011107, 0x0201011c07231207, 0x0800182304091407, 0x08051801010c2507, 0x020a0b0011132507,
+	0x030714040e100009, 0x020013210b190009, 0x030714040e011809, 0x0200110f011b160a, 0x02000a281e14010d, 0x02000f28080f070d,
+	0x081000230413070d, 0x0200092808140f0e, 0x0205090008250f0e, 0x0200091108250f0e, 0x020719001225130e, 0x0216010119081b0f,
+	0x02000b0619221b0f, 0x02000f2c01160e12, 0x0200061c06182512, 0x020214010e090816, 0x0211011501160816, 0x0211060e01190816,
+	0x0211011d01190816, 0x020011010b270a16, 0x0200061c0614181d, 0x0204031b06001b1d, 0x0204001b06111b1d, 0x0612021a0e090600,
+	0x0b0005250e0b1100, 0x13041422090e1400, 0x13000d03150b1500, 0x04060d06150a2100, 0x01060d0d15162100, 0x0c120701051c0501,
+	0x0419130107040801, 0x1018090526050801, 0x18100d0526050801, 0x06040d230e190801, 0x011009050d1b0801, 0x01100d050d1b0801,
+	0x09010d1d1a220801, 0x0d01110d1b220801, 0x0001171a1b220801, 0x0a12040d1d220801, 0x06040d1923220801, 0x130401032b131201,
+	0x09120507061d1201, 0x03001b0d0f1d1201, 0x040b040606061801, 0x1304130106191a01, 0x10000a091e042501, 0x000a100d1e042501,
+	0x130413011a062501, 0x0912050706162501, 0x03001b0d0f162501, 0x0f040d06081c2501, 0x0f00030d1e1c2501, 0x03000d0f10222501,
+	0x0201081a0e091404, 0x0b0711011f002904, 0x060e060119092904, 0x0b01011b1f092904, 0x0b0701061f112904, 0x010313061f112904,
+	0x00000d0f23112904, 0x040b001b0b140105, 0x0014070d0e201105, 0x11060d0017201405, 0x00010d0f22201405, 0x000a010d23201405,
+	0x0019060d23201405, 0x0713040a00251906, 0x0713050d00251906, 0x00031b0d16251906, 0x02040f0c0e1a0107, 0x0a01050a0e1a1107,
+	0x01010d050d191207, 0x0c01160d1e011407, 0x130400012b0a1707, 0x130400011a0a2107, 0x00040d1a1e011408, 0x0c1407040e210009,
+	0x01140e1e0e050909, 0x0101140e1f160909, 0x000c140e02210909, 0x0b0005250b011509, 0x01140e091e052509, 0x011507161e052509,
+	0x000b071623052509, 0x0104180608112509, 0x010003181e112509, 0x010114091f162509, 0x1304000819172509, 0x000c140902212509,
+	0x0904001b0b012809, 0x0b07040615002909, 0x0b07040600172909, 0x0104180608172909, 0x04041706080a000d, 0x0401170d0816000d,
+	0x040417060814010d, 0x040003171e14010d, 0x0b0704062a14010d, 0x130400170b15010d, 0x04001a210b15010d, 0x040000170812040d,
+	0x040017010b12040d, 0x11011204080f070d, 0x01011904080f070d, 0x0c010110080f070d, 0x0b010123080f070d, 0x0101140e1f09100d,
+	0x010114091f25100d, 0x040000170e031b0d, 0x1001070a13031b0d, 0x0104060400271b0d, 0x0101140e21060a0f, 0x0101140a09261b0f,
+	0x0014070d0e031e0f, 0x0c01011d01061e0f, 0x0b07012b03070011, 0x130400160b060111, 0x0406011516160111, 0x0406060e16190111,
+	0x0406011d16190111, 0x0c01011601210811, 0x01011d0c16220811, 0x1200020e1a220811, 0x0400000f09160212, 0x00000d0f1c160212,
+	0x130414000e0f0912, 0x13040918000c2512, 0x010b071c000c2512, 0x13041409000f2512, 0x04010606161d2512, 0x011a0d05070d0013,
+	0x0014070d0e1d0513, 0x0904012b07060015, 0x0304022208060015, 0x170c01040a060015, 0x0c0701040a1e0015, 0x0b01010729060515,
+	0x000c010a021e0915, 0x0101010a1b061215, 0x071304000e062515, 0x04040006090a0816, 0x00040d061c0a0816, 0x0401000d09160816,
+	0x01000d0d1c160816, 0x0014070d0e030d17, 0x030414170e030018, 0x0c01011807040a19, 0x0c01011800040d19, 0x0b0701062c14021a,
+	0x010313062c14021a, 0x0409001b0b01021b, 0x00000d1b0b11021b, 0x04060d061c0a001e, 0x0400030f0e16001e, 0x03000d0f1716001e,
+	0x040303061a16001e, 0x01060d0d1c16001e, 0x00000d0f1116051e, 0x00040d06180a081e, 0x01000d0d1816081e, 0x00000d1b0b02151e,
+	0x020416070615000a, 0x12041f070615000a, 0x030405001a0b030a, 0x0005021d1a0b030a, 0x040501201a0b030a, 0x010502221a0b030a,
+	0x01041f06081a0b0a, 0x00012805091a0b0a, 0x0203050f1b01100a, 0x050209181b01100a, 0x020305011b12100a, 0x021201010315100a,
+	0x000003211e16100a, 0x0e00001e0323100a, 0x0100001a0328100a, 0x0a03050f0e01110a, 0x060208180e01110a, 0x0a0305010e12110a,
+	0x000703060c16110a, 0x010218042a00000c, 0x050416062a00000c, 0x02051818090b000c, 0x0212010f0310010c, 0x00010321190b080c,
+	0x00020818100b120c, 0x0002182a0410130c, 0x000003211e10170c, 0x000703060c11170c, 0x02040f0601091b0c, 0x0009030627091b0c,
+	0x050008160b02240c, 0x0009030619092c0c, 0x001f0d0f051d0014, 0x0304010317260014, 0x071f0d001d100514, 0x0806000924180514,
+	0x01000a0924180514, 0x0101001809100614, 0x0118180601020814, 0x03010d0701102414, 0x0304151b01000015, 0x0201210402000015,
+	0x0307041b02000015, 0x020d040a06000015, 0x0516040a06000015, 0x041f160d06000015, 0x0411280d06000015, 0x1204000915070015,
+	0x0403030f2c070015, 0x000e050507090015, 0x08060519020b0015, 0x020508180e0b0015, 0x030605190e0b0015, 0x030405060f0b0015,
+	0x02000d0110070515, 0x000a0b0306090515, 0x00050b0506090515, 0x000c0d0506090515, 0x0305010b1f0b0515, 0x0003010f1f0b0515,
+	0x0201210400081015, 0x0307041b00081015, 0x0015100504081015, 0x020003010b161015, 0x000208180b091315, 0x000306190b091315,
+	0x040301030d022115, 0x0403010f0e022115, 0x010006040f290117, 0x050c010b00091017, 0x0100092d02091017, 0x0207000417091017,
+	0x0701010a26091017, 0x0207000403141017, 0x0500090004291017, 0x001507030f041a17, 0x0211160701030019, 0x12111f0701030019,
+	0x0200160704030519, 0x00121f0704030519, 0x07031801030b0919, 0x00061115030b0919, 0x05000816030b0919, 0x0209190106030e19,
+	0x0201160706030e19, 0x12011f0706030e19, 0x0801091b06030e19, 0x0d00280d03031019, 0x00000d1203031019, 0x02000d0a04031019,
+	0x0500160a04031019, 0x001f160d04031019, 0x0011280d04031019, 0x0007160e04031019, 0x0000251204031019, 0x030600141a031019,
+	0x050403160007091c, 0x0002081811120b1c, 0x001507030f04211c, 0x000a12061b02100a, 0x00020f060e02110a, 0x0a0305000d0a1a14,
+	0x000306160b091e14, 0x00030616130b0917, 0x020003060d1c0b17, 0x00060115031a0e17, 0x0b06011d09011017, 0x00060f0d1d051017,
+	0x02000d03040e1017, 0x05001603040e1017, 0x0200030d04171017, 0x0306002303181017, 0x0703010d01261017, 0x0006110103061a17,
+	0x0009070303061a17, 0x0006061703180b1c, 0x000611010306211c, 0x000907030306211c, 0x020216070e070002, 0x12021f070e070002,
+	0x020d000a1b070002, 0x0516000a1b070002, 0x001f160d1b070002, 0x0011280d1b070002, 0x03050d061a0b0002, 0x010301041f250b02,
+	0x020b160705001002, 0x120b1f0705001002, 0x0603011f0e191002, 0x000012210b1b1002, 0x060301191f221002, 0x0906150600231002,
+	0x000615050f231002, 0x0100090f1f0a1202, 0x01000c1803101302, 0x0806001b17101302, 0x0014000e1e101302, 0x000a12061b04100a,
+	0x00020f060e04110a, 0x0100111b1e07000c, 0x000218062707050c, 0x020024060d120514, 0x020104060d020017, 0x00032406041a0e17,
+	0x0500001804180b1c, 0x0307000d190b0802, 0x0001140e190b0802, 0x00001d10190b0802, 0x000a001a1c0b0902, 0x0a0e210019090b02,
+	0x0a030f001a1c0b02, 0x06000f1524200b02, 0x010006041f250b02, 0x0a001a0f22000c02, 0x0a000a1a23000c02, 0x1506150615000f02,
+	0x0600061f0e191002, 0x060006191f221002, 0x00031b06190a1202, 0x0009000f1f0a1202, 0x01000c1803101702, 0x0806001b17101702,
+	0x0014000e1e101702, 0x0100180115091b02, 0x010b09052a091b02, 0x0c01011513061d02, 0x00061522040a2102, 0x0100160908162402,
+	0x0100090f22162402, 0x0806000923162402, 0x01000a0923162402, 0x0200001812280508, 0x020416070613000a, 0x12041f070613000a,
+	0x021201010313100a, 0x00011d2a0610160c, 0x0118010303150014, 0x09061606001e0514, 0x0806011d00102414, 0x0a0305030d090015,
+	0x050305050d090015, 0x030405060b0b0015, 0x010a17001e090b15, 0x060401061d171015, 0x0a0305000d0a1215, 0x000600051d011615,
+	0x020104060d040017, 0x04060515032b0017, 0x010006040b290117, 0x04060515002b0e17, 0x0503070101090f17, 0x05100a0701051017,
+	0x05000d0801051017, 0x0512000e01051017, 0x0506092501051017, 0x0200001609051017, 0x020000100d051017, 0x0306002312051017,
+	0x0500060b1c051017, 0x0005090b1c051017, 0x000c090d1c051017, 0x0403000f1c051017, 0x050c010c00091017, 0x080400091b091017,
+	0x070101091b091017, 0x00000d0602151017, 0x0007010d06291017, 0x08040009032b1017, 0x07010109032b1017, 0x00000d0602101019,
+	0x00000d0602141019, 0x0500081e04120b1c, 0x0004082010120b1c, 0x0002081814120b1c, 0x020008021a120b1c, 0x0a10280d00050802,
+	0x010d001806050802, 0x0200280d0a050802, 0x010018010c050802, 0x0c0117062b091002, 0x0a06121501221002, 0x000a120619221002,
+	0x0a06101500261002, 0x020600150a261002, 0x000617062b071602, 0x0204010a2b101602, 0x0004011c2b101602, 0x0001091d2b101602,
+	0x00060015240b1802, 0x1506151506002002, 0x0506221506002002, 0x080c091c06002002, 0x010023090f002002, 0x0806020918002002,
+	0x00041906250b0b08, 0x0104001625102008, 0x010a10001e05080c, 0x0102000a1e05080c, 0x02121a0103070014, 0x0304010322160014,
+	0x0304000116280914, 0x060b01051d051015, 0x0007012006221015, 0x00000e03060b0f17, 0x00041003060b0f17, 0x00000d0604151017,
+	0x00000d0604101019, 0x00000d0604141019, 0x040605150020161b, 0x010018010f050802, 0x020b160705000b02, 0x120b1f0705000b02,
+	0x020b01051d080b02, 0x0318010526120b02, 0x050605051b250008, 0x00041906250e0b08, 0x00180526060c040c, 0x0015051a07090514,
+	0x060401061d180b15, 0x060401061d111015, 0x00031a030e250c19, 0x05000d1623000002, 0x0a15071a29030002, 0x020614150f050102,
+	0x10080619190b0102, 0x050f0f1817000702, 0x080026091e040802, 0x000a1a170d050802, 0x0102180927060802, 0x1506061519010b02,
+	0x000615112c180b02, 0x0006151712200b02, 0x0a06121501250b02, 0x000a120619250b02, 0x0a071a171b000c02, 0x0a15071a26000c02,
+	0x000a1a2211080c02, 0x000a1a1713080c02, 0x050f091826000e02, 0x020017011a160f02, 0x0109181815001002, 0x01061a152c001002,
+	0x02040e190f011002, 0x0100181a15081002, 0x000615112c111002, 0x020600150f131002, 0x0100061f11271002, 0x02001d0110011202,
+	0x0100091b2a061202, 0x010509181a001702, 0x0200160703151702, 0x00121f0703151702, 0x0006152224031802, 0x01000c18070b1a02,
+	0x0009280d200b1a02, 0x0a12280d01091b02, 0x01000a1814091b02, 0x01000c1816091b02, 0x000a120c2b091b02, 0x0001091a2b091b02,
+	0x02001401071b1d02, 0x020a0901060a2102, 0x02000e01060a2102, 0x03000f100d1c2102, 0x010216091b092402, 0x010709171b162402,
+	0x0115070926162402, 0x0001191d250b0b08, 0x020021041c13000a, 0x01000a1b1e15000a, 0x00000a1b04240b0a, 0x0002051906240b0a,
+	0x0100091e200b1a0c, 0x000205062c0b1a0c, 0x010a12011e091b0c, 0x000218060c031d0c, 0x00021606032c210c, 0x020011060d100514,
+	0x0006161700140514, 0x0310040a16000614, 0x01011f1609050614, 0x0305041700130814, 0x02001e040d1b0914, 0x020f052307000b14,
+	0x0212011a07000e14, 0x011001170b000015, 0x0304021a0b000015, 0x02011c150d000015, 0x0104071b1e000015, 0x0b06001d19020b15,
+	0x0007012006250b15, 0x050c011e06001015, 0x0f0606051d001015, 0x01061c0f1d001015, 0x020605151d001015, 0x0106021b1d001015,
+	0x01060f1d09011015, 0x06000f1b1d051015, 0x0006021c1d051015, 0x00060f1f1d051015, 0x060201201d051015, 0x0106011d09121015,
+	0x0106021d001f1015, 0x0106001d0f1f1015, 0x0004032c06061215, 0x0106011d09051315, 0x00000d2006011615, 0x000f0c2307020017,
+	0x00060d10051a0017, 0x02000414051a0017, 0x00030d14051a0017, 0x01000425051a0017, 0x01000d16071a0017, 0x07010c23071a0017,
+	0x0701280d081a0017, 0x01000d11081a0017, 0x07030128091a0017, 0x0706010d1d1a0017, 0x0200192b09080117, 0x03000f0d1b280117,
+	0x03000f1a0d290117, 0x0806001216290117, 0x000619070f020517, 0x0f00230b07020b17, 0x0015060a04000f17, 0x010d000c1e000f17,
+	0x0001210306030f17, 0x0004070306090f17, 0x0500001804021a17, 0x0406001005061a17, 0x0403001405061a17, 0x0104001607061a17,
+	0x0104001108061a17, 0x0806000310061a17, 0x0002050c1014091b, 0x0001091c1014091b, 0x000118120920091b, 0x00030611160c161b,
+	0x050019031703091c, 0x0500001804150b1c, 0x050000180402211c, 0x040600100506211c, 0x040300140506211c, 0x010400160706211c,
+	0x010400110806211c, 0x080600031006211c, 0x000616051a090002, 0x0001240612050802, 0x0000232016050802, 0x0000172616050802,
+	0x000a25061c050802, 0x000c27061c050802, 0x01010d21190b0802, 0x0005200b1b0b0802, 0x0000200f1b0b0802, 0x0009022b1c070902,
+	0x020d001e0f000b02, 0x0516001e0f000b02, 0x020d0000181c0b02, 0x05160000181c0b02, 0x05010921181c0b02, 0x01001f0f12220b02,
+	0x0110000610200c02, 0x0a000a251e000f02, 0x0c000a271e000f02, 0x0c01170629091002, 0x020401140e191002, 0x0204011914221002,
+	0x0006170629071602, 0x0204010a29101602, 0x0004011c29101602, 0x0001091d29101602, 0x01000d211e101702, 0x0001240600111702,
+	0x01070d060c111702, 0x13060001260b1a02, 0x00011a0614091b02, 0x09010d0627091b02, 0x030614000e162102, 0x000616051a002c02,
+	0x09010d0619092c02, 0x020605011b13100a, 0x0a0605010e13110a, 0x03041424090a0014, 0x0306011517170014, 0x00001d0204102114,
+	0x0306000319102414, 0x0d0604011c2b0017, 0x110604000c1b0c17, 0x1306020615010e17, 0x05100a0702001017, 0x05000d0802001017,
+	0x0512000e02001017, 0x0506092502001017, 0x110612040c001017, 0x010619040c001017, 0x0c0601100c001017, 0x0b0601230c001017,
+	0x06000f290c051017, 0x06000f2b0c051017, 0x05000b2702081017, 0x05002d0f02091017, 0x00000d1702091017, 0x050006021b0a1017,
+	0x000509021b0a1017, 0x0106000c1a171017, 0x050007020d2a1017, 0x0106000c122c1017, 0x000608020e0a1117, 0x0c000d1b2a070002,
+	0x000a0d1a03100102, 0x000a251a04100102, 0x000a251a00050802, 0x0112180101050802, 0x000a0b0325050802, 0x00050b0525050802,
+	0x000c0d0525050802, 0x000a0b031b090802, 0x00050b051b090802, 0x000c0d051b090802, 0x000c0d1f190b0802, 0x0a000a1a00221002,
+	0x0a00181a09221002, 0x0a00181a08261002, 0x0c000d0f22002002, 0x0c000a0d23002002, 0x0100231e0412100a, 0x000205061b12100a,
+	0x000003211e13100a, 0x0e00001e0325100a, 0x000a05060e12110a, 0x000703060c13110a, 0x0400200f220e0014, 0x04000a20230e0014,
+	0x01001e0f0e1a0514, 0x00001d0404102114, 0x0100031e0e102414, 0x020412060d000015, 0x01090e061e000015, 0x00050b061f0b0515,
+	0x00000f061f0b0515, 0x010a00161e090b15, 0x000403060d022115, 0x00040f060e022115, 0x0306110123190017, 0x0003060423190517,
+	0x0003280602190c17, 0x0100060b190b0d17, 0x0003060e190b0d17, 0x0306010623190e17, 0x00060115051a0e17, 0x05100a0704001017,
+	0x05000d0804001017, 0x0512000e04001017, 0x0506092504001017, 0x0517000706021017, 0x05000b2704081017, 0x05002d0f04091017,
+	0x00000d1704091017, 0x000701280e091017, 0x050006041b0a1017, 0x000509041b0a1017, 0x02000d05040e1017, 0x05001605040e1017,
+	0x0306002305181017, 0x020000020d181017, 0x0500020e06291017, 0x050007040d2a1017, 0x0500030c042b1017, 0x00070310042b1017,
+	0x000608040e0a1117, 0x00070301002b1117, 0x000306170e041a17, 0x0006110105061a17, 0x0009070305061a17, 0x00071806030b0919,
+	0x0200120d04031019, 0x0006061705180b1c, 0x000306170e04211c, 0x000611010506211c, 0x000907030506211c, 0x0102160909070002,
+	0x01001b091e100102, 0x0212010112050802, 0x01010921190b0802, 0x000a0923190b0802, 0x000615230b091702, 0x00280d2304101702,
+	0x010009211e101702, 0x0212010100111702, 0x010709060c111702, 0x0901090627091b02, 0x0006171516002c02, 0x0901090619092c02,
+	0x00060a1918250508, 0x0004190625040a08, 0x00011c190c251608, 0x0011190125012008, 0x020305011b13100a, 0x0100231e0416100a,
+	0x000205061b16100a, 0x0a0305010e13110a, 0x000a05060e16110a, 0x0100231e0410170c, 0x000205061b10170c, 0x000a05060e11170c,
+	0x00140e060e031d0c, 0x020f052311070014, 0x15061505040a0014, 0x020716001a080514, 0x12071f001a080514, 0x020b03050d000015,
+	0x060412061d001015, 0x001505040f081015, 0x0106001d0e1e1015, 0x0200030d04141017, 0x020000040d181017, 0x0703010d01281017,
+	0x0000031b07041a17, 0x0002160307180b1c, 0x0000031b0704211c, 0x000e1a0619000002, 0x0c000d1b28070002, 0x0602150e2c070002,
+	0x0a00091b2c070002, 0x0806021b16100102, 0x010021091e100102, 0x021901010a100702, 0x08011b010a100702, 0x0115180101050802,
+	0x00011b0615050802, 0x080c001c1e080b02, 0x0a0f10002b090b02, 0x06000f1524240b02, 0x060b15052c001002, 0x0906150600251002,
+	0x000615050f251002, 0x0806001b14101702, 0x0200011b0f071802, 0x02000d011b071802, 0x00011a06060b1a02, 0x00090b052b091b02,
+	0x0d14280d09002002, 0x150615060f002002, 0x0d06150624002002, 0x0403070110242002, 0x020009180328100a, 0x020003010b13110a,
+	0x010d14091e00200c, 0x000701061024200c, 0x03041424090e0014, 0x0118010305150014, 0x0207140409190014, 0x020415060d000015,
+	0x06040f061d001015, 0x000603051d001315, 0x00030616140b0917, 0x00032406041b0c17, 0x0500092404001017, 0x0003060a16041a17,
+	0x0200150d04031019, 0x000904061014091b, 0x0004031c1307091c, 0x0003060a1604211c, 0x050c010619080002, 0x0517010719080002,
+	0x0a030f001b1c0b02, 0x06000e1524240b02, 0x0a06150301250b02, 0x0506150501250b02, 0x0006150517250b02, 0x000a030619250b02,
+	0x0005050619250b02, 0x0a280d0301091b02, 0x05280d0501091b02, 0x00280d0517091b02, 0x000a0c032b091b02, 0x00050c052b091b02,
+	0x02010d1d0d1d0008, 0x01000f231e010e0a, 0x010a03011e091b0c, 0x010505011e091b0c, 0x010005171e091b0c, 0x02121a0105070014,
+	0x0212011a11070014, 0x0200030f1b0d0014, 0x030601151e160014, 0x0c06160100060414, 0x080600091b180514, 0x01000a091b180514,
+	0x0004000f23080515, 0x0a0604051d001015, 0x0106001d0e1f1015, 0x00060301190b0d17, 0x0019011507020e17, 0x0200031609001017,
+	0x020003100d001017, 0x020003010d181017, 0x0200060d04041117, 0x0200000f0d030e19, 0x031801010220161b, 0x150a09061b000002,
+	0x000c1c061b000002, 0x0c170d0628000002, 0x0a1709062c000002, 0x00061715120b0002, 0x000b061b1f0b0002, 0x020614150e050102,
+	0x021607060e0b0102, 0x121f07060e0b0102, 0x021607011d0b0102, 0x121f07011d0b0102, 0x01020c1803100102, 0x0806021b17100102,
+	0x0901090625050802, 0x090109061b090802, 0x000c0d251c0b0902, 0x02001d0112100a02, 0x0200170116100a02, 0x02000d121e060b02,
+	0x050016121e060b02, 0x0602011524240b02, 0x0a15071a0b010c02, 0x02001701100f0f02, 0x02040e190e011002, 0x020600150e131002,
+	0x000617062b171002, 0x0c01001b1f221002, 0x1000280d00101602, 0x021701060f001802, 0x02120101070b1a02, 0x0212010116091b02,
+	0x000111062b091b02, 0x0102160908002002, 0x0806020923002002, 0x011507090b112002, 0x00020a0919162a02, 0x000e0d2512250508,
+	0x0110001e0d01100a, 0x000718060b12040c, 0x011000001e10160c, 0x050019060b02240c, 0x0304062608160014, 0x000c232507120514,
+	0x00280d2508120514, 0x0003252809120514, 0x0403200119120514, 0x0006250d1d120514, 0x01071b011e000015, 0x0000170f020b0915,
+	0x01041b001e001315, 0x040a2500051a0017, 0x040c2700051a0017, 0x01040026131a0017, 0x010400121e1a0017, 0x000619070e020517,
+	0x00030616140b0617, 0x000907012c190c17, 0x0406010129190e17, 0x0106010629190e17, 0x0007010306090f17, 0x0403030f1c001017,
+	0x040303011b181017, 0x01071f01160c0c19, 0x00031a050e250c19, 0x031801010420161b, 0x0006102505120b1c, 0x0003142505120b1c,
+	0x0100162507120b1c, 0x0100112508120b1c, 0x0703040119120b1c, 0x0c15070d29070002, 0x01050c1803100102, 0x0806051b17100102,
+	0x02001b071e100102, 0x00040c171e100102, 0x0001151b16070802, 0x010109211b070802, 0x0000120f1f0a0802, 0x150a150901070902,
+	0x000c151c01070902, 0x0001151b13070902, 0x000c0d281a070902, 0x000a092c1a070902, 0x0605011524240b02, 0x02001607070c1102,
+	0x00121f07070c1102, 0x0403200110071202, 0x0006152c07061302, 0x0004011f1e101302, 0x0001211b06071802, 0x000325011b071802,
+	0x0003011b2c071802, 0x0105160908002002, 0x0806050923002002, 0x0506150522250008, 0x0506150525070108, 0x00010b1908251008,
+	0x0103011f1e13100a, 0x00011f061e16100a, 0x020008180328100a, 0x00011f061e10170c, 0x0003010f191a0514, 0x01011f160b050614,
+	0x0003030119102414, 0x0004070f23070515, 0x0100060b27070515, 0x01060f1d0b011015, 0x0106011d0b121015, 0x0106011d0b051315,
+	0x000907022c190c17, 0x0406010229190e17, 0x000401101e021017, 0x010f06001e0e1017, 0x010107001e0e1017, 0x0100060b1e141017,
+	0x01071f02160c0c19, 0x00030618160c0c19, 0x000115021207091c, 0x05001c051b000002, 0x001517060f050802, 0x00051c061c050802,
+	0x0500170624050802, 0x000d170624050802, 0x00021c0b1b070802, 0x0001140f190b0802, 0x000a1c091c0c0a02, 0x0016021606100e02,
+	0x0500141709261002, 0x000d141709261002, 0x0014000f1e101702, 0x000114022b091b02, 0x0100231d0412100a, 0x020000020b13110a,
+	0x0a0f23000e030514, 0x0a031a000e1a0514, 0x01090e061d000015, 0x010a00161d090b15, 0x02010204080e0017, 0x050c01000e091017,
+	0x02000d0208181017, 0x040300021b181017, 0x0007160b04031019, 0x031802010120161b, 0x0305010219120b1c, 0x0105091600180b1c,
+	0x0000151905180b1c, 0x0a00091b2a070002, 0x0506050719090002, 0x0117180101050802, 0x00150e0615050802, 0x000a090525050802,
+	0x000a09051b090802, 0x000a091f190b0802, 0x050a002719090b02, 0x0010001819180b02, 0x0007032319250b02, 0x0015061519081002,
+	0x0015061419091002, 0x0010001819111002, 0x0010001719221002, 0x00000f2319221002, 0x0010000e25101602, 0x0a00090f22002002,
+	0x0a000a0923002002, 0x05000d1818250508, 0x000005211e13100a, 0x020000040b13110a, 0x000705060c13110a, 0x0a030125190d0014,
+	0x130602061e160014, 0x0d06010222160014, 0x020417060d000015, 0x130605020b0b0015, 0x02010404080e0017, 0x0406020329190017,
+	0x00060002190b0d17, 0x0406020029190e17, 0x02000d0408181017, 0x040300041b181017, 0x0500050c042b1017, 0x00070510042b1017,
+	0x00070501002b1117, 0x0113060216030019, 0x0200170d04031019, 0x031804010120161b, 0x0305010419120b1c, 0x0218280d09070002,
+	0x0602150e2a070002, 0x0a00091b2a070002, 0x000e050719090002, 0x01111a000d050802, 0x020a01061c050802, 0x000a090525050802,
+	0x000a09051b090802, 0x000a091f190b0802, 0x0200010f1e0e0a02, 0x02001e0f0f000b02, 0x0006150525120b02, 0x0a0615001a170b02,
+	0x0200000f181c0b02, 0x01071a001b1c0b02, 0x0006150516250b02, 0x0a061500122c0b02, 0x01111a091c000c02, 0x01141a092d000c02,
+	0x01111a0013080c02, 0x0006150509150f02, 0x000615050b260f02, 0x060b15052a001002, 0x0006151f0b091702, 0x00280d1f04101702,
+	0x00280d05070b1a02, 0x00280d0516091b02, 0x000113052b091b02, 0x00010f062b091b02, 0x000115041b061d02, 0x140e280d09002002,
+	0x1507280d16002002, 0x0406201516002002, 0x0608150622002002, 0x0a00090f22002002, 0x0a000a0923002002, 0x0406071523002002,
+	0x060e150624002002, 0x000600150b112002, 0x040615030d012102, 0x0406150f0e012102, 0x00020a1a06250508, 0x0004031a19250508,
+	0x0004031a25071108, 0x0107051b1e010b0a, 0x0100051e1b060b0a, 0x010007051b250b0a, 0x01000f251e010e0a, 0x0101211e0401100a,
+	0x0106071e1401100a, 0x01001f1e0416100a, 0x0109061e0001110a, 0x0100141e0b01110a, 0x010218091e07000c, 0x01001f1e0410170c,
+	0x0100051e070b1a0c, 0x010005161e091b0c, 0x01140e091e00200c, 0x011507161e00200c, 0x03041422090e0014, 0x04060315221b0014,
+	0x040603151b070114, 0x02001b070d120514, 0x0008280d19120514, 0x040615001b140514, 0x02000d1a07180514, 0x040600151b180514,
+	0x06011501191c0514, 0x020b05050d000015, 0x0602020e1d070015, 0x0102080e1e070015, 0x060b02051d001015, 0x010b08051e001015,
+	0x0109061e00061015, 0x0100051e0f061015, 0x0406040329190017, 0x010306040f2b0017, 0x02001a03070e0b17, 0x0003260602190c17,
+	0x030601062c190c17, 0x00032206041b0c17, 0x00080115041b0c17, 0x00060004190b0d17, 0x0406040029190e17, 0x03060115001a0e17,
+	0x0005080e040b0f17, 0x0500092204001017, 0x00000d1404091017, 0x000701260e091017, 0x010407001e091017, 0x02001405040e1017,
+	0x01002505040e1017, 0x0200050d04141017, 0x0001080404021a17, 0x0000051b07041a17, 0x0306110100061a17, 0x00000d0f03031019,
+	0x0000250f04031019, 0x0104001e13061019, 0x0104000713251019, 0x030400011014091b, 0x0003062410120b1c, 0x0100081119120b1c,
+	0x0001080404150b1c, 0x0306061700180b1c, 0x0002160507180b1c, 0x000108040402211c, 0x0000051b0704211c, 0x030611010006211c,
+	0x0111180101050802, 0x0110190101050802, 0x0a01090325050802, 0x0501090525050802, 0x0802260901070802, 0x0a0109031b090802,
+	0x050109051b090802, 0x02001b0f0f000b02, 0x0a031e0112170b02, 0x0200010f12200b02, 0x02000f0f01220b02, 0x02000f1207220b02,
+	0x02000f0422100e02, 0x080119011e091102, 0x0217010608071602, 0x0a030b010e111702, 0x02070103060a2102, 0x0012070615002c02,
+	0x050605041a250008, 0x0100160b25102008, 0x020005010b13110a, 0x0a061e010e120514, 0x020d04060b000015, 0x051604060b000015,
+	0x020411060d000015, 0x0602040e1d070015, 0x060b04051d001015, 0x000605051d001315, 0x00050b03060b0f17, 0x00000f03060b0f17,
+	0x050c010c06001017, 0x050c01000a091017, 0x050100260e091017, 0x00020c2307181017, 0x0002280d08181017, 0x0300022809181017,
+	0x020009040d181017, 0x040006091b181017, 0x0600020d1d181017, 0x02000d0b04031019, 0x0500160b04031019, 0x0200110d04031019,
+	0x0305020119120b1c, 0x0500230519000002, 0x000e220619000002, 0x1506150612010002, 0x0507160629010002, 0x0500050619090002,
+	0x15061506070e0102, 0x0314000d0e100702, 0x0100180111050802, 0x00011b0612050802, 0x0300150d23050802, 0x0101091f190b0802,
+	0x15061506000c0a02, 0x150615060a010b02, 0x0114001809120b02, 0x1506150619000f02, 0x150606151e000f02, 0x1506150600141002,
+	0x020301130e191002, 0x0203011913221002, 0x150615060d001302, 0x0009001f1e101302, 0x1506150600071602, 0x0100091f1e101702,
+	0x00011b0600111702, 0x00012206060b1a02, 0x0200011c0e0f1d02, 0x0106070910242002, 0x0314150d09002c02, 0x0400201014102408,
+	0x0101231e0401100a, 0x0d0600270314100a, 0x000518060b12040c, 0x0304141b090a0014, 0x0304062408160014, 0x04031e0119120514,
+	0x130600050e102414, 0x01041b031e000015, 0x0015060f02010915, 0x0016011c13080117, 0x00011907020b0917, 0x000602062c190c17,
+	0x00060501190b0d17, 0x0004030306090f17, 0x0200051609001017, 0x020005100d001017, 0x010c090d1c001017, 0x000900101e021017,
+	0x0a00251005091017, 0x0c00271005091017, 0x0100102613091017, 0x010010121e091017, 0x00040c2307181017, 0x0004280d08181017,
+	0x0300042809181017, 0x020005010d181017, 0x010109091b181017, 0x0600040d1d181017, 0x0201000d04031019, 0x0c01000b1e031019,
+	0x0001080317120b1c, 0x0305040119120b1c, 0x150a09051b000002, 0x000c1c051b000002, 0x0c170d0528000002, 0x0a1709052c000002,
+	0x021607050e0b0102, 0x121f07050e0b0102, 0x02160701200b0102, 0x121f0701200b0102, 0x15061f15060e0102, 0x000a221a04100102,
+	0x020d000a16100102, 0x0516000a16100102, 0x001f160d16100102, 0x0011280d16100102, 0x000a221a00050802, 0x0100180115050802,
+	0x0901090525050802, 0x0219010110060802, 0x08011b0110060802, 0x0018120127060802, 0x090109051b090802, 0x0014001819180b02,
+	0x0014001819111002, 0x000617052b171002, 0x0a0301130e191002, 0x0a03011913221002, 0x0014001719221002, 0x00061501160b1202,
+	0x00000619160b1202, 0x0100092a16101302, 0x000401281f101602, 0x0014000e25101602, 0x0004011f2b101602, 0x04031f010e111702,
+	0x021701050f001802, 0x000111052b091b02, 0x011621010c061d02, 0x080122010c061d02, 0x000121040c061d02, 0x031601010c2c1d02,
+	0x000301040c2c1d02, 0x0219010100162102, 0x08011b0100162102, 0x031801010c162102, 0x001612011b092402, 0x000012041b092402,
+	0x011416012a140008, 0x010014042a140008, 0x02010b1d0d1d0008, 0x0016150125012008, 0x0000150425012008, 0x0001150b25102008,
+	0x01011f042414100a, 0x01011e042a14100a, 0x050909000325100a, 0x0100111e1610010c, 0x00010e061024200c, 0x030601161e160014,
+	0x0101160908190014, 0x0806010923190014, 0x080601091e1b0014, 0x0106010e1b1d0014, 0x0015061a07160514, 0x0000240404101e14,
+	0x020d00020b070015, 0x051600020b070015, 0x020011020d070015, 0x0c01000b27070515, 0x01061b011d001315, 0x000601241d011615,
+	0x0006011d05022115, 0x0516012701080117, 0x0500042701080117, 0x010c0106190b0917, 0x000604062c190c17, 0x0101080d190b0d17,
+	0x0019011607020e17, 0x0506092204001017, 0x0306012312001017, 0x0501060b1c001017, 0x0403050f1c001017, 0x05010b2701081017,
+	0x05012d0f01091017, 0x050001260e091017, 0x000d01260e091017, 0x050106011b0a1017, 0x02010d00040e1017, 0x05011600040e1017,
+	0x0000240404131017, 0x0201000d04141017, 0x0306012300181017, 0x0016010a07181017, 0x01010c2307181017, 0x02010d0108181017,
+	0x0101280d08181017, 0x0301012809181017, 0x040305011b181017, 0x0601010d1d181017, 0x050107010d2a1017, 0x0501000c042b1017,
+	0x010c010f042b1017, 0x061615011d030019, 0x000615041d030019, 0x01031a000e250c19, 0x0009001b1407021b, 0x010118090820161b,
+	0x0100062410120b1c, 0x0001081219120b1c, 0x02280d0411000002, 0x020614150b090102, 0x0310110d04100102, 0x020c220d04100102,
+	0x0214280d04100102, 0x0310110d00050802, 0x020c220d00050802, 0x0214280d00050802, 0x0200280d16050802, 0x0601091f190b0802,
+	0x0203190116100a02, 0x0201210415060b02, 0x0203010413250b02, 0x02030104152c0b02, 0x02031901100f0f02, 0x0206141500261002,
+	0x0206001516261002, 0x020109042c001802, 0x0002150b25102008, 0x0106231e0401100a, 0x010204111e00000c, 0x0102141e0410010c,
+	0x010214001e05080c, 0x010200161e05080c, 0x000a0506100b120c, 0x00020e061024200c, 0x00140e060b02240c, 0x0102160908190014,
+	0x0806020923190014, 0x080602091e1b0014, 0x0310040216000614, 0x00061907020b0917, 0x00040f03060b0f17, 0x0306022312001017,
+	0x0502060b1c001017, 0x0510070d01051017, 0x05020b2701081017, 0x05022d0f01091017, 0x050002260e091017, 0x000d02260e091017,
+	0x050206011b0a1017, 0x0306022300181017, 0x0016020a07181017, 0x02010c2307181017, 0x0201280d08181017, 0x0302012809181017,
+	0x0602010d1d181017, 0x050207010d2a1017, 0x0206000d04031019, 0x010218090820161b, 0x000a051106120b1c, 0x0006080317120b1c,
+	0x0214000e1e100102, 0x0201140406000e02, 0x0200140f04101702, 0x02001402060b1a02, 0x000c0b2412250508, 0x0800100b18250508,
+	0x0204190625000b08, 0x0002220b25100f08, 0x020205061b01100a, 0x021400090314100a, 0x00021f042414100a, 0x00021e042a14100a,
+	0x020a05060e01110a, 0x0103051b1e00130c, 0x0305011e1205200c, 0x0204032c06070015, 0x01030a051e001315, 0x02001907020b0917,
+	0x000c0206190b0917, 0x0002080d190b0d17, 0x0703010c1e001017, 0x000c020f042b1017, 0x02071f00160c0c19, 0x0200080317120b1c,
+	0x02010b041f000002, 0x0218270d09070002, 0x001f0d1b15070002, 0x000614051a090002, 0x1706020a16100102, 0x0107020a16100102,
+	0x01171a0101050802, 0x0906061c01100a02, 0x000614170e131002, 0x00061c051b001302, 0x02000b1f04101302, 0x1706001f06101302,
+	0x0107001f06101302, 0x00270d1f04101702, 0x1706000a14101702, 0x0107000a14101702, 0x00270d05070b1a02, 0x00270d0516091b02,
+	0x140e270d09002002, 0x1507270d16002002, 0x000614051a002c02, 0x01011f190b250008, 0x010017161a250008, 0x02000b2412140508,
+	0x02000d1718140508, 0x010b190525000b08, 0x0100150b25102008, 0x010a12061b01100a, 0x010000211e13100a, 0x00041f042414100a,
+	0x00041e042a14100a, 0x01020f060e01110a, 0x010700060c13110a, 0x01180526060b010c, 0x01000e061024200c, 0x0200090f22190014,
+	0x02000a0923190014, 0x02000a091e1b0014, 0x0a0f25000e030514, 0x0008270d19120514, 0x0a030500090a1a14, 0x01001d0104102114,
+	0x0109062c06010015, 0x170602020b070015, 0x010702020b070015, 0x000c0406190b0917, 0x02000b0306190b17, 0x02000306091c0b17,
+	0x010907002c190c17, 0x0004080d190b0d17, 0x0105090b1c001017, 0x02000b1004021017, 0x1706001006021017, 0x0107001006021017,
+	0x0406002911051017, 0x01000d1701091017, 0x010d00260e091017, 0x010509011b0a1017, 0x0c060111010f1017, 0x01000d0601151017,
+	0x0200030904171017, 0x0116000a07181017, 0x000209091b181017, 0x0703010901261017, 0x000c040f042b1017, 0x01070010042b1017,
+	0x010608010e0a1117, 0x01070001002b1117, 0x0100001b07041a17, 0x0109070300061a17, 0x04071f00160c0c19, 0x01000d0601101019,
+	0x01000d0601141019, 0x020018090820161b, 0x0100081219120b1c, 0x0102160007180b1c, 0x0100001b0704211c, 0x010907030006211c,
+	0x0602160b2b070002, 0x0514000e1e100102, 0x0504190625000b08, 0x050205061b01100a, 0x050a05060e01110a, 0x0400090f22190014,
+	0x04000a0923190014, 0x04000a091e1b0014, 0x02060511181d0014, 0x0504032c06070015, 0x060411061d001015, 0x010506040f2b0017,
+	0x05001907020b0917, 0x050601062c190c17, 0x05060115001a0e17, 0x000409091b181017, 0x0506110100061a17, 0x040018090820161b,
+	0x0005062410120b1c, 0x0500080317120b1c, 0x0506061700180b1c, 0x050611010006211c, 0x1406150612010002, 0x00280d1b11070002,
+	0x050022160b050102, 0x14061506070e0102, 0x0513000e1e100102, 0x051e160115000702, 0x110a1a000d050802, 0x0a01090525050802,
+	0x0219280d01070802, 0x0a0109051b090802, 0x0500150f190b0802, 0x0105091e1b0b0802, 0x00020b2b1c070902, 0x14061506000c0a02,
+	0x140615060a010b02, 0x0a071a001b1c0b02, 0x1106150012200b02, 0x0600101524240b02, 0x060b150501250b02, 0x000b050619250b02,
+	0x0f07180016260b02, 0x110a1a091c000c02, 0x0a141a092d000c02, 0x110a1a0013080c02, 0x0f07180326000e02, 0x0f071800260e0e02,
+	0x1406150619000f02, 0x140606151e000f02, 0x1406150600141002, 0x0602152001221002, 0x0600151e17221002, 0x0002200619221002,
+	0x140615060d001302, 0x1406150600071602, 0x0000280d0b111702, 0x000f180226001802, 0x010025091b071802, 0x0100091b2c071802,
+	0x0b280d0501091b02, 0x0012100127091b02, 0x050015022b091b02, 0x000b0c052b091b02, 0x0600152b0e0f1d02, 0x010109041b092402,
+	0x000622150b162402, 0x110109091c162402, 0x07280d001d162402, 0x011409092d162402, 0x0012100119092c02, 0x0012011a0a250508,
+	0x0007052012250508, 0x00010c2412250508, 0x0012010f25100f08, 0x0004061906240b0a, 0x000420042a14100a, 0x020000180328100a,
+	0x0100111e0b01110a, 0x0100001e0b16110a, 0x01001b111e07000c, 0x0102191e0107080c, 0x0100001e0b11170c, 0x000406062c0b1a0c,
+	0x010b05011e091b0c, 0x00010406032c210c, 0x0107001d1e16240c, 0x0100090f191a0514, 0x0114011500130814, 0x0020011505130814,
+	0x011201001e190914, 0x0114000f000a0a14, 0x0000200f050a0a14, 0x0f04230607000b14, 0x0100030919102414, 0x0014060f02010915,
+	0x060415061d001015, 0x0f11230107020017, 0x000f230704020517, 0x000622040b190c17, 0x040102062c190c17, 0x0f01230607020e17,
+	0x11010d0107190e17, 0x0001240204000f17, 0x010900131e011017, 0x0200032809081017, 0x050200260e091017, 0x000a2505040e1017,
+	0x000c2705040e1017, 0x01002613040e1017, 0x0100121e040e1017, 0x0100041e01151017, 0x01001e040b151017, 0x0100041e01101019,
+	0x01001e040b101019, 0x010014021014091b, 0x00040c061014091b, 0x0114000f000d0b1c, 0x0000200f050d0b1c, 0x0014140e0e100702,
+	0x0100210923050802, 0x010209211b070802, 0x0701091f190b0802, 0x0600141524240b02, 0x02000f0610200c02, 0x03000f2110200c02,
+	0x03000f2110240c02, 0x0301011b2a061202, 0x02050105070b1a02, 0x0205010516091b02, 0x0010100127091b02, 0x0114210909002c02,
+	0x0010100119092c02, 0x0010011a0a250508, 0x0010010f25100f08, 0x0107231e0401100a, 0x02171a0105070014, 0x0201171a11070014,
+	0x02142104090a0014, 0x02142109050d0014, 0x0023190107060414, 0x020918010d180514, 0x02001b060d180514, 0x010a1b011e000614,
+	0x011001001e190914, 0x0006020b27070515, 0x00071907020b0917, 0x0512010c06001017, 0x020c090d1c001017, 0x051201000a091017,
+	0x0600041d06141017, 0x0601011d09141017, 0x020109091b181017, 0x0f0600020b291017, 0x010700020b291017, 0x0207000d04031019,
+	0x0007080317120b1c, 0x080c1c060d000002, 0x16280d0611000002, 0x080c1c0603070102, 0x01060c1803100102, 0x0103111804100102,
+	0x0103101904100102, 0x0806061b17100102, 0x080c1c0607000702, 0x011809060c100702, 0x0219010616010802, 0x08011b0616010802,
+	0x0103111800050802, 0x0103101900050802, 0x010018060f050802, 0x00160e0615050802, 0x0701090525050802, 0x070109051b090802,
+	0x080c1c0601010902, 0x0219010613010902, 0x08011b0613010902, 0x080c1c0607000a02, 0x0212090116100a02, 0x0611150616000b02,
+	0x0508160616000b02, 0x0116210615060b02, 0x0801220615060b02, 0x080c1c0600080b02, 0x0606011524240b02, 0x0316010613250b02,
+	0x03160106152c0b02, 0x0115181606000c02, 0x080c1c0600080f02, 0x02120901100f0f02, 0x0016061519081002, 0x080c1c0600091002,
+	0x0219010618091002, 0x08011b0618091002, 0x0517060119091002, 0x0016061419091002, 0x0501160629091002, 0x0219010600131002,
+	0x08011b0600131002, 0x031801060c131002, 0x060e150600251002, 0x060115060b251002, 0x0318010615261002, 0x011609062c001802,
+	0x0106160908002002, 0x0806060923002002, 0x02020b1d0d1d0008, 0x02011f042414100a, 0x02011e042a14100a, 0x010d061e0001110a,
+	0x011606111e00000c, 0x0006061d0a020b15, 0x010d061e00061015, 0x020c0106190b0917, 0x0201080d190b0d17, 0x02020d00040e1017,
+	0x05021600040e1017, 0x0202000d04141017, 0x02020d0108181017, 0x0502000c042b1017, 0x020c010f042b1017, 0x02031a000e250c19,
+	0x080106021201091c, 0x0200062410120b1c, 0x0002081219120b1c, 0x0503130219000002, 0x050e170219000002, 0x02030b041f000002,
+	0x020b16071f000002, 0x0806090716080002, 0x00120c07180b0002, 0x080609071c0b0102, 0x01090c1803100102, 0x0503130e04100102,
+	0x050e170e04100102, 0x0806091b17100102, 0x030109041f040802, 0x011609071f040802, 0x0503130e00050802, 0x050e170e00050802,
+	0x01141a000d050802, 0x03000d0715050802, 0x03000d0a26050802, 0x010f09071b080802, 0x0401091f190b0802, 0x03030104210b0a02,
+	0x03160107210b0a02, 0x1506150319010b02, 0x1506150017170b02, 0x0609011524240b02, 0x030a1a0408000c02, 0x0a161a0708000c02,
+	0x01141a091c000c02, 0x01141a0013080c02, 0x0503150406000e02, 0x0515160706000e02, 0x150607151e000f02, 0x1506001508100f02,
+	0x030b06041f001002, 0x0b0616071f001002, 0x051303190e011002, 0x0503130019081002, 0x050e170019081002, 0x00031b190e121002,
+	0x0118090716091102, 0x0806090700061202, 0x0615070b01061202, 0x0118090709061202, 0x00070b0619061202, 0x00031b190e051302,
+	0x0806090724001702, 0x0318010714071702, 0x00030c040c061d02, 0x00160c070c061d02, 0x0806090700111d02, 0x1506150005111d02,
+	0x001200070e2a1d02, 0x0109160908002002, 0x010d160909002002, 0x0806090712002002, 0x0806090923002002, 0x010e090719092002,
+	0x0107070910242002, 0x0806090705012102, 0x080107050b062102, 0x03061501040a2102, 0x000615170e0a2102, 0x001200070e162102,
+	0x00060e150e162102, 0x0c030d010e1c2102, 0x03010f0a0e1c2102, 0x00030b140e1c2102, 0x0806090700162402, 0x0301090408162402,
+	0x0116090708162402, 0x1506001511162402, 0x0012180716002c02, 0x05060c051a250008, 0x0103140414000b08, 0x0114160714000b08,
+	0x0104231e0401100a, 0x021500180306100a, 0x020007180328100a, 0x050905060e01110a, 0x01031f010e13110a, 0x020108180e13110a,
+	0x030601190e13110a, 0x0306010e2014110a, 0x00011f060e16110a, 0x00011f060e11170c, 0x000d18060e031d0c, 0x00030f061205200c,
+	0x00091e061205200c, 0x00030c2407120514, 0x010314040b000614, 0x011416070b000614, 0x0015000d04061a14, 0x0f0605001d180b15,
+	0x0f0605031d001015, 0x0015001c0f051015, 0x0f0605001d111015, 0x03061004050e0017, 0x03031404050e0017, 0x06161007050e0017,
+	0x03161407050e0017, 0x01031604070e0017, 0x01161607070e0017, 0x01031104080e0017, 0x01161107080e0017, 0x030305040d140017,
+	0x031605070d140017, 0x000304060a150117, 0x001607060a150117, 0x000819070e020517, 0x0801070212090717, 0x0d06040701190717,
+	0x001500040d1c0717, 0x00041907020b0917, 0x030601030f190b17, 0x1506000411190c17, 0x00011a0106190e17, 0x0001240107190e17,
+	0x00150a0304000f17, 0x0507070401010f17, 0x0103091304011017, 0x0304010d12051017, 0x00030a130e041117, 0x030b06040b030019,
+	0x0b0616070b030019, 0x08060f0716030019, 0x000304060a100119, 0x001607060a100119, 0x000304060a140119, 0x001607060a140119,
+	0x0204000d04031019, 0x0010070317120b1c, 0x0004080317120b1c, 0x0007011c13160b1c, 0x0614000e1e100102, 0x08001e010a100702,
+	0x0a0f0b010e100702, 0x00001e0615050802, 0x010c0121190b0802, 0x01000f0610200c02, 0x000c01211e101702, 0x070c01060c111702,
+	0x01050105070b1a02, 0x0105010516091b02, 0x090c010627091b02, 0x090c010619092c02, 0x0f05020d1d0b0108, 0x0604190625000b08,
+	0x060205061b01100a, 0x0400061a1b12100a, 0x020105071b13100a, 0x0c00091e031c100a, 0x0c00091f0325100a, 0x010000180328100a,
+	0x060a05060e01110a, 0x0a0105070e13110a, 0x01171a0105070014, 0x0101171a11070014, 0x001f210f05090014, 0x0a0f070125090014,
+	0x01142104090a0014, 0x01142109050d0014, 0x071f210009100514, 0x0f0301061b140514, 0x010918010d180514, 0x01001b060d180514,
+	0x080526011a000614, 0x0604032c06070015, 0x00010e1a020b0915, 0x0401101a020b0915, 0x010407040c2b0017, 0x080407011c2b0017,
+	0x06001907020b0917, 0x0100032809081017, 0x0107000d04031019, 0x0600080317120b1c, 0x042718031b000002, 0x0c00091b2a070002,
+	0x0407271803100102, 0x0d18271806000702, 0x182718010c000702, 0x000c090525050802, 0x000c09051b090802, 0x000c091f190b0802,
+	0x0009271816100a02, 0x0018271808120b02, 0x0008271812170b02, 0x0c00180f01260b02, 0x000c181207260b02, 0x080023180e080c02,
+	0x000c180426100e02, 0x00092718100f0f02, 0x080018011e091102, 0x0c00090f22002002, 0x0c000a0923002002, 0x02011f190b250008,
+	0x020017161a250008, 0x020b190525000b08, 0x0200150b25102008, 0x020a12061b01100a, 0x020000211e13100a, 0x02020f060e01110a,
+	0x020700060c13110a, 0x02180526060b010c, 0x02000e061024200c, 0x000820250e120514, 0x02001d0104102114, 0x0209062c06010015,
+	0x030705020b0b0015, 0x020907002c190c17, 0x0205090b1c001017, 0x02000d1701091017, 0x020d00260e091017, 0x020509011b0a1017,
+	0x02000d0601151017, 0x0216000a07181017, 0x02070010042b1017, 0x020608010e0a1117, 0x02070001002b1117, 0x0200001b07041a17,
+	0x0209070300061a17, 0x02000d0601101019, 0x02000d0601141019, 0x0200081219120b1c, 0x0202160007180b1c, 0x0200001b0704211c,
+	0x020907030006211c, 0x000c1c051b000002, 0x04010b041f000002, 0x00120d1b28070002, 0x02060d1d28070002, 0x0206160d29070002,
+	0x1000091b2a070002, 0x00100d1b2a070002, 0x060e050719090002, 0x0b07050e1f0b0002, 0x0414000e1e100102, 0x000c170624050802,
+	0x0801190624050802, 0x0010090525050802, 0x00100d0525050802, 0x001009051b090802, 0x00100d051b090802, 0x0010091f190b0802,
+	0x00100d1f190b0802, 0x01010d21190b0802, 0x00020d281a070902, 0x00020d2b1c070902, 0x0a0e002719090b02, 0x000c141709261002,
+	0x0801141909261002, 0x000b071f0b091302, 0x04000b1f04101302, 0x00010d211e101702, 0x07010d060c111702, 0x09010d0627091b02,
+	0x000111052b091b02, 0x060113052b091b02, 0x06010f062b091b02, 0x060115041b061d02, 0x1000090f22002002, 0x00100d0f22002002,
+	0x10000a0923002002, 0x000a100d23002002, 0x0014070d0e162102, 0x0f1207060f002c02, 0x09010d0619092c02, 0x00040d1a1e140008,
+	0x04000b2412140508, 0x04000d1718140508, 0x000e0d1818250508, 0x0404190625000b08, 0x040205061b01100a, 0x020105081b13100a,
+	0x040a05060e01110a, 0x0a0105080e13110a, 0x13041422090e0014, 0x0022060d19120514, 0x09010608161e0514, 0x0012021a0b090614,
+	0x0000250605102014, 0x04060d0615002114, 0x0404032c06070015, 0x0107030c16290117, 0x04001907020b0917, 0x000b0710020b0917,
+	0x00040616140b0917, 0x00090406190b0917, 0x04000b0306190b17, 0x04000306091c0b17, 0x001207030c2b0b17, 0x000b07030f2b0b17,
+	0x16040306001a0e17, 0x04000b1004021017, 0x0c0c01000e091017, 0x0c0101170e091017, 0x0400030904171017, 0x000e050c042b1017,
+	0x0009040f042b1017, 0x00060d0515041a17, 0x0004060a16041a17, 0x0801000b1e031019, 0x130400011014091b, 0x120702001a0c161b,
+	0x0101140a0920161b, 0x0400080317120b1c, 0x0004091a10180b1c, 0x00060d051504211c, 0x0004060a1604211c, 0x0105180b1b060005,
+	0x000f231816070005, 0x03100d0a17070005, 0x01140c1809170005, 0x15061515061b0005, 0x05062215061b0005, 0x080c091c061b0005,
+	0x010023090f1b0005, 0x08060209181b0005, 0x0806020922240005, 0x0a0f100b09260005, 0x0806020924070105, 0x03050d1b060b0105,
+	0x0202190107060605, 0x0801021b07060605, 0x00280d05170b0605, 0x01180905260b0605, 0x0100111806100605, 0x0110001906100605,
+	0x0016020e16100605, 0x0001061b17100605, 0x03100d0a01130805, 0x0a280d0318010905, 0x05280d0518010905, 0x02120f0100190905,
+	0x0212010117190905, 0x09010a0626190905, 0x0001140626190905, 0x050016050d280905, 0x000a090517280905, 0x0806000924081005,
+	0x01000a0924081005, 0x01091818010c1605, 0x0100181b060c1605, 0x01141809010f1605, 0x02091901061d1605, 0x02011607061d1605,
+	0x12011f07061d1605, 0x0801091b061d1605, 0x060801061c0a1a05, 0x00060806200a1a05, 0x0004010d200a1a05, 0x00001d1404102105,
+	0x0100041a00102405, 0x0300140d07102405, 0x000e200d07102405, 0x000e0c1807102405, 0x06000e0a1c102405, 0x020416070614000e,
+	0x12041f070614000e, 0x010301041f29010e, 0x110604001c1b0c0e, 0x00030f0503090f0e, 0x110612041c00100e, 0x010619041c00100e,
+	0x0c0601101c00100e, 0x0b0601231c00100e, 0x06000f291c05100e, 0x06000f2b1c05100e, 0x0212010f0009100e, 0x021201011709100e,
+	0x030400142609100e, 0x04000e202609100e, 0x021201010314100e, 0x0106001c1a17100e, 0x02000301121e100e, 0x0106001c122c100e,
+	0x0006040613061a0e, 0x02071603101a0005, 0x12071f03101a0005, 0x021601091b1a0005, 0x06170f060b1d0005, 0x0006051a171d0005,
+	0x06021611201d0005, 0x04060a1b241d0005, 0x00000d2306100f05, 0x040600241d100f05, 0x000600051d041a05, 0x0a0b06000b0a1a05,
+	0x0204010a0b0a1a05, 0x0100060b160b1a05, 0x0200150d04101e05, 0x00001d0f04102105, 0x000222180d1b0007, 0x0f0502180b260007,
+	0x000a001a1c0b0207, 0x02061701180f0507, 0x0501280d12240507, 0x01021609182c0507, 0x02011c010f100f07, 0x020105092c100f07,
+	0x02040106060f1007, 0x0101001809101307, 0x0f0002180c261607, 0x010109051b271607, 0x020101040f012007, 0x000e05061a002307,
+	0x010109051b0c2307, 0x0a0a090004132307, 0x010a25051b000009, 0x010c27051b000009, 0x0212011403100109, 0x050c012003100109,
+	0x0112012503100109, 0x1506060417100109, 0x0100061c29101609, 0x020605011b101709, 0x0a0605010e111709, 0x0204140601091b09,
+	0x0104250601091b09, 0x06140e010e031d09, 0x000a082512052009, 0x000c082712052009, 0x0a0112210306100a, 0x13060016031e100a,
+	0x0c00001e031e100a, 0x000205061b10170d, 0x000a05060e11170d, 0x110f06011c00180d, 0x011107011c00180d, 0x0a0613001a05180d,
+	0x11011e030209180d, 0x000408200b11180d, 0x110f060003051b0d, 0x0111070003051b0d, 0x00010d2206051b0d, 0x0007012306051b0d,
+	0x00030617190b1b0d, 0x02000817030b1e0d, 0x030400061110220d, 0x0006011d1110220d, 0x01011e031a09240d, 0x010703231e1c000e,
+	0x03040008162a0c0e, 0x010700231e1c0e0e, 0x050c011e0600100e, 0x0f0606051d00100e, 0x01061c0f1d00100e, 0x020605151d00100e,
+	0x0106021b1d00100e, 0x0b06001d1404100e, 0x000602241d05100e, 0x0601011d1d12100e, 0x0600041e1d12100e, 0x060002201d18100e,
+	0x0100091e1622100e, 0x0806001d0224100e, 0x00060b0503061a0e, 0x0006061703081a0e, 0x0801062402060c19, 0x011000020d061019,
+	0x0706010c011e1019, 0x0801020206070c1b, 0x020216070e070004, 0x12021f070e070004, 0x020d000a1b070004, 0x0516000a1b070004,
+	0x001f160d1b070004, 0x0011280d1b070004, 0x03050d061a0b0004, 0x010301041f250b04, 0x020b160705001004, 0x120b1f0705001004,
+	0x0603011f0e191004, 0x000012210b1b1004, 0x060301191f221004, 0x0906150600231004, 0x000615050f231004, 0x0100090f1f0a1204,
+	0x01000c1803101304, 0x0806001b17101304, 0x0014000e1e101304, 0x02021a091a090005, 0x0200231922090005, 0x00060d1a1e110005,
+	0x0116180109150005, 0x0118010315150005, 0x0c000a0d1e1c0005, 0x0200231909070105, 0x001400131e100b05, 0x020d040619000009,
+	0x0516040619000009, 0x010600211a101309, 0x000602281d101609, 0x001400131e02100e, 0x000209181c18100e, 0x0006040612061a0e,
+	0x0500001804081a0e, 0x05001801040b1a0e, 0x0004150309051b1e, 0x000703060f051b1e, 0x0004030012051b1e, 0x0003030613051b1e,
+	0x0307000d190b0804, 0x0001140e190b0804, 0x00001d10190b0804, 0x000a001a1c0b0904, 0x0a0e210019090b04, 0x0a030f001a1c0b04,
+	0x06000f1524200b04, 0x010006041f250b04, 0x0a001a0f22000c04, 0x0a000a1a23000c04, 0x1506150615000f04, 0x0600061f0e191004,
+	0x060006191f221004, 0x00031b06190a1204, 0x0009000f1f0a1204, 0x01000c1803101704, 0x0806001b17101704, 0x0014000e1e101704,
+	0x0100180115091b04, 0x010b09052a091b04, 0x0c01011513061d04, 0x00061522040a2104, 0x0100160908162404, 0x0100090f22162404,
+	0x0806000923162404, 0x01000a0923162404, 0x02121a0112070005, 0x050f23061c070005, 0x00061715161b0005, 0x01101d0100190905,
+	0x090109061b190905, 0x00061605000d1005, 0x0101001809101706, 0x08050d051d2c0007, 0x000a1e14120f0507, 0x000a1e0b12150507,
+	0x0501280d121e0507, 0x0305000d12280507, 0x0501200d12280507, 0x05010c1812280507, 0x0016050a121a0508, 0x05010c23121a0508,
+	0x0305000d121d0508, 0x0501200d121d0508, 0x05010c18121d0508, 0x00010b191a0b1108, 0x0100111f190b0809, 0x010600211a101709,
+	0x0c041f0601091b09, 0x01041f0612091b09, 0x000a082512052209, 0x000c082712052209, 0x0207170504002609, 0x0304141409002609,
+	0x020a051709002609, 0x04140e2009002609, 0x0415072016002609, 0x0a0f100003052609, 0x000f061b12052609, 0x0100071b12052609,
+	0x000c081c12052609, 0x0100061f12052609, 0x0200170502092609, 0x020b16070503000a, 0x120b1f070503000a, 0x0318010526030b0a,
+	0x010700180403100a, 0x021600071703100a, 0x0c001c0f2200020d, 0x0c000a1c2300020d, 0x000928061909020d, 0x01020818042b000e,
+	0x01030619042b000e, 0x06041115062b000e, 0x05040816062b000e, 0x00000f2204220c0e, 0x00000a2304220c0e, 0x00100018041c0e0e,
+	0x001400131e04100e, 0x000a091a1c05100e, 0x0110011d0009100e, 0x0806001d021e100e, 0x000a082512050d18, 0x000c082712050d18,
+	0x00000d06020f1019, 0x010709050416161b, 0x0300030d0816161b, 0x0a0105090916161b, 0x0507160504000d1e, 0x050a051609000d1e,
+	0x02140e1809000d1e, 0x0215071816000d1e, 0x000a081a12050d1e, 0x0500160502090d1e, 0x0a10280d00050804, 0x010d001806050804,
+	0x0200280d0a050804, 0x010018010c050804, 0x0c0117062b091004, 0x0a06121501221004, 0x000a120619221004, 0x0a06101500261004,
+	0x020600150a261004, 0x000617062b071604, 0x0204010a2b101604, 0x0004011c2b101604, 0x0001091d2b101604, 0x00060015240b1804,
+	0x1506151506002004, 0x0506221506002004, 0x080c091c06002004, 0x010023090f002004, 0x0806020918002004, 0x050f230624070005,
+	0x020d001e0f0e0005, 0x0516001e0f0e0005, 0x0118010316150005, 0x0209190f06170005, 0x1506151506190005, 0x0506221506190005,
+	0x080c091c06190005, 0x010023090f190005, 0x0806020918190005, 0x00011a06101b0905, 0x0001130516280905, 0x00010f0616280905,
+	0x00010608160c1005, 0x02000f010d1e1605, 0x0004270013061a05, 0x0105100900102005, 0x0806021a00102005, 0x000f0c2307102005,
+	0x000f280d08102005, 0x03000f2809102005, 0x020a09010d102005, 0x02000e010d102005, 0x06000f0d1d102005, 0x0202140106051b06,
+	0x0201120406051b06, 0x0e011f0506051b06, 0x00010b191a0b1508, 0x0c01002318070509, 0x000f061b180b0509, 0x0100071b180b0509,
+	0x000c081c180b0509, 0x0100061f180b0509, 0x01060105290b1c09, 0x0200170504092609, 0x0c0104061b092609, 0x0c071f0002051b0d,
+	0x0100060d24051b0d, 0x0106010529190b0e, 0x050205270108100e, 0x000209181c12100e, 0x0806001d041e100e, 0x000701200629100e,
+	0x0015070317041a0e, 0x1506150406001818, 0x0506220406001818, 0x1306021106001818, 0x0f06022206001818, 0x0107022206001818,
+	0x0201040606160c19, 0x020b000228061019, 0x00000d06040f1019, 0x030201062116161b, 0x0500160504090d1e, 0x04031f0f0100181e,
+	0x01031f0f0600181e, 0x020316180600181e, 0x010018010f050804, 0x020b160705000b04, 0x120b1f0705000b04, 0x020b01051d080b04,
+	0x0318010526120b04, 0x02121a0117070005, 0x020a0517070d0005, 0x06181005260e0005, 0x03181405260e0005, 0x00060514181d0005,
+	0x0105100500130805, 0x020a05010d130805, 0x03180105260e1605, 0x0006160500271605, 0x02000d0a03051b06, 0x0500160a03051b06,
+	0x001f160d03051b06, 0x0011280d03051b06, 0x0007160e03051b06, 0x0000251203051b06, 0x01031801101b0007, 0x0501160500052307,
+	0x0500011a1e1a0508, 0x000d011a1e1a0508, 0x02001a030b1a1608, 0x020d040619000709, 0x0516040619000709, 0x000604062c0c1c09,
+	0x01060105290e1c09, 0x11011e031308020d, 0x000604062c190c0e, 0x02001607031f0c0e, 0x00121f07031f0c0e, 0x0106010529190e0e,
+	0x0006251003001818, 0x0003251403001818, 0x060e01011e051818, 0x02001607030b0c19, 0x00121f07030b0c19, 0x030401060a16161b,
+	0x00031a030e1a161b, 0x000a0b030305181e, 0x00050b050305181e, 0x000c0d050305181e, 0x05000d1623000004, 0x0a15071a29030004,
+	0x020614150f050104, 0x10080619190b0104, 0x050f0f1817000704, 0x080026091e040804, 0x000a1a170d050804, 0x0102180927060804,
+	0x1506061519010b04, 0x000615112c180b04, 0x0006151712200b04, 0x0a06121501250b04, 0x000a120619250b04, 0x0a071a171b000c04,
+	0x0a15071a26000c04, 0x000a1a2211080c04, 0x000a1a1713080c04, 0x050f091826000e04, 0x020017011a160f04, 0x0109181815001004,
+	0x01061a152c001004, 0x02040e190f011004, 0x0100181a15081004, 0x000615112c111004, 0x020600150f131004, 0x0100061f11271004,
+	0x02001d0110011204, 0x0100091b2a061204, 0x010509181a001704, 0x0200160703151704, 0x00121f0703151704, 0x0006152224031804,
+	0x01000c18070b1a04, 0x0009280d200b1a04, 0x0a12280d01091b04, 0x01000a1814091b04, 0x01000c1816091b04, 0x000a120c2b091b04,
+	0x0001091a2b091b04, 0x02001401071b1d04, 0x020a0901060a2104, 0x02000e01060a2104, 0x03000f100d1c2104, 0x010216091b092404,
+	0x010709171b162404, 0x0115070926162404, 0x00060d1a21110005, 0x0c000a0d25170005, 0x0c000a0d211c0005, 0x01001813150d0905,
+	0x0100181506140905, 0x0a0f122307000b05, 0x090606181d000e05, 0x020012040a051b06, 0x0e001f050a051b06, 0x0804000925051b06,
+	0x0701010925051b06, 0x080e00050a091b06, 0x080400091b091b06, 0x070101091b091b06, 0x05010a1617230007, 0x0300030d06281007,
+	0x08000d0221091207, 0x08020d0221002307, 0x0501190009082307, 0x08000d02210f2307, 0x00001d0514112307, 0x070104091b112307,
+	0x050605171b1a0008, 0x05061505261a0008, 0x0300030d061d1008, 0x02011c1418000009, 0x01011c2518000009, 0x0115061b1f000009,
+	0x0106172c1f000009, 0x0c000a1c05090009, 0x01000a171f090009, 0x0c01002318080509, 0x010d00251f050809, 0x010d001f1b090809,
+	0x0d060005280b1a09, 0x0110011700091b09, 0x0304021a00091b09, 0x1101121e05091b09, 0x0101191e05091b09, 0x0201052111091b09,
+	0x0202050123091b09, 0x0110011706001c09, 0x0304021a06001c09, 0x0304022407001c09, 0x0c0601161e001c09, 0x13060005270b1c09,
+	0x0003061b260c1c09, 0x06000f1a03282109, 0x0202051708002609, 0x0402162008002609, 0x04000a2013002609, 0x0200170225002609,
+	0x0c01011d1b092609, 0x0004092006102609, 0x0200091701202609, 0x0100241a1c03000a, 0x010018061a030b0a, 0x020014010a03110a,
+	0x020316010f03110a, 0x0c071c171b00020d, 0x0c15071c2600020d, 0x000c1c221108020d, 0x11011e091308020d, 0x000c1c171308020d,
+	0x00051d171308020d, 0x0a011e171308020d, 0x050122171308020d, 0x01021e2d1909020d, 0x020d001e1b09020d, 0x0516001e1b09020d,
+	0x04000a202200170d, 0x010006240911170d, 0x0c001f0102051b0d, 0x0c01000224051b0d, 0x030400141809240d, 0x0f1000021b09240d,
+	0x0a0f12230702000e, 0x01000a1b1e14000e, 0x011001170619000e, 0x0304021a0619000e, 0x030402240719000e, 0x0c0601161e19000e,
+	0x02060515162b000e, 0x010018121508010e, 0x1306000527190b0e, 0x0003061b26190c0e, 0x0007171b04220c0e, 0x0015072604220c0e,
+	0x0201052112000f0e, 0x02000f181c000f0e, 0x020b060500061a0e, 0x0105140900061a0e, 0x0500091e04061a0e, 0x0500062005061a0e,
+	0x0005092005061a0e, 0x0002051507061a0e, 0x0004092010061a0e, 0x0002091814061a0e, 0x020009021a061a0e, 0x0501190801091a0e,
+	0x0001191507091a0e, 0x0007131709051818, 0x0c01000a1c051818, 0x0100140d1c051818, 0x00000d1302091818, 0x0001062402091818,
+	0x0207020407160019, 0x0002160c28060119, 0x0009061728060119, 0x05000018280d0119, 0x1204000900160c19, 0x0200040a06160c19,
+	0x001507151a03021b, 0x0002050c100f091b, 0x0001091c100f091b, 0x00000c03101a091b, 0x020105090816161b, 0x010009022516161b,
+	0x0502051608000d1e, 0x0202161808000d1e, 0x02000a1813000d1e, 0x0500160225000d1e, 0x0002091806100d1e, 0x0500091601200d1e,
+	0x000a0b090305181e, 0x0015070313031b1e, 0x000616051a090004, 0x0001240612050804, 0x0000232016050804, 0x0000172616050804,
+	0x000a25061c050804, 0x000c27061c050804, 0x01010d21190b0804, 0x0005200b1b0b0804, 0x0000200f1b0b0804, 0x0009022b1c070904,
+	0x020d001e0f000b04, 0x0516001e0f000b04, 0x020d0000181c0b04, 0x05160000181c0b04, 0x05010921181c0b04, 0x01001f0f12220b04,
+	0x0110000610200c04, 0x0a000a251e000f04, 0x0c000a271e000f04, 0x0c01170629091004, 0x020401140e191004, 0x0204011914221004,
+	0x0006170629071604, 0x0204010a29101604, 0x0004011c29101604, 0x0001091d29101604, 0x01000d211e101704, 0x0001240600111704,
+	0x01070d060c111704, 0x13060001260b1a04, 0x00011a0614091b04, 0x09010d0627091b04, 0x030614000e162104, 0x000616051a002c04,
+	0x09010d0619092c04, 0x0110010317170005, 0x1008060a17170005, 0x10000c0f22170005, 0x10000a0c23170005, 0x070d060d150b0105,
+	0x0007280117190905, 0x0c01001c09071a05, 0x0a0615000c0a1a05, 0x0106010c160b1a05, 0x0d06150115002105, 0x070d060215002105,
+	0x0b06000c17102105, 0x090606010c102405, 0x0306001217102405, 0x0806001417102405, 0x030424011c001706, 0x0201050d1b101706,
+	0x0a01050d0e111706, 0x01010d0d22051b06, 0x0701010d23051b06, 0x020d0406190d0007, 0x05160406190d0007, 0x011101151f1b0007,
+	0x0200002312240507, 0x010d011c1f002207, 0x000a251f0403100a, 0x000c271f0403100a, 0x0a0612011b03100a, 0x000013211e03100a,
+	0x13060016031d100a, 0x0c00001e031d100a, 0x020000140b03110a, 0x010000250b03110a, 0x000713060c03110a, 0x02060f010e03110a,
+	0x090604061a2b000e, 0x01060404232b000e, 0x00000f2202240c0e, 0x00000a2302240c0e, 0x0c0104061c000f0e, 0x020b06051c00100e,
+	0x010514091c00100e, 0x000701281709100e, 0x030400061c12100e, 0x0006011d1c12100e, 0x0003061b042b110e, 0x0003061717041a0e,
+	0x0006040614061a0e, 0x0706010c011d1019, 0x000220010916161b, 0x030600031e16161b, 0x0c01001b04070a1e, 0x0006061718050d1e,
+	0x0100061c100f0d1e, 0x0006040606100d1e, 0x0100060401200d1e, 0x0304011c0700171e, 0x0004200e0410171e, 0x080600041710171e,
+	0x10070c050400181e, 0x0a10050c0900181e, 0x040415200900181e, 0x040720060f00181e, 0x040420001200181e, 0x040320061300181e,
+	0x020a0b000305181e, 0x040613001705181e, 0x00100c050209181e, 0x0006080603051b1e, 0x0004010d03051b1e, 0x0c000d1b2a070004,
+	0x000a0d1a03100104, 0x000a251a04100104, 0x000a251a00050804, 0x0112180101050804, 0x000a0b0325050804, 0x00050b0525050804,
+	0x000c0d0525050804, 0x000a0b031b090804, 0x00050b051b090804, 0x000c0d051b090804, 0x000c0d1f190b0804, 0x0a000a1a00221004,
+	0x0a00181a09221004, 0x0a00181a08261004, 0x0c000d0f22002004, 0x0c000a0d23002004, 0x050c010e1b060005, 0x051901151b060005,
+	0x0c001c0f220e0005, 0x0c000a1c230e0005, 0x0c000d0f22190005, 0x0c000a0d23190005, 0x0c000a0d1e1b0005, 0x000928060e190905,
+	0x0016020716100b05, 0x0000211c070b1105, 0x0500160502090a06, 0x0004200316051b06, 0x0008030622051b06, 0x0004070323051b06,
+	0x000e030624051b06, 0x0500030c190b1b06, 0x00070310190b1b06, 0x050c03010e230007, 0x0519030115230007, 0x0c001f1b02070009,
+	0x020008171d0b0509, 0x03060b0523001c09, 0x0106130529001c09, 0x000604062a0c1c09, 0x000408200b0d1c09, 0x11011e01070e1c09,
+	0x0006052b12052209, 0x0100061c0b112209, 0x0304000818162a09, 0x0200000f0b03110a, 0x03060b052319000e, 0x010613052919000e,
+	0x0001041f0629010e, 0x000703051b2b0b0e, 0x000604062a190c0e, 0x0000030f221f0c0e, 0x00000a03231f0c0e, 0x00000f2204240c0e,
+	0x00000a2304240c0e, 0x00040820190b0d0e, 0x11011e0107190e0e, 0x0000030f252b0e0e, 0x001602071602100e, 0x000209181b18100e,
+	0x0100091e161e100e, 0x00010321042b100e, 0x00060703142b100e, 0x00090306002b110e, 0x000014030b2b110e, 0x00060b0505061a0e,
+	0x0006061705081a0e, 0x0006052b12050d18, 0x0100061c0b110d18, 0x0c01011503051818, 0x000428000a051818, 0x0c0109011c051818,
+	0x060113011c051818, 0x0100060b0b111818, 0x0003060e0b111818, 0x020017030e092418, 0x0000030f220b0c19, 0x00000a03230b0c19,
+	0x02001818080b161b, 0x040218000016161b, 0x020318060116161b, 0x000218000716161b, 0x020118010916161b, 0x020718000a16161b,
+	0x000208180b16161b, 0x020018081016161b, 0x000209181116161b, 0x0102160909070004, 0x01001b091e100104, 0x0212010112050804,
+	0x01010921190b0804, 0x000a0923190b0804, 0x000615230b091704, 0x00280d2304101704, 0x010009211e101704, 0x0212010100111704,
+	0x010709060c111704, 0x0901090627091b04, 0x0006171516002c04, 0x0901090619092c04, 0x0a0f122311070005, 0x15061506150a0005,
+	0x0201041d060d0005, 0x130606241a110005, 0x1306180625110005, 0x0118010318150005, 0x0c000d0f22170005, 0x0c000a0d23170005,
+	0x0006130d1e1d0005, 0x021116011a000605, 0x12111f011a000605, 0x0200161a04050605, 0x00121f1a04050605, 0x020116061a0e0605,
+	0x12011f061a0e0605, 0x0100180115130905, 0x00011907160b0a05, 0x0a0f230307000e05, 0x050f230507000e05, 0x0a0f2300070e0e05,
+	0x0019012b07071005, 0x00031b06130a1a05, 0x020104060d001e05, 0x020105091b101706, 0x0a0105090e111706, 0x0101090d22051b06,
+	0x0804000923051b06, 0x0701010923051b06, 0x011f0d0d1d1b0007, 0x0f0502180b280007, 0x08050d051d2a0007, 0x0f0002180c281607,
+	0x0f0502230b1a0008, 0x0f0502180b1d0008, 0x001901150d1a0508, 0x0001190d1a0a0a08, 0x0f0002230c1a1608, 0x0f0002180c1d1608,
+	0x0c001f1b04070009, 0x0006051b180b0509, 0x010d00231f050809, 0x0106100529001c09, 0x0103140529001c09, 0x0006061718052609,
+	0x0100061c100f2609, 0x0006040606102609, 0x0100060401202609, 0x010d14091f002c09, 0x0a0312011b03100a, 0x000012211e03100a,
+	0x020011010b03110a, 0x000712060c03110a, 0x02030f010e03110a, 0x011000061020020d, 0x0b0600022310220d, 0x010610052919000e,
+	0x010314052919000e, 0x00061503232b0b0e, 0x01001123042b100e, 0x0006040610061a0e, 0x0002160307081a0e, 0x060110011c051818,
+	0x030114011c051818, 0x0002180e0410171e, 0x0c070d050400181e, 0x0a0c050d0900181e, 0x040215180900181e, 0x020718060f00181e,
+	0x040218001200181e, 0x020318061300181e, 0x04030f001705181e, 0x000a0b030209181e, 0x00050b050209181e, 0x000c0d050209181e,
+	0x000e1a0619000004, 0x0c000d1b28070004, 0x0602150e2c070004, 0x0a00091b2c070004, 0x0806021b16100104, 0x010021091e100104,
+	0x021901010a100704, 0x08011b010a100704, 0x0115180101050804, 0x00011b0615050804, 0x080c001c1e080b04, 0x0a0f10002b090b04,
+	0x06000f1524240b04, 0x060b15052c001004, 0x0906150600251004, 0x000615050f251004, 0x0806001b14101704, 0x0200011b0f071804,
+	0x02000d011b071804, 0x00011a06060b1a04, 0x00090b052b091b04, 0x0d14280d09002004, 0x150615060f002004, 0x0d06150624002004,
+	0x0403070110242004, 0x02121a0119070005, 0x0d14280d09190005, 0x150615060f190005, 0x0d06150624190005, 0x0006130d1b1d0005,
+	0x00032106130a1a05, 0x1306001106102105, 0x0403070119102405, 0x0300030d28100f07, 0x0300030d1d100f08, 0x0204140618000009,
+	0x0104250618000009, 0x0101042c1f000009, 0x0006130518090509, 0x01002c1f04101309, 0x01060105270b1c09, 0x0200091718052609,
+	0x00040920100f2609, 0x021600071403100a, 0x0113060002051b0d, 0x0106010527190b0e, 0x0806052405001818, 0x150604060f001818,
+	0x0d06040624001818, 0x060f01011c051818, 0x090601061e051818, 0x0001090428060119, 0x090301061601021b, 0x00090406100f091b,
+	0x040303012216161b, 0x0500091618050d1e, 0x00020918100f0d1e, 0x050c010619080004, 0x0517010719080004, 0x0a030f001b1c0b04,
+	0x06000e1524240b04, 0x0a06150301250b04, 0x0506150501250b04, 0x0006150517250b04, 0x000a030619250b04, 0x0005050619250b04,
+	0x0a280d0301091b04, 0x05280d0501091b04, 0x00280d0517091b04, 0x000a0c032b091b04, 0x00050c052b091b04, 0x0200150f1e0d0005,
+	0x0118010312150005, 0x011001031e160005, 0x1008060a1e160005, 0x08060209221b0005, 0x09060611181d0005, 0x080602091b070105,
+	0x0a0f230307000b05, 0x050f230507000b05, 0x0a0f2300070e0b05, 0x000c230507061005, 0x00280d0508061005, 0x0003052809061005,
+	0x0006050d1d061005, 0x080600091b081005, 0x01000a091b081005, 0x0c06160100081505, 0x0200000f0d1d1605, 0x02000f010d211605,
+	0x08000d02210e2307, 0x0500011a1c1a0508, 0x000d011a1c1a0508, 0x010600211b101709, 0x11011e0305091b09, 0x0100031e100f2609,
+	0x0006052112052c09, 0x020014010b03110a, 0x00000a280810020d, 0x0a0f23030702000e, 0x050f23050702000e, 0x0a0f230007020e0e,
+	0x130601251100100e, 0x00020818042b110e, 0x00030619042b110e, 0x0003061e16041a0e, 0x0006100505061a0e, 0x0003140505061a0e,
+	0x0100160507061a0e, 0x0100110508061a0e, 0x060e01011c051818, 0x000603010b111818, 0x00030301160b0d19, 0x00000f0a0218161b,
+	0x00000a110218161b, 0x0500160504000a1e, 0x150a09061b000004, 0x000c1c061b000004, 0x0c170d0628000004, 0x0a1709062c000004,
+	0x00061715120b0004, 0x000b061b1f0b0004, 0x020614150e050104, 0x021607060e0b0104, 0x121f07060e0b0104, 0x021607011d0b0104,
+	0x121f07011d0b0104, 0x01020c1803100104, 0x0806021b17100104, 0x0901090625050804, 0x090109061b090804, 0x000c0d251c0b0904,
+	0x02001d0112100a04, 0x0200170116100a04, 0x02000d121e060b04, 0x050016121e060b04, 0x0602011524240b04, 0x0a15071a0b010c04,
+	0x02001701100f0f04, 0x02040e190e011004, 0x020600150e131004, 0x000617062b171004, 0x0c01001b1f221004, 0x1000280d00101604,
+	0x021701060f001804, 0x02120101070b1a04, 0x0212010116091b04, 0x000111062b091b04, 0x0102160908002004, 0x0806020923002004,
+	0x011507090b112004, 0x00020a0919162a04, 0x050c012119060005, 0x02121a0113070005, 0x05021326090e0005, 0x0c06160121120005,
+	0x03100d0916150005, 0x0504231609170005, 0x0504160025170005, 0x03180f0626170005, 0x0102160908190005, 0x0806020923190005,
+	0x080602091e1b0005, 0x05041600211c0005, 0x0606061a171d0005, 0x021715060d000605, 0x011f060e160b0605, 0x011f011d160b0605,
+	0x0001061316280905, 0x00010608160d1005, 0x0000171a070b1105, 0x01150709190b1105, 0x001000100a102405, 0x02000d0a05051b06,
+	0x0500160a05051b06, 0x001f160d05051b06, 0x0011280d05051b06, 0x0007160e05051b06, 0x0000251205051b06, 0x02002525120c0507,
+	0x0004201412240507, 0x000419091b0b1207, 0x000a0b0111132307, 0x0002180611132307, 0x050615051a0b0108, 0x05002527120d0508,
+	0x02001a050b1a1608, 0x010602211a100109, 0x000f06190b120409, 0x010007190b120409, 0x001507131d0b0509, 0x000619161d0b0509,
+	0x0006021d1b0b1809, 0x0003061b0b0d1c09, 0x020714011d002209, 0x010725011d002209, 0x0006132512052609, 0x000203091a162a09,
+	0x020316010e03110a, 0x07031801030b150a, 0x00061115030b150a, 0x05000816030b150a, 0x0c15071c0b01020d, 0x02001607051f0c0e,
+	0x00121f07051f0c0e, 0x01071f0116230c0e, 0x0003061b190b0d0e, 0x00150704220b0d0e, 0x0009060306090f0e, 0x0512001b0400100e,
+	0x0110001e0115100e, 0x05120000021f100e, 0x051200040122100e, 0x051200010224100e, 0x020714011d000d18, 0x010725011d000d18,
+	0x0006251005001818, 0x0003251405001818, 0x110f06010d001818, 0x011107010d001818, 0x000a250603051818, 0x000c270603051818,
+	0x050601061a051818, 0x02001607050b0c19, 0x00121f07050b0c19, 0x020701010b160e19, 0x0403010129160e19, 0x0103010629160e19,
+	0x05120000020b1019, 0x0015070b0218161b, 0x0007061b0218161b, 0x00031a050e1a161b, 0x01071a011d000d1e, 0x00030f2512050d1e,
+	0x000a1a060305181e, 0x00030f0603051b1e, 0x0c15070d29070004, 0x01050c1803100104, 0x0806051b17100104, 0x02001b071e100104,
+	0x00040c171e100104, 0x0001151b16070804, 0x010109211b070804, 0x0000120f1f0a0804, 0x150a150901070904, 0x000c151c01070904,
+	0x0001151b13070904, 0x000c0d281a070904, 0x000a092c1a070904, 0x0605011524240b04, 0x02001607070c1104, 0x00121f07070c1104,
+	0x0403200110071204, 0x0006152c07061304, 0x0004011f1e101304, 0x0001211b06071804, 0x000325011b071804, 0x0003011b2c071804,
+	0x0105160908002004, 0x0806050923002004, 0x0201221b060d0005, 0x0105160908190005, 0x0806050923190005, 0x080605091e1b0005,
+	0x02011b060d070105, 0x0201000d16100605, 0x000401121e101e05, 0x0101091f1e101706, 0x00000f141a240507, 0x000109201e101307,
+	0x000109131e101b07, 0x050119000b082307, 0x000a0b0211132307, 0x0000031424102407, 0x001515030d071108, 0x010605211a100109,
+	0x010612211e100109, 0x0006132218070509, 0x000602251d101609, 0x020714021d002209, 0x010725021d002209, 0x0200081718052609,
+	0x00040820100f2609, 0x0003061707152609, 0x01011e081e10170d, 0x010006240b11170d, 0x000306171e10220d, 0x01071f0216230c0e,
+	0x0003061816230c0e, 0x0001210306070f0e, 0x05011908010b1a0e, 0x00011915070b1a0e, 0x020714021d000d18, 0x010725021d000d18,
+	0x0106010e1e101718, 0x110f06020d001818, 0x011107020d001818, 0x020701020b160e19, 0x0403010229160e19, 0x001507120d07021b,
+	0x000313011607021b, 0x000303011e16161b, 0x0015070316070a1e, 0x01071a021d000d1e, 0x0500081618050d1e, 0x00020818100f0d1e,
+	0x05001c051b000004, 0x001517060f050804, 0x00051c061c050804, 0x0500170624050804, 0x000d170624050804, 0x00021c0b1b070804,
+	0x0001140f190b0804, 0x000a1c091c0c0a04, 0x0016021606100e04, 0x0500141709261004, 0x000d141709261004, 0x0014000f1e101704,
+	0x000114022b091b04, 0x02001d1a100e0005, 0x0016020b16100605, 0x001400101e100b05, 0x000023190e071105, 0x00031b06120a1a05,
+	0x00001d1104102105, 0x011101151c1b0007, 0x02000d021e100f07, 0x0016012009101307, 0x0211020118001b07, 0x0200021804051b07,
+	0x02010206180e1b07, 0x0016011309101b07, 0x010d011c1c002207, 0x0101042a1d000009, 0x0501051b28000009, 0x010518091d0b0009,
+	0x000509191d0b0509, 0x0305011a1d0b0509, 0x010d002321050809, 0x00011403190b0809, 0x00000f1f040a1209, 0x0100081d100b1209,
+	0x01002a1d04101309, 0x00031a0522011609, 0x001400031e101709, 0x0100160522091b09, 0x0500082812052009, 0x0f0002230e082209,
+	0x000114031b092609, 0x010d140921002c09, 0x000014211e03100a, 0x000714060c03110a, 0x110e1e091c00020d, 0x0e141e092d00020d,
+	0x110e1e001308020d, 0x00000a270810020d, 0x000021021e10170d, 0x000706020c11170d, 0x020a0205081a000e, 0x010302041f2b000e,
+	0x001400101e02100e, 0x0100091d161e100e, 0x0105091600081a0e, 0x0000151905081a0e, 0x00001914050b1a0e, 0x0f0002230e080d18,
+	0x00010b190b031718, 0x011507060f001818, 0x010d070624001818, 0x050600011c051818, 0x020702030b160019, 0x0403020329160019,
+	0x00021c0109160c19, 0x00020109181e0c19, 0x00030002160b0d19, 0x020702000b160e19, 0x0403020029160e19, 0x010a16000a06161b,
+	0x0a00091b2a070004, 0x0506050719090004, 0x0117180101050804, 0x00150e0615050804, 0x000a090525050804, 0x000a09051b090804,
+	0x000a091f190b0804, 0x050a002719090b04, 0x0010001819180b04, 0x0007032319250b04, 0x0015061519081004, 0x0015061419091004,
+	0x0010001819111004, 0x0010001719221004, 0x00000f2319221004, 0x0010000e25101604, 0x0a00090f22002004, 0x0a000a0923002004,
+	0x00060d1a1e100005, 0x130606241a120005, 0x1306180625120005, 0x0a00090f22190005, 0x0a000a0923190005, 0x0a000a091e1b0005,
+	0x000f180d091c0005, 0x1013060a00100f05, 0x0216060a00100f05, 0x0016061c00100f05, 0x00000d1b07100f05, 0x00020a2407100f05,
+	0x00001c2407100f05, 0x000305250d181605, 0x00150a06071a1605, 0x00001d1304102105, 0x0004200516051b06, 0x0008050622051b06,
+	0x0004070523051b06, 0x000e050624051b06, 0x0500050c190b1b06, 0x00070510190b1b06, 0x050c05010e230007, 0x0519050115230007,
+	0x0200002512240507, 0x02000d041e100f07, 0x0211040118001b07, 0x0200041804051b07, 0x02010406180e1b07, 0x050f180600022307,
+	0x050118061b1a0508, 0x0009061c180b0509, 0x02061a0a02002609, 0x0706011a1e002609, 0x0009062412052609, 0x06000f1a18052609,
+	0x0d060005100f2609, 0x110c1e091c00020d, 0x0c141e092d00020d, 0x110c1e001308020d, 0x00061a050915020d, 0x00061a050b26020d,
+	0x020a0405081a000e, 0x010304041f2b000e, 0x000705051b2b0b0e, 0x0000050f221f0c0e, 0x00000a05231f0c0e, 0x0000050f252b0e0e,
+	0x00010521042b100e, 0x00060705142b100e, 0x00090506002b110e, 0x000014050b2b110e, 0x0906040600061a0e, 0x0406200216001818,
+	0x0608020622001818, 0x0406070223001818, 0x060e020624001818, 0x000600020b111818, 0x020704030b160019, 0x0403040329160019,
+	0x0000050f220b0c19, 0x00000a05230b0c19, 0x00030004160b0d19, 0x020704000b160e19, 0x0403040029160e19, 0x000201091818161b,
+	0x0f0002180e080d1e, 0x0218280d09070004, 0x0602150e2a070004, 0x0a00091b2a070004, 0x000e050719090004, 0x01111a000d050804,
+	0x020a01061c050804, 0x000a090525050804, 0x000a09051b090804, 0x000a091f190b0804, 0x0200010f1e0e0a04, 0x02001e0f0f000b04,
+	0x0006150525120b04, 0x0a0615001a170b04, 0x0200000f181c0b04, 0x01071a001b1c0b04, 0x0006150516250b04, 0x0a061500122c0b04,
+	0x01111a091c000c04, 0x01141a092d000c04, 0x01111a0013080c04, 0x0006150509150f04, 0x000615050b260f04, 0x060b15052a001004,
+	0x0006151f0b091704, 0x00280d1f04101704, 0x00280d05070b1a04, 0x00280d0516091b04, 0x000113052b091b04, 0x00010f062b091b04,
+	0x000115041b061d04, 0x140e280d09002004, 0x1507280d16002004, 0x0406201516002004, 0x0608150622002004, 0x0a00090f22002004,
+	0x0a000a0923002004, 0x0406071523002004, 0x060e150624002004, 0x000600150b112004, 0x040615030d012104, 0x0406150f0e012104,
+	0x140e280d09190005, 0x1507280d16190005, 0x0406201516190005, 0x0608150622190005, 0x0a00090f22190005, 0x0a000a0923190005,
+	0x0406071523190005, 0x060e150624190005, 0x0a000a091e1b0005, 0x040607151e1b0005, 0x0006051a171d0005, 0x060819061b1d0005,
+	0x090615061b010105, 0x000926060e190905, 0x080101121e1c0905, 0x080101101e1f0905, 0x020a1a0507000e05, 0x02000d1a07081005,
+	0x040600151b081005, 0x00060015190b1105, 0x0806180500091505, 0x00061505250e1605, 0x02011a0607211605, 0x01001f1209071a05,
+	0x0009061a07072405, 0x08061805000b2605, 0x0100251100051b06, 0x02040f06190d0007, 0x011f0d0d211b0007, 0x08050d05212a0007,
+	0x050c011e190d0008, 0x000f011a1c1a0508, 0x0009061a1e1a0508, 0x0101042a1f000009, 0x0201051b23000009, 0x03040509190b0009,
+	0x010518091f0b0009, 0x0100081f100b1209, 0x01002a1f04101309, 0x01041f0611091b09, 0x0200082312052009, 0x000010211e03100a,
+	0x020016010b03110a, 0x000710060c03110a, 0x0003061624051b0d, 0x00030617190b1b0d, 0x000615031f2b0b0e, 0x01041f0612000f0e,
+	0x0d0601231100100e, 0x051200240105100e, 0x0100111f042b100e, 0x03060b0500061a0e, 0x0306061700081a0e, 0x0002160507081a0e,
+	0x080c050126000818, 0x000306171c0b0a18, 0x0806052205001818, 0x0406200416001818, 0x0608040622001818, 0x0406070423001818,
+	0x060e040624001818, 0x000426000a051818, 0x000600040b111818, 0x00010804280d0119, 0x020701030a160119, 0x03040001100f091b,
+	0x0111180101050804, 0x0110190101050804, 0x0a01090325050804, 0x0501090525050804, 0x0802260901070804, 0x0a0109031b090804,
+	0x050109051b090804, 0x02001b0f0f000b04, 0x0a031e0112170b04, 0x0200010f12200b04, 0x02000f0f01220b04, 0x02000f1207220b04,
+	0x02000f0422100e04, 0x080119011e091104, 0x0217010608071604, 0x0a030b010e111704, 0x02070103060a2104, 0x0012070615002c04,
+	0x021706010d0b0805, 0x011e011510130805, 0x01001e0f100a0a05, 0x0217010608070f05, 0x0200160904101e05, 0x0200100d04101e05,
+	0x0206010e08102005, 0x02000f010d102005, 0x0012050425110007, 0x0002280d1e100f07, 0x0300050d28100f07, 0x0002200d28100f07,
+	0x00020c1828100f07, 0x0012050425011607, 0x01180102011a1607, 0x050106241a1a0008, 0x00020c231a100f08, 0x0300050d1d100f08,
+	0x0002200d1d100f08, 0x00020c181d100f08, 0x000f061c180b0509, 0x0100071c180b0509, 0x01001e0f050a1209, 0x0c0601001d101609,
+	0x020d040600091b09, 0x0516040600091b09, 0x020d040606001c09, 0x0516040606001c09, 0x01001e0f0d052609, 0x000f062412052609,
+	0x0100072412052609, 0x01011e0d13082609, 0x060002132310220d, 0x020d04060619000e, 0x051604060619000e, 0x000a030306090f0e,
+	0x0005050306090f0e, 0x130601231100100e, 0x0203050f1c00100e, 0x050209181c00100e, 0x02011c010818100e, 0x020305011b18100e,
+	0x0f06040600061a0e, 0x0107040600061a0e, 0x0106011c28001718, 0x020305011116161b, 0x0a0c0d000305181e, 0x0500230519000004,
+	0x000e220619000004, 0x1506150612010004, 0x0507160629010004, 0x0500050619090004, 0x15061506070e0104, 0x0314000d0e100704,
+	0x0100180111050804, 0x00011b0612050804, 0x0300150d23050804, 0x0101091f190b0804, 0x15061506000c0a04, 0x150615060a010b04,
+	0x0114001809120b04, 0x1506150619000f04, 0x150606151e000f04, 0x1506150600141004, 0x020301130e191004, 0x0203011913221004,
+	0x150615060d001304, 0x0009001f1e101304, 0x1506150600071604, 0x0100091f1e101704, 0x00011b0600111704, 0x00012206060b1a04,
+	0x0200011c0e0f1d04, 0x0106070910242004, 0x0314150d09002c04, 0x01141518090a0005, 0x03180f0624170005, 0x00060513181d0005,
+	0x001510060a190905, 0x01001f0a160b1005, 0x0015061a07011105, 0x0006160500091505, 0x01140018090e1605, 0x00150f06071a1605,
+	0x000900121e101e05, 0x0007061c13072405, 0x0d0600140a102405, 0x0d0600110e102405, 0x03000d0614102405, 0x0106070919102405,
+	0x00061605000b2605, 0x03041b011c001706, 0x0016050e05051b06, 0x00041e1412240507, 0x0004280d1e100f07, 0x0004200d28100f07,
+	0x00040c1828100f07, 0x02020106180e1b07, 0x0001061d13012307, 0x0402180011132307, 0x0200181015102407, 0x010011101e102407,
+	0x00040c231a100f08, 0x0004200d1d100f08, 0x00040c181d100f08, 0x040020100f102408, 0x010016101a102408, 0x0115061f03100109,
+	0x0100111f1e100109, 0x0100061c180b0509, 0x0001130522091b09, 0x15060406000c1c09, 0x0304140916002609, 0x0100062412052609,
+	0x0201170501092609, 0x0100051e100f2609, 0x0000121f1e03100a, 0x000010231e03100a, 0x0d060027030f100a, 0x001510060003110a,
+	0x020010010b03110a, 0x03051801030b150a, 0x0d060027100f020d, 0x060004132310220d, 0x1506040600190c0e, 0x0001270513000f0e,
+	0x010a091a1c00100e, 0x02160007021f100e, 0x040a250003051818, 0x040c270003051818, 0x000313061a051818, 0x0006010d1a051818,
+	0x000713061e051818, 0x000605010b111818, 0x00030501160b0d19, 0x02160007020b1019, 0x000712061601021b, 0x010109050d16091b,
+	0x001409100218161b, 0x0004091c0218161b, 0x0501160501090d1e, 0x04030f011c00181e, 0x01030f061c00181e, 0x040a1a000305181e,
+	0x00020b0a0305181e, 0x000703060111181e, 0x04030f0003051b1e, 0x150a09051b000004, 0x000c1c051b000004, 0x0c170d0528000004,
+	0x0a1709052c000004, 0x021607050e0b0104, 0x121f07050e0b0104, 0x02160701200b0104, 0x121f0701200b0104, 0x15061f15060e0104,
+	0x000a221a04100104, 0x020d000a16100104, 0x0516000a16100104, 0x001f160d16100104, 0x0011280d16100104, 0x000a221a00050804,
+	0x0100180115050804, 0x0901090525050804, 0x0219010110060804, 0x08011b0110060804, 0x0018120127060804, 0x090109051b090804,
+	0x0014001819180b04, 0x0014001819111004, 0x000617052b171004, 0x0a0301130e191004, 0x0a03011913221004, 0x0014001719221004,
+	0x00061501160b1204, 0x00000619160b1204, 0x0100092a16101304, 0x000401281f101604, 0x0014000e25101604, 0x0004011f2b101604,
+	0x04031f010e111704, 0x021701050f001804, 0x000111052b091b04, 0x011621010c061d04, 0x080122010c061d04, 0x000121040c061d04,
+	0x031601010c2c1d04, 0x000301040c2c1d04, 0x0219010100162104, 0x08011b0100162104, 0x031801010c162104, 0x001612011b092404,
+	0x000012041b092404, 0x0509062519060005, 0x0906160625120005, 0x0606051a171d0005, 0x09060617181d0005, 0x021715050d000605,
+	0x011f050e160b0605, 0x011f0120160b0605, 0x011e012d10190905, 0x0001051316280905, 0x00010508160d1005, 0x00001b1304102105,
+	0x0016010e14101706, 0x02010d0a00051b06, 0x0501160a00051b06, 0x011f160d00051b06, 0x0111280d00051b06, 0x0501000c190b1b06,
+	0x010c010f190b1b06, 0x02010d011e100f07, 0x0101280d1e100f07, 0x0301000d28100f07, 0x0101200d28100f07, 0x01010c1828100f07,
+	0x0201011804051b07, 0x02040106180e1b07, 0x01191a0105002307, 0x011416012a0f0008, 0x010014042a0f0008, 0x0016010a1a100f08,
+	0x01010c231a100f08, 0x0301000d1d100f08, 0x0101200d1d100f08, 0x01010c181d100f08, 0x02011a000b1a1608, 0x0200172105070009,
+	0x0500011a27070509, 0x0000111a27070509, 0x080c012306002009, 0x020001161603100a, 0x050909001b03100a, 0x01011f04240f100a,
+	0x01011e042a0f100a, 0x11011e0a1308020d, 0x0100061624051b0d, 0x01000617190b1b0d, 0x0c0101092310220d, 0x060101132310220d,
+	0x02011607001f0c0e, 0x01121f07001f0c0e, 0x0009050306090f0e, 0x090209181c00100e, 0x01011e2d1009100e, 0x0806011d011e100e,
+	0x0001121f042b100e, 0x00011023042b100e, 0x010006171c0b0a18, 0x0306011523001818, 0x0101080d0b111818, 0x000013031a092418,
+	0x02011607000b0c19, 0x01121f07000b0c19, 0x01010809160b0d19, 0x0009001b0f07021b, 0x010014091607021b, 0x001601080218161b,
+	0x000004080218161b, 0x01031a000e1a161b, 0x0000030e1610171e, 0x0301120d0800181e, 0x000a0b0a0305181e, 0x02280d0411000004,
+	0x020614150b090104, 0x0310110d04100104, 0x020c220d04100104, 0x0214280d04100104, 0x0310110d00050804, 0x020c220d00050804,
+	0x0214280d00050804, 0x0200280d16050804, 0x0601091f190b0804, 0x0203190116100a04, 0x0201210415060b04, 0x0203010413250b04,
+	0x02030104152c0b04, 0x02031901100f0f04, 0x0206141500261004, 0x0206001516261004, 0x020109042c001804, 0x1008060b1e160005,
+	0x00020b041c130905, 0x0016020e14101706, 0x0201280d1e100f07, 0x0302000d28100f07, 0x0201200d28100f07, 0x02010c1828100f07,
+	0x03140d04010b1207, 0x0016020a1a100f08, 0x02010c231a100f08, 0x0302000d1d100f08, 0x0201200d1d100f08, 0x02010c181d100f08,
+	0x13061404160b0009, 0x0d0614041e0b0009, 0x01140e081f0b0009, 0x0600061c180b0509, 0x06140e011d0b0509, 0x010d141f010b0909,
+	0x0a0605010b0d1c09, 0x080c022306002009, 0x0600062412052609, 0x020b06042a00020d, 0x11011e0d1308020d, 0x0c0102092310220d,
+	0x060201132310220d, 0x050204270108010e, 0x0a060501190b0d0e, 0x01021e2d1009100e, 0x000224040413100e, 0x0806021d011e100e,
+	0x0306021523001818, 0x0a0305010b16161b, 0x0302120d0800181e, 0x000a0b0d0305181e, 0x0214000e1e100104, 0x0201140406000e04,
+	0x0200140f04101704, 0x02001402060b1a04, 0x0012220619070005, 0x001206221e070005, 0x020114040b000605, 0x0214080600130805,
+	0x0200141004100b05, 0x0214000f000e0e05, 0x0003061c1e181605, 0x0003050c1e041a05, 0x02001d0104102105, 0x000c020f190b1b06,
+	0x0c020115201b0007, 0x02010b191a0b0108, 0x02001f1b12070009, 0x0200140304101709, 0x02001403060b1c09, 0x01021e0408002609,
+	0x02001e0f18002609, 0x0200001e100f2609, 0x020000211e03100a, 0x02140009030f100a, 0x00021f04240f100a, 0x00021e042a0f100a,
+	0x02000016031a100a, 0x020000110b03110a, 0x020700060c03110a, 0x0214000f1500020d, 0x02000a281e00020d, 0x02140009100f020d,
+	0x01021f041e00080d, 0x0c0200092310220d, 0x0200140306190b0e, 0x02071f0016230c0e, 0x0200050306090f0e, 0x020014100402100e,
+	0x02001e2d1009100e, 0x0002080d0b111818, 0x020a0b000305181e, 0x02010b041f000004, 0x0218270d09070004, 0x001f0d1b15070004,
+	0x000614051a090004, 0x1706020a16100104, 0x0107020a16100104, 0x01171a0101050804, 0x0906061c01100a04, 0x000614170e131004,
+	0x00061c051b001304, 0x02000b1f04101304, 0x1706001f06101304, 0x0107001f06101304, 0x00270d1f04101704, 0x1706000a14101704,
+	0x0107000a14101704, 0x00270d05070b1a04, 0x00270d0516091b04, 0x140e270d09002004, 0x1507270d16002004, 0x000614051a002c04,
+	0x0200170f0a180005, 0x0200100f0f180005, 0x0503062519180005, 0x140e270d09190005, 0x1507270d16190005, 0x0200120f0a1a0005,
+	0x02071409171a0005, 0x000f1a0d091c0005, 0x020b1706000b0805, 0x0013061c000b1105, 0x0003250018181605, 0x0200150904101e05,
+	0x02000b1204101e05, 0x1706001206101e05, 0x0107001206101e05, 0x020b000f00102005, 0x090606000e102405, 0x0403070018102405,
+	0x0116000e14101706, 0x0107160e00051b06, 0x0100251200051b06, 0x0104200016051b06, 0x0108000622051b06, 0x0104070023051b06,
+	0x010e000624051b06, 0x000c040f190b1b06, 0x01070010190b1b06, 0x02010b0d201b0007, 0x0c040115201b0007, 0x0800230d18150507,
+	0x000c0d2412280507, 0x0800100d18280507, 0x0002220d28100f07, 0x050f1a0600022307, 0x010a0b0011132307, 0x01190115151a0008,
+	0x0115060f1a1a0008, 0x010d06241a1a0008, 0x011119012a1a0008, 0x02000b24120f0508, 0x02000d17180f0508, 0x000c0d24121d0508,
+	0x0800100d181d0508, 0x0116000a1a100f08, 0x0002220d1d100f08, 0x04001f1b12070009, 0x0011061c180b0509, 0x0103051b23001309,
+	0x0106051b28001309, 0x06040106280b1a09, 0x0100130522091b09, 0x0106120529001c09, 0x0c0601001e0c1c09, 0x0305012312052009,
+	0x0605012812052009, 0x0106010403282109, 0x0f0002250e082209, 0x01041e0408002609, 0x04001e0f18002609, 0x0011062412052609,
+	0x0400001e100f2609, 0x00041f04240f100a, 0x00041e042a0f100a, 0x020000130b03110a, 0x020b17050800020d, 0x020013172200020d,
+	0x020013170701020d, 0x020a17050109020d, 0x020000170810020d, 0x020017010b10020d, 0x020717002116020d, 0x01041f041e00080d,
+	0x020417060800170d, 0x0806002302051b0d, 0x0c0400092310220d, 0x010612052919000e, 0x010700051b2b0b0e, 0x0c0601001e190c0e,
+	0x0100000f221f0c0e, 0x01000a00231f0c0e, 0x04071f0016230c0e, 0x01000f2201240c0e, 0x01000a2301240c0e, 0x0100000f252b0e0e,
+	0x0100270513000f0e, 0x011400131e01100e, 0x04001e2d1009100e, 0x020000021a18100e, 0x0100121f042b100e, 0x01010021042b100e,
+	0x01001023042b100e, 0x01060700142b100e, 0x01090006002b110e, 0x010014000b2b110e, 0x1106040600061a0e, 0x0102160007081a0e,
+	0x0f0002250e080d18, 0x0100260d06001818, 0x0c0600010a051818, 0x060112011c051818, 0x0004080d0b111818, 0x0100000f220b0c19,
+	0x01000a00230b0c19, 0x00020809160b0d19, 0x01000d06010f1019, 0x0706010d011e1019, 0x000209050d16091b, 0x0f00021a0e080d1e,
+	0x0602160b2b070004, 0x0514000e1e100104, 0x0a061211181d0005, 0x0a0603181d000e05, 0x050605181d000e05, 0x0a0600181d0e0e05,
+	0x05001d0104102105, 0x05010b191a0b0108, 0x0106160529001c09, 0x050000211e03100a, 0x050700060c03110a, 0x05000a281e00020d,
+	0x0005061624051b0d, 0x00050617190b1b0d, 0x010616052919000e, 0x0500050306090f0e, 0x0706011d011e100e, 0x05060b0500061a0e,
+	0x0506061700081a0e, 0x000506171c0b0a18, 0x060116011c051818, 0x00040809160b0d19, 0x000409050d16091b, 0x050a0b000305181e,
+	0x1406150612010004, 0x00280d1b11070004, 0x050022160b050104, 0x14061506070e0104, 0x0513000e1e100104, 0x051e160115000704,
+	0x110a1a000d050804, 0x0a01090525050804, 0x0219280d01070804, 0x0a0109051b090804, 0x0500150f190b0804, 0x0105091e1b0b0804,
+	0x00020b2b1c070904, 0x14061506000c0a04, 0x140615060a010b04, 0x0a071a001b1c0b04, 0x1106150012200b04, 0x0600101524240b04,
+	0x060b150501250b04, 0x000b050619250b04, 0x0f07180016260b04, 0x110a1a091c000c04, 0x0a141a092d000c04, 0x110a1a0013080c04,
+	0x0f07180326000e04, 0x0f071800260e0e04, 0x1406150619000f04, 0x140606151e000f04, 0x1406150600141004, 0x0602152001221004,
+	0x0600151e17221004, 0x0002200619221004, 0x140615060d001304, 0x1406150600071604, 0x0000280d0b111704, 0x000f180226001804,
+	0x010025091b071804, 0x0100091b2c071804, 0x0b280d0501091b04, 0x0012100127091b04, 0x050015022b091b04, 0x000b0c052b091b04,
+	0x0600152b0e0f1d04, 0x010109041b092404, 0x000622150b162404, 0x110109091c162404, 0x07280d001d162404, 0x011409092d162404,
+	0x0012100119092c04, 0x010f1f230b070005, 0x05110b1609170005, 0x12061501191b0005, 0x0515011500130805, 0x0501152001130805,
+	0x001d011510130805, 0x0122011510130805, 0x001410060a190905, 0x0515000f000a0a05, 0x05000f20010a0a05, 0x00001d0f100a0a05,
+	0x0100220f100a0a05, 0x0f0b230507000b05, 0x0014061a07011105, 0x00140f06071a1605, 0x0100211209071a05, 0x0200040018102405,
+	0x01210d0d211b0007, 0x0502221606230007, 0x000f1803280b0b07, 0x000218190b091307, 0x010011180b091b07, 0x00280d03180b1b07,
+	0x050206241a1a0008, 0x000f23031a0b0b08, 0x000f18031d0b0b08, 0x0114061f03100109, 0x0212012303100109, 0x0100141f1e100109,
+	0x0104011c180b0509, 0x000b061c180b0509, 0x010219181f000709, 0x0105191f010b0809, 0x05001503190b0809, 0x0100161f190b0809,
+	0x0114000f000a1209, 0x00001d0f050a1209, 0x0100220f050a1209, 0x01000f011f0a1209, 0x0104210611091b09, 0x0204060123091b09,
+	0x14060406000c1c09, 0x011407002c0c1c09, 0x0104200408002609, 0x0204170608002609, 0x0114000f15002609, 0x0400200f18002609,
+	0x020003171e002609, 0x00001d0f0d052609, 0x0100220f0d052609, 0x0104012412052609, 0x000b062412052609, 0x0f10000918052609,
+	0x0200001718052609, 0x00011d0d13082609, 0x0101220d13082609, 0x050015031b092609, 0x01140009100f2609, 0x04000020100f2609,
+	0x00031a032a1a0b0a, 0x000420042a0f100a, 0x010016042a1a100a, 0x001410060003110a, 0x06031b010e03110a, 0x110c1c091c00020d,
+	0x0f1000232200020d, 0x0c141c092d00020d, 0x0f1000230701020d, 0x110c1c001308020d, 0x0f0b23050702000e, 0x06041506162b000e,
+	0x1406040600190c0e, 0x011407002c190c0e, 0x0011091c04220c0e, 0x0014092d04220c0e, 0x00111b0304000f0e, 0x0104210612000f0e,
+	0x000a050306090f0e, 0x00051e03060b0f0e, 0x0a0209181c00100e, 0x02000e181c00100e, 0x05011d270108100e, 0x05002d1e0409100e,
+	0x0400202d1009100e, 0x0200182d1409100e, 0x02002d021a09100e, 0x010000110b2b110e, 0x0114070300061a0e, 0x0b06040600061a0e,
+	0x0007200305061a0e, 0x0004150607061a0e, 0x0206011c28001718, 0x060801061a051818, 0x061001011c051818, 0x11010d0302091818,
+	0x01010d031a092418, 0x000f100228060119, 0x00010c0428060119, 0x1101090107160e19, 0x010013091607021b, 0x01001402100f091b,
+	0x00040c06100f091b, 0x00110301101a091b, 0x010409060816161b, 0x010003091e16161b, 0x0102180408000d1e, 0x0504160608000d1e,
+	0x0200180f18000d1e, 0x050003161e000d1e, 0x0500001618050d1e, 0x02000018100f0d1e, 0x0000031a0b05171e, 0x0014140e0e100704,
+	0x0100210923050804, 0x010209211b070804, 0x0701091f190b0804, 0x0600141524240b04, 0x02000f0610200c04, 0x03000f2110200c04,
+	0x03000f2110240c04, 0x0301011b2a061204, 0x02050105070b1a04, 0x0205010516091b04, 0x0010100127091b04, 0x0114210909002c04,
+	0x0010100119092c04, 0x02051a0513070005, 0x021d1a0119070005, 0x0114241a090a0005, 0x0202221b060d0005, 0x02141b09110d0005,
+	0x020f010317170005, 0x030a0f0125170005, 0x02091409171a0005, 0x10061501191b0005, 0x030a0f01211c0005, 0x02021b060d070105,
+	0x020a27011a000605, 0x0202000d16100605, 0x0200150d17100605, 0x021805010d0f0805, 0x021805010d120905, 0x00090526101b0905,
+	0x00190526070b0b05, 0x020918010d081005, 0x02001b060d081005, 0x0023190107081505, 0x0e000d2107102005, 0x0a00092108102005,
+	0x020006160d102005, 0x030021160d102005, 0x0600210c11102005, 0x0e000d2107102405, 0x0a00092108102405, 0x021400070a102405,
+	0x030021160d102405, 0x0600210c11102405, 0x022104011c001706, 0x0212040101051b06, 0x0e1f050101051b06, 0x0210010102051b06,
+	0x020a180100091207, 0x00012c1409101b07, 0x0001231409102207, 0x020a1801000f2307, 0x000123190c1a1608, 0x0210012303100109,
+	0x0700061c180b0509, 0x120601001d101609, 0x0002130522091b09, 0x0700062412052609, 0x0202170501092609, 0x10011e0a1308020d,
+	0x0c0105261b09020d, 0x060013211020020d, 0x060013211024020d, 0x0c001f0802051b0d, 0x030600141e10220d, 0x0019052607020b0e,
+	0x0002270513000f0e, 0x0002210306070f0e, 0x020a091a1c00100e, 0x0a0025210509100e, 0x0c0027210509100e, 0x010021261309100e,
+	0x010021121e09100e, 0x13060014021f100e, 0x130600110224100e, 0x061401011c051818, 0x0204010106160c19, 0x13060014020b1019,
+	0x020109050d16091b, 0x000a01020d18091b, 0x030101022516161b, 0x0502160501090d1e, 0x02030f061c00181e, 0x080c1c060d000004,
+	0x16280d0611000004, 0x080c1c0603070104, 0x01060c1803100104, 0x0103111804100104, 0x0103101904100104, 0x0806061b17100104,
+	0x080c1c0607000704, 0x011809060c100704, 0x0219010616010804, 0x08011b0616010804, 0x0103111800050804, 0x0103101900050804,
+	0x010018060f050804, 0x00160e0615050804, 0x0701090525050804, 0x070109051b090804, 0x080c1c0601010904, 0x0219010613010904,
+	0x08011b0613010904, 0x080c1c0607000a04, 0x0212090116100a04, 0x0611150616000b04, 0x0508160616000b04, 0x0116210615060b04,
+	0x0801220615060b04, 0x080c1c0600080b04, 0x0606011524240b04, 0x0316010613250b04, 0x03160106152c0b04, 0x0115181606000c04,
+	0x080c1c0600080f04, 0x02120901100f0f04, 0x0016061519081004, 0x080c1c0600091004, 0x0219010618091004, 0x08011b0618091004,
+	0x0517060119091004, 0x0016061419091004, 0x0501160629091004, 0x0219010600131004, 0x08011b0600131004, 0x031801060c131004,
+	0x060e150600251004, 0x060115060b251004, 0x0318010615261004, 0x011609062c001804, 0x0106160908002004, 0x0806060923002004,
+	0x02121a0617070005, 0x02190612070d0005, 0x0106160908190005, 0x0806060923190005, 0x08060906191b0005, 0x080606091e1b0005,
+	0x0d0615061b010105, 0x00160b061c130905, 0x05062d0f01190905, 0x050026060e190905, 0x000d26060e190905, 0x00190616070e0b05,
+	0x08061a0600061005, 0x0806061d000c1005, 0x0018060f060c1005, 0x03062306001a1605, 0x00160a06071a1605, 0x010c2306071a1605,
+	0x01280d06081a1605, 0x03010628091a1605, 0x0601060d1d1a1605, 0x080c060600072405, 0x0507061a01072405, 0x0500061a07072405,
+	0x000d061a07072405, 0x02020d0a00051b06, 0x0502160a00051b06, 0x021f160d00051b06, 0x0211280d00051b06, 0x0502000c190b1b06,
+	0x020c010f190b1b06, 0x01031806101b0007, 0x02020d011e100f07, 0x0202011804051b07, 0x0500061a1e1a0508, 0x000d061a1e1a0508,
+	0x02021a000b1a1608, 0x010606211a100109, 0x02011f04240f100a, 0x02011e042a0f100a, 0x050c0900031a100a, 0x0b0616062a00020d,
+	0x0200061624051b0d, 0x02000617190b1b0d, 0x051606270108010e, 0x02021607001f0c0e, 0x02121f07001f0c0e, 0x0019061607020e0e,
+	0x0007050306090f0e, 0x070209181c00100e, 0x0002121f042b100e, 0x00021023042b100e, 0x020006171c0b0a18, 0x060e01061e051818,
+	0x0201080d0b111818, 0x02021607000b0c19, 0x02121f07000b0c19, 0x02010809160b0d19, 0x030e01061601021b, 0x03180105040b161b,
+	0x030105041016161b, 0x02031a000e1a161b, 0x0503130219000004, 0x050e170219000004, 0x02030b041f000004, 0x020b16071f000004,
+	0x0806090716080004, 0x00120c07180b0004, 0x080609071c0b0104, 0x01090c1803100104, 0x0503130e04100104, 0x050e170e04100104,
+	0x0806091b17100104, 0x030109041f040804, 0x011609071f040804, 0x0503130e00050804, 0x050e170e00050804, 0x01141a000d050804,
+	0x03000d0715050804, 0x03000d0a26050804, 0x010f09071b080804, 0x0401091f190b0804, 0x03030104210b0a04, 0x03160107210b0a04,
+	0x1506150319010b04, 0x1506150017170b04, 0x0609011524240b04, 0x030a1a0408000c04, 0x0a161a0708000c04, 0x01141a091c000c04,
+	0x01141a0013080c04, 0x0503150406000e04, 0x0515160706000e04, 0x150607151e000f04, 0x1506001508100f04, 0x030b06041f001004,
+	0x0b0616071f001004, 0x051303190e011004, 0x0503130019081004, 0x050e170019081004, 0x00031b190e121004, 0x0118090716091104,
+	0x0806090700061204, 0x0615070b01061204, 0x0118090709061204, 0x00070b0619061204, 0x00031b190e051304, 0x0806090724001704,
+	0x0318010714071704, 0x00030c040c061d04, 0x00160c070c061d04, 0x0806090700111d04, 0x1506150005111d04, 0x001200070e2a1d04,
+	0x0109160908002004, 0x010d160909002004, 0x0806090712002004, 0x0806090923002004, 0x010e090719092004, 0x0107070910242004,
+	0x0806090705012104, 0x080107050b062104, 0x03061501040a2104, 0x000615170e0a2104, 0x001200070e162104, 0x00060e150e162104,
+	0x0c030d010e1c2104, 0x03010f0a0e1c2104, 0x00030b140e1c2104, 0x0806090700162404, 0x0301090408162404, 0x0116090708162404,
+	0x1506001511162404, 0x0012180716002c04, 0x0e08061622160005, 0x0109160908190005, 0x010d160909190005, 0x0806090712190005,
+	0x0806090923190005, 0x080609091e1b0005, 0x09061211181d0005, 0x050315040b000605, 0x051516070b000605, 0x010e100216000605,
+	0x00181207160e0905, 0x010e090719190905, 0x00090720101b0905, 0x00190720070b0b05, 0x090603181d000e05, 0x090600181d0e0e05,
+	0x05060c01030b1a05, 0x0107070919102405, 0x010314040f001706, 0x011416070f001706, 0x01011f090e111706, 0x0014020e0e111706,
+	0x021204000e051b06, 0x0e1f05000e051b06, 0x00120c0525110007, 0x00120c0525011607, 0x000304140f012007, 0x001607140f012007,
+	0x00030b0415012007, 0x00160b0715012007, 0x00150a1a091a0508, 0x010314040f000b08, 0x011416070f000b08, 0x080c1b0704000009,
+	0x0103140415000009, 0x0114160715000009, 0x05011b071a000009, 0x010304111f000009, 0x011607111f000009, 0x0115031b1f000009,
+	0x0117032c1f000009, 0x0106070e210e0109, 0x0115071f03100109, 0x0103141f04100109, 0x010609211a100109, 0x0c01090718080509,
+	0x0601130718080509, 0x0400061c180b0509, 0x010314001f050809, 0x010300161f050809, 0x001500241a011609, 0x150600041e101609,
+	0x0601021d0e111709, 0x0103001f0e111709, 0x0f0601190e031d09, 0x010701190e031d09, 0x0003061a04022109, 0x0015071a04022109,
+	0x0015001a05022109, 0x080c030700082209, 0x0407200a1b002609, 0x090420091c002609, 0x0202170921002609, 0x0203071722002609,
+	0x0203071707012609, 0x0400062412052609, 0x0207170014052609, 0x0200071718052609, 0x0904200013082609, 0x0004200a13082609,
+	0x04000720100f2609, 0x0d0615072403000a, 0x05031b010e03110a, 0x090601170e03110a, 0x0a01081a0e03110a, 0x0306010e200f110a,
+	0x030c1c040800020d, 0x0c161c070800020d, 0x00031d041609020d, 0x030122041609020d, 0x00161d071609020d, 0x011622071609020d,
+	0x0c0107201b09020d, 0x030420040800170d, 0x041620070800170d, 0x0c011f0902051b0d, 0x0019072007020b0e, 0x0003040804220c0e,
+	0x0016070804220c0e, 0x05011b0701000f0e, 0x000f070306080f0e, 0x080c030700080d18, 0x030600070a051818, 0x0001240302091818,
+	0x0804090707160019, 0x0009170328060119, 0x000304060a0f0119, 0x001607060a0f0119, 0x0115110001160719, 0x030301030f160b19,
+	0x0204000e06160c19, 0x0f0409000016161b, 0x010209092116161b, 0x010307092216161b, 0x0207180a1b000d1e, 0x090218091c000d1e,
+	0x0502160921000d1e, 0x0503071622000d1e, 0x0503071607010d1e, 0x0507160014050d1e, 0x0500071618050d1e, 0x0902180013080d1e,
+	0x0002180a13080d1e, 0x02000718100f0d1e, 0x010c1f0d0900181e, 0x09020b180900181e, 0x05090b000305181e, 0x0614000e1e100104,
+	0x08001e010a100704, 0x0a0f0b010e100704, 0x00001e0615050804, 0x010c0121190b0804, 0x01000f0610200c04, 0x000c01211e101704,
+	0x070c01060c111704, 0x01050105070b1a04, 0x0105010516091b04, 0x090c010627091b04, 0x090c010619092c04, 0x01051a0513070005,
+	0x081f062416070005, 0x011d1a0119070005, 0x0102221b060d0005, 0x0a0f0325070d0005, 0x050f0525070d0005, 0x01141b09110d0005,
+	0x010f010317170005, 0x000c0f0f22170005, 0x000a0c0f23170005, 0x08260111081a0005, 0x00152616081a0005, 0x01091409171a0005,
+	0x08060624171a0005, 0x0806050b241a0005, 0x01021b060d070105, 0x08060523090b0105, 0x0701181a0b090605, 0x0102000d16100605,
+	0x0100150d17100605, 0x020f010a1b050805, 0x011805010d0f0805, 0x0a0f032809010905, 0x050f052809010905, 0x011805010d120905,
+	0x0118010f1a280905, 0x010918010d081005, 0x01001b060d081005, 0x080600241a0c1605, 0x01000a241a0c1605, 0x040100241a1a1605,
+	0x01010809160b1a05, 0x010006160d102005, 0x06001d0104102105, 0x0100040018102405, 0x0a0f010302090a06, 0x050f010502090a06,
+	0x012104011c001706, 0x02050c011b101706, 0x0a050c010e111706, 0x0112040101051b06, 0x0110010102051b06, 0x010c010d22051b06,
+	0x07010c0123051b06, 0x0004051a25110007, 0x000a002512240507, 0x0004051a25011607, 0x06010b191a0b0108, 0x010a051b23000009,
+	0x0112012303100109, 0x0104060123091b09, 0x000a082312052009, 0x0104170608002609, 0x010003171e002609, 0x0100001718052609,
+	0x0a0112071b03100a, 0x060000211e03100a, 0x060700060c03110a, 0x02010f070e03110a, 0x110e1e091c00020d, 0x06000a281e00020d,
+	0x0e141e092d00020d, 0x110e1e001308020d, 0x0600050306090f0e, 0x01002d021a09100e, 0x0104010106160c19, 0x070c0f050400181e,
+	0x0a050c0f0900181e, 0x060a0b000305181e, 0x000c0f050209181e, 0x042718031b000004, 0x0c00091b2a070004, 0x0407271803100104,
+	0x0d18271806000704, 0x182718010c000704, 0x000c090525050804, 0x000c09051b090804, 0x000c091f190b0804, 0x0009271816100a04,
+	0x0018271808120b04, 0x0008271812170b04, 0x0c00180f01260b04, 0x000c181207260b04, 0x080023180e080c04, 0x000c180426100e04,
+	0x00092718100f0f04, 0x080018011e091104, 0x0c00090f22002004, 0x0c000a0923002004, 0x0216222311070005, 0x03141425090e0005,
+	0x140e2025090e0005, 0x15072025160e0005, 0x030706241a120005, 0x0307180625120005, 0x0818062406140005, 0x0823180109140005,
+	0x071f180310150005, 0x0c00090f22190005, 0x0c000a0923190005, 0x0c000a091e1b0005, 0x0310070a00100f05, 0x000d1e2307100f05,
+	0x00182718080e1605, 0x00002306071a1605, 0x0216000e14101706, 0x0207160e00051b06, 0x0200251200051b06, 0x0204200016051b06,
+	0x0208000622051b06, 0x0204070023051b06, 0x020e000624051b06, 0x02070010190b1b06, 0x0805180101271607, 0x08051801010c2307,
+	0x020a0b0011132307, 0x02190115151a0008, 0x0215060f1a1a0008, 0x020d06241a1a0008, 0x021119012a1a0008, 0x0216000a1a100f08,
+	0x0200130522091b09, 0x0c000923031a100a, 0x0c000918031d100a, 0x11101e091c00020d, 0x10141e092d00020d, 0x11101e001308020d,
+	0x020700051b2b0b0e, 0x0200000f221f0c0e, 0x02000a00231f0c0e, 0x02000f2201240c0e, 0x02000a2301240c0e, 0x0200000f252b0e0e,
+	0x0200270513000f0e, 0x021400131e01100e, 0x000222230718100e, 0x0200121f042b100e, 0x02010021042b100e, 0x02001023042b100e,
+	0x02060700142b100e, 0x02090006002b110e, 0x020014000b2b110e, 0x0202160007081a0e, 0x0200260d06001818, 0x0200000f220b0c19,
+	0x02000a00230b0c19, 0x02000d06010f1019, 0x0805180506000d1e, 0x000c1c051b000004, 0x04010b041f000004, 0x00120d1b28070004,
+	0x02060d1d28070004, 0x0206160d29070004, 0x1000091b2a070004, 0x00100d1b2a070004, 0x060e050719090004, 0x0b07050e1f0b0004,
+	0x0414000e1e100104, 0x000c170624050804, 0x0801190624050804, 0x0010090525050804, 0x00100d0525050804, 0x001009051b090804,
+	0x00100d051b090804, 0x0010091f190b0804, 0x00100d1f190b0804, 0x01010d21190b0804, 0x00020d281a070904, 0x00020d2b1c070904,
+	0x0a0e002719090b04, 0x000c141709261004, 0x0801141909261004, 0x000b071f0b091304, 0x04000b1f04101304, 0x00010d211e101704,
+	0x07010d060c111704, 0x09010d0627091b04, 0x000111052b091b04, 0x060113052b091b04, 0x06010f062b091b04, 0x060115041b061d04,
+	0x1000090f22002004, 0x00100d0f22002004, 0x10000a0923002004, 0x000a100d23002004, 0x0014070d0e162104, 0x0f1207060f002c04,
+	0x09010d0619092c04, 0x00130d0f22170005, 0x000a130d23170005, 0x0400170f0a180005, 0x0400100f0f180005, 0x1000090f22190005,
+	0x00100d0f22190005, 0x10000a0923190005, 0x000a100d23190005, 0x0400120f0a1a0005, 0x04071409171a0005, 0x08120109241a0005,
+	0x10000a091e1b0005, 0x000a100d1e1b0005, 0x040b1706000b0805, 0x0001051316280905, 0x010b0700160b0a05, 0x0b07012b00071005,
+	0x13000d00150b1005, 0x00010508160d1005, 0x0007180500091505, 0x000b07120b091e05, 0x0400150904101e05, 0x04000b1204101e05,
+	0x040b000f00102005, 0x0b060d0515002105, 0x04001d0104102105, 0x00071805000b2605, 0x0205010d1b101706, 0x0a05010d0e111706,
+	0x01010d0d22051b06, 0x0701010d23051b06, 0x0d00040d23051b06, 0x000e050c190b1b06, 0x0009040f190b1b06, 0x120b0205250d0007,
+	0x0c01160d1e150007, 0x0016040d201b0007, 0x04010b0d201b0007, 0x09040115201b0007, 0x011926090d230007, 0x010b27090d230007,
+	0x0c0e05010e230007, 0x0e19050115230007, 0x021a0d0a02280007, 0x07011a0d1e280007, 0x00090d2412280507, 0x000f1a0d18280507,
+	0x0d00050d28100f07, 0x0101140a0e231007, 0x01000d211a101307, 0x00040d1a1e0f0008, 0x021a0d0a021d0008, 0x07011a0d1e1d0008,
+	0x04010b191a0b0108, 0x04000b24120f0508, 0x04000d17180f0508, 0x0e0118061b1a0508, 0x00090d24121d0508, 0x000f1a0d181d0508,
+	0x0d00050d1d100f08, 0x010c051b28000009, 0x13040509190b0009, 0x0115072704031d09, 0x000c082812052009, 0x09041a0600082609,
+	0x00041a050f082609, 0x00041a0512092609, 0x0004091a08102609, 0x010114091f162609, 0x0a0112081b03100a, 0x040000211e03100a,
+	0x040000130b03110a, 0x040700060c03110a, 0x02010f080e03110a, 0x040b17050800020d, 0x04000a281e00020d, 0x040013172200020d,
+	0x0b070b052a00020d, 0x040013170701020d, 0x010b071f0b01020d, 0x040a17050109020d, 0x090106291909020d, 0x0b0105261b09020d,
+	0x040000170810020d, 0x040017010b10020d, 0x000b07240b11020d, 0x120100170715020d, 0x011807050915020d, 0x000b071c0b15020d,
+	0x040717002116020d, 0x011807050b26020d, 0x040417060800170d, 0x0a0109042310220d, 0x01000e042310220d, 0x010113072310220d,
+	0x070101082310220d, 0x090400092310220d, 0x0400050306090f0e, 0x040000021a18100e, 0x0004091a10081a0e, 0x0007052205001818,
+	0x0c0600011c051818, 0x010617011c051818, 0x13040001100f091b, 0x01030d042000081e, 0x04060d061c00171e, 0x07130d050400181e,
+	0x0a05130d0900181e, 0x040a0b000305181e, 0x0a0b0d000305181e, 0x00130d050209181e, 0x01020818041c000a, 0x01030619041c000a,
+	0x06041115061c000a, 0x05040816061c000a, 0x02050118150b030a, 0x000a12061b02100a, 0x00020f060e02110a, 0x020b16070503000e,
+	0x120b1f070503000e, 0x0318010526030b0e, 0x0304001b08190c0e, 0x000705041c230c0e, 0x000a05091c230c0e, 0x010700180403100e,
+	0x021600071703100e, 0x001f0d0f051d0010, 0x0304010317260010, 0x071f0d001d100510, 0x0806000924180510, 0x01000a0924180510,
+	0x0101001809100610, 0x0118180601020810, 0x03010d0701102410, 0x01000c1803100211, 0x0806001b17100211, 0x0014000e1e100211,
+	0x0206051501240b11, 0x0002050619240b11, 0x060415062c000e11, 0x04060515001d1d11, 0x000615022c032111, 0x040218031b00081d,
+	0x010c0d051b00081d, 0x040218001b0e081d, 0x000a12061b04100a, 0x00020f060e04110a, 0x000a12061b10050d, 0x00020f060e11050d,
+	0x0a0305000d0a1a10, 0x000306160b091e10, 0x01000c1803100213, 0x0806001b17100213, 0x0014000e1e100213, 0x0206051501240b13,
+	0x0002050619240b13, 0x060415062c000e13, 0x04060515001d1d13, 0x000615022c032113, 0x0801062402060c17, 0x011000020d061017,
+	0x0706010c011e1017, 0x010601040e01221a, 0x0201210412070b01, 0x0307041b12070b01, 0x0204160706150b01, 0x12041f0706150b01,
+	0x01021a11091b0b01, 0x0206051516240b01, 0x0201210404100e01, 0x0307041b04100e01, 0x050416002c011d01, 0x0211160701032101,
+	0x12111f0701032101, 0x010703231e15000a, 0x010700231e150e0a, 0x020605131b01100a, 0x050409201b01100a, 0x000003211e11100a,
+	0x020605011b13100a, 0x0a0605130e01110a, 0x060408200e01110a, 0x000703060c11110a, 0x0a0605010e13110a, 0x020117052900070d,
+	0x050c011d0110070d, 0x010100180910080f, 0x080600190210220f, 0x020008180e10220f, 0x030600190e10220f, 0x030400060f10220f,
+	0x0006011d0f10220f, 0x020024060d120510, 0x0009061a0b090518, 0x00060d010d100518, 0x080600240d100518, 0x00060c011b100518,
+	0x0501090d1b100518, 0x0406200104110518, 0x040615010e110518, 0x0601080d0e110518, 0x0106010d22050f18, 0x0706010123050f18,
+	0x0d06000423050f18, 0x000106060310221a, 0x0b06000b0310221a, 0x0006060e0310221a, 0x0009000f0310221a, 0x050416002400051e,
+	0x000c0d1f0410051e, 0x00020f0309050f1e, 0x0007030615050f1e, 0x110f06011f190b01, 0x011107011f190b01, 0x0206051511240b01,
+	0x0202190107060506, 0x0801021b07060506, 0x00280d05170b0506, 0x01180905260b0506, 0x0100111806100506, 0x0110001906100506,
+	0x0016020e16100506, 0x0001061b17100506, 0x0202190102070f06, 0x0801021b02070f06, 0x000a1e0b12100507, 0x0001140d12230507,
+	0x0500002212230507, 0x020416070612000a, 0x12041f070612000a, 0x0002182a0411100a, 0x021201010312100a, 0x0c001c0f2200040d,
+	0x0c000a1c2300040d, 0x000928061909040d, 0x0100060d131d280d, 0x0118010303150010, 0x09061606001e0510, 0x0806011d00102410,
+	0x0c06160103001d11, 0x0006011503131d11, 0x0515000224060b15, 0x0304001124060b15, 0x010c011c24060b15, 0x0501210602061d15,
+	0x00000d06020f1017, 0x030600151a100518, 0x010601040901221a, 0x050007011a01221a, 0x0d0600030e10221a, 0x060415062c0b0e01,
+	0x050c010619011d01, 0x0517010719011d01, 0x000a221001050f06, 0x0202190104070f06, 0x0801021b04070f06, 0x0102241a06190007,
+	0x03040d1b06190007, 0x0203280d0a190007, 0x03041b010c190007, 0x0e021e061a230007, 0x050905061c230007, 0x01021a061a280007,
+	0x0104001127102007, 0x06140e010e032109, 0x02121a0103070010, 0x0304010322160010, 0x0304000116280910, 0x0201040606160c17,
+	0x020b000228061017, 0x00000d06040f1017, 0x0006011c280b0518, 0x0010090c0510221a, 0x040600130510221a, 0x0003060d1210221a,
+	0x0204160706130b01, 0x12041f0706130b01, 0x060415062c160b01, 0x060415062c0e0e01, 0x050c010619021d01, 0x0517010719021d01,
+	0x04060515031d1d01, 0x0107001803050f06, 0x03041b010f190007, 0x0015100509190507, 0x080c01011e1f0507, 0x0001140210230507,
+	0x0004031c17230507, 0x00280d0517031607, 0x0118090526031607, 0x11011e031308040d, 0x0200160703200c0e, 0x00121f0703200c0e,
+	0x0015051a07090510, 0x00030602161d1d11, 0x02001607030b0c17, 0x00121f07030b0c17, 0x0006011c280e0518, 0x0006120328050f18,
+	0x000610032a050f18, 0x000314032a050f18, 0x00030f0503050f1e, 0x020614150f050201, 0x10080619190b0201, 0x01061c152c150b01,
+	0x0601151d2c0b0e01, 0x0215071829031801, 0x0106151717051d01, 0x020004131c071d01, 0x0207020400101d01, 0x0704280d08111d01,
+	0x0104201108111d01, 0x04060515091d1d01, 0x06060a152c032101, 0x03021a0d1a000506, 0x05000d1620000506, 0x0302000d0c110506,
+	0x020a00090f110506, 0x020116090f110506, 0x050f150003170506, 0x0202190104080f06, 0x0801021b04080f06, 0x010a121610230007,
+	0x050f001709190507, 0x0001061b19190507, 0x0004091c17230507, 0x0003061811281d09, 0x060018100d032109, 0x030018140d032109,
+	0x0c000a1c2204000a, 0x011001171906000a, 0x0304021a1906000a, 0x020021041c12000a, 0x0103061a161c000a, 0x0306001b161c0b0a,
+	0x0003061f161c0b0a, 0x00030611161c0e0a, 0x0c071c171b00040d, 0x0c15071c2600040d, 0x000c1c221108040d, 0x11011e091308040d,
+	0x000c1c171308040d, 0x00051d171308040d, 0x0a011e171308040d, 0x050122171308040d, 0x01021e2d1909040d, 0x020d001e1b09040d,
+	0x0516001e1b09040d, 0x0c000a1c2200050d, 0x000c091c1901220d, 0x0500061d1901220d, 0x0005091d1901220d, 0x0a01091e1901220d,
+	0x01000e1e1901220d, 0x050109221901220d, 0x0100061c0b1a280d, 0x000606170321280d, 0x02000a271a03000e, 0x030409182514000e,
+	0x0002221906030b0e, 0x020011060d100510, 0x0006161700140510, 0x0310040a16000610, 0x01011f1609050610, 0x0305041700130810,
+	0x02001e040d1b0910, 0x020f052307000b10, 0x0212011a07000e10, 0x001209251a000211, 0x0002181703180b13, 0x0806000924032113,
+	0x01000a0924032113, 0x0000032201182113, 0x0105141701060b15, 0x0201052115060b15, 0x0d060005151e0b15, 0x0110011706000e15,
+	0x0304021a06000e15, 0x02000d0d03062115, 0x0500160d03062115, 0x00010c2103062115, 0x000c090a031e2115, 0x03060010031e2115,
+	0x0207020407160017, 0x0002160c28060117, 0x0009061728060117, 0x05000018280d0117, 0x1204000900160c17, 0x0200040a06160c17,
+	0x0006101703050f18, 0x0003141703050f18, 0x0102160d0801221a, 0x060216010e01221a, 0x0007040610031e1d, 0x01060528121e0b01,
+	0x000c1a061a000506, 0x0a01120d1b100506, 0x0000232004110506, 0x0000172604110506, 0x050026010a110506, 0x000d26010a110506,
+	0x000c00060c110506, 0x000117060c110506, 0x02010f0d0e110506, 0x0304240111190007, 0x080c0624021d0007, 0x030401111a280007,
+	0x0015061b180b0507, 0x0006172c180b0507, 0x000124060a190507, 0x0001061a0a280507, 0x00011c2c0b100f07, 0x0004062c060b1007,
+	0x01010d050d191007, 0x0801050120281607, 0x0304000128041a07, 0x0001042c0b012007, 0x000205061b11100a, 0x020605011b12100a,
+	0x000a05060e11110a, 0x0a0605010e12110a, 0x0601011d0e10220f, 0x03041424090a0010, 0x0306011517170010, 0x00001d0204102110,
+	0x0306000319102410, 0x0004032818070913, 0x0004031a23070913, 0x00040020180b0913, 0x01000f2c1f010b13, 0x01002c1f12070b13,
+	0x0100081f12250b13, 0x01002c1f04100e13, 0x0706010c011d1017, 0x0d0615011c00051e, 0x070d06021c00051e, 0x000c1c0e0410051e,
+	0x080600111410051e, 0x080602011610051e, 0x000210061610051e, 0x000e01060a11051e, 0x0a0b060003050f1e, 0x0204010a03050f1e,
+	0x0304000811050f1e, 0x000a0d1a03100201, 0x000a251a04100201, 0x0200180f2a120b01, 0x02000a1816240b01, 0x0500161f0b090506,
+	0x00010321190b0f06, 0x0009030619072407, 0x000003211e12100a, 0x000205061b13100a, 0x000703060c12110a, 0x000a05060e13110a,
+	0x0018052606030b0e, 0x0000030f22200c0e, 0x00000a0323200c0e, 0x000705041c250c0e, 0x000a05091c250c0e, 0x0000030f0e0a1e0f,
+	0x000303061a0a1e0f, 0x0400200f220e0010, 0x04000a20230e0010, 0x01001e0f0e1a0510, 0x00001d0404102110, 0x0100031e0e102410,
+	0x0200181808280b13, 0x0000030f220b0c17, 0x00000a03230b0c17, 0x0110011c07000518, 0x011306021c000518, 0x0106040c26000518,
+	0x0806011c26000518, 0x0204170027000518, 0x020000170b030518, 0x00000d060d100518, 0x00000c061b100518, 0x0004200604110518,
+	0x000415060e110518, 0x0600060d0e110518, 0x110f060003050f18, 0x0111070003050f18, 0x00010d2206050f18, 0x0007012306050f18,
+	0x00030617190b0f18, 0x030600180210221a, 0x01001b091e100201, 0x0a06221501130b01, 0x0a06121502240b01, 0x01280d0423000506,
+	0x01000c180d100506, 0x0a0112091b100506, 0x02010f090e110506, 0x02011b0400050f06, 0x0107031800050f06, 0x01001123190b0f06,
+	0x010518051a0e0007, 0x150a090504190007, 0x000c1c0504190007, 0x01050c1805190007, 0x080c0624021f0007, 0x021201010a190507,
+	0x010109050d191007, 0x09060406191e000a, 0x020305011b12100a, 0x0a0305010e12110a, 0x011000061020040d, 0x020105211310070d,
+	0x080105020b12070d, 0x0100060d190a1e0d, 0x00060b051901220d, 0x020716031a03000e, 0x12071f031a03000e, 0x020716001a030e0e,
+	0x12071f001a030e0e, 0x0b06001d1703100e, 0x0300030d0910220f, 0x0301011d0e10220f, 0x020f052311070010, 0x15061505040a0010,
+	0x020716001a080510, 0x12071f001a080510, 0x001f0d1d04100213, 0x00020018180b0913, 0x0f00021807240b13, 0x090604061e000e15,
+	0x00090602031e2115, 0x000a250e04100518, 0x000c270e04100518, 0x030600180410221a, 0x000106060510221a, 0x0b06000b0510221a,
+	0x0006060e0510221a, 0x0009000f0510221a, 0x010600180910221a, 0x0b0600020f10221a, 0x000a1a0e0410051e, 0x0806021b16100201,
+	0x010021091e100201, 0x060415062c150b01, 0x0a0b06012b190b01, 0x0a06121504240b01, 0x0504160029011d01, 0x000603150d1d1d01,
+	0x061115012c032101, 0x00011b051b0b0506, 0x0001061b14100506, 0x0201210400050f06, 0x0307041b00050f06, 0x0015100504050f06,
+	0x080c0624041f0007, 0x00020a1c06230507, 0x00020a0a10230507, 0x0004031c19230507, 0x0202190103070c07, 0x0801021b03070c07,
+	0x0004031c23071107, 0x03060b05161c000a, 0x020003010b12110a, 0x080105040b12070d, 0x000604060b1a280d, 0x010006040321280d,
+	0x03041424090e0010, 0x0118010305150010, 0x0207140409190010, 0x03060106161d1d11, 0x0001090428060117, 0x0006050528050f18,
+	0x070601010a10221a, 0x0d0600040a10221a, 0x0d0600050e10221a, 0x080600021210221a, 0x0306000e1210221a, 0x02000a1814240b01,
+	0x0115180102190007, 0x010a160310230007, 0x0105160510230007, 0x080c01011c1f0507, 0x00001b0d10230507, 0x00000a280810040d,
+	0x000613051901220d, 0x00030301100b1e0f, 0x02121a0105070010, 0x0212011a11070010, 0x0200030f1b0d0010, 0x030601151e160010,
+	0x0c06160100060410, 0x080600091b180510, 0x01000a091b180510, 0x02000a1800240b13, 0x00030301160b0d17, 0x030600151b100518,
+	0x080600041210221a, 0x020614150e050201, 0x021607060e0b0201, 0x121f07060e0b0201, 0x021607011d0b0201, 0x121f07011d0b0201,
+	0x01020c1803100201, 0x0806021b17100201, 0x0f041509140b0901, 0x000e15051c0b0901, 0x00061d15050b1801, 0x010018011b0b0506,
+	0x0016020e14100506, 0x020a00090e110506, 0x020116090e110506, 0x070118090b150506, 0x0107001805050f06, 0x0115180104190007,
+	0x000a092512270507, 0x0c15071c0b01040d, 0x06170f061d03000e, 0x030617062514000e, 0x0200160705200c0e, 0x00121f0705200c0e,
+	0x0110001e0110100e, 0x051200000220100e, 0x0304062608160010, 0x000c232507120510, 0x00280d2508120510, 0x0003252809120510,
+	0x0403200119120510, 0x0006250d1d120510, 0x0a01210112060b15, 0x02001607050b0c17, 0x00121f07050b0c17, 0x020701010b160e17,
+	0x0403010129160e17, 0x0103010629160e17, 0x05120000020b1017, 0x000c15000b030518, 0x000115170b030518, 0x0200140109100518,
+	0x0100250109100518, 0x0006120528050f18, 0x000610052a050f18, 0x000314052a050f18, 0x01001a010910051e, 0x01050c1803100201,
+	0x0806051b17100201, 0x02001b071e100201, 0x00040c171e100201, 0x0016050e14100506, 0x000c210f051f0007, 0x0103011f1e12100a,
+	0x0100061c0e1d280d, 0x0106011d1603100e, 0x0001091f1e10080f, 0x0003010f191a0510, 0x01011f160b050610, 0x0003030119102410,
+	0x000401201e100213, 0x0004200318070913, 0x0a01210212060b15, 0x020701020b160e17, 0x0403010229160e17, 0x000401141e100518,
+	0x000109151e10081a, 0x0015070313070f1e, 0x0403200204101d01, 0x040315020e101d01, 0x030d1802061d1d01, 0x031802010c1d1d01,
+	0x0517000a14100506, 0x0016020f16100506, 0x0202190201070f06, 0x000e1b0504190007, 0x00151506101f0507, 0x00052206101f0507,
+	0x0016021606100209, 0x00011f19030b0909, 0x00031a2204032109, 0x0107051b26010b0a, 0x01000f2526010e0a, 0x010121260401100a,
+	0x010607261401100a, 0x001400171e04100a, 0x010023280413100a, 0x010906260001110a, 0x010014260b01110a, 0x020000020b12110a,
+	0x110e1e091c00040d, 0x0e141e092d00040d, 0x110e1e001308040d, 0x00000a270810040d, 0x001400171e10050d, 0x0016011f0910080f,
+	0x00030002100b1e0f, 0x0a0f23000e030510, 0x0a031a000e1a0510, 0x0014000b1e100211, 0x0014001c03240b11, 0x001400031e100e11,
+	0x01000f2c1c010b13, 0x01002c1c12070b13, 0x0100081c12250b13, 0x01002c1c04100e13, 0x0517000103062115, 0x0016150103062115,
+	0x0007160203062115, 0x05000701031e2115, 0x020702030b160017, 0x0403020329160017, 0x00021c0109160c17, 0x00020109181e0c17,
+	0x00030002160b0d17, 0x020702000b160e17, 0x0403020029160e17, 0x07031a0127000518, 0x00031a06270e0518, 0x000718040b09081a,
+	0x001601150910081a, 0x050009040110221a, 0x0100160b0810221a, 0x010d00070a10221a, 0x070301000b10221a, 0x03000e050b10221a,
+	0x0403200404101d01, 0x040315040e101d01, 0x030d1804061d1d01, 0x031804010c1d1d01, 0x00150e051b0b0506, 0x0300240d0d100506,
+	0x0015060e14100506, 0x0202190401070f06, 0x00010521190b0f06, 0x000c1b0504190007, 0x0305240d05190007, 0x03050d051a280007,
+	0x00001d0b10230507, 0x0009050619072407, 0x0006020519091809, 0x000005211e12100a, 0x020000040b12110a, 0x000705060c12110a,
+	0x110c1e091c00040d, 0x0c141e092d00040d, 0x110c1e001308040d, 0x00061a050915040d, 0x00061a050b26040d, 0x0000050f22200c0e,
+	0x00000a0523200c0e, 0x0000050f0e0a1e0f, 0x000305061a0a1e0f, 0x00030004100b1e0f, 0x0a030125190d0010, 0x130602061e160010,
+	0x0d06010222160010, 0x00061a0626021d13, 0x020704030b160017, 0x0403040329160017, 0x0000050f220b0c17, 0x00000a05230b0c17,
+	0x00030004160b0d17, 0x020704000b160e17, 0x0403040029160e17, 0x06000e020a10221a, 0x03070d010410051e, 0x03000d070d10051e,
+	0x060415062a150b01, 0x0206051513240b01, 0x01280d051b001801, 0x030608062b131d01, 0x061115012a032101, 0x010e18011a000506,
+	0x01280d041f000506, 0x0110000a14100506, 0x0801050a0b150506, 0x0107051800050f06, 0x0100110525050f06, 0x010011051b090f06,
+	0x0100111f190b0f06, 0x0c011f06101f0507, 0x080c05011f002107, 0x000c1f041d100209, 0x0801051e030b0909, 0x0006040519091809,
+	0x0102011e1507030a, 0x01280d051b00080f, 0x0304000a0910220f, 0x0300050d0910220f, 0x080600021f10220f, 0x0306000e1f10220f,
+	0x03041422090e0010, 0x04060315221b0010, 0x040603151b070110, 0x02001b070d120510, 0x0008280d19120510, 0x040615001b140510,
+	0x02000d1a07180510, 0x040600151b180510, 0x06011501191c0510, 0x001f0d2104100213, 0x0310040a01060b15, 0x01041f0615060b15,
+	0x0304001224060b15, 0x0110000103062115, 0x01111f0103062115, 0x00010804280d0117, 0x020701030a160117, 0x0106040c28000518,
+	0x0806011c28000518, 0x00030614190b0f18, 0x0500021a0b09081a, 0x000025031a0b081a, 0x0306060e0010221a, 0x06000e040a10221a,
+	0x070601000e10221a, 0x06000e050e10221a, 0x080600021510221a, 0x0306000e1510221a, 0x0206051517240b01, 0x080e0905061d1d01,
+	0x000605150d1d1d01, 0x0517000e14100506, 0x000a0b120e110506, 0x050900061e190507, 0x00000d1c17230507, 0x08010519030b0c07,
+	0x0002011c07231007, 0x0a280d0017031607, 0x0801190624031607, 0x0100110b27102007, 0x0801051b030b0909, 0x020d04061906000a,
+	0x051604061906000a, 0x01001e0f22040e0a, 0x000a012706150e0a, 0x020005010b12110a, 0x01001e0f220e050d, 0x000205281310070d,
+	0x01071e031901220d, 0x0a061e010e120510, 0x01001e0f26020b13, 0x01001808041b0b13, 0x020d040606000e15, 0x0516040606000e15,
+	0x02000d0203062115, 0x0500160203062115, 0x0500041a0b09081a, 0x030600150410221a, 0x0600130b0510221a, 0x010600150910221a,
+	0x060002130f10221a, 0x0a030f0003050f1e, 0x15061506070e0201, 0x06021115061d1d01, 0x05020816061d1d01, 0x010615022c032101,
+	0x011518011c000506, 0x010518090b150506, 0x0105001805050f06, 0x0001120525050f06, 0x000112051b090f06, 0x03041b0111190007,
+	0x00011b060a190507, 0x050f00061e190507, 0x0004011c07231007, 0x0200181010102407, 0x0106010519091809, 0x0c0100240b04110a,
+	0x0d060027100f040d, 0x0c0100240b11050d, 0x0216001a0303100e, 0x021600070220100e, 0x00030501100b1e0f, 0x0304141b090a0010,
+	0x0304062408160010, 0x04031e0119120510, 0x130600050e102410, 0x01001f160b050211, 0x000900201e100213, 0x00030501160b0d17,
+	0x02160007020b1017, 0x0b06011c28000518, 0x0000130e1e100518, 0x000900141e100518, 0x060004130f10221a, 0x021607050e0b0201,
+	0x121f07050e0b0201, 0x02160701200b0201, 0x121f0701200b0201, 0x15061f15060e0201, 0x000a221a04100201, 0x020d000a16100201,
+	0x0516000a16100201, 0x001f160d16100201, 0x0011280d16100201, 0x0100112c16100e01, 0x010615022c0c1d01, 0x0106150d2c0e1d01,
+	0x06041115061d1d01, 0x05040816061d1d01, 0x040605150a1d1d01, 0x080c1c0124000506, 0x00041f120e110506, 0x0001121f190b0f06,
+	0x00011023190b0f06, 0x03041b0115190007, 0x0015100616190507, 0x00001b0b10230507, 0x0016120115230507, 0x0000120415230507,
+	0x00040a1c17230507, 0x11011e0a1308040d, 0x06170f051d03000e, 0x030617052514000e, 0x0201160700200c0e, 0x01121f0700200c0e,
+	0x01010809100b1e0f, 0x0301000d0910220f, 0x0006010e1f10220f, 0x030601161e160010, 0x0101160908190010, 0x0806010923190010,
+	0x080601091e1b0010, 0x0106010e1b1d0010, 0x0015061a07160510, 0x0000240404101e10, 0x0200000d16100211, 0x0009012b0e061d15,
+	0x02011607000b0c17, 0x01121f07000b0c17, 0x01010809160b0d17, 0x0106120028050f18, 0x010610002a050f18, 0x010314002a050f18,
+	0x01000614190b0f18, 0x020114021800081a, 0x010125021800081a, 0x0501011a0b09081a, 0x0001111a0b09081a, 0x0b0616010001221a,
+	0x000b06040001221a, 0x001613010801221a, 0x000013040801221a, 0x0b06010b0010221a, 0x000c09040110221a, 0x030601180110221a,
+	0x0001130b0810221a, 0x000601150910221a, 0x06010e010a10221a, 0x0d0601000e10221a, 0x0c0101090f10221a, 0x060101130f10221a,
+	0x080601011210221a, 0x000109041210221a, 0x0006010e1510221a, 0x020614150b090201, 0x0310110d04100201, 0x020c220d04100201,
+	0x0214280d04100201, 0x040605150d1d1d01, 0x060615022c032101, 0x02280d0416000506, 0x00020b042c0b0506, 0x0200280d04110506,
+	0x0203280d16190007, 0x00040d1c17230507, 0x03041414010b030a, 0x020a0517010b030a, 0x04140e20010b030a, 0x031004170401100a,
+	0x020401240404110a, 0x020b06042a00040d, 0x11011e0d1308040d, 0x020401240411050d, 0x020615041d03000e, 0x0302000d0910220f,
+	0x0006020e1f10220f, 0x0102160908190010, 0x0806020923190010, 0x080602091e1b0010, 0x0310040216000610, 0x0009022b0e061d15,
+	0x01140e0d0b030518, 0x0b06020b0010221a, 0x030602180110221a, 0x0002130b0810221a, 0x000602150910221a, 0x06020e010a10221a,
+	0x0d0602000e10221a, 0x0c0102090f10221a, 0x060201130f10221a, 0x080602011210221a, 0x0006020e1510221a, 0x0214000e1e100201,
+	0x0202050619240b01, 0x0004020d2b131d01, 0x020114040f000506, 0x0216000e14100506, 0x0802021b01070f06, 0x00021b0615190007,
+	0x0012050413230007, 0x0204001c17230507, 0x0201140406000209, 0x0200140319060b0a, 0x020205061b01100a, 0x020014170404100a,
+	0x020a05060e01110a, 0x0214000f1500040d, 0x02000a281e00040d, 0x02140009100f040d, 0x020014170410050d, 0x080205010b12070d,
+	0x0200140b04100211, 0x0214000f03010b11, 0x0200140312070b11, 0x0200140304100e11, 0x0201140d01060b15, 0x0200141604060b15,
+	0x0a02210012060b15, 0x02001403060b0e15, 0x000206060010221a, 0x0c0200090f10221a, 0x1706020a16100201, 0x0107020a16100201,
+	0x010a120619240b01, 0x01270d051b001801, 0x0200091b2a071801, 0x060208090e101d01, 0x0004040d2b131d01, 0x01270d041f000506,
+	0x010021090d100506, 0x0100120914100506, 0x0805000d0b150506, 0x0100120525050f06, 0x0804021b01070f06, 0x010012051b090f06,
+	0x0100121f190b0f06, 0x01010021190b0f06, 0x01001023190b0f06, 0x0105210905190007, 0x00041b0615190007, 0x0800230d18100507,
+	0x000c0d27121d0507, 0x0101011c07231007, 0x0109000619072407, 0x020b17050804000a, 0x010906270615000a, 0x020703021815000a,
+	0x06040f06191e000a, 0x1706180505010b0a, 0x0107180505010b0a, 0x0207000218150e0a, 0x010a12061b01100a, 0x010000211e12100a,
+	0x01020f060e01110a, 0x010700060c12110a, 0x020b17050800040d, 0x020013172200040d, 0x020013170701040d, 0x020a17050109040d,
+	0x020000170810040d, 0x020017010b10040d, 0x020717002116040d, 0x020b17050800050d, 0x020017031c0b070d, 0x080405010b12070d,
+	0x0100000f22200c0e, 0x01000a0023200c0e, 0x020017180403100e, 0x0200121a0403100e, 0x01270d051b00080f, 0x0100000f0e0a1e0f,
+	0x010300061a0a1e0f, 0x00020809100b1e0f, 0x0200090f22190010, 0x02000a0923190010, 0x02000a091e1b0010, 0x0a0f25000e030510,
+	0x0008270d19120510, 0x0a030500090a1a10, 0x01001d0104102110, 0x0207001a03100211, 0x02000b2004100213, 0x1706002006100213,
+	0x0107002006100213, 0x0a04210012060b15, 0x06040106151e0b15, 0x06040f061e000e15, 0x0109002b0e061d15, 0x06110101031e2115,
+	0x00060f02031e2115, 0x0100000f220b0c17, 0x01000a00230b0c17, 0x00020809160b0d17, 0x01000d06010f1017, 0x0706010d011e1017,
+	0x02000b1404100518, 0x1706001406100518, 0x0107001406100518, 0x0100111a0b09081a, 0x0106040c0101221a, 0x0806011c0101221a,
+	0x0006011c1601221a, 0x000406060010221a, 0x0109000f0010221a, 0x0100130b0810221a, 0x0c0400090f10221a, 0x0514000e1e100201,
+	0x0502050619240b01, 0x0400091b2a071801, 0x050616062b021d01, 0x060408090e101d01, 0x050608062b131d01, 0x0516000e14100506,
+	0x0504001c17230507, 0x050205061b01100a, 0x050a05060e01110a, 0x05000a281e00040d, 0x000605171d030b0e, 0x00040809100b1e0f,
+	0x0506000e1f10220f, 0x0400090f22190010, 0x04000a0923190010, 0x04000a091e1b0010, 0x02060511181d0010, 0x0a0601011d190b11,
+	0x00040809160b0d17, 0x0d06011c28000518, 0x00050614190b0f18, 0x0506060e0010221a, 0x0506000e1510221a, 0x050022160b050201,
+	0x14061506070e0201, 0x0513000e1e100201, 0x0515000f2b020b01, 0x01061a1504240b01, 0x1206011516240b01, 0x01091911061d1d01,
+	0x06021415061d1d01, 0x06011b090e110506, 0x0102221800050f06, 0x001112011c050f06, 0x0012011023050f06, 0x010b160510230007,
+	0x0c012106101f0507, 0x000c21041d100209, 0x00001d0f22040e0a, 0x0100220f22040e0a, 0x0012010f031c100a, 0x110c1c091c00040d,
+	0x0f1000232200040d, 0x0c141c092d00040d, 0x0f1000230701040d, 0x110c1c001308040d, 0x00001d0f220e050d, 0x0100220f220e050d,
+	0x00071d031901220d, 0x010722031901220d, 0x00031a031c250b0e, 0x010016041c25100e, 0x0100090f191a0510, 0x0114011500130810,
+	0x0020011505130810, 0x011201001e190910, 0x0114000f000a0a10, 0x0000200f050a0a10, 0x0f04230607000b10, 0x0100030919102410,
+	0x00210d2104100213, 0x00001d0f26020b13, 0x0100220f26020b13, 0x1102180003180b13, 0x0104210615060b15, 0x0111210103062115,
+	0x000f100228060117, 0x00010c0428060117, 0x1101090107160e17, 0x0106011a0b090518, 0x1106100003050f18, 0x1103140003050f18,
+	0x00110e011a0e081a, 0x01010d040801221a, 0x010604010e01221a, 0x020600150910221a, 0x000003130a10221a, 0x1006011516240b01,
+	0x0f0618062b021d01, 0x010718062b021d01, 0x061515012c032101, 0x070615022c032101, 0x01241a011c000506, 0x020d000a14100506,
+	0x0516000a14100506, 0x001f160d14100506, 0x0011280d14100506, 0x021401010a110506, 0x0010011023050f06, 0x0002120525050f06,
+	0x000212051b090f06, 0x0221040111190007, 0x0203010107191007, 0x0206010519091809, 0x0010010f031c100a, 0x10011e0a1308040d,
+	0x0c0105261b09040d, 0x060013211020040d, 0x060013211024040d, 0x0602011d1603100e, 0x06000f1d1703100e, 0x030600172514100e,
+	0x130600140220100e, 0x02171a0105070010, 0x0201171a11070010, 0x02142104090a0010, 0x02142109050d0010, 0x0023190107060410,
+	0x020918010d180510, 0x02001b060d180510, 0x010a1b011e000610, 0x011001001e190910, 0x0209001a03100211, 0x030a010124032113,
+	0x020d000103062115, 0x0516000103062115, 0x0204010106160c17, 0x13060014020b1017, 0x0214011c07000518, 0x0125011c07000518,
+	0x1306011c15000518, 0x0806011c28000518, 0x0c011f010910081a, 0x01011f120910081a, 0x011a011c0700051e, 0x080c1c0603070201,
+	0x01060c1803100201, 0x0103111804100201, 0x0103101904100201, 0x0806061b17100201, 0x050c060619021d01, 0x0517060719021d01,
+	0x020615022c0c1d01, 0x0206150d2c0e1d01, 0x16280d0616000506, 0x021901060d070506, 0x08011b060d070506, 0x00160e051b0b0506,
+	0x00160b062c0b0506, 0x0016060e14100506, 0x0002121f190b0f06, 0x00021023190b0f06, 0x03041b060f190007, 0x080c06011e1f0507,
+	0x0c06160505010b0a, 0x0b0616062a00040d, 0x061615061d03000e, 0x0202160700200c0e, 0x02121f0700200c0e, 0x02010809100b1e0f,
+	0x0318010504280b13, 0x02021607000b0c17, 0x02121f07000b0c17, 0x02010809160b0d17, 0x0006061c280e0518, 0x0206120028050f18,
+	0x020610002a050f18, 0x020314002a050f18, 0x02000614190b0f18, 0x020214021800081a, 0x010225021800081a, 0x0502011a0b09081a,
+	0x0002111a0b09081a, 0x03010f061007051e, 0x080609071c0b0201, 0x01090c1803100201, 0x0503130e04100201, 0x050e170e04100201,
+	0x0806091b17100201, 0x080e05071c010901, 0x15061f1501130b01, 0x1506150116140b01, 0x0106150a17250b01, 0x0806090712011d01,
+	0x010903190e0d1d01, 0x000605162b0e1d01, 0x0804090700101d01, 0x080409090e101d01, 0x00120f07011d1d01, 0x09060e15011d1d01,
+	0x000e05000e1d1d01, 0x0d0615070d032101, 0x000e220019032101, 0x03040e0219032101, 0x040615022c032101, 0x010903190e102101,
+	0x050315040f000506, 0x051516070f000506, 0x0018120714070506, 0x0016090e14100506, 0x05011b090e110506, 0x030d000d0e110506,
+	0x00010e190e110506, 0x0118180a050e0007, 0x00011b0319190507, 0x0001031b19071107, 0x00030b0410012007, 0x00160b0710012007,
+	0x0503150406000209, 0x0515160706000209, 0x0d06040700191d09, 0x150600040e191d09, 0x030c1c040804000a, 0x0c161c070804000a,
+	0x050905060e01110a, 0x01031f010e12110a, 0x020108180e12110a, 0x030601190e12110a, 0x030c1c040800040d, 0x0c161c070800040d,
+	0x00031d041609040d, 0x030122041609040d, 0x00161d071609040d, 0x011622071609040d, 0x0c0107201b09040d, 0x030c1c040800050d,
+	0x0c161c070800050d, 0x010314041400070d, 0x011416071400070d, 0x030420001a0c070d, 0x000617030321280d, 0x00030c2407120510,
+	0x010314040b000610, 0x011416070b000610, 0x0015000d04061a10, 0x090601011d190b11, 0x00121b0025000213, 0x0804090707160017,
+	0x0009170328060117, 0x000304060a0f0117, 0x001607060a0f0117, 0x0115110001160717, 0x030301030f160b17, 0x0204000e06160c17,
+	0x080c000701030518, 0x0801170701030518, 0x0306011a04050518, 0x0003131a0e050518, 0x0601100710070518, 0x0301140710070518,
+	0x0006100d0e110518, 0x0003140d0e110518, 0x0614000e1e100201, 0x0602050619240b01, 0x000407051a091801, 0x04081907061d1d01,
+	0x00001e051b0b0506, 0x010d000a14100506, 0x0616000e14100506, 0x0006001e14100506, 0x0a120c011b100506, 0x011401010a110506,
+	0x020f0c010e110506, 0x000e1b0504190007, 0x00151e0504190007, 0x0121040111190007, 0x081e0111021d0007, 0x00151e16021d0007,
+	0x0604001c17230507, 0x0802001e03070c07, 0x0103010107191007, 0x010c01050d191007, 0x060205061b01100a, 0x020105071b12100a,
+	0x0804001a031c100a, 0x0701011a031c100a, 0x060a05060e01110a, 0x0a0105070e12110a, 0x110e1e091c00040d, 0x06000a281e00040d,
+	0x0e141e092d00040d, 0x110e1e001308040d, 0x0101071d0e10220f, 0x01171a0105070010, 0x0101171a11070010, 0x001f210f05090010,
+	0x0a0f070125090010, 0x01142104090a0010, 0x01142109050d0010, 0x071f210009100510, 0x0f0301061b140510, 0x010918010d180510,
+	0x01001b060d180510, 0x080526011a000610, 0x0109001a03100211, 0x00010d1a03100211, 0x0001251a04100211, 0x010d000103062115,
+	0x0104010106160c17, 0x0114011c07000518, 0x0407271803100201, 0x020a120619240b01, 0x000c181a0b090506, 0x0200120525050f06,
+	0x020012051b090f06, 0x0200121f190b0f06, 0x02010021190b0f06, 0x02001023190b0f06, 0x00101b0504190007, 0x001f180b100e0507,
+	0x08050018030b0c07, 0x0201011c07231007, 0x1827180101031607, 0x0800180624031607, 0x0209000619072407, 0x020906270615000a,
+	0x020a12061b01100a, 0x020000211e12100a, 0x02020f060e01110a, 0x020700060c12110a, 0x11101e091c00040d, 0x10141e092d00040d,
+	0x11101e001308040d, 0x0200000f22200c0e, 0x02000a0023200c0e, 0x0200000f0e0a1e0f, 0x020300061a0a1e0f, 0x000820250e120510,
+	0x02001d0104102110, 0x0209002b0e061d15, 0x0200000f220b0c17, 0x02000a00230b0c17, 0x02000d06010f1017, 0x0200111a0b09081a,
+	0x0209000f0010221a, 0x0200130b0810221a, 0x0414000e1e100201, 0x0402050619240b01, 0x09011b061c0e0506, 0x0000241a0d100506,
+	0x170c000a14100506, 0x0416000e14100506, 0x0a12010d1b100506, 0x020f010d0e110506, 0x0113041900050f06, 0x0c01160d1e100007,
+	0x0005241a05190007, 0x15040d0615190007, 0x00051a051a280007, 0x01030d041d280007, 0x00090d27121d0507, 0x0404001c17230507,
+	0x01010d050d191007, 0x01030d0428001e07, 0x040b17050804000a, 0x040703021815000a, 0x040b0605161c000a, 0x120702031a1c000a,
+	0x0407000218150e0a, 0x120702001a1c0e0a, 0x040205061b01100a, 0x020105081b12100a, 0x040a05060e01110a, 0x080100240b04110a,
+	0x0a0105080e12110a, 0x010206180407170a, 0x040b17050800040d, 0x04000a281e00040d, 0x040013172200040d, 0x0b070b052a00040d,
+	0x040013170701040d, 0x010b071f0b01040d, 0x040a17050109040d, 0x090106291909040d, 0x0b0105261b09040d, 0x040000170810040d,
+	0x040017010b10040d, 0x000b07240b11040d, 0x120100170715040d, 0x011807050915040d, 0x000b071c0b15040d, 0x040717002116040d,
+	0x011807050b26040d, 0x040b17050800050d, 0x080100240b11050d, 0x010206180717050d, 0x00041a050918060d, 0x040017031c0b070d,
+	0x040017180403100e, 0x0400121a0403100e, 0x1201060d0010220f, 0x01060d1d0110220f, 0x00060d1b0410220f, 0x00060d1f0410220f,
+	0x1304000a0910220f, 0x1300050d0910220f, 0x0101081d0e10220f, 0x000700021f10220f, 0x13041422090e0010, 0x0022060d19120510,
+	0x09010608161e0510, 0x0012021a0b090610, 0x0000250605102010, 0x04060d0615002110, 0x1201001607060211, 0x0407001a03100211,
+	0x04010606161d1d11, 0x000b07200b090213, 0x04000b2004100213, 0x04041a0026001d13, 0x0118070626021d13, 0x1013040a01060b15,
+	0x0216040a01060b15, 0x1304001224060b15, 0x0501062702061d15, 0x170c000103062115, 0x0c000701031e2115, 0x000b07140b090518,
+	0x000b2502080b0518, 0x000b0702290b0518, 0x0007250104100518, 0x04000b1404100518, 0x000025070d100518, 0x030400121a10081a,
+	0x0b0711010001221a, 0x011118010801221a, 0x000b07021101221a, 0x000c09040110221a, 0x0a0109040f10221a, 0x01000e040f10221a,
+	0x010113070f10221a, 0x070101080f10221a, 0x090400090f10221a, 0x000109041210221a, 0x0400060e1210221a, 0x000700021510221a,
+	0x0b060d051c00051e, 0x000b1a02080b051e, 0x00071a010410051e, 0x00001a070d10051e, 0x0806020924070200, 0x03050d1b060b0200,
+	0x01191a01051e0900, 0x001f0d0f051d1600, 0x0304010317261600, 0x0015100509190905, 0x080c01011e1f0905, 0x0001140210230905,
+	0x0004031c17230905, 0x0512000019070c05, 0x00061a06251f1605, 0x000a001a150b0208, 0x020416070615000e, 0x12041f070615000e,
+	0x030405001a0b030e, 0x0005021d1a0b030e, 0x040501201a0b030e, 0x010502221a0b030e, 0x01041f06081a0b0e, 0x00012805091a0b0e,
+	0x0203050f1b01100e, 0x050209181b01100e, 0x020305011b12100e, 0x021201010315100e, 0x000003211e16100e, 0x0e00001e0323100e,
+	0x0100001a0328100e, 0x0a03050f0e01110e, 0x060208180e01110e, 0x0a0305010e12110e, 0x000703060c16110e, 0x000600151e0b0210,
+	0x01000c1803100411, 0x0806001b17100411, 0x0014000e1e100411, 0x0100091b2a070511, 0x020305011b100a11, 0x0a0305010e110a11,
+	0x0a0305010e101011, 0x0004082026120b12, 0x00030f0503090a16, 0x0110011c07020019, 0x011306021c020019, 0x0106040c26020019,
+	0x0806011c26020019, 0x0204170027020019, 0x04060515031c0019, 0x02000017020b0319, 0x0005020b150b0319, 0x04060515001c0e19,
+	0x00000d060d021019, 0x00000c061b021019, 0x08040009031c1019, 0x07010109031c1019, 0x0004200604021119, 0x000415060e021119,
+	0x0600060d0e021119, 0x000403031709181d, 0x020b03050d100900, 0x020700041e181607, 0x00011f19090b0208, 0x001505041a091608,
+	0x000419062a091608, 0x000205061b10110d, 0x000a05060e11110d, 0x000a12061b02100e, 0x00020f060e02110e, 0x01000c1803100413,
+	0x0806001b17100413, 0x0014000e1e100413, 0x0100091b2a070513, 0x020305011b100a13, 0x0a0305010e110a13, 0x0a0305010e101013,
+	0x02000d0d03061017, 0x0500160d03061017, 0x00010c2103061017, 0x000c090a031e1017, 0x03060010031e1017, 0x0110011c07040019,
+	0x011306021c040019, 0x0106040c26040019, 0x0806011c26040019, 0x0204170027040019, 0x02071a0302090019, 0x02000017040b0319,
+	0x02071a0002090e19, 0x00000d060d041019, 0x00000c061b041019, 0x0004200604041119, 0x000415060e041119, 0x0600060d0e041119,
+	0x0200231909070200, 0x020216070e070501, 0x12021f070e070501, 0x020d000a1b070501, 0x0516000a1b070501, 0x001f160d1b070501,
+	0x0011280d1b070501, 0x03050d061a0b0501, 0x02041607060c1001, 0x12041f07060c1001, 0x020021041c0e1001, 0x0207001d0d1d1605,
+	0x000928061a010207, 0x000c001c1a0b0207, 0x0000151d1a0b0207, 0x0001091f1a0b0207, 0x000115221a0b0207, 0x00040328221a1607,
+	0x000904062a1a1607, 0x000a12061b04100e, 0x00020f060e04110e, 0x0200001b0d070511, 0x0003051a0d090511, 0x0001050716090511,
+	0x0003001a1a0b0214, 0x020003060d150b19, 0x0007160304091019, 0x0603060e0e011119, 0x0118010303151600, 0x0a062215010e0a01,
+	0x02011b0404100a01, 0x0107031804100a01, 0x0307042212060b01, 0x0200180f22160c01, 0x02000a1823160c01, 0x1506150504160f01,
+	0x01061c152c0e1001, 0x0100160908161e04, 0x0100090f22161e04, 0x0806000923161e04, 0x01000a0923161e04, 0x00061522040d2104,
+	0x040301030d182104, 0x0403010f0e182104, 0x0101001809101106, 0x01001d001e151608, 0x0400200f2216010d, 0x04000a202316010d,
+	0x020416070613000e, 0x12041f070613000e, 0x021201010313100e, 0x0100081e12220b11, 0x0106001c1a100a13, 0x000208180b091c13,
+	0x000306190b091c13, 0x0102210b06070515, 0x000a0c0306090515, 0x00050c0506090515, 0x0009051b060b0515, 0x020105210e061015,
+	0x0d0600050e1e1015, 0x0211160701030017, 0x12111f0701030017, 0x0200160704030517, 0x00121f0704030517, 0x07031801030b0917,
+	0x00061115030b0917, 0x05000816030b0917, 0x0209190106030e17, 0x0201160706030e17, 0x12011f0706030e17, 0x0801091b06030e17,
+	0x0d00280d03031017, 0x00000d1203031017, 0x02000d0a04031017, 0x0500160a04031017, 0x001f160d04031017, 0x0011280d04031017,
+	0x0007160e04031017, 0x0000251204031017, 0x030600141a031017, 0x0009000f24040e19, 0x0207000403121019, 0x080c00011e09021a,
+	0x080117011e09021a, 0x01000d0f2216021a, 0x01000a0d2316021a, 0x02121a0103071600, 0x0304010322161600, 0x0209190106201605,
+	0x0201160706201605, 0x12011f0706201605, 0x0801091b06201605, 0x00042006271a1607, 0x010106231e151608, 0x0009022b06070515,
+	0x00030602161c0b19, 0x0100061c150b0a1a, 0x00041f010616181d, 0x00011f060616181d, 0x020b160705030b01, 0x120b1f0705030b01,
+	0x01020818041d1001, 0x01030619041d1001, 0x06041115061d1001, 0x05040816061d1001, 0x00030602161c0e19, 0x0101181315090900,
+	0x020614150f050401, 0x10080619190b0401, 0x05000d1623000501, 0x0a15071a29030501, 0x050403162c060801, 0x050205161b090c01,
+	0x020216181b090c01, 0x020718171b160c01, 0x0215071826160c01, 0x01061c152c0c1001, 0x0106152c090d1001, 0x020a0904060c2101,
+	0x02000e04060c2101, 0x02001204011b2101, 0x0e001f05011b2101, 0x010216091b091e04, 0x010709171b161e04, 0x0115070926161e04,
+	0x020a0901060d2104, 0x02000e01060d2104, 0x0500190001242104, 0x0806020900062904, 0x0602150b01062904, 0x0102180909062904,
+	0x00020b0619062904, 0x0800160d1a200905, 0x0200190d0d210905, 0x020016070a201605, 0x12001f070a201605, 0x0806000925201605,
+	0x01000a0925201605, 0x0403001a1d251605, 0x03050417001a1607, 0x00011d17051a1607, 0x02010521101a1607, 0x050f152801030208,
+	0x01000a231e151608, 0x0515000210092809, 0x0304001110092809, 0x010c011c10092809, 0x020205171b09010d, 0x040216201b09010d,
+	0x040720171b16010d, 0x041507202616010d, 0x020205172a00070d, 0x040216202a00070d, 0x04000a202200110d, 0x010006240911110d,
+	0x020105211009160d, 0x020021041c13000e, 0x01000a1b1e15000e, 0x00000a1b04240b0e, 0x0002051906240b0e, 0x0f00021826000a0f,
+	0x010100180909180f, 0x0010002619010210, 0x0006191d1e030210, 0x0201050d1b190910, 0x001209251a000411, 0x00030611161d1011,
+	0x0304001606092c11, 0x1204000924001c13, 0x02001d0116010214, 0x020105091b160914, 0x0004072718000515, 0x000c0d1e1e000515,
+	0x0009022b06080515, 0x020105210c061015, 0x0d0600050c1e1015, 0x0201052112000a16, 0x02000f181c000a16, 0x020016070e030b17,
+	0x12001f070e030b17, 0x0200100101031117, 0x0102162102000a18, 0x0801022202000a18, 0x080c002302000a18, 0x080c000602090a18,
+	0x10000a0c22040019, 0x01000a1622090019, 0x0703011a22090019, 0x030216050d1c0019, 0x0603060a161c0019, 0x08060113161c0019,
+	0x00000a280a040b19, 0x0c01002401041119, 0x0102160d1b09021a, 0x01070d171b16021a, 0x0115070d2616021a, 0x0007040610031b1d,
+	0x02000f1818000a1e, 0x070d060d150b0200, 0x080c0301191e0900, 0x03041424090a1600, 0x0306011517171600, 0x000616051a090501,
+	0x030424011c040801, 0x020605101b100a01, 0x020305141b100a01, 0x0a0605100e110a01, 0x0a0305140e110a01, 0x020d001e0f030b01,
+	0x0516001e0f030b01, 0x0306052b12220b01, 0x0c0601161e160c01, 0x0a0605100e101001, 0x0a0305140e101001, 0x080c03011e092001,
+	0x000a092518180b04, 0x000c092718180b04, 0x0115070d04242104, 0x080c01011e1c0905, 0x080c00011e200905, 0x080117011e200905,
+	0x00061a06251c1605, 0x01000d0f22201605, 0x01000a0d23201605, 0x030424011c001106, 0x0201050d1b101106, 0x0a01050d0e111106,
+	0x020605011b13100e, 0x0a0605010e13110e, 0x0010001802100b12, 0x000604230b091c13, 0x000603010b151c13, 0x0406030107171c13,
+	0x0c0104061c000a16, 0x0009061a030b0917, 0x00060d010d031017, 0x080600240d031017, 0x00060c011b031017, 0x0501090d1b031017,
+	0x000c090a031d1017, 0x03060010031d1017, 0x0406200104031117, 0x040615010e031117, 0x0601080d0e031117, 0x0c01040618000a1e,
+	0x0304011c0700111e, 0x0004200e0410111e, 0x080600041710111e, 0x0400200f220e1600, 0x04000a20230e1600, 0x000a0d1a03100401,
+	0x000a251a04100401, 0x0c000d1b2a070501, 0x01011a1c0f0b0901, 0x0203050f1b100a01, 0x050209181b100a01, 0x0a03050f0e110a01,
+	0x060208180e110a01, 0x0a03050f0e101001, 0x060208180e101001, 0x0504160000062904, 0x0001140210250905, 0x0004031c17250905,
+	0x0006130519090509, 0x0100231e0412100e, 0x000205061b12100e, 0x000003211e13100e, 0x0e00001e0325100e, 0x000a05060e12110e,
+	0x000703060c13110e, 0x0000030f0e0a1b0f, 0x000303061a0a1b0f, 0x0009002319070210, 0x0100231e04100a11, 0x000205061b100a11,
+	0x000a05060e110a11, 0x0100081e12240b11, 0x000a05060e101011, 0x0010001804100b12, 0x02000817030b0f18, 0x050006021b091019,
+	0x000509021b091019, 0x000608020e091119, 0x080101161e09021a, 0x020f052311071600, 0x15061505040a1600, 0x01001b091e100401,
+	0x0102160909070501, 0x0115070904242104, 0x0015050f09190905, 0x0006021d19070c05, 0x020716001a0c1605, 0x12071f001a0c1605,
+	0x0100160908201605, 0x0100090f22201605, 0x0806000923201605, 0x01000a0923201605, 0x0207001d0d211605, 0x020105091b101106,
+	0x0a0105090e111106, 0x000a0c01251a1607, 0x0006100519090509, 0x0003140519090509, 0x0c0601161e16010d, 0x0a0112210310070d,
+	0x0100060d190a1b0d, 0x020305011b13100e, 0x0100231e0416100e, 0x000205061b16100e, 0x0a0305010e13110e, 0x000a05060e16110e,
+	0x0100180115030910, 0x020716001a030b11, 0x12071f001a030b11, 0x0f00022307180b12, 0x001f0d1d04100413, 0x000303010b151c13,
+	0x0403030107171c13, 0x0517000118000515, 0x0016150118000515, 0x0007160218000515, 0x00050b06180b0515, 0x00000f06180b0515,
+	0x020004010d031017, 0x00030d010d031017, 0x0306001c0d031017, 0x00030c011b031017, 0x050109091b031017, 0x03060023030f1017,
+	0x0403200104031117, 0x040315010e031117, 0x060108090e031117, 0x0009000f22040e19, 0x020d000008041019, 0x0516000008041019,
+	0x0501092108041019, 0x0007160504091019, 0x050100071a091019, 0x050006041b091019, 0x000509041b091019, 0x040006091b121019,
+	0x000608040e091119, 0x0002180e0410111e, 0x03041424090e1600, 0x0118010305151600, 0x0207140409191600, 0x0806021b16100401,
+	0x010021091e100401, 0x000e1a0619000501, 0x0c000d1b28070501, 0x0602150e2c070501, 0x0a00091b2c070501, 0x060415062c0c1001,
+	0x020603150a1d1001, 0x0207140409162001, 0x0903010610012904, 0x00011a0610140905, 0x00042006251a1607, 0x000306041b282109,
+	0x0c01040610092809, 0x020017050905060d, 0x1101121e0310070d, 0x0101191e0310070d, 0x0c01001b0705280d, 0x020009180328100e,
+	0x020003010b13110e, 0x05000927030d1017, 0x03061101161c0019, 0x00030616041c0519, 0x130602061c010e19, 0x03060106161c0e19,
+	0x080602091b070200, 0x02121a0105071600, 0x0212011a11071600, 0x0200030f1b0d1600, 0x030601151e161600, 0x050c010619080501,
+	0x0517010719080501, 0x01000f231e010e0e, 0x00030301100b1b0f, 0x0c06011600180b12, 0x0106001c1b100a13, 0x000c0a051e000515,
+	0x030600141b031017, 0x0003250104031117, 0x02000317010b0319, 0x0009000f2c16021a, 0x03070408160b0c00, 0x0304062608161600,
+	0x020614150e050401, 0x021607060e0b0401, 0x121f07060e0b0401, 0x021607011d0b0401, 0x121f07011d0b0401, 0x01020c1803100401,
+	0x0806021b17100401, 0x150a09061b000501, 0x000c1c061b000501, 0x0c170d0628000501, 0x0a1709062c000501, 0x00061715120b0501,
+	0x000b061b1f0b0501, 0x0a0f10010f0a0801, 0x0f041509110b0901, 0x0a15071a0b020c01, 0x0a0b06012b131001, 0x0a061015011d1001,
+	0x07031801200b0c05, 0x00061115200b0c05, 0x05000816200b0c05, 0x0318010626201605, 0x00001714180b0207, 0x030704011a0b0c07,
+	0x03040626011a1607, 0x0906010619090509, 0x0c15071c0b02010d, 0x0c0117060005280d, 0x0110001e0d01100e, 0x000208181b0b0a0f,
+	0x000306191b0b0a0f, 0x000208180b0c180f, 0x000306190b0c180f, 0x00060423190b0c10, 0x00041909190b0912, 0x011507091b0b0513,
+	0x011507090b022213, 0x0007270118000515, 0x000c00061e000515, 0x0009060306090a16, 0x0200011609031017, 0x02000d010d031017,
+	0x00090023030f1017, 0x00150713030b0f18, 0x00061916030b0f18, 0x0115070d0b021218, 0x0204170022040019, 0x0c06160105010b19,
+	0x0c01002308041019, 0x0009061a0b0c021a, 0x02011b060d070200, 0x01050c1803100401, 0x0806051b17100401, 0x02001b071e100401,
+	0x00040c171e100401, 0x0c15070d29070501, 0x000e15051b070801, 0x0a0f10020f0a0801, 0x000e15052a070901, 0x0201040616100a01,
+	0x0106152c0b0d1001, 0x0a061e15040e1001, 0x0a0b06022b131001, 0x0a061015021d1001, 0x0003130110072904, 0x00060f1d19070c05,
+	0x0101091f1e101106, 0x0504201601070207, 0x0500190c23070207, 0x0204201701070208, 0x000f102301070208, 0x050019280d070208,
+	0x0106012119070509, 0x0500190607022809, 0x0100061b07022809, 0x020017220705060d, 0x02000d1b0310070d, 0x0500161b0310070d,
+	0x01011e081e10110d, 0x010006240b11110d, 0x000619260702160d, 0x0103011f1e13100e, 0x00011f061e16100e, 0x020008180328100e,
+	0x0406200119070210, 0x00030616070c2c11, 0x000401201e100413, 0x020016070a070513, 0x00121f070a070513, 0x0403200116070214,
+	0x0200040616070c14, 0x0001210306070a16, 0x05000827030d1017, 0x0106010e1e101118, 0x05010c061e011019, 0x0106130e1e011019,
+	0x000401171e041019, 0x050101071e091019, 0x000111071e091019, 0x0100060f1e121019, 0x0106010e1e131019, 0x050002061b070a1d,
+	0x0500190607020d1d, 0x05000206070c181d, 0x0e041f0616080900, 0x05001c051b000501, 0x0a0312021b100a01, 0x020011020b110a01,
+	0x02030f020e110a01, 0x03021602182c0b01, 0x020011020b101001, 0x02030f020e101001, 0x02070203060f2101, 0x00032502041b2101,
+	0x0003021b042c2101, 0x0500061c18180b04, 0x0005091c18180b04, 0x0001140d1a0b0207, 0x050000221a0b0207, 0x0016021606100409,
+	0x0000231907021509, 0x000705041c162809, 0x000a05091c162809, 0x0002020610072909, 0x0016021f0310070d, 0x000021021e10110d,
+	0x000706020c11110d, 0x0100231d0412100e, 0x020000020b13110e, 0x00030002100b1b0f, 0x0014000b1e100411, 0x0100231d04100a11,
+	0x0100081d12240b11, 0x0003021f0b091c13, 0x050000051e000515, 0x00090e061e000515, 0x0007160f04031017, 0x00050919030b0f18,
+	0x0305011a030b0f18, 0x00010b190b031118, 0x0003001a0b021218, 0x00010b19130b0319, 0x00030306191e0e19, 0x0107102604011019,
+	0x0107012600011119, 0x0500011a1e09021a, 0x000d011a1e09021a, 0x0c041f0616080900, 0x0a030125190d1600, 0x130602061e161600,
+	0x0d06010222161600, 0x0a00091b2a070501, 0x0506050719090501, 0x0a0312041b100a01, 0x020011040b110a01, 0x02030f040e110a01,
+	0x03021604182c0b01, 0x020011040b101001, 0x02030f040e101001, 0x02070403060f2101, 0x00032504041b2101, 0x0003041b042c2101,
+	0x000f1518010b0207, 0x000005211e13100e, 0x020000040b13110e, 0x000705060c13110e, 0x0000050f0e0a1b0f, 0x000305061a0a1b0f,
+	0x00030004100b1b0f, 0x0003041f0b091c13, 0x0306001b0d031017, 0x020703020d150019, 0x020700020d150e19, 0x090615061b010200,
+	0x0304011a121e0900, 0x03041422090e1600, 0x04060315221b1600, 0x0218280d09070501, 0x0602150e2a070501, 0x0a00091b2a070501,
+	0x000e050719090501, 0x010011211e100a01, 0x010711060c110a01, 0x02001e0f0f030b01, 0x030617062b0b1001, 0x060415062a0c1001,
+	0x030409182b0e1001, 0x010711060c101001, 0x020a090118180b04, 0x02000e0118180b04, 0x0706150100062904, 0x0006251500201605,
+	0x0018280d08201605, 0x01041f06101a1607, 0x02000018150b0208, 0x000c1f041d100409, 0x01001f1b10070509, 0x01041f061009160d,
+	0x0107051b1e010b0e, 0x0100051e1b060b0e, 0x010007051b250b0e, 0x01000f251e010e0e, 0x0101211e0401100e, 0x0106071e1401100e,
+	0x01001f1e0416100e, 0x0109061e0001110e, 0x0100141e0b01110e, 0x08061404000e2112, 0x001f0d2104100413, 0x000600151b0b0513,
+	0x000600150b022213, 0x01021f0e06070515, 0x01041f060c061015, 0x01041f0612000a16, 0x00010925030f1017, 0x01011f0402000a18,
+	0x0107030e1e150019, 0x010306040b1c0019, 0x02001a0308090b19, 0x0107000e1e150e19, 0x0603060d0e011119, 0x02001b0f0f030b01,
+	0x020605150a1d1001, 0x02070403060c2101, 0x0012070504162c01, 0x02070103060d2104, 0x0a010a01251a1607, 0x0a06010319090509,
+	0x0506010519090509, 0x01011e1c160b0909, 0x000a12280310070d, 0x01011e1c0b09100d, 0x020005010b13110e, 0x000c1e021e000515,
+	0x000a030306090a16, 0x0005050306090a16, 0x02000d0f04031017, 0x0500160f04031017, 0x03060027030f1017, 0x050c000100031117,
+	0x0003230104031117, 0x0106011c28001118, 0x0106011c28130019, 0x020d000908041019, 0x0516000908041019, 0x0500062808041019,
+	0x0005092808041019, 0x03040508160b0c00, 0x0304141b090a1600, 0x0304062408161600, 0x15061506070e0401, 0x0500230519000501,
+	0x000e220619000501, 0x1506150612010501, 0x0507160629010501, 0x0500050619090501, 0x03041b011c040801, 0x15061506030e0a01,
+	0x010011231e100a01, 0x0115110600110a01, 0x1506150612011001, 0x0507160629011001, 0x0115110600101001, 0x0007120610012904,
+	0x0001220610140905, 0x001812011e200905, 0x03051801200b0c05, 0x0016140e09201605, 0x0318010624201605, 0x03041b011c001106,
+	0x0015061418010207, 0x030405011a0b0c07, 0x03040624011a1607, 0x0304140901162809, 0x000128051b0b070d, 0x0101231e0401100e,
+	0x0d0600270314100e, 0x00030501100b1b0f, 0x01001f160b050411, 0x0100141c000b0912, 0x0000201c050b0912, 0x000900201e100413,
+	0x0004270318000515, 0x0001270513000a16, 0x021607011c030017, 0x0806001b0d031017, 0x050009001b031017, 0x0500000c1e031017,
+	0x0c01000f1e031017, 0x01030602161c0019, 0x02000517010b0319, 0x0004012706150e19, 0x0001062706150e19, 0x000900171e041019,
+	0x0000030e1e111019, 0x0004011c0616181d, 0x0001061c0616181d, 0x0516011e041b0900, 0x0500041e041b0900, 0x04162001101b0900,
+	0x00042004101b0900, 0x02161801141b0900, 0x00021804141b0900, 0x021601021a1b0900, 0x020004021a1b0900, 0x030601161e161600,
+	0x0101160908191600, 0x0806010923191600, 0x080601091e1b1600, 0x0106010e1b1d1600, 0x021607050e0b0401, 0x121f07050e0b0401,
+	0x02160701200b0401, 0x121f0701200b0401, 0x15061f15060e0401, 0x000a221a04100401, 0x020d000a16100401, 0x0516000a16100401,
+	0x001f160d16100401, 0x0011280d16100401, 0x150a09051b000501, 0x000c1c051b000501, 0x0c170d0528000501, 0x0a1709052c000501,
+	0x080c012318060b01, 0x080c011c18070b01, 0x0101160908162001, 0x0806010923162001, 0x001612011b091e04, 0x000012041b091e04,
+	0x0006001504242104, 0x0d06150100062904, 0x0018120109062904, 0x0100140910072904, 0x0016010e14101106, 0x000f101f010b0208,
+	0x011416012a011608, 0x010014042a011608, 0x0000132119070509, 0x0906010519090509, 0x0c01001b07022809, 0x0c0117050005280d,
+	0x01011f042414100e, 0x01011e042a14100e, 0x050909000325100e, 0x01010809100b1b0f, 0x001601041b220910, 0x000004041b220910,
+	0x0200000d16100411, 0x0103011f0b091c13, 0x001601021b180914, 0x000004021b180914, 0x000c00051e000515, 0x0c01012b06080515,
+	0x0009050306090a16, 0x010c0119060b0919, 0x0009092808041019, 0x050106011b091019, 0x010c010b041c1019, 0x0004012404041119,
+	0x001613011b09021a, 0x000013041b09021a, 0x001606001a16021a, 0x0000030e1610111e, 0x010217041e080900, 0x0102160908191600,
+	0x0806020923191600, 0x080602091e1b1600, 0x020614150b090401, 0x0310110d04100401, 0x020c220d04100401, 0x0214280d04100401,
+	0x02280d0411000501, 0x010a111c0f0b0901, 0x080c022318060b01, 0x080c021c18070b01, 0x0102160908162001, 0x0806020923162001,
+	0x0016020e14101106, 0x0a0f100b010b0208, 0x0201210410000509, 0x0106231e0401100e, 0x00020b041c030910, 0x0006141c0b020f13,
+	0x0403230104031117, 0x06140e01030b0f18, 0x030614000b021218, 0x06030602161c0019, 0x050206011b091019, 0x020b1f0516080900,
+	0x0214000e1e100401, 0x020305111b100a01, 0x0a0305110e110a01, 0x0202162118060b01, 0x0802022218060b01, 0x0a0305110e101001,
+	0x0204020a2b131001, 0x0002211b04062101, 0x0200140210140905, 0x0201140406000409, 0x01021e041b09010d, 0x11021e091c16010d,
+	0x02141e092d16010d, 0x01021f042400070d, 0x01021e042a00070d, 0x020205061b01100e, 0x021400090314100e, 0x00021f042414100e,
+	0x00021e042a14100e, 0x020a05060e01110e, 0x0200140b04100411, 0x0200050306090a16, 0x000c0219060b0919, 0x0003030e1e150b19,
+	0x0200092808041019, 0x000c020b041c1019, 0x040b1f0516080900, 0x020b030509100900, 0x0200090f22191600, 0x02000a0923191600,
+	0x02000a091e1b1600, 0x1706020a16100401, 0x0107020a16100401, 0x02010b041f000501, 0x0218270d09070501, 0x001f0d1b15070501,
+	0x000614051a090501, 0x02051809140b0801, 0x020305131b100a01, 0x010012211e100a01, 0x010712060c110a01, 0x0a0305130e110a01,
+	0x0402162118060b01, 0x0804022218060b01, 0x010712060c101001, 0x0a0305130e101001, 0x0204040a2b131001, 0x0200090f22162001,
+	0x02000a0923162001, 0x0004211b04062101, 0x0018270d08201605, 0x0116000e14101106, 0x0802230d01070207, 0x000f151a010b0207,
+	0x0006120519090509, 0x020013170702010d, 0x01041e041b09010d, 0x020417060816010d, 0x11041e091c16010d, 0x020003171e16010d,
+	0x01000a281e16010d, 0x04141e092d16010d, 0x01041f042400070d, 0x01041e042a00070d, 0x010028051b0b070d, 0x020417060800110d,
+	0x010a12061b01100e, 0x010000211e13100e, 0x00041f042414100e, 0x00041e042a14100e, 0x01020f060e01110e, 0x010700060c13110e,
+	0x0100000f0e0a1b0f, 0x010300061a0a1b0f, 0x00020809100b1b0f, 0x0207001a03100411, 0x0110001801100b12, 0x02000b2004100413,
+	0x1706002006100413, 0x0107002006100413, 0x001f0d1b01070513, 0x0602010e1e070515, 0x060401060c1e1015, 0x0100270513000a16,
+	0x020700070d031017, 0x020b0009030f1017, 0x0c00090d031d1017, 0x0211170108040019, 0x0107012706150019, 0x0200170804040519,
+	0x000c0419060b0919, 0x02000b0319060b19, 0x0201170608040e19, 0x0100062706150e19, 0x1706011309011019, 0x0107011309011019,
+	0x01000d060d011019, 0x01000c061b011019, 0x02000b1704041019, 0x1706001706041019, 0x0107001706041019, 0x1706001608041019,
+	0x0107001608041019, 0x0806002708041019, 0x0107160004091019, 0x010509011b091019, 0x000c040b041c1019, 0x0104200604011119,
+	0x010415060e011119, 0x010608010e091119, 0x0006051a0b0c021a, 0x000606241a16021a, 0x0100061c0616181d, 0x0400090f22191600,
+	0x04000a0923191600, 0x04000a091e1b1600, 0x02060511181d1600, 0x0514000e1e100401, 0x0602160b2b070501, 0x04051809140b0801,
+	0x050617062b0b1001, 0x020605162b0e1001, 0x0400090f22162001, 0x04000a0923162001, 0x0006160519090509, 0x0a06160005162809,
+	0x050205061b01100e, 0x050a05060e01110e, 0x00040809100b1b0f, 0x0a0600041d131011, 0x060002181d180b12, 0x0500050306090a16,
+	0x010506040b1c0019, 0x0500092808041019, 0x0605060d0e011119, 0x02190105181e0900, 0x050022160b050401, 0x14061506070e0401,
+	0x0513000e1e100401, 0x1406150612010501, 0x00280d1b11070501, 0x14061506030e0a01, 0x0114110600110a01, 0x0114052b12060b01,
+	0x0106150d1a240b01, 0x0100110f1a240b01, 0x010218041b090c01, 0x050416061b090c01, 0x110218091c160c01, 0x021418092d160c01,
+	0x1406150612011001, 0x0114110600101001, 0x1103120118180b04, 0x0103190118180b04, 0x010109041b091e04, 0x000622150b161e04,
+	0x110109091c161e04, 0x07280d001d161e04, 0x011409092d161e04, 0x0100130910072904, 0x0014061418010207, 0x0500150d1a0b0207,
+	0x01140115001a1607, 0x01042106101a1607, 0x0201180619241607, 0x011201001e151608, 0x000c21041d100409, 0x0100211b10070509,
+	0x0a06010519090509, 0x0605011e190b0509, 0x0501151c010b0909, 0x0001201c120b0909, 0x00011d1c160b0909, 0x0101221c160b0909,
+	0x0114000f00162809, 0x0f1000230702010d, 0x010420041b09010d, 0x020417061b09010d, 0x110420091c16010d, 0x041420092d16010d,
+	0x000f101c0b05060d, 0x010420042a00070d, 0x020417062a00070d, 0x00011d1c0b09100d, 0x0101221c0b09100d, 0x010421061009160d,
+	0x0004061906240b0e, 0x000420042a14100e, 0x020000180328100e, 0x0100111e0b01110e, 0x0100001e0b16110e, 0x01040d061b190910,
+	0x0000030f171a0b12, 0x00210d2104100413, 0x02071800191d1013, 0x010409061b160914, 0x00111b030d000515, 0x000c22021e000515,
+	0x0102210e06070515, 0x010421060c061015, 0x0114002b0e061015, 0x00111b0304000a16, 0x0104210612000a16, 0x000a050306090a16,
+	0x00051e03060b0a16, 0x00061516030b0917, 0x00280d1604031017, 0x05000027030d1017, 0x0101210402000a18, 0x0206011c28001118,
+	0x0206011c28130019, 0x010305040d1c0019, 0x010f100b010b0319, 0x02001708040b0919, 0x000a092808041019, 0x00000e2808041019,
+	0x01010d041b09021a, 0x11010d091c16021a, 0x01140d092d16021a, 0x0000031a0b05111e, 0x02021b060d070200, 0x02171a0105071600,
+	0x0201171a11071600, 0x02142104090a1600, 0x02142109050d1600, 0x022104011c040801, 0x021204011b060801, 0x0e1f05011b060801,
+	0x0202040616100a01, 0x011e011a1e140905, 0x0216070101201605, 0x121f070101201605, 0x0201010317201605, 0x030a010125201605,
+	0x022104011c001106, 0x011001001e151608, 0x010101231e151608, 0x0602012119070509, 0x0f0614040e012109, 0x010714040e012109,
+	0x0006021b07022809, 0x000228051b0b070d, 0x0107231e0401100e, 0x0209001a03100411, 0x0001231907180b12, 0x0c001e011e000515,
+	0x0002270513000a16, 0x0002210306070a16, 0x130614011c030017, 0x020900070d031017, 0x0512000100031117, 0x060a130122040019,
+	0x03061501161c0019, 0x07030602161c0019, 0x0002062706150e19, 0x0002061c0616181d, 0x0d0615061b010200, 0x011617061e080900,
+	0x080c1c0603070401, 0x01060c1803100401, 0x0103111804100401, 0x0103101904100401, 0x0806061b17100401, 0x080c1c060d000501,
+	0x16280d0611000501, 0x080e05061b010801, 0x080e05062a010901, 0x0611150616030b01, 0x0508160616030b01, 0x030e010610012904,
+	0x000919060b251605, 0x03011a060b251605, 0x0116210610000509, 0x0801220610000509, 0x0706010519090509, 0x02011f042414100e,
+	0x02011e042a14100e, 0x010d061e0001110e, 0x02010809100b1b0f, 0x00160b061c030910, 0x0203011f0b091c13, 0x0007050306090a16,
+	0x020c0119060b0919, 0x0007092808041019, 0x020c010b041c1019, 0x03040f0716080900, 0x080609071c0b0401, 0x01090c1803100401,
+	0x0503130e04100401, 0x050e170e04100401, 0x0806091b17100401, 0x0503130219000501, 0x050e170219000501, 0x02030b041f000501,
+	0x020b16071f000501, 0x0806090716080501, 0x00120c07180b0501, 0x010314040f040801, 0x011416070f040801, 0x1506150116110b01,
+	0x0302180408160c01, 0x0216180708160c01, 0x1506031522160f01, 0x03061a15040e1001, 0x010615170e161001, 0x0306150404171001,
+	0x00120c0705162c01, 0x0806090700161e04, 0x0301090408161e04, 0x0116090708161e04, 0x1506001511161e04, 0x03061501040d2104,
+	0x000615170e0d2104, 0x0303001a0d1d1605, 0x021607000e201605, 0x121f07000e201605, 0x010314040f001106, 0x011416070f001106,
+	0x01011f090e111106, 0x0014020e0e111106, 0x00030b041d041607, 0x00160b071d041607, 0x030400070b1a1607, 0x00021d070b1a1607,
+	0x040120070b1a1607, 0x010222070b1a1607, 0x01000e231e151608, 0x0503150406000409, 0x0515160706000409, 0x060f010719080509,
+	0x0906160005162809, 0x01021e091a162809, 0x030420040816010d, 0x041620070816010d, 0x080110070805060d, 0x020117070805060d,
+	0x010314041100070d, 0x011416071100070d, 0x050f00280310070d, 0x030420040800110d, 0x041620070800110d, 0x0104231e0401100e,
+	0x021500180306100e, 0x020007180328100e, 0x050905060e01110e, 0x01031f010e13110e, 0x020108180e13110e, 0x030601190e13110e,
+	0x0306010e2014110e, 0x00011f060e16110e, 0x000103161b070811, 0x000103162a070911, 0x090600041d131011, 0x0015011a07160b12,
+	0x00121b0025000413, 0x05011b0701000a16, 0x000f070306080a16, 0x030b06040f030017, 0x0b0616070f030017, 0x05000727030d1017,
+	0x09030b010e031117, 0x0a0300090e031117, 0x010316090e031117, 0x0f06010a0e031117, 0x0107010a0e031117, 0x0c01070d0e031117,
+	0x0c01080d0e031117, 0x03100c0408040019, 0x10160c0708040019, 0x0103160408090019, 0x0116160708090019, 0x04030602161c0019,
+	0x0003031a0e110519, 0x0b06020710010719, 0x00011a0119060e19, 0x050005061b011019, 0x000316040e091119, 0x03010d040816021a,
+	0x01160d070816021a, 0x000124091c16021a, 0x01021b060d070200, 0x08060523090b0200, 0x0e041f0616080900, 0x01190105181e0900,
+	0x01171a0105071600, 0x0101171a11071600, 0x001f210f05091600, 0x0a0f070125091600, 0x01142104090a1600, 0x01142109050d1600,
+	0x0614000e1e100401, 0x012104011c040801, 0x011204011b060801, 0x0102040616100a01, 0x000407051a162c01, 0x15070c0104242104,
+	0x000c1e02101c0905, 0x000c1f0210250905, 0x0116070101201605, 0x0101010317201605, 0x000c010f22201605, 0x000a0c0123201605,
+	0x012104011c001106, 0x02050c011b101106, 0x0a050c010e111106, 0x0901062518010207, 0x0401032225181607, 0x000a0018150b0208,
+	0x010417061b09010d, 0x010417062a00070d, 0x060205061b01100e, 0x0400061a1b12100e, 0x020105071b13100e, 0x0c00091e031c100e,
+	0x0c00091f0325100e, 0x010000180328100e, 0x060a05060e01110e, 0x0a0105070e13110e, 0x0109001a03100411, 0x00010d1a03100411,
+	0x0001251a04100411, 0x0400061a1b100a11, 0x000103070b151c13, 0x0401030707171c13, 0x0600050306090a16, 0x010900070d031017,
+	0x00010d070d031017, 0x05090c011b031017, 0x00010c071b031017, 0x0401200704031117, 0x06080c010e031117, 0x040115070e031117,
+	0x010208040d1c0019, 0x0205010d150b0319, 0x01001708040b0919, 0x0600092808041019, 0x10041f0616080900, 0x0407271803100401,
+	0x042718031b000501, 0x0c00091b2a070501, 0x020012211e100a01, 0x020712060c110a01, 0x020712060c101001, 0x0216000e14101106,
+	0x0800182304091607, 0x02000a281e16010d, 0x020028051b0b070d, 0x020a12061b01100e, 0x020000211e13100e, 0x02020f060e01110e,
+	0x020700060c13110e, 0x0200000f0e0a1b0f, 0x020300061a0a1b0f, 0x0210001801100b12, 0x0200270513000a16, 0x0207012706150019,
+	0x0200062706150e19, 0x02000d060d011019, 0x02000c061b011019, 0x0207160004091019, 0x020509011b091019, 0x0204200604011119,
+	0x020415060e011119, 0x020608010e091119, 0x0200061c0616181d, 0x040b030509100900, 0x1304011a121e0900, 0x13041422090e1600,
+	0x0414000e1e100401, 0x000c1c051b000501, 0x04010b041f000501, 0x00120d1b28070501, 0x02060d1d28070501, 0x0206160d29070501,
+	0x1000091b2a070501, 0x00100d1b2a070501, 0x060e050719090501, 0x0b07050e1f0b0501, 0x130409182b0e1001, 0x010b071c2b0e1001,
+	0x0c00061c18180b04, 0x1507010d04242104, 0x11060d0017201605, 0x00010d0f22201605, 0x000a010d23201605, 0x0019060d23201605,
+	0x0205010d1b101106, 0x0a05010d0e111106, 0x000b0e1a160b0207, 0x000115201a0b0207, 0x000c00221a0b0207, 0x00010e241a0b0207,
+	0x040110241a0b0207, 0x0c01160d1e011607, 0x000b0e1a110b0208, 0x00040d1a1e011608, 0x010418061b091509, 0x011407040e162109,
+	0x000406041b282109, 0x0104120610092809, 0x0b07040600042909, 0x0104180608042909, 0x040013170702010d, 0x010b071f0b02010d,
+	0x040417060816010d, 0x040003171e16010d, 0x0b0704062a16010d, 0x011407040e21100d, 0x040417060800110d, 0x0100121b0705280d,
+	0x0102061d0705280d, 0x040205061b01100e, 0x020105081b13100e, 0x040a05060e01110e, 0x0a0105080e13110e, 0x1201001607060411,
+	0x0407001a03100411, 0x120702001a1d1011, 0x00071404000e2112, 0x000b07200b090413, 0x04000b2004100413, 0x001a0d0507090513,
+	0x000103080b151c13, 0x0401030807171c13, 0x000c00051e000515, 0x01020b2706070515, 0x020105270e061015, 0x0400050306090a16,
+	0x040700070d031017, 0x00010d080d031017, 0x00010c081b031017, 0x0509010d1b031017, 0x0006160d1b031017, 0x0801000f1e031017,
+	0x10010a07030f1017, 0x00010d08030f1017, 0x040b0009030f1017, 0x1201000e030f1017, 0x06010925030f1017, 0x010107092a0f1017,
+	0x0900090d031d1017, 0x0401200804031117, 0x040115080e031117, 0x0608010d0e031117, 0x000b0717020b0a18, 0x0105061d020b0a18,
+	0x0411170108040019, 0x04110601161c0019, 0x00040e1a010b0319, 0x0404101a010b0319, 0x0400170804040519, 0x00040616041c0519,
+	0x000b0717040b0919, 0x00090419060b0919, 0x04041a0025010b19, 0x04000b0319060b19, 0x000b07030b1c0b19, 0x0401170608040e19,
+	0x04010606161c0e19, 0x0504090c1b011019, 0x04000b1704041019, 0x0400092808041019, 0x0501090d1b041019, 0x0009040b041c1019,
+	0x0604080c0e011119, 0x0601080d0e041119, 0x011118011b09021a, 0x000c011a1e09021a, 0x0b0701062c16021a, 0x010313062c16021a,
+	0x04060d061c00111e, 0x0806020924070400, 0x03050d1b060b0400, 0x0105180b1b060500, 0x000f231816070500, 0x03100d0a17070500,
+	0x01140c1809170500, 0x15061515061b0500, 0x05062215061b0500, 0x080c091c061b0500, 0x010023090f1b0500, 0x08060209181b0500,
+	0x0806020922240500, 0x0a0f100b09260500, 0x0212010f0d100600, 0x020702041c100600, 0x020d010a1d100600, 0x0516010a1d100600,
+	0x011f160d1d100600, 0x0111280d1d100600, 0x000a251a03180900, 0x0806011d13102600, 0x000a0b0306091a05, 0x00050b0506091a05,
+	0x000c0d0506091a05, 0x000a090927101d05, 0x06000e0c1f102605, 0x030600111f102605, 0x000a001a150b0408, 0x02120f0100150508,
+	0x0100221a0b150508, 0x0200170502090a08, 0x020d001e02100b08, 0x0516001e02100b08, 0x010601041c1b010a, 0x01000604201b010a,
+	0x01001f0f2402100a, 0x01001e0f2a02100a, 0x000208182814100a, 0x000306192814100a, 0x000209182c14100a, 0x020b16070500010e,
+	0x120b1f070500010e, 0x020b01051808010e, 0x020607182701100e, 0x0201011f0705100e, 0x011000061f05100e, 0x030201202a05100e,
+	0x0212010f0007100e, 0x02010f1d0107100e, 0x02000f1b0407100e, 0x02000f1f0407100e, 0x00011d2c1408100e, 0x000208182811100e,
+	0x000306192811100e, 0x000209182c11100e, 0x00090628041f100e, 0x0100061c1322100e, 0x000209181522100e, 0x000600151e0b0410,
+	0x060101151c1b0510, 0x00060115201b0510, 0x0209190106230510, 0x0201160706230510, 0x12011f0706230510, 0x0801091b06230510,
+	0x0006011c1c012210, 0x120400091c100111, 0x1506150504010b11, 0x010301051b270b11, 0x0100160908052011, 0x0100090f22052011,
+	0x0806000923052011, 0x01000a0923052011, 0x0100180110010816, 0x00000d0610021019, 0x0806001325021019, 0x0806001127021019,
+	0x0001051b1102091b, 0x000a1a030e15091b, 0x01071a001d050d1d, 0x0300120d0805181d, 0x00030f061c05181d, 0x02071603101a0500,
+	0x12071f03101a0500, 0x021601091b1a0500, 0x06170f060b1d0500, 0x0006051a171d0500, 0x06021611201d0500, 0x04060a1b241d0500,
+	0x080c230103070800, 0x0a0305030d091a00, 0x050305050d091a00, 0x030405060b0b1a00, 0x0105100903101d00, 0x0806021a03101d00,
+	0x0212010119180507, 0x0d00280d1e180507, 0x00000d121e180507, 0x0500160502090a07, 0x00011f19090b0408, 0x0a0f230015090508,
+	0x001506151a090508, 0x000b19052a090508, 0x0200170504090a08, 0x020d001e04100b08, 0x0516001e04100b08, 0x0100061c29101409,
+	0x020714001d051e09, 0x010725001d051e09, 0x01001f0f2404100a, 0x01001e0f2a04100a, 0x000906172805100a, 0x000a081a2805100a,
+	0x000a091a2c05100a, 0x051500022406100a, 0x030400112406100a, 0x010c011c2406100a, 0x021201140007100a, 0x050c01200007100a,
+	0x011201250007100a, 0x0201141d0107100a, 0x0101251d0107100a, 0x0200141b0407100a, 0x0100251b0407100a, 0x0200141f0407100a,
+	0x0100251f0407100a, 0x030400241807100a, 0x051500022907100a, 0x030400112907100a, 0x010c011c2907100a, 0x01001f0f2410050d,
+	0x01001e0f2a10050d, 0x0306001b2510110d, 0x0003061f2510110d, 0x11011e091c05120d, 0x00000a281e05120d, 0x01141e092d05120d,
+	0x0100031e1026120d, 0x020d001e0308100e, 0x0516001e0308100e, 0x00011d2c0f08100e, 0x0601011d1d17100e, 0x0600041e1d17100e,
+	0x0100061a0322100e, 0x000701230622100e, 0x120400091c100113, 0x1506150504010b13, 0x010301051b270b13, 0x0100160908052013,
+	0x0100090f22052013, 0x0806000923052013, 0x01000a0923052013, 0x001601091b180514, 0x020b00050d010816, 0x0906000e041e1017,
+	0x00000d0610041019, 0x0806001325041019, 0x0806001127041019, 0x020714001d050d1a, 0x010725001d050d1a, 0x0006011c2801171a,
+	0x000625100005181a, 0x000325140005181a, 0x0000260d0605181a, 0x110f06000d05181a, 0x011107000d05181a, 0x040620011605181a,
+	0x060801062205181a, 0x040607012305181a, 0x030600152305181a, 0x060e01062405181a, 0x0001051b1104091b, 0x000419061209091b,
+	0x0200231909070400, 0x02021a091a090500, 0x0200231922090500, 0x00060d1a1e110500, 0x0116180109150500, 0x0118010315150500,
+	0x0c000a0d1e1c0500, 0x0500092404101d00, 0x0806011d12102600, 0x1506150615020b01, 0x0102081804270b01, 0x0103061904270b01,
+	0x0604111506270b01, 0x0504081606270b01, 0x020b160705031001, 0x120b1f0705031001, 0x050116050d061001, 0x120400091c101301,
+	0x0a06101500220b04, 0x020600150a220b04, 0x000e090d25101d05, 0x03000e0d1d102605, 0x000928061a010407, 0x000c001c1a0b0407,
+	0x0000151d1a0b0407, 0x0001091f1a0b0407, 0x000115221a0b0407, 0x050c1d01001a0507, 0x02000d1b0b1a0507, 0x0500161b0b1a0507,
+	0x1101121e111a0507, 0x0101191e111a0507, 0x011e0115181a0507, 0x000407281e1a0507, 0x00090b052a1a0507, 0x011e01112d1a0507,
+	0x0500160504090a07, 0x11011e031a010e07, 0x0306001b28101309, 0x0003061f28101309, 0x000602281d101409, 0x01011e0408052809,
+	0x01001e0f18052809, 0x020d001e0307100a, 0x0516001e0307100a, 0x010011281f07100a, 0x000208182810100a, 0x000306192810100a,
+	0x000209182c10100a, 0x11011e031a01070d, 0x020d001e0210070d, 0x0516001e0210070d, 0x11011e091c05160d, 0x00000a281e05160d,
+	0x01141e092d05160d, 0x0100031e1026160d, 0x010301041f26010e, 0x06000f1b1d05100e, 0x0006021c1d05100e, 0x00060f1f1d05100e,
+	0x060201201d05100e, 0x0d0600051122100e, 0x0100061c1222100e, 0x0003001a1a0b0414, 0x02001a030b1a0914, 0x0106010d220b1918,
+	0x07060101230b1918, 0x0d060004230b1918, 0x0004030629150119, 0x0306060e23011019, 0x010420040a01091b, 0x020417060a01091b,
+	0x050416002401001e, 0x00020f03090b191e, 0x00070306150b191e, 0x02121a0112070500, 0x050f23061c070500, 0x00061715161b0500,
+	0x1506150615040b01, 0x0a001a0f22050c01, 0x0a000a1a23050c01, 0x1506150615050f01, 0x120400091c101701, 0x0107160903092401,
+	0x00061522040d1d04, 0x040301030d181d04, 0x0403010f0e181d04, 0x0212010f0d100006, 0x020702041c100006, 0x020d010a1d100006,
+	0x0516010a1d100006, 0x011f160d1d100006, 0x0111280d1d100006, 0x080c00230f1f0507, 0x0100180115011707, 0x010b09052a011707,
+	0x050028051a010508, 0x02011b000d150508, 0x0306001b28101709, 0x0003061f28101709, 0x080c002306051e09, 0x020b16070500010a,
+	0x120b1f070500010a, 0x0f06011d2c01100a, 0x0107011d2c01100a, 0x01001f0f1e04100a, 0x011000062005100a, 0x0c011f1d0107100a,
+	0x01011f1d1207100a, 0x0301011d2a10100a, 0x0601011d1d14100a, 0x0600041e1d14100a, 0x0113061f0210000d, 0x0c001c0f2205010d,
+	0x0c000a1c2305010d, 0x01001f0f1e10050d, 0x020d001e0410070d, 0x0516001e0410070d, 0x0306001b2710170d, 0x0003061f2710170d,
+	0x010006041f26010e, 0x0601011d1d11100e, 0x0600041e1d11100e, 0x03000d08152c0510, 0x0100160908052213, 0x0100090f22052213,
+	0x0806000923052213, 0x01000a0923052213, 0x0503070101091e16, 0x00060d1003100018, 0x0200041403100018, 0x00030d1403100018,
+	0x0100042503100018, 0x0600100b2c100518, 0x0300140b2c100518, 0x01000d0f22051218, 0x01000a0d23051218, 0x080c002306050d1a,
+	0x0007120504160b1c, 0x000a051209160b1c, 0x00140e0902180b1c, 0x0015071602180b1c, 0x0100041a0310001e, 0x050f230624070500,
+	0x020d001e0f0e0500, 0x0516001e0f0e0500, 0x0118010316150500, 0x0209190f06170500, 0x1506151506190500, 0x0506221506190500,
+	0x080c091c06190500, 0x010023090f190500, 0x0806020918190500, 0x011001170b100600, 0x0304021a0b100600, 0x02011c150d100600,
+	0x0104071b1e100600, 0x0f0415091b040800, 0x020412060d180900, 0x01090e061e180900, 0x020104040d1f0900, 0x0403030f1c071a00,
+	0x0500092404101e00, 0x0a06221501170b01, 0x050a05160e080c01, 0x02140e180e080c01, 0x0501160529090c01, 0x0110011706100e01,
+	0x0304021a06100e01, 0x1204000924101701, 0x1506151506052001, 0x0506221506052001, 0x080c091c06052001, 0x010023090f052001,
+	0x0806020918052001, 0x000617062b071404, 0x0204010a2b101404, 0x0004011c2b101404, 0x0001091d2b101404, 0x01140e090e081e04,
+	0x020101040b091e04, 0x0009002314071a05, 0x0305010d1d0b1a05, 0x000e090d25101e05, 0x0006170614072105, 0x0204010a14102105,
+	0x0004011c14102105, 0x0001091d14102105, 0x020121040d100006, 0x0307041b0d100006, 0x011001170f100006, 0x0304021a0f100006,
+	0x0205280d16100006, 0x050c010b20100006, 0x0207020424100006, 0x000a2210010b1906, 0x01141a061c010507, 0x0516011525010507,
+	0x000c1c06271a0507, 0x00051d06271a0507, 0x0a011e06271a0507, 0x05012206271a0507, 0x0212010f01100e07, 0x0212010112100e07,
+	0x000a001a040b1a07, 0x0104001127101b07, 0x0504031600072507, 0x0217011525010508, 0x0110011701100b08, 0x0304021a01100b08,
+	0x050c011d01100e08, 0x0304002413100e08, 0x0110011706100109, 0x0304021a06100109, 0x0103061a28100109, 0x020605132a01100a,
+	0x050409202a01100a, 0x06000f291c05100a, 0x06000f2b1c05100a, 0x020105211506100a, 0x011001170007100a, 0x0304021a0007100a,
+	0x1101121e0507100a, 0x0101191e0507100a, 0x020105211107100a, 0x020205012307100a, 0x050205270108100a, 0x0100061c2b10100a,
+	0x0306002b2213100a, 0x020605012a13100a, 0x0d060005111b100a, 0x0100061c121b100a, 0x0d060005151e100a, 0x030414140e08010d,
+	0x020a05170e08010d, 0x04140e200e08010d, 0x020117052909010d, 0x11011e031a09040d, 0x011001170110070d, 0x0304021a0110070d,
+	0x020105211710070d, 0x020105211210080d, 0x0d0600022910110d, 0x000408200b1a160d, 0x0100061c1021160d, 0x02000817030b1b0d,
+	0x0100061c120b1e0d, 0x0100061c1013280d, 0x050c011e0600100e, 0x0f0606051d00100e, 0x01061c0f1d00100e, 0x020605151d00100e,
+	0x0106021b1d00100e, 0x050c01061e01100e, 0x06000f241d05100e, 0x010a12011e07100e, 0x011001170008100e, 0x0304021a0008100e,
+	0x0106001d1e12100e, 0x000209181c17100e, 0x020305011326100e, 0x000209181426100e, 0x02011c010f10080f, 0x020105092c10080f,
+	0x0001091c060b1e0f, 0x0006011520190510, 0x0601011525190510, 0x02091901061f0510, 0x02011607061f0510, 0x12011f07061f0510,
+	0x0801091b061f0510, 0x0a01050d0e190810, 0x01010d0529190910, 0x0106001d1e100a11, 0x010700231e1c0b11, 0x0100091e22100e11,
+	0x0301230d06100113, 0x000703060c181013, 0x00020918100b2613, 0x07280d0023160514, 0x0301011525160514, 0x00031a06271a0514,
+	0x0a0105090e160814, 0x020401060b160914, 0x0101090529160914, 0x00000e03060b1e16, 0x00041003060b1e16, 0x000a090923031017,
+	0x0306002b0a0f1017, 0x0009060d26100518, 0x00060c012a100518, 0x0501090d2a100518, 0x02000d0d02100818, 0x0500160d02100818,
+	0x00010c2102100818, 0x0603060a25011019, 0x0806011325011019, 0x02000d0d03061019, 0x0500160d03061019, 0x00010c2103061019,
+	0x000c090a031e1019, 0x03060010031e1019, 0x01140e0d0e08021a, 0x000a0925100b021a, 0x000c0927100b021a, 0x020002230f10081a,
+	0x110f06000c05181a, 0x011107000c05181a, 0x020300062305181a, 0x010420040e01091b, 0x020417060e01091b, 0x0001041f0409091b,
+	0x000419061709091b, 0x0903010603160b1c, 0x0107110023160b1c, 0x0103010d25160b1c, 0x020002180f10081d, 0x00051b060605181d,
+	0x000906070605181d, 0x020300061805181d, 0x00020918100b121e, 0x02121a0117070500, 0x020a0517070d0500, 0x06181005260e0500,
+	0x03181405260e0500, 0x00060514181d0500, 0x0204160706160b01, 0x12041f0706160b01, 0x01071803061c0b01, 0x0318010526170b04,
+	0x010006041f220b04, 0x01070018030b1906, 0x0516052610010507, 0x00280d0517150507, 0x0118090526150507, 0x01051005001a0507,
+	0x00011a06121a0507, 0x09010a06251a0507, 0x00011406251a0507, 0x000e0a051b230507, 0x050016050c240507, 0x0001090420240507,
+	0x0217052610010508, 0x0601052610190510, 0x03180105260b0514, 0x0301052610160514, 0x00061a050a1e0514, 0x00061203280b1918,
+	0x000610032a0b1918, 0x000314032a0b1918, 0x0103010514160b1c, 0x0103010321160b1c, 0x0007011c0605181d, 0x00030f05030b191e,
+	0x00060d1a21110500, 0x0c000a0d25170500, 0x0c000a0d211c0500, 0x020a2519050f0900, 0x020c2719050f0900, 0x01021926130f0900,
+	0x010219121e0f0900, 0x0201121d0d180900, 0x020619040d1f0900, 0x05000a1e04090a00, 0x04000a2010090a00, 0x02000a1814090a00,
+	0x02000a021a090a00, 0x0a0f122307010b00, 0x090606181d010e00, 0x0403030f1c081a00, 0x0806011d12091a00, 0x050f0f1817050701,
+	0x0200170f051c0b01, 0x0206051511270b01, 0x0a071a171b050c01, 0x0a15071a26050c01, 0x0501162209080c01, 0x050f091826010e01,
+	0x0109181815031001, 0x01061a152c031001, 0x0106152c09101001, 0x0215071829031201, 0x010509181a011701, 0x020a0904060c1d01,
+	0x02000e04060c1d01, 0x02001204011b1d01, 0x0e001f05011b1d01, 0x0100181a15080b04, 0x020a0901060d1d04, 0x02000e01060d1d04,
+	0x0500190001241d04, 0x020601190b091e04, 0x00000a12090a1e04, 0x0d060015090a1e04, 0x0200190d10210905, 0x000219150f250905,
+	0x00020c1914250905, 0x0002190f0f270905, 0x0009002314081a05, 0x03000e0d1d091a05, 0x03021a0d1a010006, 0x05000d1620010006,
+	0x080026091e011106, 0x050f181700090507, 0x0100181a17090507, 0x0100181a110e0507, 0x0000172614180507, 0x0a011221101a0507,
+	0x00011717121a0507, 0x00040728211a0507, 0x000c0a171b1f0507, 0x0a12280d01011707, 0x01000a1814011707, 0x01000c1816011707,
+	0x000a120c2b011707, 0x0001091a2b011707, 0x0202011b04071707, 0x0202011829071707, 0x000a1a2204031a07, 0x000a120c1a012107,
+	0x0001091a1a012107, 0x05011900090c2307, 0x0002050b06102307, 0x0402001806102307, 0x0504031600082507, 0x050f152801030408,
+	0x01001e111a052809, 0x020009171d052809, 0x02000917011e2809, 0x0100241a1c00010a, 0x011009182401010a, 0x010018121508010a,
+	0x000a12062a15010a, 0x00000a271518010a, 0x000a1219061b010a, 0x0c000a1c2201000d, 0x0c071c171b05010d, 0x0c15071c2605010d,
+	0x020117220908010d, 0x000c091c0623040d, 0x0500061d0623040d, 0x0005091d0623040d, 0x0a01091e0623040d, 0x01000e1e0623040d,
+	0x050109220623040d, 0x00000a282105160d, 0x0100031e091a160d, 0x02000a271a00010e, 0x000a12061c25010e, 0x0a0612150126010e,
+	0x000a12061926010e, 0x0010002619010410, 0x0006191d1e030410, 0x020016070a1f0510, 0x12001f070a1f0510, 0x08060009251f0510,
+	0x01000a09251f0510, 0x01010d2209190810, 0x00001d28041c0910, 0x0301000d1b2b0910, 0x00000a0422090a10, 0x00000a1b04022310,
+	0x0002051906022310, 0x0305040900062310, 0x0806011700062310, 0x001209251a010111, 0x030400160f090811, 0x011000001e1c0b11,
+	0x010001231e1c0b11, 0x0109181801031013, 0x0100181b06031013, 0x01000a1806011c13, 0x010709171b052213, 0x0115070926052213,
+	0x000203190f092613, 0x02001d0116010414, 0x1000280d00160514, 0x00280d0123160514, 0x000023190b1a0514, 0x0101092209160814,
+	0x0300030d0d160814, 0x0201011d0b160914, 0x0300030d27160914, 0x00000a0218090a14, 0x0515000227060b15, 0x0304001127060b15,
+	0x010c011c27060b15, 0x0a01122103061015, 0x13060016031e1015, 0x0c00001e031e1015, 0x000a120b1c010816, 0x040a001a1c010816,
+	0x0015060a04001e16, 0x010d000c1e001e16, 0x0001210306031e16, 0x0004070306091e16, 0x00000d061a0f0117, 0x0406001a141e0117,
+	0x0302180127030717, 0x040a002518010818, 0x040c002718010818, 0x01070d171b051218, 0x0115070d26051218, 0x00061017030b1918,
+	0x00031417030b1918, 0x0406001523120119, 0x00000a13090a021a, 0x01000a0d2201171a, 0x0d0600250e05181a, 0x060420190e01091b,
+	0x0201171d0e01091b, 0x0002160c1b04091b, 0x000906171b04091b, 0x020400171e04091b, 0x0006191f0409091b, 0x0002051d1609091b,
+	0x0001191d1709091b, 0x000216031b09091b, 0x0002051d100d091b, 0x0301000d1b12091b, 0x02000b021815091b, 0x0110001100160b1c,
+	0x0002051208160b1c, 0x0100110123160b1c, 0x0000120225160b1c, 0x0002160802180b1c, 0x00000a1302180b1c, 0x00001902161a0b1c,
+	0x050002061b031e1d, 0x020218180907001e, 0x000a120b1801081e, 0x040a001a1801081e, 0x000203190f09121e, 0x070d060d150b0400,
+	0x0110010317170500, 0x1008060a17170500, 0x10000c0f22170500, 0x10000a0c23170500, 0x0a0604050c091a00, 0x0605041e0c0b1a00,
+	0x0d06150115012100, 0x070d060215012100, 0x0601121d0c102100, 0x070601240c102600, 0x0806011d14102600, 0x0a000a251e040b01,
+	0x0c000a271e040b01, 0x0304142409130b01, 0x020d0406081c0b01, 0x05160406081c0b01, 0x020d00031e1c0b01, 0x051600031e1c0b01,
+	0x010610051b270b01, 0x010314051b270b01, 0x0906011d26100e01, 0x0a000a251e050f01, 0x0c000a271e050f01, 0x00061d0428101701,
+	0x030504092c101701, 0x080601172c101701, 0x000616051a052c01, 0x0c01000f23220b04, 0x0006170629071404, 0x0204010a29101404,
+	0x0004011c29101404, 0x0001091d29101404, 0x0115070d04241d04, 0x06000e0c1c102605, 0x030600111c102605, 0x000c1a061a010006,
+	0x02020b052c100006, 0x0100140c2c100006, 0x0a0f101e0b010507, 0x080c001e2c0e0507, 0x0a0f10000c240507, 0x00011a0614011707,
+	0x09010d0627011707, 0x0102210b04071a07, 0x000a0c0304091a07, 0x00050c0504091a07, 0x0009051b040b1a07, 0x0001042c0b011b07,
+	0x000104230b012207, 0x0009040606102307, 0x000701200b102607, 0x01000e1f0d102607, 0x071306052800100a, 0x020b06052c00100a,
+	0x010514092c00100a, 0x000612282105100a, 0x0100061c2910100a, 0x000306282011100a, 0x0002202c0208100e, 0x130600052713100e,
+	0x030400061c17100e, 0x0006011d1c17100e, 0x00090628041c100e, 0x050009240222100e, 0x0100061c1422100e, 0x030400170926100e,
+	0x030400061426100e, 0x0006011d1426100e, 0x000603011b0b1e0f, 0x01000d0f221f0510, 0x01000a0d231f0510, 0x0306001e152c0510,
+	0x00021a091a020b13, 0x00011a0606011c13, 0x0001240607011c13, 0x0306000310262213, 0x01000a0a1e052613, 0x03040006100b2613,
+	0x0006011d100b2613, 0x08060003101d2613, 0x00090b051c010816, 0x00060d0110031017, 0x0806002410031017, 0x0106070d27031017,
+	0x0806001727031017, 0x0906000e041d1017, 0x0d0615011c01001e, 0x070d06021c01001e, 0x0708061f0410001e, 0x05011d0c0610001e,
+	0x0307040d0810001e, 0x0400200f0e10001e, 0x0601131d0e10001e, 0x030504091210001e, 0x080601171210001e, 0x0d0600140c10051e,
+	0x080600132410051e, 0x00090b051801081e, 0x030400130d10081e, 0x0c01001b04070f1e, 0x01000a0a1e05121e, 0x03040006100b121e,
+	0x0006011d100b121e, 0x08060003101d121e, 0x0a0b0600030b191e, 0x0204010a030b191e, 0x03040008110b191e, 0x050c010e1b060500,
+	0x051901151b060500, 0x0c001c0f220e0500, 0x0c000a1c230e0500, 0x0c000d0f22190500, 0x0c000a0d23190500, 0x0c000a0d1e1b0500,
+	0x010906171e070600, 0x0201121d0d100600, 0x080c230105070800, 0x020104020d210900, 0x0105100905101d00, 0x0806021a05101d00,
+	0x020a09020d101d00, 0x02000e020d101d00, 0x0206071827100a01, 0x0200180f22170b01, 0x02000a1823170b01, 0x01030f051b270b01,
+	0x050116050d080f01, 0x0501160527090f01, 0x0c000d0f22052001, 0x0c000a0d23052001, 0x00020d1815100006, 0x0500160502090f06,
+	0x000f030107192307, 0x0306001b27101309, 0x0003061f27101309, 0x11011e091c051509, 0x00000a281e051509, 0x01141e092d051509,
+	0x0100031e10261509, 0x020017052207010a, 0x011000031e07100a, 0x000306282013100a, 0x0002202a0605100e, 0x0002202c0408100e,
+	0x020d001e0508100e, 0x0516001e0508100e, 0x050009240422100e, 0x0100061a0522100e, 0x000205120722100e, 0x0e0002220722100e,
+	0x000209181226100e, 0x0200180b2c10080f, 0x0009002319070410, 0x0009002322190510, 0x01010a050d190810, 0x01010a0527190910,
+	0x0001051b06270b11, 0x0007030627071c13, 0x0118010106160514, 0x001601091b1a0514, 0x0200270509010816, 0x0110011c07010018,
+	0x011306021c010018, 0x0106040c26010018, 0x0806011c26010018, 0x0204170027010018, 0x0600130b2a100518, 0x0f06000e2c100518,
+	0x0107000e2c100518, 0x01011f040d010818, 0x110f0600030b1918, 0x01110700030b1918, 0x00010d22060b1918, 0x00070123060b1918,
+	0x01000604010e2718, 0x0006070227091019, 0x01100006100b021a, 0x030600121026021a, 0x080600141026021a, 0x0a0f122311070500,
+	0x15061506150a0500, 0x0201041d060d0500, 0x130606241a110500, 0x1306180625110500, 0x0118010318150500, 0x0c000d0f22170500,
+	0x0c000a0d23170500, 0x0006130d1e1d0500, 0x021116011a010600, 0x12111f011a010600, 0x020203200d100600, 0x02011b030d180900,
+	0x020103040d1d0900, 0x020104040d210900, 0x0a0f230307010e00, 0x050f230507010e00, 0x1306030111091a00, 0x020a09040d101d00,
+	0x02000e040d101d00, 0x020104060d011e00, 0x0806011d10102600, 0x1506150504130b01, 0x0a06221501160b01, 0x0006171516052c01,
+	0x0115070904241d04, 0x03000e0d21102605, 0x01280d0423010006, 0x0307030d28100006, 0x01001d1128100006, 0x0201011d0b101106,
+	0x0300030d27101106, 0x02011b04000b1906, 0x01070318000b1906, 0x00001b0d1b230507, 0x0901090627011707, 0x0a0f101e0b010508,
+	0x01000e1d09102608, 0x010006041d052809, 0x01000604011e2809, 0x020204200600100a, 0x0f06011d2a01100a, 0x0107011d2a01100a,
+	0x020d00002304100a, 0x051600002304100a, 0x050109212304100a, 0x010018140605100a, 0x000612281c05100a, 0x020d001e0507100a,
+	0x0516001e0507100a, 0x0100061c240f100a, 0x010003180910100a, 0x05000603241a100a, 0x00050903241a100a, 0x020d011d0810000d,
+	0x0516011d0810000d, 0x01100006101b040d, 0x00060b050623040d, 0x000606170823040d, 0x020d00002310050d, 0x051600002310050d,
+	0x050109212310050d, 0x020105211610070d, 0x020716031a00010e, 0x12071f031a00010e, 0x0601121d1d00100e, 0x000a12030722100e,
+	0x0100061c1022100e, 0x000303011b0b1e0f, 0x01001609081f0510, 0x0100090f221f0510, 0x08060009231f0510, 0x01000a09231f0510,
+	0x03000d08152a0510, 0x020116061a050711, 0x12011f061a050711, 0x02001b060d100212, 0x02001f060d100212, 0x0212010107011c13,
+	0x000a0b091c052613, 0x130600011e011315, 0x0200010f0b031017, 0x0200040110031017, 0x00030d0110031017, 0x0306001c10031017,
+	0x0106070927031017, 0x0306020325100018, 0x0600100b2a100518, 0x0300140b2a100518, 0x0306000310261218, 0x0006070427091019,
+	0x0d0600230e05181a, 0x000109041e04091b, 0x00011d0e0610171d, 0x0200180f0e10001e, 0x03010f1d0e10001e, 0x000a0b091c05121e,
+	0x02121a0119070500, 0x0d14280d09190500, 0x150615060f190500, 0x0d06150624190500, 0x0006130d1b1d0500, 0x0201151d0d100600,
+	0x020121030d180900, 0x1506150504170b01, 0x050116050d080c01, 0x0501160527090c01, 0x060b15052c031001, 0x0d14280d09052001,
+	0x150615060f052001, 0x0d06150624052001, 0x0403070110261e04, 0x02012104000b1906, 0x0307041b000b1906, 0x00151005040b1906,
+	0x05000d161e010507, 0x000c1c06251a0507, 0x00051d06251a0507, 0x0a011e06251a0507, 0x05012206251a0507, 0x080e001e0f230507,
+	0x0000210d1b230507, 0x00090b052b011707, 0x000a0b0304091a07, 0x00050b0504091a07, 0x000c0d0504091a07, 0x00090b051a012107,
+	0x0402071801102607, 0x02000d171e010508, 0x0404072001102608, 0x010d002109102608, 0x0306022028100109, 0x000306041b281d09,
+	0x070d06001c052809, 0x00060f281c05100a, 0x00040920240f100a, 0x0304001b0910100a, 0x000209182910100a, 0x030400062b10100a,
+	0x0006011d2b10100a, 0x000306282213100a, 0x130600022613100a, 0x01000916241a100a, 0x03040006121b100a, 0x0006011d121b100a,
+	0x13060002121e100a, 0x070d06280210000d, 0x020117050d08010d, 0x020117052709010d, 0x020009170823040d, 0x0d0600022710110d,
+	0x030400061021160d, 0x0006011d1021160d, 0x030400071026160d, 0x030400061013280d, 0x0006011d1013280d, 0x06010f1d1d00100e,
+	0x020b06050022100e, 0x010514090022100e, 0x0500091e0422100e, 0x050006200522100e, 0x000509200522100e, 0x000205150722100e,
+	0x000409201022100e, 0x000209181422100e, 0x020009021a22100e, 0x0200041e0c10080f, 0x0201011d0f10080f, 0x00060d011e190510,
+	0x080600241e190510, 0x01010d050d190810, 0x01010d0527190910, 0x000003210b181013, 0x020004011e160514, 0x00030d011e160514,
+	0x0306001c1e160514, 0x00031a06251a0514, 0x0306001e181e0514, 0x010109050d160814, 0x0101090527160914, 0x0c01040627060b15,
+	0x00011a0606011315, 0x00011a0612010816, 0x000306280a0f1017, 0x00060d1005100018, 0x0200041405100018, 0x00030d1405100018,
+	0x0100042505100018, 0x0606060228100018, 0x0906000e26100518, 0x00060505280b1918, 0x0306060e25011019, 0x040607011026021a,
+	0x030600151026021a, 0x020017050a04091b, 0x000109041b04091b, 0x0203010a02160b1c, 0x070301011e160b1c, 0x0100041a0510001e,
+	0x080602091b070400, 0x0200150f1e0d0500, 0x0118010312150500, 0x011001031e160500, 0x1008060a1e160500, 0x08060209221b0500,
+	0x09060611181d0500, 0x01100301161d0900, 0x0a0f230307010b00, 0x050f230507010b00, 0x00060d1005101d00, 0x0200041405101d00,
+	0x00030d1405101d00, 0x0100042505101d00, 0x01000d1607101d00, 0x07010c2307101d00, 0x0701280d08101d00, 0x01000d1108101d00,
+	0x0703012809101d00, 0x0706010d1d101d00, 0x0a06150011220b04, 0x0c01000f1f220b04, 0x0004280014081a05, 0x0004110025081a05,
+	0x00000d0610101d05, 0x00000d0614101d05, 0x040207182c100006, 0x011a01151d010507, 0x0a280d001d120507, 0x000928060b1a0507,
+	0x0a012103101a0507, 0x05012105101a0507, 0x0a0c0d0019240507, 0x0a280d0301011707, 0x05280d0501011707, 0x00280d0517011707,
+	0x000a0c032b011707, 0x00050c052b011707, 0x050c010b01101d07, 0x0207000412101d07, 0x00000d0316101d07, 0x0007010c23101d07,
+	0x000a0c031a012107, 0x00050c051a012107, 0x0110010d01101d08, 0x000701280d101d08, 0x00000d0311101d08, 0x00070106101d2809,
+	0x050005291a07010a, 0x000a03062a15010a, 0x000505062a15010a, 0x05180705011b010a, 0x000a0319061b010a, 0x00050519061b010a,
+	0x00061a05111b010a, 0x00061a05151e010a, 0x0100031e240f100a, 0x130600042613100a, 0x010d0007241a100a, 0x13060004121e100a,
+	0x020d00031b10000d, 0x051600031b10000d, 0x000613050623040d, 0x000615052313010e, 0x00031a051325010e, 0x000a03061c25010e,
+	0x000505061c25010e, 0x0a0615030126010e, 0x050615050126010e, 0x000615051726010e, 0x000a03061926010e, 0x000505061926010e,
+	0x050c01062101100e, 0x0106001d2112100e, 0x0100031e1022100e, 0x0200000f0d230510, 0x0106001d21100a11, 0x0a01210303061015,
+	0x0501210503061015, 0x0506250501010816, 0x000a0b031c010816, 0x00050b051c010816, 0x000c0d051c010816, 0x0606060428100018,
+	0x0009000f2c051218, 0x0203010a04160b1c, 0x0903010605160b1c, 0x00070106101d0d1d, 0x000a0b031801081e, 0x00050b051801081e,
+	0x000c0d051801081e, 0x0500160504000f1e, 0x050c012119060500, 0x02121a0113070500, 0x05021326090e0500, 0x0c06160121120500,
+	0x03100d0916150500, 0x0504231609170500, 0x0504160025170500, 0x03180f0626170500, 0x0102160908190500, 0x0806020923190500,
+	0x080602091e1b0500, 0x05041600211c0500, 0x0606061a171d0500, 0x021715060d010600, 0x0111060e1e180900, 0x0111011d1e180900,
+	0x000e1505210b0801, 0x01071805061c0b01, 0x0a15071a0b040c01, 0x0110001110260f01, 0x00061d15050b1201, 0x1000280d03101301,
+	0x0102160908052001, 0x0806020923052001, 0x1000280d00101404, 0x0019060e14250905, 0x0019011d14250905, 0x040a031a2c100006,
+	0x01070018050b1906, 0x00001714180b0407, 0x00072801211a0507, 0x0212010116011707, 0x000111062b011707, 0x000111061a012107,
+	0x050f15280b010508, 0x050f28061b010508, 0x0306021b28100109, 0x000617062b10010a, 0x00061706121b010a, 0x0c0100232304100a,
+	0x02001d010510100a, 0x0c15071c0b04010d, 0x0c0100232310050d, 0x000617060121160d, 0x00030617150b1e0d, 0x000617060113280d,
+	0x06170f061d00010e, 0x0602041e1d00100e, 0x0110001e1001100e, 0x011000110026100e, 0x021701060f01080f, 0x0200280d0905180f,
+	0x0006190b1d1e0510, 0x03180106261f0510, 0x0110000d1e100111, 0x0006170603270b11, 0x010200091e180b12, 0x01071f01161d0b12,
+	0x000703060d181013, 0x011507090b042213, 0x0200170111160514, 0x0016020802180b15, 0x0004270018011315, 0x0007010306091e16,
+	0x02000d0110031017, 0x0602010b2a100518, 0x0102210b02100818, 0x0115070d0b041218, 0x00061205280b1918, 0x000610052a0b1918,
+	0x000314052a0b1918, 0x0102210b03061019, 0x030602001026021a, 0x0304011b1101091b, 0x000106141804091b, 0x0a03010118160b1c,
+	0x0103010521160b1c, 0x00071901121a0b1c, 0x02011b060d070400, 0x0201221b060d0500, 0x0105160908190500, 0x0806050923190500,
+	0x080605091e1b0500, 0x050116220b080c01, 0x0106152c0b101001, 0x0105160908052001, 0x0806050923052001, 0x0004280714071a05,
+	0x0004110725071a05, 0x00020e182c100006, 0x040210182c100006, 0x0504201601070407, 0x0500190c23070407, 0x0504201622010507,
+	0x050019220c230507, 0x000c0d2204071a07, 0x050119000b0c2307, 0x050019030f072507, 0x000a031a01102607, 0x0204201701070408,
+	0x000f102301070408, 0x050019280d070408, 0x0204201722010508, 0x000f102322010508, 0x05001922280d0508, 0x000c031c01102608,
+	0x0306051b28100109, 0x000602251d101409, 0x0500190607042809, 0x0100061b07042809, 0x0500192206052809, 0x010006221b052809,
+	0x010011251f07100a, 0x0100172c1f07100a, 0x00040820240f100a, 0x000208182510100a, 0x000306192510100a, 0x000208182910100a,
+	0x01000816241a100a, 0x020117220b08010d, 0x020008170823040d, 0x000619260704160d, 0x000619222605160d, 0x0605041e1d00100e,
+	0x0500081e0422100e, 0x000408201022100e, 0x000208181422100e, 0x020008021a22100e, 0x0406200119070410, 0x0406200122190510,
+	0x01010d220b190810, 0x00010b1907082310, 0x02001c060d100212, 0x01071f02161d0b12, 0x00030618161d0b12, 0x0003030110262213,
+	0x0403200116070414, 0x0403200122160514, 0x010109220b160814, 0x0016050802180b15, 0x0605010b2a100518, 0x0006010f2a100518,
+	0x0105210b02100818, 0x0001210f02100818, 0x0006030110261218, 0x0105210b03061019, 0x0001210f03061019, 0x030605001026021a,
+	0x0a03010218160b1c, 0x0703040122160b1c, 0x00071902121a0b1c, 0x0500190607040d1d, 0x0500192206050d1d, 0x0015070316070f1e,
+	0x02001d1a100e0500, 0x010906171d070600, 0x020a0205170e0900, 0x0102160a27060b01, 0x02070203060f1d01, 0x00032502041b1d01,
+	0x0003021b042c1d01, 0x021102011d092401, 0x0016011b07140805, 0x0004270014081a05, 0x0001140d1a0b0407, 0x050000221a0b0407,
+	0x000927060b1a0507, 0x000a2303101a0507, 0x00052305101a0507, 0x050101151b1f0507, 0x001101151b1f0507, 0x000114022b011707,
+	0x000114021a012107, 0x0500011c1f012207, 0x000d011c1f012207, 0x01000e1c0d102607, 0x02121a0100130508, 0x00031a0522011409,
+	0x0000231907041509, 0x00021a091a051509, 0x0000231922051509, 0x00020f091c052809, 0x000706151c052809, 0x050014091d052c09,
+	0x000d14091d052c09, 0x110e1e091c05010d, 0x0e141e092d05010d, 0x0e00031e1026010d, 0x000114280410070d, 0x01000926101d160d,
+	0x00011d2c1108100e, 0x0200021b0f10080f, 0x0200021f0f10080f, 0x000a1c091c050d0f, 0x000a0b1c0905180f, 0x0200021e08100e12,
+	0x00021c0107160814, 0x00020118071e0814, 0x0003020516090a14, 0x00020a06021e0b15, 0x00100010021e0b15, 0x000a230303061015,
+	0x0005230503061015, 0x05000805031e1015, 0x07031a0127010018, 0x0e00210b02100818, 0x0003001a0b041218, 0x02001a030b091218,
+	0x00071903010e2718, 0x0e00210b03061019, 0x000023160605181a, 0x000705041c0f0b1c, 0x000a05091c0f0b1c, 0x0903020600160b1c,
+	0x0203020a01160b1c, 0x0003020513160b1c, 0x0a03020018160b1c, 0x03000e021e160b1c, 0x0103020021160b1c, 0x0302010222160b1c,
+	0x0003021625160b1c, 0x00060d1a1e100500, 0x130606241a120500, 0x1306180625120500, 0x0a00090f22190500, 0x0a000a0923190500,
+	0x0a000a091e1b0500, 0x000f180d091c0500, 0x0201171d0d100600, 0x020a0405170e0900, 0x1306030112091a00, 0x02070403060f1d01,
+	0x00032504041b1d01, 0x0003041b042c1d01, 0x0a00090f22052001, 0x0a000a0923052001, 0x021104011d092401, 0x0015061519080b04,
+	0x0010000e25101404, 0x000f1518010b0407, 0x010d18061d010507, 0x0118010c1d010507, 0x00040a1b20230507, 0x000f050107192307,
+	0x0006020519091209, 0x000906282005100a, 0x0d060005240f100a, 0x110c1e091c05010d, 0x0c141e092d05010d, 0x0c00031e1026010d,
+	0x06000f1a0823040d, 0x000703231c25010e, 0x000703231926010e, 0x00011d2c1308100e, 0x130601130022100e, 0x0109061c0022100e,
+	0x000205170722100e, 0x0007011b0722100e, 0x0501001e0722100e, 0x0d0600051022100e, 0x0200041b0f10080f, 0x0200041f0f10080f,
+	0x00021a0e0905180f, 0x0006020519090a10, 0x0d06010116052c11, 0x03000d061c100212, 0x0200041e08100e12, 0x0007050627071c13,
+	0x0003040516090a14, 0x0015060802180b15, 0x0306001b10031017, 0x00060d0218100018, 0x0c00210b02100818, 0x0c00210b03061019,
+	0x030600171026021a, 0x0903040600160b1c, 0x0203040a01160b1c, 0x0003040513160b1c, 0x0a03040018160b1c, 0x03000e041e160b1c,
+	0x0103040021160b1c, 0x0302010422160b1c, 0x0003041625160b1c, 0x0301130d0810001e, 0x03000d061110051e, 0x090615061b010400,
+	0x140e280d09190500, 0x1507280d16190500, 0x0406201516190500, 0x0608150622190500, 0x0a00090f22190500, 0x0a000a0923190500,
+	0x0406071523190500, 0x060e150624190500, 0x0a000a091e1b0500, 0x040607151e1b0500, 0x0006051a171d0500, 0x060819061b1d0500,
+	0x020205200d100600, 0x01181105260e0900, 0x0200250318180900, 0x0107011c1e180900, 0x020105040d1d0900, 0x020a1a0507010e00,
+	0x0512000d04071a00, 0x02040f06081c0b01, 0x0200030f1e1c0b01, 0x010306041f270b01, 0x01111a091c050c01, 0x01141a092d050c01,
+	0x0100031a10260c01, 0x060b15052a031001, 0x010615050d141001, 0x01280d051b001201, 0x140e280d09052001, 0x1507280d16052001,
+	0x0406201516052001, 0x0608150622052001, 0x0a00090f22052001, 0x0a000a0923052001, 0x0406071523052001, 0x060e150624052001,
+	0x0006150525170b04, 0x010e18011a010006, 0x01280d041f010006, 0x0307040a28100006, 0x0307050d28100006, 0x0304000a27101106,
+	0x0300050d27101106, 0x01070518000b1906, 0x01001105250b1906, 0x00000d1e14180507, 0x010b1f05101a0507, 0x01011a0619240507,
+	0x00280d0516011707, 0x000113052b011707, 0x00010f062b011707, 0x000113051a012107, 0x00010f061a012107, 0x02000018150b0408,
+	0x01000e2109102608, 0x0006040519091209, 0x00000a261e051509, 0x01011f1d1506100a, 0x01011f1d1107100a, 0x010005180910100a,
+	0x000306281f10100a, 0x0306001b2b10100a, 0x0003061f2b10100a, 0x05000605241a100a, 0x00050905241a100a, 0x01000f07241a100a,
+	0x00020820041b100a, 0x0306001b121b100a, 0x0003061f121b100a, 0x01011f1d1710070d, 0x01011f1d1210080d, 0x0003061c0b1a160d,
+	0x0306001b1021160d, 0x0003061f1021160d, 0x0306001b1013280d, 0x0003061f1013280d, 0x000615051626010e, 0x060202201d00100e,
+	0x010208201e00100e, 0x0105091e2101100e, 0x0200141e0508100e, 0x0100251e0508100e, 0x0103061a0022100e, 0x000a12050722100e,
+	0x080600221e190510, 0x00062515001f0510, 0x0018280d081f0510, 0x00052610041c0910, 0x0006040519090a10, 0x0100091e101d0c11,
+	0x0200071e09100212, 0x08061404000e1d12, 0x0006150524031013, 0x000600150b042213, 0x00061505250b0514, 0x070d0600021e0b15,
+	0x010b1f0503061015, 0x050c1b0101010816, 0x0005080e040b1e16, 0x020701030e160117, 0x0106040c28010018, 0x0806011c28010018,
+	0x00060d0418100018, 0x0306020525100018, 0x0603060a29100018, 0x0806011329100018, 0x0306001826100518, 0x01061f0e02100818,
+	0x000306171c0b0f18, 0x0306000510261218, 0x0801050129091518, 0x01061f0e03061019, 0x000602280910171a, 0x0200030e1815091b,
+	0x020d011d0b100600, 0x0516011d0b100600, 0x0201111d0d100600, 0x020d011d06100e01, 0x0516011d06100e01, 0x02070403060c1d01,
+	0x0012070615052c01, 0x0203010a27180b04, 0x0203010a1b220b04, 0x0217010608071404, 0x02070103060d1d04, 0x0200170d04210805,
+	0x020d011d0f100006, 0x0516011d0f100006, 0x020c050d2c100006, 0x00020c182c100006, 0x050a1e160b010507, 0x0a280d0017150507,
+	0x0801190624150507, 0x011e0115181a0507, 0x0a0e0a001b230507, 0x050a16000c240507, 0x0100110b27101b07, 0x020a1e170b010508,
+	0x020d011d01100b08, 0x0516011d01100b08, 0x020d011d06100109, 0x0516011d06100109, 0x0c0601001d101409, 0x01001e0f18052809,
+	0x0203050f2c00100a, 0x050209182c00100a, 0x020d00092304100a, 0x051600092304100a, 0x050006282304100a, 0x000509282304100a,
+	0x000f06282005100a, 0x010007282005100a, 0x020d011d0007100a, 0x0516011d0007100a, 0x0a0002251b07100a, 0x0c0002271b07100a,
+	0x02011c010810100a, 0x0002052c0614100a, 0x01071e030623040d, 0x020d00092310050d, 0x051600092310050d, 0x050006282310050d,
+	0x000509282310050d, 0x020d011d0110070d, 0x0516011d0110070d, 0x000205281610070d, 0x0106021c1d00100e, 0x060204201d00100e,
+	0x020d011d0008100e, 0x0516011d0008100e, 0x0002052c0611100e, 0x010f061c0022100e, 0x0101071c0022100e, 0x000205150622100e,
+	0x000205110722100e, 0x020305011226100e, 0x0200041b0c10080f, 0x0200041f0c10080f, 0x0a061e010b190510, 0x0201011d08100e12,
+	0x0106001c10260f13, 0x0a031e010b160514, 0x0a061a000a1e0514, 0x0517000802180b15, 0x07130600021e0b15, 0x0506230501010816,
+	0x00050b03060b1e16, 0x00000f03060b1e16, 0x030600111026021a, 0x000604280910171a, 0x030600231005181a, 0x0a03010117160b1c,
+	0x0302020122160b1c, 0x0005061c0605181d, 0x0a030f00030b191e, 0x01141518090a0500, 0x03180f0624170500, 0x00060513181d0500,
+	0x01100501161d0900, 0x1506150619040b01, 0x150606151e040b01, 0x011511061a070b01, 0x0304141b09130b01, 0x0114031809170b01,
+	0x01051805061c0b01, 0x0206071810260c01, 0x1506150619050f01, 0x150606151e050f01, 0x01280d0517091101, 0x150615060d011301,
+	0x1506150603071301, 0x0115110607071a01, 0x0314150d09052c01, 0x0114001809170b04, 0x1506150600071404, 0x0106070910261e04,
+	0x011518011c010006, 0x040212182c100006, 0x01050018050b1906, 0x00011205250b1906, 0x0015061418010407, 0x010016091e120507,
+	0x00042803211a0507, 0x0501160501090a07, 0x0115110600071707, 0x0300030d12102607, 0x0517001e19090508, 0x0500181e28090508,
+	0x0201170501090a08, 0x0103061f28100109, 0x0106010519091209, 0x1306000510261509, 0x010208182800100a, 0x010306192800100a,
+	0x010a091a2c00100a, 0x010306282001100a, 0x010018150605100a, 0x010601281c05100a, 0x010006282005100a, 0x0a0004251b07100a,
+	0x0c0004271b07100a, 0x011506001f07100a, 0x0100051e240f100a, 0x00010911241a100a, 0x020d00051b10000d, 0x051600051b10000d,
+	0x040607201026010d, 0x000109281d10110d, 0x0d0600231c05160d, 0x050109240122100e, 0x0100051e1022100e, 0x1506150600050d0f,
+	0x0016140e091f0510, 0x03180106241f0510, 0x0300181e0d280510, 0x0106010519090a10, 0x0001052506180b12, 0x000003220b181013,
+	0x00011b0607011c13, 0x01140018090b0514, 0x0f032306001a0514, 0x0f031806001d0514, 0x03140d09011d0514, 0x0103010516090a14,
+	0x0001220606011315, 0x0001220612010816, 0x0004030306091e16, 0x0806001b10031017, 0x0b06011c28010018, 0x0106070d1026021a,
+	0x080600171026021a, 0x000109280f10171a, 0x000106171804091b, 0x03041409010f0b1c, 0x0103010513160b1c, 0x0302040122160b1c,
+	0x050716060507001e, 0x0509062519060500, 0x0906160625120500, 0x0606051a171d0500, 0x09060617181d0500, 0x021715050d010600,
+	0x020d011e0b100600, 0x0516011e0b100600, 0x0201151b0d100600, 0x0201111e0d100600, 0x0201151f0d100600, 0x0111050e1e180900,
+	0x010d011c1e180900, 0x011101201e180900, 0x011617011e1d0900, 0x010017041e1d0900, 0x0a16250105210900, 0x0c16270105210900,
+	0x000a250405210900, 0x000c270405210900, 0x0116012613210900, 0x0100042613210900, 0x011601121e210900, 0x010004121e210900,
+	0x0006191005101d00, 0x0003191405101d00, 0x0100191607101d00, 0x010f0c2307101d00, 0x010f280d08101d00, 0x0100191108101d00,
+	0x03010f2809101d00, 0x06010f0d1d101d00, 0x020d011e06100e01, 0x0516011e06100e01, 0x0500130319092a01, 0x000401281f101404,
+	0x0014000e25101404, 0x0004011f2b101404, 0x0006001504241d04, 0x0019050e14250905, 0x0019012014250905, 0x0016011521250905,
+	0x0000041521250905, 0x0016010f21270905, 0x0000040f21270905, 0x01000a2114071a05, 0x0506000125081a05, 0x0004011c140b1a05,
+	0x0000190610101d05, 0x0000190614101d05, 0x0004011f14102105, 0x080c1c0124010006, 0x020d011e0f100006, 0x0516011e0f100006,
+	0x01010c1815100006, 0x040a051a2c100006, 0x0301000d27101106, 0x011a01161d010507, 0x000111052b011707, 0x0000190316101d07,
+	0x00010f0c23101d07, 0x000111051a012107, 0x000f101f010b0408, 0x051516012a010508, 0x050015042a010508, 0x001620012a130508,
+	0x000020042a130508, 0x020d011e01100b08, 0x0516011e01100b08, 0x00010f280d101d08, 0x0000190311101d08, 0x020d011e06100109,
+	0x0516011e06100109, 0x0c01001b07042809, 0x01001e101a052809, 0x0c0100221b052809, 0x00010f06101d2809, 0x000617052b10010a,
+	0x00061705121b010a, 0x020021041700100a, 0x010906172800100a, 0x010a081a2800100a, 0x090209182c00100a, 0x000909282304100a,
+	0x020d011e0007100a, 0x0516011e0007100a, 0x0a0101251b07100a, 0x0c0101271b07100a, 0x010100180910100a, 0x010006281f10100a,
+	0x0006011b2b10100a, 0x0100061f2b10100a, 0x130601012613100a, 0x05010600241a100a, 0x0006011b121b100a, 0x0100061f121b100a,
+	0x13060101121e100a, 0x000909282310050d, 0x020d011e0110070d, 0x0516011e0110070d, 0x0100061c0b1a160d, 0x000617050121160d,
+	0x0006011b1021160d, 0x0100061f1021160d, 0x000617050113280d, 0x0006011b1013280d, 0x0100061f1013280d, 0x06170f051d00010e,
+	0x06010f1b1d00100e, 0x01060f1f1d00100e, 0x020d011e0008100e, 0x0516011e0008100e, 0x021701050f01080f, 0x0201011b0f10080f,
+	0x0201011f0f10080f, 0x001606170005180f, 0x0006170503270b11, 0x0201011e08100e12, 0x0006011c10260f13, 0x000703050d181013,
+	0x0016030121092613, 0x0000030421092613, 0x00161f0113010816, 0x0116210114060117, 0x0801220114060117, 0x0001210414060117,
+	0x0101210b14061017, 0x00040128040f1017, 0x02010d1408100018, 0x01010d2508100018, 0x0806012418100018, 0x0601120e28100018,
+	0x0501060c29100018, 0x010f060d29100018, 0x0101070d29100018, 0x0806011129100018, 0x0601100e2a100018, 0x0301140e2a100018,
+	0x010006171c0b0f18, 0x001606001a051218, 0x0306010010261218, 0x01061200280b1918, 0x010610002a0b1918, 0x010314002a0b1918,
+	0x0219010107120119, 0x08011b0107120119, 0x0806011325011019, 0x0806011127011019, 0x011621011501081a, 0x080122011501081a,
+	0x000121041501081a, 0x0101210b1510081a, 0x010601280910171a, 0x011416011201091b, 0x010014041201091b, 0x000c1c031a01091b,
+	0x000105141804091b, 0x03010e011e160b1c, 0x0103011625160b1c, 0x00010f06101d0d1d, 0x0009061c0605181d, 0x01010d1a0810001e,
+	0x0301120d0910001e, 0x001603012109121e, 0x000003042109121e, 0x1008060b1e160500, 0x020d021e0b100600, 0x0516021e0b100600,
+	0x0202151b0d100600, 0x0202111e0d100600, 0x03100d0315040800, 0x05022216030e0900, 0x03100d0315140900, 0x020f0c2307101d00,
+	0x020f280d08101d00, 0x03020f2809101d00, 0x06020f0d1d101d00, 0x020d021e06100e01, 0x0516021e06100e01, 0x02280d0416010006,
+	0x020d021e0f100006, 0x0516021e0f100006, 0x01020c1815100006, 0x04020c182c100006, 0x0302000d27101106, 0x0502191611010507,
+	0x00020b042a160507, 0x00021a0b14180507, 0x000212040d230507, 0x00020f0c23101d07, 0x0a0f100b010b0408, 0x0202191711010508,
+	0x02020b042a010508, 0x00020b042a110508, 0x020d021e01100b08, 0x0516021e01100b08, 0x00020f280d101d08, 0x020d021e06100109,
+	0x0516021e06100109, 0x0603061f28100109, 0x101306001a051509, 0x021606001a051509, 0x020613001a052809, 0x00020f06101d2809,
+	0x020613042a01010a, 0x020121041506010a, 0x020121041107010a, 0x020204012307010a, 0x050204270108010a, 0x020601042a13010a,
+	0x060208182800100a, 0x060306192800100a, 0x060306282001100a, 0x060601281c05100a, 0x060006282005100a, 0x020d021e0007100a,
+	0x0516021e0007100a, 0x0a0201251b07100a, 0x0c0201271b07100a, 0x010200180910100a, 0x0006021b2b10100a, 0x130602012613100a,
+	0x05020600241a100a, 0x0006021b121b100a, 0x13060201121e100a, 0x020b06042a05010d, 0x031004170408010d, 0x020121041701070d,
+	0x020d021e0110070d, 0x0516021e0110070d, 0x020121041201080d, 0x0006021b1021160d, 0x0006021b1013280d, 0x020615041d00010e,
+	0x020301041326010e, 0x06020f1b1d00100e, 0x020d021e0008100e, 0x0516021e0008100e, 0x020401280414100e, 0x020109042c01080f,
+	0x0202011b0f10080f, 0x100806190005180f, 0x0206190111190510, 0x03100d0315010910, 0x0202011e08100e12, 0x0006141c0b040f13,
+	0x0006021c10260f13, 0x0203190111160514, 0x02040c00021e0b15, 0x00040f03060b1e16, 0x0102210b14061017, 0x0806022418100018,
+	0x0602120e28100018, 0x0502060c29100018, 0x0806021129100018, 0x0602100e2a100018, 0x0302140e2a100018, 0x030614000b041218,
+	0x0306020010261218, 0x0806021325011019, 0x0806021127011019, 0x0102210b1510081a, 0x02100c031a01091b, 0x0002031a1009091b,
+	0x02010d031a13091b, 0x0203010b04160b1c, 0x03020e011e160b1c, 0x00020f06101d0d1d, 0x0302120d0910001e, 0x0012220619070500,
+	0x001206221e070500, 0x020114040b010600, 0x02111f01161d0900, 0x010311051b270b01, 0x0201140406010e01, 0x0002211b04061d01,
+	0x0403001e10101d05, 0x020114040f010006, 0x0202050b2c100006, 0x02140806001a0507, 0x02140106121a0507, 0x02000b1d21090508,
+	0x0201140401010b08, 0x0201140406010109, 0x020114040007010a, 0x020104011f07010a, 0x02001f0f2401100a, 0x02001e0f2a01100a,
+	0x020009282304100a, 0x0200001e240f100a, 0x050209211b10000d, 0x0214000f1505010d, 0x02000a281e05010d, 0x020009282310050d,
+	0x020114040101070d, 0x0214000f0005160d, 0x020114040008010e, 0x0003051e1a10010e, 0x02011d2c0108100e, 0x020205000722100e,
+	0x0200001e1022100e, 0x02071f00161d0b12, 0x0216000802180b15, 0x0200140206011315, 0x0200140212010816, 0x0200210b14061017,
+	0x0200210b1510081a, 0x0002051b1101091b, 0x0200061c0605181d, 0x0200170f0a180500, 0x0200100f0f180500, 0x0503062519180500,
+	0x140e270d09190500, 0x1507270d16190500, 0x0200120f0a1a0500, 0x02071409171a0500, 0x000f1a0d091c0500, 0x0116011b13070800,
+	0x01181205260e0900, 0x04111f01161d0900, 0x0104270013081a00, 0x0a03050309091a00, 0x0503050509091a00, 0x0202180927070801,
+	0x010313051b270b01, 0x0218090526091101, 0x01270d051b001201, 0x0200091b2a071201, 0x00061c051b011301, 0x0004211b04061d01,
+	0x140e270d09052001, 0x1507270d16052001, 0x000614051a052c01, 0x01270d041f010006, 0x0101140e28100006, 0x01001d1028100006,
+	0x010a120b2c100006, 0x01001205250b1906, 0x0802230d01070407, 0x000f151a010b0407, 0x010d1a061d010507, 0x011a010c1d010507,
+	0x0802230d22010507, 0x00270d0516011707, 0x01000f0c23101d07, 0x010f000107192307, 0x020a170501010e08, 0x01000f280d101d08,
+	0x01000f06101d2809, 0x04001f0f2401100a, 0x04001e0f2a01100a, 0x170600162304100a, 0x010700162304100a, 0x080600272304100a,
+	0x001106282005100a, 0x0400001e240f100a, 0x170600021f10100a, 0x010700021f10100a, 0x01050900241a100a, 0x01000911241a100a,
+	0x0601011d111b100a, 0x0600041e111b100a, 0x0601011d151e100a, 0x0600041e151e100a, 0x020b17050801000d, 0x170601131b10000d,
+	0x010701131b10000d, 0x050409211b10000d, 0x020013170704010d, 0x020b17050805010d, 0x020013172205010d, 0x170600162310050d,
+	0x010700162310050d, 0x080600272310050d, 0x010009281d10110d, 0x020017031c09160d, 0x020104011807010e, 0x0102202c0108100e,
+	0x0111061c0022100e, 0x010a12000722100e, 0x0400001e1022100e, 0x060002201122100e, 0x000617062405180f, 0x0018270d081f0510,
+	0x0207001d18050c11, 0x0100052506180b12, 0x04071f00161d0b12, 0x0107000627071c13, 0x08000d2306052013, 0x060b0105031e1015,
+	0x000600051e011315, 0x020b000509010816, 0x0207000710031017, 0x0400210b14061017, 0x0105090c29100018, 0x0109001529100018,
+	0x0606060126100518, 0x0600120e26100518, 0x0600120b2a100518, 0x000606241a051218, 0x01000d0610011019, 0x0106070127091019,
+	0x0600150b031e1019, 0x0606010e031e1019, 0x0400210b1510081a, 0x0c0601000a10171a, 0x010009280f10171a, 0x0004051b1101091b,
+	0x01071900121a0b1c, 0x01000f06101d0d1d, 0x0a061211181d0500, 0x0a0603181d010e00, 0x050605181d010e00, 0x0402180927070801,
+	0x010506041f270b01, 0x0418090526091101, 0x0400091b2a071201, 0x0406002614101d05, 0x0502050b2c100006, 0x050009282304100a,
+	0x000611281c05100a, 0x000506281f10100a, 0x0506001b2b10100a, 0x0005061f2b10100a, 0x0506001b121b100a, 0x0005061f121b100a,
+	0x05000a281e05010d, 0x050009282310050d, 0x0005061c0b1a160d, 0x0506001b1021160d, 0x0005061f1021160d, 0x0506001b1013280d,
+	0x0005061f1013280d, 0x000605261a14010e, 0x0601111d1d00100e, 0x05011d2c0108100e, 0x0105061a0022100e, 0x050205000722100e,
+	0x0516000802180b15, 0x0d06011c28010018, 0x0605060a29100018, 0x0600160b2a100518, 0x000506171c0b0f18, 0x0a061600050f0b1c,
+	0x0500061c0605181d, 0x010f1f230b070500, 0x05110b1609170500, 0x12061501191b0500, 0x0f0b230507010b00, 0x051e160115050701,
+	0x1406150619040b01, 0x140606151e040b01, 0x011411061a070b01, 0x1206011523170b01, 0x0604150611270b01, 0x110a1a091c050c01,
+	0x0a141a092d050c01, 0x0a00031a10260c01, 0x0f07180326010e01, 0x1406150619050f01, 0x140606151e050f01, 0x140615060d011301,
+	0x1406150603071301, 0x0114110607071a01, 0x0f1007001f220b04, 0x1406150600071404, 0x1201280d15100006, 0x01280d1d16100006,
+	0x01022218000b1906, 0x001112011c0b1906, 0x00120110230b1906, 0x0014061418010407, 0x0500150d1a0b0407, 0x0207001e25180507,
+	0x05150115001a0507, 0x010b2105101a0507, 0x001d0115181a0507, 0x01220115181a0507, 0x11010a03211a0507, 0x110c0a001b1f0507,
+	0x0a011a0619240507, 0x0f10010620240507, 0x0b280d0501011707, 0x0012100127011707, 0x050015022b011707, 0x000b0c052b011707,
+	0x0114110600071707, 0x00050b1b040b1a07, 0x050015021a012107, 0x000b0c051a012107, 0x00040b0606102307, 0x0200220b18150508,
+	0x0100142806101709, 0x0207001d23051e09, 0x0515000f00052809, 0x00001d0f18052809, 0x0100220f18052809, 0x020017031c092809,
+	0x000b05062a15010a, 0x000b0519061b010a, 0x0a0209182c00100a, 0x02000e182c00100a, 0x0400200f2a01100a, 0x0601131d2a01100a,
+	0x000a09282304100a, 0x00000e282304100a, 0x000615281c05100a, 0x010401282005100a, 0x000b06282005100a, 0x0101211d1506100a,
+	0x0101211d1107100a, 0x010014281507100a, 0x011406001f07100a, 0x010028111f07100a, 0x021201002307100a, 0x02011d012307100a,
+	0x02001b042307100a, 0x02001f042307100a, 0x05011d270108100a, 0x01140009240f100a, 0x04000020240f100a, 0x020000182910100a,
+	0x0601011d2a13100a, 0x01000016241a100a, 0x0f1000230704010d, 0x110c1c091c05010d, 0x0f1000232205010d, 0x0c141c092d05010d,
+	0x0c00031c1026010d, 0x00071d030623040d, 0x010722030623040d, 0x0f1000090823040d, 0x020000170823040d, 0x020017010b23040d,
+	0x000a09282310050d, 0x00000e282310050d, 0x050015280410070d, 0x0101211d1710070d, 0x0101211d1210080d, 0x000b05061c25010e,
+	0x060b15050126010e, 0x000b05061926010e, 0x0206021c1d00100e, 0x0601151d1d00100e, 0x010220011e07100e, 0x01001e171e07100e,
+	0x0a00251e0508100e, 0x0c00271e0508100e, 0x01001e261308100e, 0x01001e121e08100e, 0x011400150022100e, 0x010b061c0022100e,
+	0x0500001e0422100e, 0x000015200522100e, 0x00011c150722100e, 0x011400091022100e, 0x040000201022100e, 0x020000181422100e,
+	0x020000021a22100e, 0x0301011d1326100e, 0x000f18022601080f, 0x0101091d2c10080f, 0x1406150600050d0f, 0x000004261e190510,
+	0x0004061906022310, 0x0011011c06180b12, 0x0206001c10260f13, 0x000622150b052213, 0x110109091c052213, 0x07280d001d052213,
+	0x011409092d052213, 0x0100030910262213, 0x010b210503061015, 0x000b0b051c010816, 0x0001240204001e16, 0x0606010e2a100518,
+	0x01000d0f2a100518, 0x0600100e2c100518, 0x0300140e2c100518, 0x0106210e02100818, 0x11010d091c051218, 0x01140d092d051218,
+	0x0100030d10261218, 0x11061000030b1918, 0x11031400030b1918, 0x0106210e03061019, 0x0207001d23050d1a, 0x000f10021b04091b,
+	0x00010c041b04091b, 0x0004061d1609091b, 0x000103041b09091b, 0x0004061d100d091b, 0x0114000f000f0b1c, 0x0004120608160b1c,
+	0x000003121e160b1c, 0x0001040802180b1c, 0x00000f1802180b1c, 0x0207001d18050d1d, 0x000a061c0605181d, 0x000b0b051801081e,
+	0x02021b060d070400, 0x02051a0513070500, 0x021d1a0119070500, 0x0114241a090a0500, 0x0202221b060d0500, 0x02141b09110d0500,
+	0x020f010317170500, 0x030a0f0125170500, 0x02091409171a0500, 0x10061501191b0500, 0x030a0f01211c0500, 0x020a27011a010600,
+	0x0205091405101d00, 0x0105092505101d00, 0x0214210409130b01, 0x02141b0409170b01, 0x1006011523170b01, 0x02280d0517091101,
+	0x0114210909052c01, 0x0006230114081a05, 0x01241a011c010006, 0x1001280d15100006, 0x00100110230b1906, 0x00021205250b1906,
+	0x0516062421010507, 0x0502160501090a07, 0x0200182116100b07, 0x0205010516011707, 0x0010100127011707, 0x02000a0412101d07,
+	0x0c000d2104101e07, 0x0217062421010508, 0x0202170501090a08, 0x0200182111100b08, 0x0703061f28100109, 0x0206010519091209,
+	0x120601001d101409, 0x0f0614040e011d09, 0x010714040e011d09, 0x0006021b07042809, 0x000602221b052809, 0x070208182800100a,
+	0x070306192800100a, 0x020a091a2c00100a, 0x070306282001100a, 0x070601281c05100a, 0x070006282005100a, 0x0c001c210507100a,
+	0x020003141e07100a, 0x010003251e07100a, 0x010021171f07100a, 0x0100142c1f07100a, 0x021001002307100a, 0x00020911241a100a,
+	0x06001321101b040d, 0x040020211310070d, 0x000601231d10110d, 0x000209281d10110d, 0x0500211e0408100e, 0x040020211008100e,
+	0x020018211408100e, 0x020021021a08100e, 0x020018210613100e, 0x020008182713100e, 0x030600192713100e, 0x030600272014100e,
+	0x050209240122100e, 0x0f0600021f26100e, 0x010700021f26100e, 0x0601062421190510, 0x02160701011f0510, 0x121f0701011f0510,
+	0x02010103171f0510, 0x030a0101251f0510, 0x0206010519090a10, 0x010008231e1c0b11, 0x0002052506180b12, 0x0301062421160514,
+	0x00280d0823160514, 0x000a270118010614, 0x0203010516090a14, 0x0c000d2106031017, 0x0209000710031017, 0x0f06000a27031017,
+	0x0107000a27031017, 0x0c00070d27031017, 0x0c00080d27031017, 0x0214011c07010018, 0x0125011c07010018, 0x1306011c15010018,
+	0x0806011c28010018, 0x02001406100b021a, 0x01002506100b021a, 0x06001021100b021a, 0x03001421100b021a, 0x1306011c0101171a,
+	0x060a01012201171a, 0x000601230f10171a, 0x000209280f10171a, 0x040a20011801091b, 0x020a18010011091b, 0x0203010513160b1c,
+	0x0305010521160b1c, 0x0100110823160b1c, 0x011a011c0701001e, 0x020a18010009151e, 0x0d0615061b010400, 0x02121a0617070500,
+	0x02190612070d0500, 0x0106160908190500, 0x0806060923190500, 0x08060906191b0500, 0x080606091e1b0500, 0x0202151f0d100600,
+	0x0103180315040800, 0x0103180315140900, 0x080c1c0607050701, 0x080c1c0607010a01, 0x0115181606050c01, 0x0106160908052001,
+	0x0806060923052001, 0x0016061519080b04, 0x16280d0616010006, 0x051606160a010507, 0x0115181601090507, 0x00160b062a160507,
+	0x011000060b1a0507, 0x000f28060b1a0507, 0x00090616121a0507, 0x001612060d230507, 0x080e06000f230507, 0x021706160a010508,
+	0x020b16062a010508, 0x00160b062a110508, 0x0306061b28100109, 0x061613062a01010a, 0x011621061506010a, 0x080122061506010a,
+	0x011621061107010a, 0x080122061107010a, 0x021606012307010a, 0x051606270108010a, 0x061601062a13010a, 0x020906172800100a,
+	0x020a081a2800100a, 0x070209182c00100a, 0x000709282304100a, 0x020006281f10100a, 0x0200061f2b10100a, 0x0200061f121b100a,
+	0x0b0616062a05010d, 0x000709282310050d, 0x011621061701070d, 0x080122061701070d, 0x011621061201080d, 0x080122061201080d,
+	0x0200061c0b1a160d, 0x0200061f1021160d, 0x0200061f1013280d, 0x061615061d00010e, 0x021901060713010e, 0x08011b060713010e,
+	0x031601061326010e, 0x0606041e1d00100e, 0x02060f1f1d00100e, 0x011609062c01080f, 0x0202011f0f10080f, 0x0806240600190510,
+	0x060106160a190510, 0x0103180315010910, 0x03061c0600160514, 0x030106160a160514, 0x0212090111160514, 0x03060600181e0514,
+	0x0016060802180b15, 0x02020d1408100018, 0x01020d2508100018, 0x020f060d29100018, 0x0102070d29100018, 0x0606010b2a100518,
+	0x0106210b02100818, 0x020006171c0b0f18, 0x02061200280b1918, 0x020610002a0b1918, 0x020314002a0b1918, 0x0106210b03061019,
+	0x030606001026021a, 0x020601280910171a, 0x030f010605160b1c, 0x0203011625160b1c, 0x0007061c0605181d, 0x01020d1a0810001e,
+	0x0e08061622160500, 0x0109160908190500, 0x010d160909190500, 0x0806090712190500, 0x0806090923190500, 0x080609091e1b0500,
+	0x09061211181d0500, 0x050315040b010600, 0x051516070b010600, 0x010e100216010600, 0x0304071316070600, 0x090603181d010e00,
+	0x080e050721010801, 0x150607151e040b01, 0x051502071a060b01, 0x030411071a060b01, 0x15061f1501160b01, 0x0106150a27200b01,
+	0x030a1a0408050c01, 0x0a161a0708050c01, 0x01141a091c050c01, 0x0207071810260c01, 0x0503150406010e01, 0x0515160706010e01,
+	0x150607151e050f01, 0x030b06041f031001, 0x0b0616071f031001, 0x0806090724011701, 0x0515020706071a01, 0x0304110706071a01,
+	0x0109160908052001, 0x010d160909052001, 0x0806090712052001, 0x0806090923052001, 0x0012180716052c01, 0x0503130019080b04,
+	0x050e170019080b04, 0x03061501040d1d04, 0x000615170e0d1d04, 0x0107070910261e04, 0x0806000714081a05, 0x0009090714081a05,
+	0x050315040f010006, 0x051516070f010006, 0x030109041f011106, 0x011609071f011106, 0x0c011c070b1a0507, 0x01101e070b1a0507,
+	0x080c07000f1f0507, 0x0c170d0021240507, 0x0c010d0704081a07, 0x00030b0410011b07, 0x00160b0710011b07, 0x0001031d13072507,
+	0x030f101f0b010508, 0x0215001118150508, 0x0503150401010b08, 0x0515160701010b08, 0x0003200413010b08, 0x0016200713010b08,
+	0x0503150406010109, 0x0515160706010109, 0x0306091b28100109, 0x0403061f28100109, 0x001500241a011409, 0x150600041e101409,
+	0x15060004101d1509, 0x080c070006051e09, 0x0d0615072400010a, 0x050315040007010a, 0x051516070007010a, 0x000320041707010a,
+	0x001620071707010a, 0x050007241a07010a, 0x000d07241a07010a, 0x000304061218010a, 0x001607061218010a, 0x040208182800100a,
+	0x040306192800100a, 0x040306282001100a, 0x040601281c05100a, 0x040006282005100a, 0x011507001f07100a, 0x011500121f07100a,
+	0x04000720240f100a, 0x020007182910100a, 0x01000716241a100a, 0x030c1c040801000d, 0x0c161c070801000d, 0x030c1c040805010d,
+	0x0c161c070805010d, 0x040707201026010d, 0x020007170823040d, 0x050315040101070d, 0x051516070101070d, 0x00031d041301070d,
+	0x030122041301070d, 0x00161d071301070d, 0x011622071301070d, 0x020304011807010e, 0x021607011807010e, 0x050315040008010e,
+	0x051516070008010e, 0x050304200108010e, 0x051607200108010e, 0x00031d041008010e, 0x030122041008010e, 0x00161d071008010e,
+	0x011622071008010e, 0x030301041f13010e, 0x031601071f13010e, 0x000304061f16010e, 0x001607061f16010e, 0x0609041e1d00100e,
+	0x00031f070f05100e, 0x0500071e0422100e, 0x040007201022100e, 0x020007181422100e, 0x020007021a22100e, 0x021607000e1f0510,
+	0x121f07000e1f0510, 0x0006051600082310, 0x0306071b16070111, 0x010109231e1c0b11, 0x0e08060016052c11, 0x00150023041a0b12,
+	0x0015002304071a12, 0x00121b0025010113, 0x0012000925052013, 0x0806090700052213, 0x0301090408052213, 0x0116090708052213,
+	0x1506001511052213, 0x01280d0923160514, 0x000919070b1a0514, 0x03011a070b1a0514, 0x03040e0002180b15, 0x0016090802180b15,
+	0x00160d0902180b15, 0x0003210213010816, 0x0504071e01070816, 0x00150a0304001e16, 0x0507070401011e16, 0x00030c0414060117,
+	0x00160c0714060117, 0x000304060e0f0117, 0x001607060e0f0117, 0x080107070f0f0117, 0x0606120428100018, 0x060e01071b070518,
+	0x0609010b2a100518, 0x0109210b02100818, 0x03010d0408051218, 0x01160d0708051218, 0x000124091c051218, 0x03010d031a091518,
+	0x0003040614090119, 0x0016070614090119, 0x00030b0406120119, 0x00160b0706120119, 0x0109210b03061019, 0x030609001026021a,
+	0x0107070d1026021a, 0x00030c041501081a, 0x00160c071501081a, 0x080c070006050d1a, 0x03010d040801171a, 0x01160d070801171a,
+	0x030604010e01171a, 0x061607010e01171a, 0x030401160c05181a, 0x030614000e05181a, 0x030600160e05181a, 0x02000e092305181a,
+	0x000917031b04091b, 0x09061600050f0b1c, 0x01021e091a0f0b1c, 0x0002120921160b1c, 0x0003071222160b1c, 0x0101110923160b1c,
+	0x00070a1b02180b1c, 0x0009091c02180b1c, 0x02000e091805181d, 0x01021b060d070400, 0x08060523090b0400, 0x01051a0513070500,
+	0x081f062416070500, 0x011d1a0119070500, 0x0102221b060d0500, 0x0a0f0325070d0500, 0x050f0525070d0500, 0x01141b09110d0500,
+	0x010f010317170500, 0x000c0f0f22170500, 0x000a0c0f23170500, 0x08260111081a0500, 0x00152616081a0500, 0x01091409171a0500,
+	0x08060624171a0500, 0x0806050b241a0500, 0x000a250318180900, 0x0105091405101d00, 0x07010a1f07102600, 0x0114210409130b01,
+	0x01141b0409170b01, 0x000407051a091201, 0x15070c0104241d04, 0x0602050b2c100006, 0x0a0f010302090f06, 0x050f010502090f06,
+	0x0901062518010407, 0x0a0f1e0f0b010507, 0x08001e1e11090507, 0x011e1e001a090507, 0x0a0f1e010b120507, 0x0107001e25180507,
+	0x0401071e25180507, 0x0a0f0f000c240507, 0x0105010516011707, 0x090c010627011707, 0x01000a0412101d07, 0x000a0018150b0408,
+	0x0100220b18150508, 0x0107001d23051e09, 0x010017031c092809, 0x060009282304100a, 0x01000f1f2505100a, 0x010003141e07100a,
+	0x011201002307100a, 0x01011d012307100a, 0x01001b042307100a, 0x01001f042307100a, 0x110e1e091c05010d, 0x06000a281e05010d,
+	0x0e141e092d05010d, 0x0e00031e1026010d, 0x010000170823040d, 0x010017010b23040d, 0x060009282310050d, 0x01000f2a1a05100e,
+	0x06011d2c0108100e, 0x060205000722100e, 0x010000021a22100e, 0x000103071b0b1e0f, 0x01160701011f0510, 0x01010103171f0510,
+	0x000c010f221f0510, 0x000a0c01231f0510, 0x0400062521100a13, 0x08001e1e06040b13, 0x0806001e25040b13, 0x01000a1e25040b13,
+	0x08001e1e06050f13, 0x0806001e25050f13, 0x01000a1e25050f13, 0x0616000802180b15, 0x0109000710031017, 0x00010d0710031017,
+	0x06070c0127031017, 0x0114011c07010018, 0x0e00210b02100818, 0x0e00210b03061019, 0x01001406100b021a, 0x0107001d23050d1a,
+	0x000205180d15091b, 0x000a030e1815091b, 0x0107001d18050d1d, 0x0600061c0605181d, 0x0216222311070500, 0x03141425090e0500,
+	0x140e2025090e0500, 0x15072025160e0500, 0x030706241a120500, 0x0307180625120500, 0x0818062406140500, 0x0823180109140500,
+	0x071f180310150500, 0x0c00090f22190500, 0x0c000a0923190500, 0x0c000a091e1b0500, 0x0216011b13070800, 0x07182718030e0900,
+	0x02181205260e0900, 0x0c01231d07100b00, 0x0204270013081a00, 0x0307030112091a00, 0x0006032307101d00, 0x0d18271806050701,
+	0x182718010c050701, 0x0c00090f22052001, 0x0c000a0923052001, 0x0018271808170b04, 0x0201140e28100006, 0x02001d1028100006,
+	0x020a120b2c100006, 0x02001205250b1906, 0x080523180b010507, 0x1827180101150507, 0x0800180624150507, 0x02000f0c23101d07,
+	0x020f000107192307, 0x02000f280d101d08, 0x02000f06101d2809, 0x02050900241a100a, 0x02000911241a100a, 0x11101e091c05010d,
+	0x10141e092d05010d, 0x1000031e1026010d, 0x020009281d10110d, 0x0202202c0108100e, 0x030701130022100e, 0x020a12000722100e,
+	0x0420250000190510, 0x0320250601190510, 0x0020250007190510, 0x0300250109190510, 0x0120250109190510, 0x072025000a190510,
+	0x000820250b190510, 0x0020250810190510, 0x0009202511190510, 0x0200052506180b12, 0x0300250605100e12, 0x0207000627071c13,
+	0x00182718080b0514, 0x0427180000160514, 0x0327180601160514, 0x0027180007160514, 0x0127180109160514, 0x072718000a160514,
+	0x000827180b160514, 0x0027180810160514, 0x0009271811160514, 0x0205090c29100018, 0x0209001529100018, 0x1000210b02100818,
+	0x02000d0610011019, 0x1000210b03061019, 0x0206070127091019, 0x020009280f10171a, 0x02071900121a0b1c, 0x02000f06101d0d1d,
+	0x00130d0f22170500, 0x000a130d23170500, 0x0400170f0a180500, 0x0400100f0f180500, 0x1000090f22190500, 0x00100d0f22190500,
+	0x10000a0923190500, 0x000a100d23190500, 0x0400120f0a1a0500, 0x04071409171a0500, 0x08120109241a0500, 0x10000a091e1b0500,
+	0x000a100d1e1b0500, 0x01130402161d0900, 0x0b060d0515012100, 0x1000090f22052001, 0x00100d0f22052001, 0x10000a0923052001,
+	0x000a100d23052001, 0x0f1207060f052c01, 0x000b070b1f220b04, 0x1507010d04241d04, 0x0713040a28100006, 0x0713050d28100006,
+	0x0402050b2c100006, 0x020b050d2c100006, 0x1304000a27101106, 0x1300050d27101106, 0x01130419000b1906, 0x000b0e1a160b0407,
+	0x000115201a0b0407, 0x000c00221a0b0407, 0x00010e241a0b0407, 0x040110241a0b0407, 0x0c0101151b1f0507, 0x0001130d20240507,
+	0x000b1a0228011307, 0x03000d1b28101307, 0x00030d1f28101307, 0x09010d0627011707, 0x000111052b011707, 0x060113052b011707,
+	0x06010f062b011707, 0x00050d1b040b1a07, 0x000111051a012107, 0x060113051a012107, 0x06010f061a012107, 0x000c011c1f012207,
+	0x00040d0606102307, 0x000b0e1a110b0408, 0x040a170501010e08, 0x0000032513101d08, 0x09041a0601072608, 0x0402062028100109,
+	0x011407040e161d09, 0x000406041b281d09, 0x000c14091d052c09, 0x0a0118052207010a, 0x120100171e04100a, 0x040009282304100a,
+	0x000406282213100a, 0x040b17050801000d, 0x040013170704010d, 0x010b071f0b04010d, 0x040b17050805010d, 0x04000a281e05010d,
+	0x040013172205010d, 0x0b070b052a05010d, 0x120100171e10050d, 0x040009282310050d, 0x00041a050912060d, 0x011407040e1d100d,
+	0x040017031c09160d, 0x040104011807010e, 0x04011d2c0108100e, 0x040205000722100e, 0x010e001e0722100e, 0x000103081b0b1e0f,
+	0x000700221e190510, 0x11060d00171f0510, 0x00010d0f221f0510, 0x000a010d231f0510, 0x0019060d231f0510, 0x0000250605101b10,
+	0x0407001d18050c11, 0x00001a061c100212, 0x00071404000e1d12, 0x0012030c25092413, 0x00140d0921052c13, 0x14060d0600160514,
+	0x0104120627060b15, 0x0416000802180b15, 0x000c0805031e1015, 0x040b000509010816, 0x000b0d051c010816, 0x0407000710031017,
+	0x00010d0810031017, 0x0607010d27031017, 0x0b00070d27031017, 0x000406280a0f1017, 0x0001132508100018, 0x0007011329100018,
+	0x0000250611100518, 0x0b0701062c051218, 0x010313062c051218, 0x0406060e25011019, 0x0406070c27011019, 0x0106070d27041019,
+	0x040115092705181a, 0x0107060f2705181a, 0x040100122705181a, 0x010306132705181a, 0x000105141804091b, 0x0400061c0605181d,
+	0x0b060d051c01001e, 0x01031a0d0810001e, 0x0001131a0810001e, 0x00001a061110051e, 0x000b0d051801081e, 0x0f021801161c0800,
+	0x001f0d0f051d1000, 0x0304010317261000, 0x000a1e0b12100805, 0x0001140d12230805, 0x0500002212230805, 0x00061a06251f1005,
+	0x010601041c1b020a, 0x01000604201b020a, 0x000a22011408110a, 0x020b16070500020e, 0x120b1f070500020e, 0x020b01051808020e,
+	0x0002180b2a07110e, 0x0006011c1c022210, 0x0206051501241011, 0x0002050619241011, 0x0209190106031d11, 0x0201160706031d11,
+	0x12011f0706031d11, 0x0801091b06031d11, 0x0207140409012111, 0x0100060b26121d12, 0x0003060e26121d12, 0x0100180110020816,
+	0x0205011812080d1d, 0x020a0b1e03120800, 0x020700041e181007, 0x001505041a091008, 0x000419062a091008, 0x0006052b12021d09,
+	0x020a23070005110a, 0x001000101805110a, 0x000a22010f08110a, 0x030402180711000d, 0x110f06000321190d, 0x011107000321190d,
+	0x00010d220621190d, 0x000701230621190d, 0x0100001e12220810, 0x0003060216152310, 0x020703000d101d12, 0x0206051501241013,
+	0x0002050619241013, 0x0209190106031d13, 0x0201160706031d13, 0x12011f0706031d13, 0x0801091b06031d13, 0x0207140409012113,
+	0x0100002612180814, 0x020b00050d020816, 0x010a17001e050816, 0x09060106041e1117, 0x0801011102061a17, 0x0001151602061a17,
+	0x0006011c2802171a, 0x080101110206211c, 0x000115160206211c, 0x00020e181c120800, 0x040210181c120800, 0x050416011c160800,
+	0x050116061c160800, 0x0201210412071001, 0x0307041b12071001, 0x0204160706151001, 0x12041f0706151001, 0x01021a11091b1001,
+	0x0206051516241001, 0x0d14280d09022101, 0x150615060f022101, 0x0d06150624022101, 0x02160701021a2101, 0x0406051503272101,
+	0x0219010111082104, 0x08011b0111082104, 0x0001151b16082104, 0x030d180106222104, 0x0601111506222104, 0x0501081606222104,
+	0x031801010c222104, 0x000600150d222104, 0x0200001812280805, 0x0207001d0d1d1005, 0x11011e031a020e07, 0x00040328221a1007,
+	0x000904062a1a1007, 0x0006052b12041d09, 0x0a00182508052109, 0x0c00182708052109, 0x0500142609052109, 0x000d142609052109,
+	0x0000130f22052109, 0x00000a1323052109, 0x000306161a282109, 0x0304050012082809, 0x0005021d12082809, 0x0405012012082809,
+	0x0105022212082809, 0x11011e031a02070d, 0x010301041f26020e, 0x010a10001e07110e, 0x0102000a1e07110e, 0x000208180b26110e,
+	0x000306190b26110e, 0x0003060216272111, 0x05001409030d1a17, 0x000d1409030d1a17, 0x1506150406110018, 0x0506220406110018,
+	0x1306021106110018, 0x0f06022206110018, 0x0107022206110018, 0x0004030629150219, 0x05001409030d211c, 0x000d1409030d211c,
+	0x00041f010611171d, 0x00011f060611171d, 0x050416002402001e, 0x04031f0f0111001e, 0x01031f0f0611001e, 0x020316180611001e,
+	0x000415030921191e, 0x000703060f21191e, 0x000403001221191e, 0x000303061321191e, 0x0118010303151000, 0x0200180f22100c01,
+	0x02000a1823100c01, 0x1506150504100f01, 0x110f06011f191001, 0x011107011f191001, 0x0206051511241001, 0x0f1002011c061d01,
+	0x0207050412071d01, 0x04050609122c1d01, 0x0d14280d09042101, 0x150615060f042101, 0x0d06150624042101, 0x0106150d220a2101,
+	0x0100110f220a2101, 0x01000a11230a2101, 0x07060115230a2101, 0x030f01011c181d04, 0x090301061e181d04, 0x0100160908101e04,
+	0x0100090f22101e04, 0x0806000923101e04, 0x01000a0923101e04, 0x0100180115021707, 0x010b09052a021707, 0x0002001812102307,
+	0x01001d001e151008, 0x020b16070500020a, 0x120b1f070500020a, 0x0400200f2210010d, 0x04000a202310010d, 0x0a0f10000323040d,
+	0x000f061b1223040d, 0x0100071b1223040d, 0x000c081c1223040d, 0x0100061f1223040d, 0x0a0f1000031a070d, 0x010006041f26020e,
+	0x0515000224061015, 0x0304001124061015, 0x010c011c24061015, 0x0009000f030f1a17, 0x01000d0f2210021a, 0x01000a0d2310021a,
+	0x0009000f030f211c, 0x02121a0103071000, 0x0304010322161000, 0x00160d0619082104, 0x0016010c19082104, 0x0209190106172104,
+	0x0201160706172104, 0x12011f0706172104, 0x0801091b06172104, 0x0209190106201005, 0x0201160706201005, 0x12011f0706201005,
+	0x0801091b06201005, 0x0202140106211906, 0x0201120406211906, 0x0e011f0506211906, 0x00042006271a1007, 0x010106231e151008,
+	0x0801021804072109, 0x0c071f000221190d, 0x0100060d2421190d, 0x0100060d1a21280d, 0x00060115031a2111, 0x010300061e182112,
+	0x09060106021e2115, 0x08010906040f1a17, 0x0004120003161a17, 0x0703010103161a17, 0x08010906040f211c, 0x000412000316211c,
+	0x070301010316211c, 0x00041f010610181d, 0x00011f060610181d, 0x0204160706131001, 0x12041f0706131001, 0x060415062c161001,
+	0x0211160701031d01, 0x12111f0701031d01, 0x0016010f19082104, 0x0403010327182104, 0x040301031b222104, 0x0304151b01110006,
+	0x0201210402110006, 0x0307041b02110006, 0x020d040a06110006, 0x0516040a06110006, 0x041f160d06110006, 0x0411280d06110006,
+	0x02000d0a03211906, 0x0500160a03211906, 0x001f160d03211906, 0x0011280d03211906, 0x0007160e03211906, 0x0000251203211906,
+	0x000c1f031c072109, 0x0200140318082109, 0x0100250318082109, 0x0f0604062c01110a, 0x010704062c01110a, 0x01071f031e04110a,
+	0x0c041f060107110a, 0x01041f061207110a, 0x030401062a10110a, 0x060401061d14110a, 0x01071f031e11050d, 0x01011e031a1a070d,
+	0x060401061d11110e, 0x0703180103201a0e, 0x0006111503201a0e, 0x0500081603201a0e, 0x020003060d1c2111, 0x02001a03070b2112,
+	0x02001607030e2112, 0x00121f07030e2112, 0x0000250306182112, 0x02000d030e062115, 0x050016030e062115, 0x07031801030b1a17,
+	0x00061115030b1a17, 0x05000816030b1a17, 0x05001803080d1a17, 0x08010501080f1a17, 0x0100090306161a17, 0x0000120307161a17,
+	0x0703010310161a17, 0x0009060226110518, 0x080c00011e08021a, 0x080117011e08021a, 0x07031801030b211c, 0x00061115030b211c,
+	0x05000816030b211c, 0x05001803080d211c, 0x08010501080f211c, 0x010009030616211c, 0x000012030716211c, 0x070301031016211c,
+	0x000a0b030711051e, 0x00050b050711051e, 0x000c0d050711051e, 0x0a0f122307020b00, 0x090606181d020e00, 0x0501161717080c01,
+	0x020718171b100c01, 0x0215071826100c01, 0x050f091826020e01, 0x01061c152c151001, 0x010509181a021701, 0x0012130717031d01,
+	0x020702041a072101, 0x01061517140a2101, 0x010711171b0a2101, 0x01150711260a2101, 0x07060415260a2101, 0x020013041a0c2101,
+	0x0c000d02281a2101, 0x0a0009022c1a2101, 0x040206091a2c2101, 0x000615170d0d1d04, 0x010709171b101e04, 0x0115070926101e04,
+	0x00061517100d2104, 0x020013011a0d2104, 0x020016070a172104, 0x12001f070a172104, 0x0806000925172104, 0x01000a0925172104,
+	0x0403010927182104, 0x040301091b222104, 0x020016070a201005, 0x12001f070a201005, 0x0806000925201005, 0x01000a0925201005,
+	0x0403001a1d251005, 0x03021a0d1a020006, 0x05000d1620020006, 0x010a0a1a17110006, 0x080026091e021106, 0x020012040a211906,
+	0x0e001f050a211906, 0x0804000925211906, 0x0701010925211906, 0x03050417001a1007, 0x00011d17051a1007, 0x02010521101a1007,
+	0x0a12280d01021707, 0x01000a1814021707, 0x01000c1816021707, 0x000a120c2b021707, 0x0001091a2b021707, 0x0002181714051707,
+	0x0500161704051e07, 0x000a120c1a022107, 0x0001091a1a022107, 0x01000a231e151008, 0x0003061128111709, 0x02000917021e2809,
+	0x0100241a1c00020a, 0x011009182401020a, 0x010018121508020a, 0x000a12062a15020a, 0x00000a271518020a, 0x000a1219061b020a,
+	0x020208181600110a, 0x030602191600110a, 0x020b08181700110a, 0x03060b191700110a, 0x010514170701110a, 0x030602162001110a,
+	0x03060b172001110a, 0x01071f091e04110a, 0x01001f0c1e04110a, 0x060201161c05110a, 0x060b01171c05110a, 0x000602162005110a,
+	0x00060b172005110a, 0x000218170711110a, 0x0c000a1c2202000d, 0x011306110211000d, 0x020117171708010d, 0x040720171b10010d,
+	0x041507202610010d, 0x01071f091e11050d, 0x01001f0c1e11050d, 0x0304001a171a070d, 0x000306112711170d, 0x0c001f010221190d,
+	0x0c0100022421190d, 0x0c0100021a21280d, 0x02000a271a00020e, 0x000a12061c25020e, 0x0a0612150126020e, 0x000a12061926020e,
+	0x0500190002201a0e, 0x01010d1717190810, 0x0003061116082310, 0x001209251a020111, 0x040303011b1a2112, 0x0002181703181013,
+	0x01000a1806021c13, 0x0002181706051c13, 0x0101091717160814, 0x0105141701061015, 0x0201052115061015, 0x0d060005151e1015,
+	0x020b000227062115, 0x0906000a021e2115, 0x000a120b1c020816, 0x040a001a1c020816, 0x00000d061a0f0217, 0x0406001a141e0217,
+	0x0500161706030517, 0x05001900020b1a17, 0x0500071a050d1a17, 0x040a002518020818, 0x040c002718020818, 0x0406001523120219,
+	0x01070d171b10021a, 0x0115070d2610021a, 0x01000a0d2202171a, 0x05001900020b211c, 0x0500071a050d211c, 0x000a0b090711051e,
+	0x000a120b1802081e, 0x040a001a1802081e, 0x03041424090a1000, 0x0306011517171000, 0x0d06150115022100, 0x070d060215022100,
+	0x0307042212080c01, 0x0c0601161e100c01, 0x01060528121e1001, 0x0304092406111701, 0x03061b0115111701, 0x0209191406031d01,
+	0x0109192506031d01, 0x0503132606031d01, 0x0c0616010e031d01, 0x0619160115031d01, 0x0b060102281a2101, 0x0006011523111404,
+	0x000a002512081e04, 0x000c002712081e04, 0x01000d0f22172104, 0x01000a0d23172104, 0x000a09250c182104, 0x000c09270c182104,
+	0x0406100027182104, 0x0403140027182104, 0x040610001b222104, 0x040314001b222104, 0x00061a06251c1005, 0x01000d0f22201005,
+	0x01000a0d23201005, 0x000c1a061a020006, 0x040a1f2501110006, 0x040c1f2701110006, 0x010a1f2506110006, 0x010c1f2706110006,
+	0x01010d0d22211906, 0x0701010d23211906, 0x00011a0614021707, 0x09010d0627021707, 0x0001042c0b021b07, 0x000104230b022207,
+	0x0004130116192307, 0x0001130616192307, 0x000602182105110a, 0x0100060d2326110e, 0x000a1e02120f0810, 0x00000f2c02051b10,
+	0x00000f2302052210, 0x0100060b17122310, 0x0003060e17122310, 0x01000f2c1f011013, 0x01002c1f12071013, 0x0100081f12251013,
+	0x00011a0606021c13, 0x0001240607021c13, 0x0004002012082613, 0x000220011c160814, 0x00090b051c020816, 0x09060106041d1117,
+	0x0d0615011c02001e, 0x070d06021c02001e, 0x050905060611001e, 0x0a0b06010d11001e, 0x020a0b000711051e, 0x00090b051802081e,
+	0x000400201208121e, 0x000608060321191e, 0x0004010d0321191e, 0x020a0b1e05120800, 0x00020e181b120800, 0x040210181b120800,
+	0x050416011b160800, 0x050116061b160800, 0x01000d181e170800, 0x02020118181c0800, 0x0400200f220e1000, 0x04000a20230e1000,
+	0x0200180f2a121001, 0x02000a1816241001, 0x0200180f2a051301, 0x0209190f06031d01, 0x050116011c081e04, 0x04030f0027182104,
+	0x04030f001b222104, 0x0001140d12250805, 0x0500002212250805, 0x0200001812270805, 0x01110e1a01110006, 0x040223180a110006,
+	0x000225180b110006, 0x0004200316211906, 0x0008030622211906, 0x0004070323211906, 0x000e030624211906, 0x0002030a06192307,
+	0x0004030319192307, 0x0006191626052109, 0x000306161a272109, 0x020017052207020a, 0x020718002a10110a, 0x00140e0309201a0e,
+	0x0015070316201a0e, 0x000a1e04120f0810, 0x0004280116190810, 0x0001280616190810, 0x030400011c190810, 0x00021d011c190810,
+	0x040120011c190810, 0x010222011c190810, 0x0100001e121e0810, 0x00000f2c04051b10, 0x00000f2304052210, 0x000408200e122310,
+	0x0000030f220e2112, 0x00000a03230e2112, 0x0200181808281013, 0x020118011c160814, 0x01000026121a0814, 0x00150608020d2115,
+	0x0200270509020816, 0x00140e03090b1a17, 0x00150703160b1a17, 0x0110011c07020018, 0x011306021c020018, 0x0106040c26020018,
+	0x0806011c26020018, 0x0204170027020018, 0x110f06010d110018, 0x011107010d110018, 0x0c01011507110518, 0x0c071f000c110518,
+	0x0f0601062c110518, 0x010701062c110518, 0x01011f040d020818, 0x01000604020e2718, 0x00000e281208021a, 0x000410281208021a,
+	0x080110011c08021a, 0x020117011c08021a, 0x00140e03090b211c, 0x00150703160b211c, 0x021116011a020600, 0x12111f011a020600,
+	0x0201160d1a050600, 0x01121f0d1a050600, 0x0a0f230307020e00, 0x050f230507020e00, 0x020f052311071000, 0x15061505040a1000,
+	0x020104060d021e00, 0x0a06221501131001, 0x0a06121502241001, 0x1506151506031d01, 0x0506221506031d01, 0x080c091c06031d01,
+	0x010023090f031d01, 0x0806020918031d01, 0x04050609122a1d01, 0x0207140409132101, 0x0100160908172104, 0x0100090f22172104,
+	0x0806000923172104, 0x01000a0923172104, 0x020716001a0c1005, 0x12071f001a0c1005, 0x0100160908201005, 0x0100090f22201005,
+	0x0806000923201005, 0x01000a0923201005, 0x0207001d0d211005, 0x01280d0423020006, 0x0a0a220901110006, 0x010d031806110006,
+	0x010318010c110006, 0x0101090d22211906, 0x0804000923211906, 0x0701010923211906, 0x000a0c01251a1007, 0x010a160023051307,
+	0x0901090627021707, 0x0004120116192307, 0x0001120616192307, 0x01000604021e2809, 0x011000111800110a, 0x001000181405110a,
+	0x000602181c05110a, 0x030704221208010d, 0x0c0601161e10010d, 0x000606171823040d, 0x020716031a00020e, 0x12071f031a00020e,
+	0x000220011c190810, 0x0f000223070c2112, 0x0f00021807241013, 0x0212010107021c13, 0x0002001812082613, 0x130600011e021315,
+	0x05001409050d1a17, 0x000d1409050d1a17, 0x0200140f02050018, 0x0100250f02050018, 0x000a00251208021a, 0x000c00271208021a,
+	0x05001409050d211c, 0x000d1409050d211c, 0x01001a0f0205001e, 0x000200181208121e, 0x0310040a16050600, 0x03041424090e1000,
+	0x0118010305151000, 0x0207140409191000, 0x060415062c151001, 0x0a0b06012b191001, 0x0a06121504241001, 0x0207140409102001,
+	0x0207140409172101, 0x0102241a06110006, 0x03040d1b06110006, 0x0203280d0a110006, 0x03041b010c110006, 0x00042006251a1007,
+	0x00090b052b021707, 0x00090b051a022107, 0x0107002c1f111409, 0x1506150416002109, 0x01000b2c1f07110a, 0x020009171823040d,
+	0x0a0f1000051a070d, 0x011306000221190d, 0x00011a0606021315, 0x00011a0612020816, 0x0002240a04050816, 0x0009000f050f1a17,
+	0x0003120602161a17, 0x0003010d02161a17, 0x0200140f04050018, 0x0100250f04050018, 0x0202140607110018, 0x0102250607110018,
+	0x1306020615110018, 0x0806020628110018, 0x020714000f110518, 0x010725000f110518, 0x0906010626110518, 0x130602060111171a,
+	0x0009000f050f211c, 0x000312060216211c, 0x0003010d0216211c, 0x01001a0f0405001e, 0x01021a060711001e, 0x01071a000f11051e,
+	0x0a0f230307020b00, 0x050f230507020b00, 0x02121a0105071000, 0x0212011a11071000, 0x0200030f1b0d1000, 0x030601151e161000,
+	0x02000a1814241001, 0x0203221806111701, 0x0208180115111701, 0x0306190115111701, 0x0208160706031d01, 0x12081f0706031d01,
+	0x0503221606031d01, 0x020d000a0f031d01, 0x0516000a0f031d01, 0x001f160d0f031d01, 0x0011280d0f031d01, 0x0611150115031d01,
+	0x0508160115031d01, 0x080c1c0109042101, 0x000601151f111404, 0x000222180d110006, 0x0a280d0301021707, 0x05280d0501021707,
+	0x00280d0517021707, 0x000a0c032b021707, 0x00050c052b021707, 0x000a0c031a022107, 0x00050c051a022107, 0x050005291a07020a,
+	0x000a03062a15020a, 0x000505062a15020a, 0x05180705011b020a, 0x000a0319061b020a, 0x00050519061b020a, 0x00061a05111b020a,
+	0x00061a05151e020a, 0x110f06002005110a, 0x011107002005110a, 0x000615052313020e, 0x00031a051325020e, 0x000a03061c25020e,
+	0x000505061c25020e, 0x0a0615030126020e, 0x050615050126020e, 0x000615051726020e, 0x000a03061926020e, 0x000505061926020e,
+	0x010a00111e07110e, 0x0100060d1f26110e, 0x0003030119122310, 0x0200000f0d031d11, 0x0c060116000c2112, 0x02000a1800241013,
+	0x0506250501020816, 0x000a0b031c020816, 0x00050b051c020816, 0x000c0d051c020816, 0x00060115040f1117, 0x0003120604161a17,
+	0x0003010d04161a17, 0x0004120005161a17, 0x0703010105161a17, 0x0103010d0a161a17, 0x0703010111161a17, 0x080c00011c08021a,
+	0x080117011c08021a, 0x0009000f2c10021a, 0x110604000911171a, 0x000312060416211c, 0x0003010d0416211c, 0x000412000516211c,
+	0x070301010516211c, 0x0103010d0a16211c, 0x070301011116211c, 0x000a0b031802081e, 0x00050b051802081e, 0x000c0d051802081e,
+	0x021715060d020600, 0x0504201e04120800, 0x0404202010120800, 0x0100142310120800, 0x0402201814120800, 0x020420021a120800,
+	0x010017111b120800, 0x010017151e120800, 0x0304062608161000, 0x050a16011a080c01, 0x020b160706031d01, 0x120b1f0706031d01,
+	0x0100230912081e04, 0x0004201212081e04, 0x0318010626172104, 0x0201000d12210805, 0x0200100d12210805, 0x0318010626201005,
+	0x0a10280d01110006, 0x02000d0a05211906, 0x0500160a05211906, 0x001f160d05211906, 0x0011280d05211906, 0x0007160e05211906,
+	0x0000251205211906, 0x03040626011a1007, 0x0212010116021707, 0x000111062b021707, 0x000111061a022107, 0x0801022304072109,
+	0x000c1f051c072109, 0x0200140518082109, 0x0100250518082109, 0x050701011a222109, 0x000711011a222109, 0x000617062b10020a,
+	0x00061706121b020a, 0x020a23070100110a, 0x000a23011308110a, 0x01071f012213110a, 0x0a0b06012411000d, 0x020a17011a08010d,
+	0x000613251223040d, 0x0a0f1001001a070d, 0x01011e051a1a070d, 0x000617060221160d, 0x000617060213280d, 0x06170f061d00020e,
+	0x0c0107011f26110e, 0x000203090f191a0e, 0x0703180105201a0e, 0x0006111505201a0e, 0x0500081605201a0e, 0x021701060f02080f,
+	0x0a010d011a190810, 0x0004200412220810, 0x0003061b0e122310, 0x020005060d1c2111, 0x01071f0116081d12, 0x02001a05070b2112,
+	0x02001607050e2112, 0x00121f07050e2112, 0x0000250506182112, 0x0a0109011a160814, 0x0004200212180814, 0x0a01210112061015,
+	0x0004270018021315, 0x0a01210106051315, 0x02000d050e062115, 0x050016050e062115, 0x0a01210112050816, 0x01071f010a0f1117,
+	0x07031801050b1a17, 0x00061115050b1a17, 0x05000816050b1a17, 0x05001805080d1a17, 0x0100090506161a17, 0x0000120507161a17,
+	0x000712010a161a17, 0x070304010b161a17, 0x0703010510161a17, 0x0403010114161a17, 0x0103010614161a17, 0x000a250607110518,
+	0x000c270607110518, 0x000420131208021a, 0x07031801050b211c, 0x00061115050b211c, 0x05000816050b211c, 0x05001805080d211c,
+	0x010009050616211c, 0x000012050716211c, 0x000712010a16211c, 0x070304010b16211c, 0x070301051016211c, 0x040301011416211c,
+	0x010301061416211c, 0x000a1a060711051e, 0x00030f060321191e, 0x05000f1e041a0800, 0x0004200f101a0800, 0x0002180f141a0800,
+	0x02000f021a1a0800, 0x050a16021a080c01, 0x020023070f031d01, 0x0000120f1a081e04, 0x0a10280d02110006, 0x0801052304072109,
+	0x050701021a222109, 0x000711021a222109, 0x020a23070200110a, 0x00060f181c05110a, 0x000a23021308110a, 0x01071f022213110a,
+	0x000306182213110a, 0x070d06180211000d, 0x0a0b06022411000d, 0x020a17021a08010d, 0x020008171823040d, 0x0a0f1002001a070d,
+	0x0c0107021f26110e, 0x0a010d021a190810, 0x00000f041a220810, 0x00010b1907182310, 0x01071f0216081d12, 0x0003061816081d12,
+	0x0a0109021a160814, 0x00000f021a180814, 0x0a01210212061015, 0x0a01210206051315, 0x0a01210212050816, 0x01071f020a0f1117,
+	0x000306180a0f1117, 0x000712020a161a17, 0x0403010214161a17, 0x0000130f1a08021a, 0x000712020a16211c, 0x040301021416211c,
+	0x000f230d05170800, 0x01000d181d170800, 0x080e091b06031d01, 0x0200020f0d0f1d01, 0x0100160d27062101, 0x02010204080a2101,
+	0x0200020f180a2101, 0x0200020f100f2101, 0x0209190206162101, 0x040302031b272101, 0x030216020c2c2101, 0x0000151c12081e04,
+	0x0500061c0c182104, 0x0005091c0c182104, 0x000114022b021707, 0x000114021a022107, 0x0500011c1f022207, 0x000d011c1f022207,
+	0x0004140116192307, 0x0001140616192307, 0x00001504121f2307, 0x00031a0522021409, 0x0107002a1d111409, 0x0115150716002109,
+	0x01031a0d22002109, 0x0100160f22002109, 0x01000a1623002109, 0x0703011a23002109, 0x00000f2215052109, 0x00000a2315052109,
+	0x080e002304072109, 0x00010d221c072109, 0x000701231c072109, 0x000705041c102809, 0x000a05091c102809, 0x0e071f001e04110a,
+	0x000a22011607110a, 0x01000b2a1d07110a, 0x000a22011108110a, 0x0e071f001e11050d, 0x000705041c141a0e, 0x000a05091c141a0e,
+	0x0703180200201a0e, 0x0100001d121e0810, 0x0003000219122310, 0x0103160600142310, 0x0014001c03241011, 0x0103160600272112,
+	0x01000f2c1c011013, 0x01002c1c12071013, 0x0100081c12251013, 0x00000d06021e2115, 0x07031802000b1a17, 0x0703020100161a17,
+	0x0003020d01161a17, 0x0003020b0a161a17, 0x030501020b161a17, 0x0703020010161a17, 0x03000f0211161a17, 0x0403020014161a17,
+	0x0003020617161a17, 0x07031a0127020018, 0x010d090628110018, 0x0103110628110018, 0x0500090626110518, 0x000d090626110518,
+	0x0003110626110518, 0x00071903020e2718, 0x0500010f031e0519, 0x0000110f031e0519, 0x0016050a1208021a, 0x05010c231208021a,
+	0x07031802000b211c, 0x070302010016211c, 0x0003020d0116211c, 0x0003020b0a16211c, 0x030501020b16211c, 0x070302001016211c,
+	0x03000f021116211c, 0x040302001416211c, 0x000302061716211c, 0x0f021801141c0800, 0x020201181a1c0800, 0x0a030125190d1000,
+	0x130602061e161000, 0x0d06010222161000, 0x1306021906111701, 0x080c091b06031d01, 0x0200040f0d0f1d01, 0x02010404080a2101,
+	0x0200040f180a2101, 0x0200040f100f2101, 0x0209190406162101, 0x040304031b272101, 0x030216040c2c2101, 0x0100220912081e04,
+	0x0015060f19082104, 0x0500062419082104, 0x000d062419082104, 0x0500090619222104, 0x000d090619222104, 0x0003110619222104,
+	0x0500001e12250805, 0x0200001a12270805, 0x0004200516211906, 0x0008050622211906, 0x0004070523211906, 0x000e050624211906,
+	0x0002050a06192307, 0x0004050319192307, 0x0009062712041d09, 0x080c002304072109, 0x020a22070100110a, 0x0c071f001e04110a,
+	0x000a22011308110a, 0x000906241223040d, 0x06000f1a1823040d, 0x0c071f001e11050d, 0x000703231c25020e, 0x000703231926020e,
+	0x0703180400201a0e, 0x00140e0509201a0e, 0x0015070516201a0e, 0x0003000419122310, 0x0000050f220e2112, 0x00000a05230e2112,
+	0x000201181c180814, 0x07031804000b1a17, 0x00140e05090b1a17, 0x00150705160b1a17, 0x0703040100161a17, 0x0003040d01161a17,
+	0x0003040b0a161a17, 0x030501040b161a17, 0x0703040010161a17, 0x03000f0411161a17, 0x0403040014161a17, 0x0003040617161a17,
+	0x07031804000b211c, 0x00140e05090b211c, 0x00150705160b211c, 0x070304010016211c, 0x0003040d0116211c, 0x0003040b0a16211c,
+	0x030501040b16211c, 0x070304001016211c, 0x03000f041116211c, 0x040304001416211c, 0x000304061716211c, 0x020a1a0507020e00,
+	0x03041422090e1000, 0x04060315221b1000, 0x060415062a151001, 0x0206051513241001, 0x1306021706111701, 0x040623150a031d01,
+	0x000625150b031d01, 0x0501280d12081e04, 0x0006251500172104, 0x0018280d08172104, 0x020a09010c182104, 0x02000e010c182104,
+	0x0006251500201005, 0x0018280d08201005, 0x010e18011a020006, 0x01280d041f020006, 0x010d051806110006, 0x0102221a06110006,
+	0x010518010c110006, 0x0100251100211906, 0x01041f06101a1007, 0x00280d0516021707, 0x000113052b021707, 0x00010f062b021707,
+	0x000113051a022107, 0x00010f061a022107, 0x0004100116192307, 0x0001100616192307, 0x0107002a1f111409, 0x0306052b12011d09,
+	0x0006191628052109, 0x050702001a222109, 0x0310040a0701110a, 0x01000b2a1f07110a, 0x0e071f00021a110a, 0x000306162421190d,
+	0x000306161a21280d, 0x000615051626020e, 0x0003060b1f26110e, 0x0100181108201a0e, 0x0004260116190810, 0x0001260616190810,
+	0x0004011a07162310, 0x0001061a07162310, 0x010400001e1c2111, 0x010306011e1c2111, 0x010000071e1c2111, 0x010101091e1c2111,
+	0x0107000a1e1c2111, 0x0100080b1e1c2111, 0x010008101e1c2111, 0x010009111e1c2111, 0x01000028121a0814, 0x0310040a01061015,
+	0x01041f0615061015, 0x0304001224061015, 0x050c1b0101020816, 0x0002220a04050816, 0x020701030e160217, 0x01001811080b1a17,
+	0x0104110000161a17, 0x0103110601161a17, 0x0100110007161a17, 0x0101110109161a17, 0x010711000a161a17, 0x010008110b161a17,
+	0x0100110810161a17, 0x0100091111161a17, 0x0106040c28020018, 0x0806011c28020018, 0x00000e261208021a, 0x000410261208021a,
+	0x01001811080b211c, 0x010411000016211c, 0x010311060116211c, 0x010011000716211c, 0x010111010916211c, 0x010711000a16211c,
+	0x010008110b16211c, 0x010011081016211c, 0x010009111116211c, 0x02011f040d120800, 0x0206051517241001, 0x010027090f031d01,
+	0x0200040f0d0c1d01, 0x0200040f100c2101, 0x0012070504102c01, 0x0200010f0d0d1d04, 0x0517010119082104, 0x0200010f100d2104,
+	0x0003120627182104, 0x0003010d27182104, 0x000312061b222104, 0x0003010d1b222104, 0x0205280d0a110006, 0x0a010a01251a1007,
+	0x000f062712041d09, 0x0100072712041d09, 0x0501142609002109, 0x050704001a222109, 0x020d07002005110a, 0x051607002005110a,
+	0x01001e0f0d23040d, 0x000f06241223040d, 0x010007241223040d, 0x01001e0f26021013, 0x01001808041b1013, 0x0506230501020816,
+	0x05011409000d1a17, 0x0002120109161a17, 0x030502010b161a17, 0x02000e141208021a, 0x01000e251208021a, 0x05011409000d211c,
+	0x000212010916211c, 0x030502010b16211c, 0x000a010d0611171d, 0x0a030f010d11001e, 0x0a0c0d000711051e, 0x05041e1e04120800,
+	0x02011b040d120800, 0x04041e2010120800, 0x04021e1814120800, 0x02041e021a120800, 0x0304141b090a1000, 0x0304062408161000,
+	0x150615060d021301, 0x0304091b06111701, 0x0202160706162101, 0x12021f0706162101, 0x00041e1212081e04, 0x0016011119082104,
+	0x0016140e09172104, 0x0318010624172104, 0x0016140e09201005, 0x0318010624201005, 0x011518011c020006, 0x0115110607110006,
+	0x0016050e05211906, 0x03040624011a1007, 0x0100062712041d09, 0x0304140901102809, 0x0d0602180211000d, 0x010006241223040d,
+	0x0304140901141a0e, 0x0305180105201a0e, 0x00041e0412220810, 0x0003050119122310, 0x00011b0607021c13, 0x00041e0212180814,
+	0x0001220606021315, 0x0001220612020816, 0x03051801050b1a17, 0x0004120109161a17, 0x030504010b161a17, 0x0305010510161a17,
+	0x0001091211161a17, 0x0403010117161a17, 0x0103010617161a17, 0x0b06011c28020018, 0x0602120628110018, 0x060210062a110018,
+	0x030214062a110018, 0x040a250007110518, 0x040c270007110518, 0x00041e131208021a, 0x03051801050b211c, 0x000412010916211c,
+	0x030504010b16211c, 0x030501051016211c, 0x000109121116211c, 0x040301011716211c, 0x010301061716211c, 0x0004011c0610181d,
+	0x0001061c0610181d, 0x040a1a000711051e, 0x00020b0a0711051e, 0x04030f000321191e, 0x021715050d020600, 0x030601161e161000,
+	0x0101160908191000, 0x0806010923191000, 0x080601091e1b1000, 0x0106010e1b1d1000, 0x0101221a12080c01, 0x0208180116111701,
+	0x0306190116111701, 0x0611150116031d01, 0x0508160116031d01, 0x0101160908102001, 0x0806010923102001, 0x080c01230c062101,
+	0x080c011c0c072101, 0x05170108190e2101, 0x0204160706162101, 0x12041f0706162101, 0x0101160908172101, 0x0806010923172101,
+	0x000601161f111404, 0x0016011519082104, 0x0403010a27182104, 0x0403010a1b222104, 0x080c1c0124020006, 0x01151f1106110006,
+	0x000222180b110006, 0x02010d0a00211906, 0x0501160a00211906, 0x011f160d00211906, 0x0111280d00211906, 0x000111052b021707,
+	0x000111051a022107, 0x011416012a011008, 0x010014042a011008, 0x0a01182508002109, 0x0c01182708002109, 0x010c1f001c072109,
+	0x0201140018082109, 0x0101250018082109, 0x000617052b10020a, 0x00061705121b020a, 0x01071f0a1e04110a, 0x02010d1b1208010d,
+	0x0501161b1208010d, 0x01071f0a1e11050d, 0x0801011e111a070d, 0x000617050221160d, 0x010006162421190d, 0x000617050213280d,
+	0x010006161a21280d, 0x06170f051d00020e, 0x0100060b1f26110e, 0x0106111500201a0e, 0x0501081600201a0e, 0x0001181208201a0e,
+	0x021701050f02080f, 0x0101080919122310, 0x020100060d1c2111, 0x02011a00070b2112, 0x02011607000e2112, 0x01121f07000e2112,
+	0x02010d000e062115, 0x050116000e062115, 0x010c010227062115, 0x00040c00021e2115, 0x00161f0113020816, 0x0116210114060217,
+	0x0801220114060217, 0x0001210414060217, 0x00060116040f1117, 0x01061115000b1a17, 0x05010816000b1a17, 0x00011812080b1a17,
+	0x05011800080d1a17, 0x0003010b04161a17, 0x030f010105161a17, 0x0101090006161a17, 0x0103010b0a161a17, 0x000108120b161a17,
+	0x0001120810161a17, 0x03010f0111161a17, 0x0604120628110018, 0x060410062a110018, 0x030414062a110018, 0x0219010107120219,
+	0x08011b0107120219, 0x001606001a10021a, 0x011621011502081a, 0x080122011502081a, 0x000121041502081a, 0x01061115000b211c,
+	0x05010816000b211c, 0x00011812080b211c, 0x05011800080d211c, 0x0003010b0416211c, 0x030f01010516211c, 0x010109000616211c,
+	0x0103010b0a16211c, 0x000108120b16211c, 0x000112081016211c, 0x03010f011116211c, 0x000a0b0a0711051e, 0x02061b040d120800,
+	0x0310040e10120800, 0x0102160908191000, 0x0806020923191000, 0x080602091e1b1000, 0x01021a1112080f01, 0x0102160908102001,
+	0x0806020923102001, 0x080c02230c062101, 0x080c021c0c072101, 0x05170208190e2101, 0x0102160908172101, 0x0806020923172101,
+	0x0403010d27182104, 0x0403010d1b222104, 0x02280d0416020006, 0x0600062712041d09, 0x0a02182508002109, 0x0c02182708002109,
+	0x020613042a01020a, 0x020121041506020a, 0x020121041107020a, 0x020204012307020a, 0x050204270108020a, 0x020601042a13020a,
+	0x01071f0d1e04110a, 0x060006241223040d, 0x01071f0d1e11050d, 0x020121041702070d, 0x0801021e111a070d, 0x020121041202080d,
+	0x020615041d00020e, 0x020301041326020e, 0x0002181208201a0e, 0x020109042c02080f, 0x0a0605010e122310, 0x0006140b1d042111,
+	0x00021812080b1a17, 0x0002120810161a17, 0x03020f0111161a17, 0x00021812080b211c, 0x000212081016211c, 0x03020f011116211c,
+	0x000a0b0d0711051e, 0x020114040b020600, 0x0201140b10120800, 0x0201140406020e01, 0x0202050619241001, 0x0209191106031d01,
+	0x020216210c062101, 0x080202220c062101, 0x0802091b06162101, 0x0201090019082104, 0x0216010119082104, 0x0403110027182104,
+	0x040311001b222104, 0x0200140d12140805, 0x020114040f020006, 0x0204000116192307, 0x0201000616192307, 0x0201140401020b08,
+	0x0201140406020109, 0x020114040007020a, 0x020104011f07020a, 0x0201140d0701110a, 0x020a22010108110a, 0x02071f002213110a,
+	0x0204020a2411000d, 0x11021e091c10010d, 0x02141e092d10010d, 0x020114040102070d, 0x0200140b0411070d, 0x0802001e111a070d,
+	0x01021e001a1a070d, 0x020114040008020e, 0x0003051e1a10020e, 0x021407000414110e, 0x0c0207001f26110e, 0x0a020d001a190810,
+	0x0214000f03011011, 0x0200140312071011, 0x0a0300191e050212, 0x02071f0016081d12, 0x0201140d01061015, 0x0200141604061015,
+	0x0a02210012061015, 0x0200140206021315, 0x0a02210006051315, 0x000c020227062115, 0x0200140212020816, 0x0a02210012050816,
+	0x02071f000a0f1117, 0x020a0b000711051e, 0x010a1e0b14120800, 0x000f250d05170800, 0x0f021a01141c0800, 0x0200090f22191000,
+	0x02000a0923191000, 0x02000a091e1b1000, 0x010a120619241001, 0x00061c051b021301, 0x02021b0706111701, 0x0209191306031d01,
+	0x0c0614010e031d01, 0x0619140115031d01, 0x0109052b12061d01, 0x0200090f22102001, 0x02000a0923102001, 0x040216210c062101,
+	0x080402220c062101, 0x0804091b06162101, 0x0200090f22172101, 0x02000a0923172101, 0x020b07001f111404, 0x0501270d12081e04,
+	0x0018270d08172104, 0x0403130027182104, 0x040313001b222104, 0x0018270d08201005, 0x01270d041f020006, 0x0107160e00211906,
+	0x0100251200211906, 0x0104200016211906, 0x0108000622211906, 0x0104070023211906, 0x010e000624211906, 0x00270d0516021707,
+	0x0102000a06192307, 0x0104000319192307, 0x020a170501020e08, 0x0011062712041d09, 0x010d142609002109, 0x0100130f22002109,
+	0x01000a1323002109, 0x0106190d01222109, 0x010711001a222109, 0x011000101800110a, 0x010a23001308110a, 0x04071f002213110a,
+	0x020b17050802000d, 0x0204040a2411000d, 0x020417060810010d, 0x11041e091c10010d, 0x020003171e10010d, 0x01000a281e10010d,
+	0x04141e092d10010d, 0x001106241223040d, 0x0804001e111a070d, 0x01041e001a1a070d, 0x080600230221190d, 0x020104011807020e,
+	0x0c0407001f26110e, 0x0100181208201a0e, 0x01140e0009201a0e, 0x0115070016201a0e, 0x010a1e01120f0810, 0x0a040d001a190810,
+	0x01000f2c01051b10, 0x01000f2301052210, 0x0002080919122310, 0x04071f0016081d12, 0x0207030009101d12, 0x0100000f220e2112,
+	0x01000a00230e2112, 0x0100250006182112, 0x0a0209001a160814, 0x0a04210012061015, 0x06040106151e1015, 0x000600051e021315,
+	0x0a04210006051315, 0x000c040227062115, 0x0b060101021e2115, 0x00060111021e2115, 0x020b000509020816, 0x0a04210012050816,
+	0x020b0700040f1117, 0x04071f000a0f1117, 0x0c070d00041d1117, 0x01001812080b1a17, 0x01140e00090b1a17, 0x01150700160b1a17,
+	0x010d1409000d1a17, 0x0109000f000f1a17, 0x0104120000161a17, 0x0103120601161a17, 0x0100120007161a17, 0x0101120109161a17,
+	0x010712000a161a17, 0x010008120b161a17, 0x0100120810161a17, 0x0100091211161a17, 0x0601120626110518, 0x05010c251208021a,
+	0x000606241a10021a, 0x01001812080b211c, 0x01140e00090b211c, 0x01150700160b211c, 0x010d1409000d211c, 0x0109000f000f211c,
+	0x010412000016211c, 0x010312060116211c, 0x010012000716211c, 0x010112010916211c, 0x010712000a16211c, 0x010008120b16211c,
+	0x010012081016211c, 0x010009121116211c, 0x0100061c0610181d, 0x0a0603181d020e00, 0x050605181d020e00, 0x0400090f22191000,
+	0x04000a0923191000, 0x04000a091e1b1000, 0x02060511181d1000, 0x0502050619241001, 0x0400090f22102001, 0x04000a0923102001,
+	0x0400090f22172101, 0x04000a0923172101, 0x0a0616002b051404, 0x0516010119082104, 0x0a06160014052105, 0x0504000116192307,
+	0x0501000616192307, 0x0506052b12011d09, 0x0a06160005102809, 0x050a22010108110a, 0x000506162421190d, 0x000506161a21280d,
+	0x000605261a14020e, 0x0005060b1f26110e, 0x0a06160005141a0e, 0x0004080919122310, 0x0a0601011d191011, 0x060002181d0c2112,
+	0x0a0409001a160814, 0x0d06011c28020018, 0x050a0b000711051e, 0x0f0b230507020b00, 0x110218091c100c01, 0x021418092d100c01,
+	0x0f07180326020e01, 0x0515000f2b021001, 0x01061a1504241001, 0x1206011516241001, 0x140615060d021301, 0x1606021706111701,
+	0x0010280d0f031d01, 0x0610150115031d01, 0x01061a150b042101, 0x11061501170a2101, 0x011111091c0a2101, 0x060515052d0a2101,
+	0x011411092d0a2101, 0x11060e1501162101, 0x110615000d0d1d04, 0x0006150b1b0d1d04, 0x000a220912081e04, 0x000622150b101e04,
+	0x110109091c101e04, 0x07280d001d101e04, 0x011409092d101e04, 0x11061500100d2104, 0x110312010c182104, 0x010319010c182104,
+	0x0601150611222104, 0x0007052312250805, 0x0000150f25051e05, 0x0a02221a06110006, 0x0114110607110006, 0x01140115001a1007,
+	0x01042106101a1007, 0x0201180619241007, 0x0b280d0501021707, 0x0012100127021707, 0x050015022b021707, 0x000b0c052b021707,
+	0x1102180014051707, 0x0511160004051e07, 0x050015021a022107, 0x000b0c051a022107, 0x011201001e151008, 0x0104012712041d09,
+	0x000b062712041d09, 0x0006220412151d09, 0x0502142609002109, 0x0114000f00102809, 0x000b05062a15020a, 0x000b0519061b020a,
+	0x0001200d2407110a, 0x110218000711110a, 0x020718002c11110a, 0x0e072100021a110a, 0x110420091c10010d, 0x041420092d10010d,
+	0x00001d0f0d23040d, 0x0100220f0d23040d, 0x010401241223040d, 0x000b06241223040d, 0x0f1000091823040d, 0x020000171823040d,
+	0x010420001a1a070d, 0x000b05061c25020e, 0x060b15050126020e, 0x000b05061926020e, 0x0114000f00141a0e, 0x000f18022602080f,
+	0x000622040e121d12, 0x00001d0f26021013, 0x0100220f26021013, 0x1102180003181013, 0x1102180006051c13, 0x0000030f1a052114,
+	0x0104210615061015, 0x000b0b051c020816, 0x0511160006030517, 0x05021409000d1a17, 0x00000c0f050f1a17, 0x110610010d110018,
+	0x110314010d110018, 0x0000130f2a050518, 0x060110062c110518, 0x030114062c110518, 0x11010d091c10021a, 0x01140d092d10021a,
+	0x05021409000d211c, 0x00000c0f050f211c, 0x0200180f1305001e, 0x000b0b051802081e, 0x0000030f1c05111e, 0x020a27011a020600,
+	0x02071b040d120800, 0x02171a0105071000, 0x0201171a11071000, 0x02142104090a1000, 0x02142109050d1000, 0x1006011516241001,
+	0x0209210406111701, 0x020d160706031d01, 0x120d1f0706031d01, 0x021607010c031d01, 0x121f07010c031d01, 0x0216070101172104,
+	0x121f070101172104, 0x0201010317172104, 0x030a010125172104, 0x0205000d12210805, 0x0216070101201005, 0x121f070101201005,
+	0x0201010317201005, 0x030a010125201005, 0x01241a011c020006, 0x0212040101211906, 0x0e1f050101211906, 0x0210010102211906,
+	0x0205010516021707, 0x0010100127021707, 0x011001001e151008, 0x010101231e151008, 0x0700062712041d09, 0x070006241223040d,
+	0x01051e051a1a070d, 0x0c001f080221190d, 0x00012319070c2112, 0x000a270118020614, 0x09060101021e2115, 0x0002091211161a17,
+	0x0203010617161a17, 0x0214011c07020018, 0x0125011c07020018, 0x1306011c15020018, 0x0806011c28020018, 0x1306011c0102171a,
+	0x060a01012202171a, 0x000209121116211c, 0x020301061716211c, 0x0002061c0610181d, 0x011a011c0702001e, 0x080c1c0607020a01,
+	0x0102221a12080c01, 0x0211160706031d01, 0x12111f0706031d01, 0x0503170019082104, 0x0016060f19082104, 0x000919060b251005,
+	0x03011a060b251005, 0x16280d0616020006, 0x0304151b06110006, 0x02020d0a00211906, 0x0502160a00211906, 0x021f160d00211906,
+	0x0211280d00211906, 0x0801062304072109, 0x020c1f001c072109, 0x0202140018082109, 0x0102250018082109, 0x061613062a01020a,
+	0x011621061506020a, 0x080122061506020a, 0x011621061107020a, 0x080122061107020a, 0x021606012307020a, 0x051606270108020a,
+	0x061601062a13020a, 0x02020d1b1208010d, 0x0502161b1208010d, 0x011621061702070d, 0x080122061702070d, 0x0c0106160411070d,
+	0x03041516011a070d, 0x08010612041a070d, 0x011621061202080d, 0x080122061202080d, 0x020006162421190d, 0x020006161a21280d,
+	0x061615061d00020e, 0x021901060713020e, 0x08011b060713020e, 0x031601061326020e, 0x000606160414110e, 0x0200060b1f26110e,
+	0x0206111500201a0e, 0x0502081600201a0e, 0x011609062c02080f, 0x0201080919122310, 0x020200060d1c2111, 0x02021a00070b2112,
+	0x02021607000e2112, 0x02121f07000e2112, 0x0318010504281013, 0x02020d000e062115, 0x050216000e062115, 0x020c010227062115,
+	0x02061115000b1a17, 0x05020816000b1a17, 0x05021800080d1a17, 0x08010506080f1a17, 0x0102090006161a17, 0x0203010b0a161a17,
+	0x000208120b161a17, 0x080c00061e08021a, 0x080117061e08021a, 0x02061115000b211c, 0x05020816000b211c, 0x05021800080d211c,
+	0x08010506080f211c, 0x010209000616211c, 0x0203010b0a16211c, 0x000208120b16211c, 0x050315040b020600, 0x051516070b020600,
+	0x010e100216020600, 0x02041b040d120800, 0x0f0410091b120800, 0x090603181d020e00, 0x03020f1812080c01, 0x09021e1812080c01,
+	0x0302180408100c01, 0x0216180708100c01, 0x0503150406020e01, 0x0515160706020e01, 0x1506031522100f01, 0x15061f1501131001,
+	0x1506150116141001, 0x0106150a17251001, 0x0806090724021701, 0x0d06150707031d01, 0x030614070e031d01, 0x150610150b042101,
+	0x0806090719042101, 0x020b02071a062101, 0x080409071a072101, 0x0306150b040a2101, 0x060f1507050a2101, 0x01031104080a2101,
+	0x01161107080a2101, 0x05060b07051c2101, 0x00120c0705102c01, 0x090616002b051404, 0x03010f0912081e04, 0x09011e0912081e04,
+	0x0806090700101e04, 0x0301090408101e04, 0x0116090708101e04, 0x1506001511101e04, 0x00030a1619082104, 0x021607000e172104,
+	0x121f07000e172104, 0x0303001a0d1d1005, 0x021607000e201005, 0x121f07000e201005, 0x09031a0025051e05, 0x00031a0a25051e05,
+	0x0906160014052105, 0x050315040f020006, 0x051516070f020006, 0x150a1f0901110006, 0x000c1a1701110006, 0x000c1f1c01110006,
+	0x0f0423090a110006, 0x030109041f021106, 0x011609071f021106, 0x021204000e211906, 0x0e1f05000e211906, 0x00030b041d041007,
+	0x00160b071d041007, 0x030400070b1a1007, 0x00021d070b1a1007, 0x040120070b1a1007, 0x010222070b1a1007, 0x00030b0410021b07,
+	0x00160b0710021b07, 0x0503150401020b08, 0x0515160701020b08, 0x0003200413020b08, 0x0016200713020b08, 0x01000e231e151008,
+	0x0503150406020109, 0x0515160706020109, 0x001500241a021409, 0x0400062712041d09, 0x0b0602071a012109, 0x0801071204072109,
+	0x0801092304072109, 0x000303161a082109, 0x0306170012222109, 0x0306170016282109, 0x0906160005102809, 0x01021e091a102809,
+	0x0d0615072400020a, 0x050315040007020a, 0x051516070007020a, 0x000320041707020a, 0x001620071707020a, 0x050007241a07020a,
+	0x000d07241a07020a, 0x000304061218020a, 0x001607061218020a, 0x0304010b2005110a, 0x050922010108110a, 0x0f0605001d14110a,
+	0x030c1c040802000d, 0x0c161c070802000d, 0x03040f201208010d, 0x09041e201208010d, 0x030420040810010d, 0x041620070810010d,
+	0x040006241223040d, 0x020717001423040d, 0x020007171823040d, 0x050315040102070d, 0x051516070102070d, 0x00031d041302070d,
+	0x030122041302070d, 0x00161d071302070d, 0x011622071302070d, 0x0c011f090221190d, 0x020304011807020e, 0x021607011807020e,
+	0x050315040008020e, 0x051516070008020e, 0x050304200108020e, 0x051607200108020e, 0x00031d041008020e, 0x030122041008020e,
+	0x00161d071008020e, 0x011622071008020e, 0x030301041f13020e, 0x031601071f13020e, 0x000304061f16020e, 0x001607061f16020e,
+	0x0f0605001d11110e, 0x0906160005141a0e, 0x01021e091a141a0e, 0x0001010816162310, 0x0006051600182310, 0x090601011d191011,
+	0x01000e091e182112, 0x00121b0025020113, 0x090409001a160814, 0x000c0006021e2115, 0x0906000e021e2115, 0x0003210213020816,
+	0x090218001c050816, 0x0002180a1c050816, 0x00030c0414060217, 0x00160c0714060217, 0x000304060e0f0217, 0x001607060e0f0217,
+	0x080107070f0f0217, 0x0906150023030517, 0x0006150a23030517, 0x06060f0128110018, 0x0003040614090219, 0x0016070614090219,
+	0x00030b0406120219, 0x00160b0706120219, 0x09061a00031e0519, 0x00061a0a031e0519, 0x03010f0d1208021a, 0x09011e0d1208021a,
+	0x03010d040810021a, 0x01160d070810021a, 0x000124091c10021a, 0x00030c041502081a, 0x00160c071502081a, 0x03010d040802171a,
+	0x01160d070802171a, 0x030604010e02171a, 0x061607010e02171a, 0x05090b000711051e, 0x090218001805081e, 0x0002180a1805081e,
+	0x01071b040d120800, 0x0a0201181a1c0800, 0x01171a0105071000, 0x0101171a11071000, 0x001f210f05091000, 0x0a0f070125091000,
+	0x01142104090a1000, 0x01142109050d1000, 0x0602050619241001, 0x0109210406111701, 0x010d160706031d01, 0x080e091b06031d01,
+	0x0809151e06031d01, 0x011607010c031d01, 0x0c000f1e0f031d01, 0x0c0407010e162101, 0x0419070115162101, 0x000407051a102c01,
+	0x0616010119082104, 0x0116070101172104, 0x0101010317172104, 0x000c010f22172104, 0x000a0c0123172104, 0x000c1e0d121c0805,
+	0x0105000d12210805, 0x000c1f0d12250805, 0x000a001a12270805, 0x0116070101201005, 0x0101010317201005, 0x000c010f22201005,
+	0x000a0c0123201005, 0x0112040101211906, 0x0110010102211906, 0x010c010d22211906, 0x07010c0123211906, 0x0401032225181007,
+	0x0105010516021707, 0x090c010627021707, 0x0604000116192307, 0x0601000616192307, 0x080e002304072109, 0x0a0a22070100110a,
+	0x0e071f001e04110a, 0x060a22010108110a, 0x010000171823040d, 0x0e071f001e11050d, 0x0c071e00041c110e, 0x0c071f000425110e,
+	0x0004190716201a0e, 0x0f0201011c082213, 0x00041907160b1a17, 0x0114011c07020018, 0x00041907160b211c, 0x060a0b000711051e,
+	0x020a1e0b14120800, 0x020a120619241001, 0x0810091b06031d01, 0x0209052b12061d01, 0x0207160e00211906, 0x0200251200211906,
+	0x0204200016211906, 0x0208000622211906, 0x0204070023211906, 0x020e000624211906, 0x0800182304091007, 0x0202000a06192307,
+	0x0204000319192307, 0x020d142609002109, 0x0200130f22002109, 0x02000a1323002109, 0x0810002304072109, 0x020711001a222109,
+	0x021000101800110a, 0x10071f001e04110a, 0x071f18001005110a, 0x020a23001308110a, 0x02000a281e10010d, 0x10071f001e11050d,
+	0x0200181208201a0e, 0x02140e0009201a0e, 0x0215070016201a0e, 0x020a1e01120f0810, 0x02000f2c01051b10, 0x02000f2301052210,
+	0x0200000f220e2112, 0x02000a00230e2112, 0x0200250006182112, 0x02001812080b1a17, 0x02140e00090b1a17, 0x02150700160b1a17,
+	0x020d1409000d1a17, 0x0209000f000f1a17, 0x0204120000161a17, 0x0203120601161a17, 0x0200120007161a17, 0x0201120109161a17,
+	0x020712000a161a17, 0x020008120b161a17, 0x0200120810161a17, 0x0200091211161a17, 0x02001812080b211c, 0x02140e00090b211c,
+	0x02150700160b211c, 0x020d1409000d211c, 0x0209000f000f211c, 0x020412000016211c, 0x020312060116211c, 0x020012000716211c,
+	0x020112010916211c, 0x020712000a16211c, 0x020008120b16211c, 0x020012081016211c, 0x020009121116211c, 0x0200061c0610181d,
+	0x13041422090e1000, 0x0b060d0515022100, 0x0402050619241001, 0x04021b0706111701, 0x1000040d18111701, 0x0409191306031d01,
+	0x0219060d18031d01, 0x0304141b09132101, 0x040b07001f111404, 0x0416010119082104, 0x000e062419082104, 0x11060d0017172104,
+	0x00010d0f22172104, 0x000a010d23172104, 0x0019060d23172104, 0x0c00061c0c182104, 0x000e090619222104, 0x000e001e12250805,
+	0x11060d0017201005, 0x00010d0f22201005, 0x000a010d23201005, 0x0019060d23201005, 0x01010d0d22211906, 0x0701010d23211906,
+	0x0d00040d23211906, 0x0c01160d1e011007, 0x000b1a0228021307, 0x09010d0627021707, 0x000111052b021707, 0x060113052b021707,
+	0x06010f062b021707, 0x000111051a022107, 0x060113051a022107, 0x06010f061a022107, 0x000c011c1f022207, 0x0404000116192307,
+	0x0401000616192307, 0x040a170501020e08, 0x00040d1a1e011008, 0x0105022012082809, 0x0a0118052207020a, 0x1013040a0701110a,
+	0x0216040a0701110a, 0x040a22010108110a, 0x040b17050802000d, 0x040417060810010d, 0x040003171e10010d, 0x0b0704062a10010d,
+	0x040104011807020e, 0x090407001f26110e, 0x01011e011c190810, 0x120702001a082310, 0x000b070203272111, 0x0407030009101d12,
+	0x1013040a01061015, 0x0216040a01061015, 0x1304001224061015, 0x0009040227062115, 0x040b000509020816, 0x000b0d051c020816,
+	0x040b0700040f1117, 0x09070d00041d1117, 0x03041409010f1a17, 0x04041a00090f1a17, 0x000c090626110518, 0x0c00010f031e0519,
+	0x000500251208021a, 0x010818061a08021a, 0x011018011c08021a, 0x0b0701062c10021a, 0x010313062c10021a, 0x03041409010f211c,
+	0x04041a00090f211c, 0x0b060d051c02001e, 0x040a0b000711051e, 0x0a0b0d000711051e, 0x000b0d051802081e,
+};
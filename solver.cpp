@@ -0,0 +1,1854 @@
+#include "solver.h"
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#define SOLVE_X64 1
+#else
+#define SOLVE_X64 0
+#endif
+
+#include "orders.h"
+#include "shapes.h"
+#include "solutions.h"
+
+constexpr uint8_t gGridMarks[MAX_ROW_NUM * MAX_COL_NUM] = {
+	0,   0,   0,   0,   0,   0,   255,
+	0,   0,   0,   0,   0,   0,   255,
+	0,   0,   0,   0,   0,   0,   0,
+	0,   0,   0,   0,   0,   0,   0,
+	0,   0,   0,   0,   0,   0,   0,
+	0,   0,   0,   0,   0,   0,   0,
+	0,   0,   0,   255, 255, 255, 255
+};
+constexpr uint8_t gGridValues[MAX_ROW_NUM * MAX_COL_NUM] = {
+	101, 102, 103, 104, 105, 106, 0,
+	107, 108, 109, 110, 111, 112, 0,
+	1,   2,   3,   4,   5,   6,   7,
+	8,   9,   10,  11,  12,  13,  14,
+	15,  16,  17,  18,  19,  20,  21,
+	22,  23,  24,  25,  26,  27,  28,
+	29,  30,  31,  0,   0,   0,   0
+};
+constexpr BlockInfo gBlockInfos[MAX_BLK_NUM] = {
+	{
+		2, 3,
+		{
+			1, 1, 1,
+			1, 1, 1
+		}
+	},
+	{
+		3, 2,
+		{
+			1, 1,
+			0, 1,
+			1, 1
+		}
+	},
+	{
+		3, 3,
+		{
+			0, 0, 1,
+			0, 0, 1,
+			1, 1, 1
+		}
+	},
+	{
+		4, 2,
+		{
+			1, 1,
+			1, 0,
+			1, 0,
+			1, 0
+		}
+	},
+	{
+		3, 2,
+		{
+			1, 0,
+			1, 1,
+			1, 1
+		}
+	},
+	{
+		3, 3,
+		{
+			0, 0, 1,
+			1, 1, 1,
+			1, 0, 0
+		}
+	},
+	{
+		2, 4,
+		{
+			1, 1, 1, 1,
+			0, 1, 0, 0
+		}
+	},
+	{
+		2, 4,
+		{
+			1, 1, 1, 0,
+			0, 0, 1, 1
+		}
+	}
+};
+
+/* orientations, placements and tile sums only depend on the board and the pieces, so the compiler builds them */
+struct ShapeTable {
+	Branch blkData[MAX_BLK_NUM];
+	uint64_t boardMask;
+	uint64_t firstColMask;
+	uint64_t lastColMask;
+	uint64_t sumMasks[1 << MAX_BLK_NUM];
+	int placeNum[MAX_COL_NUM * MAX_ROW_NUM];
+	Placement places[MAX_COL_NUM * MAX_ROW_NUM][MAX_PLACE_NUM];
+};
+constexpr BlockInfo blankShape(const BlockInfo&, int rows, int cols)
+{
+	return { rows, cols, { 0 } };
+}
+constexpr int firstBlockCell(const BlockInfo& blk)
+{
+	for(int i = 0; i < blk.cols; ++i)
+	{
+		if(0 != blk.data[i])
+		{
+			return i;
+		}
+	}
+	return 0;
+}
+constexpr uint64_t blockMask(const BlockInfo& blk)
+{
+	uint64_t msk = 0;
+	for(int r = 0; r < blk.rows; ++r)
+	{
+		for(int c = 0; c < blk.cols; ++c)
+		{
+			if(0 != blk.data[r * blk.cols + c])
+			{
+				msk |= 1ull << (r * MAX_COL_NUM + c);
+			}
+		}
+	}
+	return msk;
+}
+constexpr int blockCells(uint64_t msk)
+{
+	int num = 0;
+	for(; 0 != msk; msk &= msk - 1)
+	{
+		num++;
+	}
+	return num;
+}
+/* distinct orientations in the order of shapeOrientations() */
+constexpr ShapeTable buildShapes()
+{
+	ShapeTable t = {};
+	for(int i = 0; i < MAX_BLK_NUM; ++i)
+	{
+		Branch& blk = t.blkData[i];
+		blk.num = shapeOrientations(gBlockInfos[i], blk.data);
+		for(int b = 0; b < blk.num; ++b)
+		{
+			blk.firstCols[b] = firstBlockCell(blk.data[b]);
+			blk.masks[b] = blockMask(blk.data[b]);
+		}
+	}
+
+	uint64_t marks = 0;
+	for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+	{
+		if(255 == gGridMarks[i])
+		{
+			marks |= 1ull << i;
+		}
+		t.boardMask |= 1ull << i;
+		if(0 == i % MAX_COL_NUM)
+		{
+			t.firstColMask |= 1ull << i;
+		}
+		if(MAX_COL_NUM - 1 == i % MAX_COL_NUM)
+		{
+			t.lastColMask |= 1ull << i;
+		}
+	}
+	for(uint32_t used = 0; used < (1u << MAX_BLK_NUM); ++used)
+	{
+		uint64_t sums = 1;
+		for(int i = 0; i < MAX_BLK_NUM; ++i)
+		{
+			if(0 == (used & (1u << i)))
+			{
+				sums |= sums << blockCells(t.blkData[i].masks[0]);
+			}
+		}
+		t.sumMasks[used] = sums;
+	}
+	for(int idx = 0; idx < MAX_COL_NUM * MAX_ROW_NUM; ++idx)
+	{
+		const int r = idx / MAX_COL_NUM;
+		const int c = idx % MAX_COL_NUM;
+		for(int i = 0; i < MAX_BLK_NUM; ++i)
+		{
+			const Branch& blk = t.blkData[i];
+			for(int b = 0; b < blk.num; ++b)
+			{
+				const int x = c - blk.firstCols[b];
+				if(x < 0 || x + blk.data[b].cols > MAX_COL_NUM || r + blk.data[b].rows > MAX_ROW_NUM)
+				{
+					continue;
+				}
+				const int pos = r * MAX_COL_NUM + x;
+				const uint64_t msk = blk.masks[b] << pos;
+				if(0 != (msk & marks))
+				{
+					continue;
+				}
+				Placement& p = t.places[idx][t.placeNum[idx]++];
+				p.mask = msk;
+				p.blk = (uint8_t)i;
+				p.branch = (uint8_t)b;
+				p.pos = (uint8_t)pos;
+			}
+		}
+	}
+	return t;
+}
+static constexpr ShapeTable gShapes = buildShapes();
+
+#define SOLVE_TABLE_VERSION 1
+#define SOLVE_TABLE_DAYS 31
+
+#define SOLVE_SPLIT_DEPTH 2
+
+const char* const gCellOrderNames[ORDER_CELL_NUM] = { "first", "edge", "fewest" };
+const char* const gPieceOrderNames[ORDER_PIECE_NUM] = { "index", "constrained", "awkward" };
+struct SolveTask {
+	int index;
+	int depth;
+	const Placement* path[SOLVE_SPLIT_DEPTH];
+	ResultArena results;
+};
+struct SolveWorker {
+	std::mutex lock;
+	std::deque<int> tasks;
+	uint64_t nodes;
+	uint64_t pruneChecks;
+	uint64_t pruned;
+	uint64_t transHits;
+#if SOLVE_STATS
+	SolveStats stats;
+#endif
+};
+
+#define MAX_DANCE_COL (1 + MAX_COL_NUM * MAX_ROW_NUM + MAX_BLK_NUM)
+#define MAX_DANCE_ROW (MAX_COL_NUM * MAX_ROW_NUM * MAX_PLACE_NUM)
+#define MAX_DANCE_NODE (MAX_DANCE_COL + MAX_DANCE_ROW * (MAX_BLKROW_NUM * MAX_BLKCOL_NUM + 1))
+/* Knuth's dancing links, node 0 is the root and nodes 1..MAX_DANCE_COL-1 the column headers */
+struct Dance {
+	int left[MAX_DANCE_NODE];
+	int right[MAX_DANCE_NODE];
+	int up[MAX_DANCE_NODE];
+	int down[MAX_DANCE_NODE];
+	int col[MAX_DANCE_NODE];
+	int row[MAX_DANCE_NODE];
+	int size[MAX_DANCE_COL];
+	int nodeNum;
+	const Placement* rows[MAX_DANCE_ROW];
+	int rowNum;
+};
+
+void rotateBlock(BlockInfo* blk)
+{
+	*blk = rotatedShape(*blk);
+}
+void mirrorBlock(BlockInfo* blk)
+{
+	*blk = mirroredShape(*blk);
+}
+/* puts a placement that is known to fit */
+void solveApply(Solve* s, const Placement* p)
+{
+	SOLVE_STAT(s->stats.placed[bitCount(s->blkMask)]++);
+	Branch* blk = &s->blkData[p->blk];
+	blk->idx = p->branch;
+	blk->pos = p->pos;
+	s->blkMask |= 1u << p->blk;
+	s->nodes++;
+	s->gridMask ^= p->mask;
+}
+bool solvePlace(Solve* s, const Placement* p)
+{
+	SOLVE_STAT(s->stats.tried[bitCount(s->blkMask)]++);
+	if(0 != (s->blkMask & (1u << p->blk)) || 0 != (s->gridMask & p->mask))
+	{
+		return false;
+	}
+	solveApply(s, p);
+	return true;
+}
+void solveUnplace(Solve* s, const Placement* p)
+{
+	s->blkMask &= ~(1u << p->blk);
+	s->gridMask ^= p->mask;
+}
+int bitCount(uint64_t val)
+{
+#if defined(_MSC_VER)
+	return (int)__popcnt64(val);
+#else
+	return __builtin_popcountll(val);
+#endif
+}
+const char* const gFilterNames[FILTER_NUM] = { "scalar", "sse2", "avx2" };
+uint64_t filterScalar(const uint64_t* tests, int num, uint64_t key)
+{
+	uint64_t fits = 0;
+	for(int i = 0; i < num; ++i)
+	{
+		fits |= (uint64_t)(0 == (tests[i] & key)) << i;
+	}
+	return fits;
+}
+#if SOLVE_X64
+#if defined(_MSC_VER)
+#define SOLVE_TARGET(x)
+#else
+#define SOLVE_TARGET(x) __attribute__((target(x)))
+#endif
+/* sse2 has no 64 bit compare, a lane is zero when both of its 32 bit halves are */
+uint64_t filterSse2(const uint64_t* tests, int num, uint64_t key)
+{
+	const __m128i k = _mm_set1_epi64x((long long)key);
+	const __m128i zero = _mm_setzero_si128();
+	uint64_t fits = 0;
+	int i = 0;
+	for(; i + 2 <= num; i += 2)
+	{
+		const __m128i half = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128((const __m128i*)(tests + i)), k), zero);
+		const __m128i hit = _mm_and_si128(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+		fits |= (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(hit)) << i;
+	}
+	return i < num ? fits | filterScalar(tests + i, num - i, key) << i : fits;
+}
+SOLVE_TARGET("avx2") uint64_t filterAvx2(const uint64_t* tests, int num, uint64_t key)
+{
+	const __m256i k = _mm256_set1_epi64x((long long)key);
+	const __m256i zero = _mm256_setzero_si256();
+	uint64_t fits = 0;
+	int i = 0;
+	for(; i + 4 <= num; i += 4)
+	{
+		const __m256i hit = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(tests + i)), k), zero);
+		fits |= (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(hit)) << i;
+	}
+	/* the tail stays in here, calling the sse2 kernel with the upper halves dirty stalls on some cpus */
+	for(; i < num; ++i)
+	{
+		fits |= (uint64_t)(0 == (tests[i] & key)) << i;
+	}
+	return fits;
+}
+bool hasAvx2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	/* the os has to save the ymm registers too */
+	if(0 == (info[2] & (1 << 27)) || 0 == (info[2] & (1 << 28)) || 6 != (_xgetbv(0) & 6))
+	{
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return 0 != (info[1] & (1 << 5));
+#else
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+typedef uint64_t (*FilterFunc)(const uint64_t* tests, int num, uint64_t key);
+int bestFilterKernel()
+{
+#if SOLVE_X64
+	return hasAvx2() ? FILTER_AVX2 : FILTER_SSE2;
+#else
+	return FILTER_SCALAR;
+#endif
+}
+FilterFunc filterFunc(int kernel)
+{
+#if SOLVE_X64
+	if(FILTER_AVX2 == kernel)
+	{
+		return filterAvx2;
+	}
+	if(FILTER_SSE2 == kernel)
+	{
+		return filterSse2;
+	}
+#endif
+	return filterScalar;
+}
+/* versions are unique across all Solves, so a copy only matches the Solve it was taken from */
+static std::atomic<uint32_t> gVersion(0);
+static int gFilterKernel = bestFilterKernel();
+static FilterFunc gFilter = filterFunc(gFilterKernel);
+uint64_t filterPlaces(const uint64_t* tests, int num, uint64_t key)
+{
+	return gFilter(tests, num, key);
+}
+int filterKernel()
+{
+	return gFilterKernel;
+}
+bool setFilterKernel(int kernel)
+{
+	if(kernel < 0 || kernel > bestFilterKernel())
+	{
+		return false;
+	}
+	gFilterKernel = kernel;
+	gFilter = filterFunc(kernel);
+	return true;
+}
+/* true if some empty region can not be tiled by the sizes of the unused pieces */
+bool solvePrune(Solve* s)
+{
+	if(0 == s->pruneEvery || 0 != bitCount(s->blkMask) % s->pruneEvery)
+	{
+		return false;
+	}
+	s->pruneChecks++;
+	const uint64_t sums = s->sumMasks[s->blkMask];
+	uint64_t empty = ~s->gridMask & s->boardMask;
+	while(0 != empty)
+	{
+		uint64_t region = empty & (0 - empty);
+		for(;;)
+		{
+			uint64_t next = region | (region << MAX_COL_NUM) | (region >> MAX_COL_NUM);
+			next |= ((region << 1) & ~s->firstColMask) | ((region >> 1) & ~s->lastColMask);
+			next &= empty;
+			if(next == region)
+			{
+				break;
+			}
+			region = next;
+		}
+		empty &= ~region;
+		if(0 == (sums & (1ull << bitCount(region))))
+		{
+			s->pruned++;
+			return true;
+		}
+	}
+	return false;
+}
+uint64_t transKey(const Solve* s)
+{
+	return s->gridMask | ((uint64_t)s->blkMask << (MAX_COL_NUM * MAX_ROW_NUM));
+}
+TransEntry* transBucket(Solve* s, uint64_t key)
+{
+	if(s->trans.empty())
+	{
+		if(s->transBits <= 0)
+		{
+			return nullptr;
+		}
+		s->trans.resize((size_t)1 << s->transBits);
+	}
+	return &s->trans[(size_t)((key * 0x9e3779b97f4a7c15ull) >> (64 - s->transBits)) & ~(size_t)1];
+}
+const TransEntry* transFind(Solve* s, uint64_t key)
+{
+	TransEntry* b = transBucket(s, key);
+	for(int i = 0; nullptr != b && i < 2; ++i)
+	{
+		if(key == b[i].key && TRANS_NONE != b[i].kind)
+		{
+			s->transHits++;
+			return &b[i];
+		}
+	}
+	return nullptr;
+}
+/* answers cheaper than TRANS_MIN_WORK nodes are not worth a slot */
+void transStore(Solve* s, uint64_t key, int kind, uint64_t count, uint32_t first, uint64_t work)
+{
+	TransEntry* b = work < TRANS_MIN_WORK ? nullptr : transBucket(s, key);
+	if(nullptr == b)
+	{
+		return;
+	}
+	for(int i = 0; i < 2; ++i)
+	{
+		if(TRANS_SOME == kind && key == b[i].key && TRANS_NONE != b[i].kind)
+		{
+			return;
+		}
+	}
+	TransEntry* e = &b[1];
+	if(key == b[0].key || work >= b[0].work)
+	{
+		if(key != b[0].key)
+		{
+			b[1] = b[0];
+		}
+		e = &b[0];
+	}
+	e->key = key;
+	e->count = count;
+	e->first = first;
+	e->work = work > UINT32_MAX ? UINT32_MAX : (uint32_t)work;
+	e->gen = s->transGen;
+	e->kind = (uint8_t)kind;
+}
+void transClear(Solve* s)
+{
+	s->transEpoch = ++gVersion;
+	if(!s->trans.empty())
+	{
+		memset(&s->trans[0], 0, s->trans.size() * sizeof(TransEntry));
+	}
+}
+void arenaClear(ResultArena* a)
+{
+	a->num = 0;
+	a->chunks.clear();
+}
+void arenaPush(ResultArena* a, uint64_t code)
+{
+	if(0 == a->num % RESULT_CHUNK_NUM)
+	{
+		a->chunks.emplace_back();
+		a->chunks.back().reserve(RESULT_CHUNK_NUM);
+	}
+	a->chunks.back().push_back(code);
+	a->num++;
+}
+uint64_t arenaAt(const ResultArena* a, size_t idx)
+{
+	return a->chunks[idx / RESULT_CHUNK_NUM][idx % RESULT_CHUNK_NUM];
+}
+void statsClear(SolveStats* st)
+{
+	memset(st, 0, sizeof(*st));
+}
+void statsMerge(SolveStats* dst, const SolveStats* src)
+{
+	for(int d = 0; d < MAX_BLK_NUM; ++d)
+	{
+		dst->nodes[d] += src->nodes[d];
+		dst->tried[d] += src->tried[d];
+		dst->placed[d] += src->placed[d];
+	}
+	for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+	{
+		dst->deadEnds[i] += src->deadEnds[i];
+	}
+	dst->solutions += src->solutions;
+	dst->timeMs += src->timeMs;
+}
+void printStats(FILE* fp, const SolveStats* st)
+{
+	fprintf(fp, "depth %12s %12s %12s %8s\n", "nodes", "tried", "placed", "branch");
+	for(int d = 0; d < MAX_BLK_NUM; ++d)
+	{
+		const double branch = 0 == st->nodes[d] ? 0 : (double)st->placed[d] / st->nodes[d];
+		fprintf(fp, "%5d %12llu %12llu %12llu %8.2f\n", d, (unsigned long long)st->nodes[d],
+			(unsigned long long)st->tried[d], (unsigned long long)st->placed[d], branch);
+	}
+	fprintf(fp, "dead ends per cell:\n");
+	for(int r = 0; r < MAX_ROW_NUM; ++r)
+	{
+		for(int c = 0; c < MAX_COL_NUM; ++c)
+		{
+			fprintf(fp, " %9llu", (unsigned long long)st->deadEnds[r * MAX_COL_NUM + c]);
+		}
+		fprintf(fp, "\n");
+	}
+	fprintf(fp, "solutions %llu, %.3f ms\n", (unsigned long long)st->solutions, st->timeMs);
+}
+/* bytes of the first num pieces in fill order, the rest of the code only depends on the cells they leave */
+uint64_t packSteps(const Solve* s, int num, uint32_t blkMask)
+{
+	uint64_t code = 0;
+	uint64_t occupied = s->baseMask;
+	int index = 0;
+	for(int k = 0; k < num; ++k)
+	{
+		while(0 != (occupied & (1ull << index)))
+		{
+			index++;
+		}
+		for(int i = 0; i < s->placeNum[index]; ++i)
+		{
+			const Placement* p = &s->places[index][i];
+			const Branch* blk = &s->blkData[p->blk];
+			if(0 != (blkMask & (1u << p->blk)) && p->branch == blk->idx && p->pos == blk->pos)
+			{
+				code |= (uint64_t)i << (k * 8);
+				occupied |= p->mask;
+				break;
+			}
+		}
+	}
+	return code;
+}
+uint64_t packResult(const Solve* s)
+{
+	return packSteps(s, MAX_BLK_NUM, (1u << MAX_BLK_NUM) - 1);
+}
+void unpackResult(const Solve* s, uint64_t code, Result* res)
+{
+	memcpy(res->gridData, s->gridData, sizeof(s->gridData));
+	uint64_t occupied = s->baseMask;
+	int index = 0;
+	for(int k = 0; k < MAX_BLK_NUM; ++k)
+	{
+		while(0 != (occupied & (1ull << index)))
+		{
+			index++;
+		}
+		const Placement* p = &s->places[index][(code >> (k * 8)) & 0xff];
+		memcpy(&res->blkData[p->blk], &s->blkData[p->blk].data[p->branch], sizeof(BlockInfo));
+		for(int i = index; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+		{
+			if(0 != (p->mask & (1ull << i)))
+			{
+				res->gridData[i] = p->blk + 1;
+			}
+		}
+		occupied |= p->mask;
+	}
+}
+void solveRecord(Solve* s)
+{
+	SOLVE_STAT(s->stats.solutions++);
+	arenaPush(&s->results, packResult(s));
+}
+/* a state seen before in this search appends its completions again behind the current pieces */
+bool solveReplay(Solve* s, const TransEntry* e)
+{
+	const int depth = bitCount(s->blkMask);
+	const uint64_t low = depth >= MAX_BLK_NUM ? ~0ull : (1ull << (depth * 8)) - 1;
+	const uint64_t prefix = packSteps(s, depth, s->blkMask);
+	for(uint64_t i = 0; i < e->count; ++i)
+	{
+		arenaPush(&s->results, (arenaAt(&s->results, e->first + i) & ~low) | prefix);
+	}
+	SOLVE_STAT(s->stats.solutions += e->count);
+	return 0 != e->count;
+}
+/* completions can only be replayed when the placed pieces are a prefix of the fill order */
+void solveRemember(Solve* s, const SolveFrame* f)
+{
+	const uint32_t num = (uint32_t)s->results.num - f->first;
+	const int kind = 0 == num ? TRANS_DEAD : (ORDER_CELL_FIRST == s->cellOrder ? TRANS_LIST : TRANS_COUNT);
+	transStore(s, transKey(s), kind, num, f->first, s->nodes - f->nodes);
+}
+int solveFirstEmpty(const Solve* s, int index)
+{
+	while(index < MAX_COL_NUM * MAX_ROW_NUM && 0 != (s->gridMask & (1ull << index)))
+	{
+		index++;
+	}
+	return index;
+}
+/* the empty cell with the fewest empty neighbours, the lowest one on ties */
+int solveEdgeCell(const Solve* s, uint64_t empty)
+{
+	const uint64_t a = empty >> MAX_COL_NUM;
+	const uint64_t b = empty << MAX_COL_NUM;
+	const uint64_t c = (empty >> 1) & ~s->lastColMask;
+	const uint64_t d = (empty << 1) & ~s->firstColMask;
+	const uint64_t two = (a & b) | (a & c) | (a & d) | (b & c) | (b & d) | (c & d);
+	const uint64_t three = (a & b & c) | (a & b & d) | (a & c & d) | (b & c & d);
+	const uint64_t tiers[3] = { empty & ~two, empty & ~three, empty & ~(a & b & c & d) };
+	uint64_t m = empty;
+	for(int i = 0; i < 3; ++i)
+	{
+		if(0 != tiers[i])
+		{
+			m = tiers[i];
+			break;
+		}
+	}
+	return bitCount((m & (0 - m)) - 1);
+}
+/* unused placements that cover the cell, counting stops at bound */
+int solveCandidates(const Solve* s, int cell, int bound)
+{
+	const uint64_t key = transKey(s);
+	int num = 0;
+	for(int i = 0; i < s->coverNum[cell] && num < bound; i += 64)
+	{
+		const int len = s->coverNum[cell] - i > 64 ? 64 : s->coverNum[cell] - i;
+		num += bitCount(filterPlaces(s->coverTests[cell] + i, len, key));
+	}
+	return num;
+}
+/* the edge cell goes first so the bound is tight from the start, a forced or dead cell ends the scan */
+int solveFewestCell(const Solve* s, uint64_t empty)
+{
+	int best = solveEdgeCell(s, empty);
+	int bestNum = solveCandidates(s, best, MAX_COVER_NUM + 1);
+	for(uint64_t m = empty & ~(1ull << best); 0 != m && bestNum > 1; m &= m - 1)
+	{
+		const int cell = bitCount((m & (0 - m)) - 1);
+		const int num = solveCandidates(s, cell, bestNum);
+		if(num < bestNum)
+		{
+			best = cell;
+			bestNum = num;
+		}
+	}
+	return best;
+}
+/* the cell the next piece has to cover and the placements to try there, index is where a first empty scan starts */
+void solvePick(const Solve* s, int index, SolveFrame* f)
+{
+	const uint64_t empty = ~s->gridMask & s->boardMask;
+	f->list = nullptr;
+	f->tests = nullptr;
+	f->num = 0;
+	f->next = 0;
+	f->end = 0;
+	f->fits = 0;
+	if(ORDER_CELL_FIRST == s->cellOrder)
+	{
+		f->index = solveFirstEmpty(s, index);
+		if(f->index < MAX_COL_NUM * MAX_ROW_NUM)
+		{
+			f->list = s->anchors[f->index];
+			f->tests = s->anchorTests[f->index];
+			f->num = s->placeNum[f->index];
+		}
+		return;
+	}
+	if(0 == empty)
+	{
+		f->index = MAX_COL_NUM * MAX_ROW_NUM;
+		return;
+	}
+	f->index = ORDER_CELL_EDGE == s->cellOrder ? solveEdgeCell(s, empty) : solveFewestCell(s, empty);
+	f->list = s->covers[f->index];
+	f->tests = s->coverTests[f->index];
+	f->num = s->coverNum[f->index];
+}
+/* the next placement of the frame that fits, the list is filtered 64 at a time against the state the frame was entered with */
+const Placement* solveNextFit(Solve* s, SolveFrame* f)
+{
+	while(0 == f->fits)
+	{
+		if(f->end >= f->num)
+		{
+			f->next = f->num;
+			return nullptr;
+		}
+		f->next = f->end;
+		f->end = f->num - f->next > 64 ? f->next + 64 : f->num;
+		SOLVE_STAT(s->stats.tried[bitCount(s->blkMask)] += f->end - f->next);
+		f->fits = filterPlaces(f->tests + f->next, f->end - f->next, transKey(s));
+	}
+	const int bit = bitCount((f->fits & (0 - f->fits)) - 1);
+	f->next += bit + 1;
+	f->fits = (f->fits >> bit) >> 1;
+	return &s->places[0][0] + f->list[f->next - 1];
+}
+/* placements at the anchor cell that fit, as bits over anchors[index] */
+uint64_t solveAnchorFits(Solve* s, int index, uint64_t key)
+{
+	SOLVE_STAT(s->stats.tried[bitCount(s->blkMask)] += s->placeNum[index]);
+	return filterPlaces(s->anchorTests[index], s->placeNum[index], key);
+}
+void solveStart(Solve* s, int index)
+{
+	/* completions of an older search point into results that are gone */
+	s->transGen++;
+	s->top = 0;
+	solvePick(s, index, &s->stack[0]);
+	s->stack[0].place = nullptr;
+	s->stack[0].first = (uint32_t)s->results.num;
+	s->stack[0].nodes = s->nodes;
+#if SOLVE_STATS
+	s->stack[0].extended = false;
+	if(s->stack[0].index < MAX_COL_NUM * MAX_ROW_NUM)
+	{
+		s->stats.nodes[bitCount(s->blkMask)]++;
+	}
+#endif
+}
+bool solveStep(Solve* s)
+{
+	while(s->top >= 0)
+	{
+		if(0 != s->budget && 0 == --s->budget)
+		{
+			return false;
+		}
+		SolveFrame* f = &s->stack[s->top];
+		if(nullptr != f->place)
+		{
+			solveUnplace(s, f->place);
+			f->place = nullptr;
+		}
+		if(f->index >= MAX_COL_NUM * MAX_ROW_NUM)
+		{
+			s->top--;
+			continue;
+		}
+		while(nullptr == f->place)
+		{
+			const Placement* p = solveNextFit(s, f);
+			if(nullptr == p)
+			{
+				break;
+			}
+			solveApply(s, p);
+			if(solvePrune(s))
+			{
+				solveUnplace(s, p);
+				continue;
+			}
+			f->place = p;
+			SOLVE_STAT(f->extended = true);
+		}
+		if(nullptr == f->place)
+		{
+#if SOLVE_STATS
+			if(!f->extended)
+			{
+				s->stats.deadEnds[f->index]++;
+			}
+#endif
+			solveRemember(s, f);
+			s->top--;
+			continue;
+		}
+		SolveFrame* n = &s->stack[s->top + 1];
+		solvePick(s, f->index + 1, n);
+		const TransEntry* e = n->index < MAX_COL_NUM * MAX_ROW_NUM ? transFind(s, transKey(s)) : nullptr;
+		/* a list from an older enumeration may point past the arena even when its gen matches again */
+		if(nullptr != e && (TRANS_DEAD == e->kind || (TRANS_LIST == e->kind && s->transGen == e->gen &&
+			e->first + e->count <= s->results.num)))
+		{
+			if(solveReplay(s, e))
+			{
+				return true;
+			}
+			continue;
+		}
+		s->top++;
+		n->place = nullptr;
+		n->first = (uint32_t)s->results.num;
+		n->nodes = s->nodes;
+		if(n->index >= MAX_COL_NUM * MAX_ROW_NUM)
+		{
+			solveRecord(s);
+			return true;
+		}
+#if SOLVE_STATS
+		n->extended = false;
+		s->stats.nodes[bitCount(s->blkMask)]++;
+#endif
+	}
+	return false;
+}
+bool solveNext(Solve* s)
+{
+#if SOLVE_STATS
+	auto t0 = std::chrono::steady_clock::now();
+	const bool ret = solveStep(s);
+	s->stats.timeMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+	return ret;
+#else
+	return solveStep(s);
+#endif
+}
+void solveGrid(Solve* s, int index)
+{
+	s->budget = 0;
+	solveStart(s, index);
+	while(solveNext(s))
+	{
+	}
+}
+void danceCover(Dance* d, int c)
+{
+	d->right[d->left[c]] = d->right[c];
+	d->left[d->right[c]] = d->left[c];
+	for(int i = d->down[c]; i != c; i = d->down[i])
+	{
+		for(int j = d->right[i]; j != i; j = d->right[j])
+		{
+			d->down[d->up[j]] = d->down[j];
+			d->up[d->down[j]] = d->up[j];
+			d->size[d->col[j]]--;
+		}
+	}
+}
+void danceUncover(Dance* d, int c)
+{
+	for(int i = d->up[c]; i != c; i = d->up[i])
+	{
+		for(int j = d->left[i]; j != i; j = d->left[j])
+		{
+			d->size[d->col[j]]++;
+			d->down[d->up[j]] = j;
+			d->up[d->down[j]] = j;
+		}
+	}
+	d->right[d->left[c]] = c;
+	d->left[d->right[c]] = c;
+}
+void danceAppend(Dance* d, int c, int node)
+{
+	d->col[node] = c;
+	d->up[node] = d->up[c];
+	d->down[node] = c;
+	d->down[d->up[c]] = node;
+	d->up[c] = node;
+	d->size[c]++;
+}
+void danceBuild(Dance* d, const Solve* s)
+{
+	for(int c = 0; c < MAX_DANCE_COL; ++c)
+	{
+		d->left[c] = c;
+		d->right[c] = c;
+		d->up[c] = c;
+		d->down[c] = c;
+		d->size[c] = 0;
+	}
+	for(int c = 1; c < MAX_DANCE_COL; ++c)
+	{
+		if(c <= MAX_COL_NUM * MAX_ROW_NUM && 0 != (s->gridMask & (1ull << (c - 1))))
+		{
+			continue;
+		}
+		d->left[c] = d->left[0];
+		d->right[c] = 0;
+		d->right[d->left[0]] = c;
+		d->left[0] = c;
+	}
+	d->nodeNum = MAX_DANCE_COL;
+	d->rowNum = 0;
+	for(int idx = 0; idx < MAX_COL_NUM * MAX_ROW_NUM; ++idx)
+	{
+		for(int i = 0; i < s->placeNum[idx]; ++i)
+		{
+			const Placement* p = &s->places[idx][i];
+			if(0 != (s->gridMask & p->mask))
+			{
+				continue;
+			}
+			const int first = d->nodeNum;
+			danceAppend(d, 1 + MAX_COL_NUM * MAX_ROW_NUM + p->blk, d->nodeNum++);
+			for(int k = p->pos; k < MAX_COL_NUM * MAX_ROW_NUM; ++k)
+			{
+				if(0 != (p->mask & (1ull << k)))
+				{
+					danceAppend(d, 1 + k, d->nodeNum++);
+				}
+			}
+			for(int n = first; n < d->nodeNum; ++n)
+			{
+				d->row[n] = d->rowNum;
+				d->left[n] = n == first ? d->nodeNum - 1 : n - 1;
+				d->right[n] = n + 1 == d->nodeNum ? first : n + 1;
+			}
+			d->rows[d->rowNum++] = p;
+		}
+	}
+}
+void danceSearch(Solve* s, Dance* d)
+{
+	if(0 == d->right[0])
+	{
+		solveRecord(s);
+		return;
+	}
+	int c = d->right[0];
+	for(int j = d->right[c]; 0 != j; j = d->right[j])
+	{
+		if(d->size[j] < d->size[c])
+		{
+			c = j;
+		}
+	}
+	SOLVE_STAT(s->stats.nodes[s->depth]++);
+	if(0 == d->size[c])
+	{
+#if SOLVE_STATS
+		if(c <= MAX_COL_NUM * MAX_ROW_NUM)
+		{
+			s->stats.deadEnds[c - 1]++;
+		}
+#endif
+		return;
+	}
+	danceCover(d, c);
+	for(int r = d->down[c]; r != c; r = d->down[r])
+	{
+		const Placement* p = d->rows[d->row[r]];
+		s->nodes++;
+		SOLVE_STAT(s->stats.tried[s->depth]++);
+		SOLVE_STAT(s->stats.placed[s->depth]++);
+		s->blkData[p->blk].idx = p->branch;
+		s->blkData[p->blk].pos = p->pos;
+		for(int j = d->right[r]; j != r; j = d->right[j])
+		{
+			danceCover(d, d->col[j]);
+		}
+		s->depth++;
+		danceSearch(s, d);
+		s->depth--;
+		for(int j = d->left[r]; j != r; j = d->left[j])
+		{
+			danceUncover(d, d->col[j]);
+		}
+	}
+	danceUncover(d, c);
+}
+/* the first levels of the serial search with the same cell and piece order and prune, so the tasks concatenate to its results */
+void solveSplit(Solve* s, int index, int depth, const Placement** path, std::vector<SolveTask>& tasks)
+{
+	SolveFrame f;
+	solvePick(s, index, &f);
+	if(depth >= SOLVE_SPLIT_DEPTH || f.index >= MAX_COL_NUM * MAX_ROW_NUM)
+	{
+		tasks.emplace_back();
+		SolveTask& task = tasks.back();
+		task.index = index;
+		task.depth = depth;
+		memcpy(task.path, path, depth * sizeof(path[0]));
+		return;
+	}
+	SOLVE_STAT(s->stats.nodes[depth]++);
+	SOLVE_STAT(bool extended = false);
+	for(const Placement* p = solveNextFit(s, &f); nullptr != p; p = solveNextFit(s, &f))
+	{
+		solveApply(s, p);
+		if(!solvePrune(s))
+		{
+			SOLVE_STAT(extended = true);
+			path[depth] = p;
+			solveSplit(s, f.index + 1, depth + 1, path, tasks);
+		}
+		solveUnplace(s, p);
+	}
+#if SOLVE_STATS
+	if(!extended)
+	{
+		s->stats.deadEnds[f.index]++;
+	}
+#endif
+}
+bool solveTake(std::vector<SolveWorker>& workers, int self, int* task)
+{
+	{
+		std::lock_guard<std::mutex> guard(workers[self].lock);
+		if(!workers[self].tasks.empty())
+		{
+			*task = workers[self].tasks.back();
+			workers[self].tasks.pop_back();
+			return true;
+		}
+	}
+	for(size_t k = 1; k < workers.size(); ++k)
+	{
+		SolveWorker& victim = workers[(self + k) % workers.size()];
+		std::lock_guard<std::mutex> guard(victim.lock);
+		if(!victim.tasks.empty())
+		{
+			*task = victim.tasks.front();
+			victim.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+/* brings a worker copy up to date, the tables are copied again only when they changed and the base's hash table never */
+void solveSync(Solve* w, Solve* base)
+{
+	if(w->transBits != base->transBits || w->transEpoch != base->transEpoch)
+	{
+		w->trans.clear();
+		w->transBits = base->transBits;
+		w->transEpoch = base->transEpoch;
+	}
+	if(w->tables != base->tables)
+	{
+		/* the generation belongs to the table, a copied one could revive lists of the worker's older solves */
+		const uint32_t gen = w->transGen;
+		std::vector<TransEntry> trans;
+		std::vector<TransEntry> baseTrans;
+		trans.swap(w->trans);
+		baseTrans.swap(base->trans);
+		*w = *base;
+		base->trans.swap(baseTrans);
+		w->trans.swap(trans);
+		w->transGen = gen;
+	}
+	w->useTable = base->useTable;
+	w->pruneEvery = base->pruneEvery;
+	memcpy(w->gridData, base->gridData, sizeof(w->gridData));
+	w->baseMask = base->baseMask;
+	w->gridMask = base->gridMask;
+	w->blkMask = base->blkMask;
+	w->depth = base->depth;
+}
+void solveWork(const Solve* base, Solve* s, std::vector<SolveTask>* tasks, std::vector<SolveWorker>* workers, int self)
+{
+	s->nodes = 0;
+	s->pruneChecks = 0;
+	s->pruned = 0;
+	s->transHits = 0;
+	SOLVE_STAT(statsClear(&s->stats));
+	int t = 0;
+	while(solveTake(*workers, self, &t))
+	{
+		SolveTask& task = (*tasks)[t];
+		s->gridMask = base->gridMask;
+		s->blkMask = base->blkMask;
+		arenaClear(&s->results);
+		/* the prefix was already counted by solveSplit() */
+		const uint64_t nodes = s->nodes;
+		SOLVE_STAT(const SolveStats stats = s->stats);
+		for(int i = 0; i < task.depth; ++i)
+		{
+			solvePlace(s, task.path[i]);
+		}
+		s->nodes = nodes;
+		SOLVE_STAT(s->stats = stats);
+		solveGrid(s, task.index);
+		std::swap(task.results, s->results);
+	}
+	(*workers)[self].nodes = s->nodes;
+	(*workers)[self].pruneChecks = s->pruneChecks;
+	(*workers)[self].pruned = s->pruned;
+	(*workers)[self].transHits = s->transHits;
+	SOLVE_STAT((*workers)[self].stats = s->stats);
+}
+void solveParallel(Solve* s)
+{
+	SOLVE_STAT(auto t0 = std::chrono::steady_clock::now());
+	std::vector<SolveTask> tasks;
+	const Placement* path[SOLVE_SPLIT_DEPTH];
+	solveSplit(s, 0, 0, path, tasks);
+
+	std::vector<SolveWorker> workers(s->threads);
+	for(size_t t = 0; t < tasks.size(); ++t)
+	{
+		workers[t % workers.size()].tasks.push_back((int)t);
+	}
+	/* the copies stay with the calling thread, later dates only refresh what changed instead of copying the whole Solve */
+	static thread_local std::vector<Solve> copies;
+	if(copies.size() < workers.size())
+	{
+		copies.resize(workers.size());
+	}
+	for(size_t i = 0; i < workers.size(); ++i)
+	{
+		solveSync(&copies[i], s);
+	}
+	std::vector<std::thread> threads;
+	for(int i = 1; i < s->threads; ++i)
+	{
+		threads.emplace_back(solveWork, s, &copies[i], &tasks, &workers, i);
+	}
+	solveWork(s, &copies[0], &tasks, &workers, 0);
+	for(size_t i = 0; i < threads.size(); ++i)
+	{
+		threads[i].join();
+	}
+	for(size_t i = 0; i < workers.size(); ++i)
+	{
+		s->nodes += workers[i].nodes;
+		s->pruneChecks += workers[i].pruneChecks;
+		s->pruned += workers[i].pruned;
+		s->transHits += workers[i].transHits;
+		SOLVE_STAT(statsMerge(&s->stats, &workers[i].stats));
+	}
+	/* wall time rather than the sum over workers */
+	SOLVE_STAT(s->stats.timeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+
+	/* tasks are in depth first order, so concatenating them matches the serial search */
+	for(size_t t = 0; t < tasks.size(); ++t)
+	{
+		for(size_t i = 0; i < tasks[t].results.num; ++i)
+		{
+			arenaPush(&s->results, arenaAt(&tasks[t].results, i));
+		}
+	}
+}
+void solveInit(Solve* s, int mon, int day)
+{
+	memcpy(s->gridData, gGridMarks, sizeof(gGridMarks));
+	for(int r = 0; r < 2; ++r)
+	{
+		for(int c = 0; c < MAX_COL_NUM; ++c)
+		{
+			if(100 + mon == gGridValues[r * MAX_COL_NUM + c])
+			{
+				s->gridData[r * MAX_COL_NUM + c] = 200;
+				break;
+			}
+		}
+	}
+	for(int r = 2; r < MAX_ROW_NUM; ++r)
+	{
+		for(int c = 0; c < MAX_COL_NUM; ++c)
+		{
+			if(day == gGridValues[r * MAX_COL_NUM + c])
+			{
+				s->gridData[r * MAX_COL_NUM + c] = 200;
+				break;
+			}
+		}
+	}
+
+	s->gridMask = 0;
+	for(int i = 0; i < MAX_COL_NUM * MAX_ROW_NUM; ++i)
+	{
+		if(0 != s->gridData[i])
+		{
+			s->gridMask |= 1ull << i;
+		}
+	}
+	s->baseMask = s->gridMask;
+	s->blkMask = 0;
+	s->nodes = 0;
+	s->pruneChecks = 0;
+	s->pruned = 0;
+	s->transHits = 0;
+	SOLVE_STAT(statsClear(&s->stats));
+	if(s->autoOrder && SOLVE_ORDER_HASH == s->hash && mon >= 1 && mon <= 12 && day >= 1 && day <= SOLVE_TABLE_DAYS)
+	{
+		const int order = gSolveOrders[(mon - 1) * SOLVE_TABLE_DAYS + day - 1];
+		if(order / ORDER_PIECE_NUM != s->cellOrder || order % ORDER_PIECE_NUM != s->pieceOrder)
+		{
+			solveOrder(s, order / ORDER_PIECE_NUM, order % ORDER_PIECE_NUM);
+		}
+	}
+}
+uint64_t countGrid(Solve* s, int index)
+{
+	index = solveFirstEmpty(s, index);
+	if(index >= MAX_COL_NUM * MAX_ROW_NUM)
+	{
+		return 1;
+	}
+	/* every cell before index is filled, so the occupancy word is the frontier profile */
+	const uint64_t key = transKey(s);
+	const TransEntry* e = transFind(s, key);
+	if(nullptr != e && TRANS_SOME != e->kind)
+	{
+		return e->count;
+	}
+	const uint64_t nodes = s->nodes;
+	SOLVE_STAT(s->stats.nodes[s->depth]++);
+	SOLVE_STAT(bool extended = false);
+	uint64_t num = 0;
+	for(uint64_t fits = solveAnchorFits(s, index, key); 0 != fits; fits &= fits - 1)
+	{
+		const Placement* p = &s->places[0][0] + s->anchors[index][bitCount((fits & (0 - fits)) - 1)];
+		solveApply(s, p);
+		SOLVE_STAT(extended = true);
+		s->depth++;
+		if(!solvePrune(s))
+		{
+			num += countGrid(s, index + 1);
+		}
+		s->depth--;
+		solveUnplace(s, p);
+	}
+#if SOLVE_STATS
+	if(!extended)
+	{
+		s->stats.deadEnds[index]++;
+	}
+#endif
+	transStore(s, key, 0 == num ? TRANS_DEAD : TRANS_COUNT, num, 0, s->nodes - nodes);
+	return num;
+}
+uint64_t countSolutions(Solve* s, int mon, int day)
+{
+	solveInit(s, mon, day);
+	s->depth = 0;
+	SOLVE_STAT(auto t0 = std::chrono::steady_clock::now());
+	const uint64_t num = countGrid(s, 0);
+#if SOLVE_STATS
+	s->stats.solutions = num;
+	s->stats.timeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+#endif
+	return num;
+}
+/* stops at the first solution, so a state it stores is either dead or has some solutions */
+bool existsGrid(Solve* s, int index)
+{
+	index = solveFirstEmpty(s, index);
+	if(index >= MAX_COL_NUM * MAX_ROW_NUM)
+	{
+		return true;
+	}
+	const uint64_t key = transKey(s);
+	const TransEntry* e = transFind(s, key);
+	if(nullptr != e)
+	{
+		return TRANS_DEAD != e->kind;
+	}
+	const uint64_t nodes = s->nodes;
+	bool found = false;
+	for(uint64_t fits = solveAnchorFits(s, index, key); 0 != fits && !found; fits &= fits - 1)
+	{
+		const Placement* p = &s->places[0][0] + s->anchors[index][bitCount((fits & (0 - fits)) - 1)];
+		solveApply(s, p);
+		found = !solvePrune(s) && existsGrid(s, index + 1);
+		solveUnplace(s, p);
+	}
+	transStore(s, key, found ? TRANS_SOME : TRANS_DEAD, 0, 0, s->nodes - nodes);
+	return found;
+}
+bool solveExists(Solve* s, uint64_t gridMask, uint32_t blkMask)
+{
+	s->gridMask = gridMask;
+	s->blkMask = blkMask;
+	if(solvePrune(s))
+	{
+		return false;
+	}
+	return existsGrid(s, 0);
+}
+/**
+ * cache file, a header with one index entry per date, then the codes of each solved date in the order they were
+ * appended, the codes go to the file before their entry so an interrupted store leaves the date unsolved
+ */
+#define CACHE_MAGIC "MOYUCACH"
+#define CACHE_VERSION 1
+#define CACHE_DAYS (12 * SOLVE_TABLE_DAYS)
+struct CacheEntry {
+	/* 0 while the date is not solved */
+	uint64_t offset;
+	uint32_t count;
+	uint32_t reserved;
+};
+struct CacheHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t days;
+	uint64_t hash;
+	CacheEntry index[CACHE_DAYS];
+};
+struct SolveCache {
+	std::mutex lock;
+	/* set by openSolveCache(), the file is only opened once a date misses the stale table */
+	std::string path;
+	bool opened;
+	uint64_t hash;
+	const uint8_t* data;
+	size_t size;
+#if defined(_WIN32)
+	HANDLE file;
+	HANDLE mapping;
+#else
+	int file;
+#endif
+};
+static SolveCache gCache;
+void cacheUnmap()
+{
+#if defined(_WIN32)
+	if(nullptr != gCache.data)
+	{
+		UnmapViewOfFile(gCache.data);
+	}
+	if(nullptr != gCache.mapping)
+	{
+		CloseHandle(gCache.mapping);
+	}
+	gCache.mapping = nullptr;
+#else
+	if(nullptr != gCache.data)
+	{
+		munmap((void*)gCache.data, gCache.size);
+	}
+#endif
+	gCache.data = nullptr;
+	gCache.size = 0;
+}
+/* the whole file read-only, lookups only touch the pages of the index and of the date */
+bool cacheMap()
+{
+	cacheUnmap();
+#if defined(_WIN32)
+	LARGE_INTEGER size;
+	if(!GetFileSizeEx(gCache.file, &size) || size.QuadPart < (LONGLONG)sizeof(CacheHeader))
+	{
+		return false;
+	}
+	gCache.mapping = CreateFileMappingA(gCache.file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	gCache.data = nullptr == gCache.mapping ? nullptr : (const uint8_t*)MapViewOfFile(gCache.mapping, FILE_MAP_READ, 0, 0, 0);
+	gCache.size = nullptr == gCache.data ? 0 : (size_t)size.QuadPart;
+#else
+	struct stat st;
+	if(0 != fstat(gCache.file, &st) || st.st_size < (off_t)sizeof(CacheHeader))
+	{
+		return false;
+	}
+	void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, gCache.file, 0);
+	gCache.data = MAP_FAILED == data ? nullptr : (const uint8_t*)data;
+	gCache.size = nullptr == gCache.data ? 0 : (size_t)st.st_size;
+#endif
+	return nullptr != gCache.data;
+}
+bool cacheWrite(uint64_t offset, const void* data, size_t len)
+{
+#if defined(_WIN32)
+	OVERLAPPED at = {};
+	at.Offset = (DWORD)offset;
+	at.OffsetHigh = (DWORD)(offset >> 32);
+	DWORD done = 0;
+	return 0 == len || (WriteFile(gCache.file, data, (DWORD)len, &done, &at) && done == len);
+#else
+	return 0 == len || pwrite(gCache.file, data, len, (off_t)offset) == (ssize_t)len;
+#endif
+}
+void closeSolveCache()
+{
+	std::lock_guard<std::mutex> guard(gCache.lock);
+	cacheUnmap();
+	if(gCache.opened)
+	{
+#if defined(_WIN32)
+		CloseHandle(gCache.file);
+#else
+		close(gCache.file);
+#endif
+	}
+	gCache.opened = false;
+	gCache.path.clear();
+}
+bool openSolveCache(const char* path, uint64_t hash)
+{
+	closeSolveCache();
+	std::lock_guard<std::mutex> guard(gCache.lock);
+	gCache.path = path;
+	gCache.hash = hash;
+	return true;
+}
+/* opens and maps the file on first use, a failure is reported once and the cache stays off */
+bool cacheOpen()
+{
+	if(gCache.opened || gCache.path.empty())
+	{
+		return gCache.opened;
+	}
+	const std::string path = gCache.path;
+	const uint64_t hash = gCache.hash;
+	gCache.path.clear();
+#if defined(_WIN32)
+	gCache.file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+		FILE_ATTRIBUTE_NORMAL, nullptr);
+	gCache.opened = INVALID_HANDLE_VALUE != gCache.file;
+#else
+	gCache.file = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+	gCache.opened = gCache.file >= 0;
+#endif
+	if(!gCache.opened)
+	{
+		fprintf(stderr, "Could not open %s\n", path.c_str());
+		return false;
+	}
+	if(cacheMap())
+	{
+		const CacheHeader* head = (const CacheHeader*)gCache.data;
+		if(0 == memcmp(head->magic, CACHE_MAGIC, sizeof(head->magic)) && CACHE_VERSION == head->version &&
+			CACHE_DAYS == head->days && hash == head->hash)
+		{
+			return true;
+		}
+	}
+	/* another board or version, the file starts over */
+	cacheUnmap();
+#if defined(_WIN32)
+	SetFilePointer(gCache.file, 0, nullptr, FILE_BEGIN);
+	SetEndOfFile(gCache.file);
+#else
+	const int ret = ftruncate(gCache.file, 0);
+	(void)ret;
+#endif
+	CacheHeader* head = new CacheHeader();
+	memcpy(head->magic, CACHE_MAGIC, sizeof(head->magic));
+	head->version = CACHE_VERSION;
+	head->days = CACHE_DAYS;
+	head->hash = hash;
+	const bool ok = cacheWrite(0, head, sizeof(CacheHeader)) && cacheMap();
+	delete head;
+	if(!ok)
+	{
+		fprintf(stderr, "Could not write %s\n", path.c_str());
+	}
+	return ok;
+}
+int cacheKey(const Solve* s, int mon, int day)
+{
+	if(nullptr == gCache.data || s->hash != gCache.hash || mon < 1 || mon > 12 || day < 1 || day > SOLVE_TABLE_DAYS)
+	{
+		return -1;
+	}
+	return (mon - 1) * SOLVE_TABLE_DAYS + day - 1;
+}
+/* nullptr while the date is not solved, or when its codes were cut off */
+const CacheEntry* cacheEntry(int key)
+{
+	const CacheEntry* e = &((const CacheHeader*)gCache.data)->index[key];
+	return 0 == e->offset || e->offset + e->count * sizeof(uint64_t) > gCache.size ? nullptr : e;
+}
+bool cacheLoad(Solve* s, int mon, int day)
+{
+	std::lock_guard<std::mutex> guard(gCache.lock);
+	cacheOpen();
+	const int key = cacheKey(s, mon, day);
+	const CacheEntry* e = key < 0 ? nullptr : cacheEntry(key);
+	if(nullptr == e)
+	{
+		return false;
+	}
+	const uint64_t* codes = (const uint64_t*)(gCache.data + e->offset);
+	for(uint32_t i = 0; i < e->count; ++i)
+	{
+		arenaPush(&s->results, codes[i]);
+	}
+	return true;
+}
+void solveCacheStore(const Solve* s, int mon, int day)
+{
+	/* only read back when the table is on but stale, and a hit would give the results in table order */
+	if(!s->useTable || SOLUTION_TABLE_HASH == s->hash || SOLVE_METHOD_GRID != s->method ||
+		ORDER_CELL_FIRST != s->cellOrder || ORDER_PIECE_INDEX != s->pieceOrder)
+	{
+		return;
+	}
+	std::lock_guard<std::mutex> guard(gCache.lock);
+	cacheOpen();
+	const int key = cacheKey(s, mon, day);
+	if(key < 0 || nullptr != cacheEntry(key))
+	{
+		return;
+	}
+	std::vector<uint64_t> codes(s->results.num);
+	for(size_t i = 0; i < s->results.num; ++i)
+	{
+		codes[i] = arenaAt(&s->results, i);
+	}
+	CacheEntry e = {};
+	/* an interrupted store may have left a partial block behind */
+	e.offset = (gCache.size + 7) & ~(uint64_t)7;
+	e.count = (uint32_t)codes.size();
+	cacheUnmap();
+	if(cacheWrite(e.offset, codes.data(), codes.size() * sizeof(uint64_t)))
+	{
+		cacheWrite(offsetof(CacheHeader, index) + key * sizeof(CacheEntry), &e, sizeof(e));
+	}
+	cacheMap();
+}
+bool solveTableStale(const Solve* s)
+{
+	return SOLUTION_TABLE_HASH != s->hash;
+}
+/* the compiled table when it matches the board, the cache file otherwise */
+bool solveTable(Solve* s, int mon, int day)
+{
+	if(!s->useTable || mon < 1 || mon > 12 || day < 1 || day > SOLVE_TABLE_DAYS)
+	{
+		return false;
+	}
+	if(SOLUTION_TABLE_HASH != s->hash)
+	{
+		return cacheLoad(s, mon, day);
+	}
+	const int key = (mon - 1) * SOLVE_TABLE_DAYS + day - 1;
+	for(uint32_t i = gSolutionIndex[key]; i < gSolutionIndex[key + 1]; ++i)
+	{
+		arenaPush(&s->results, gSolutionData[i]);
+	}
+	return true;
+}
+void solve(Solve* s, int mon, int day)
+{
+	solveInit(s, mon, day);
+	arenaClear(&s->results);
+	s->finished = true;
+	if(solveTable(s, mon, day))
+	{
+		return;
+	}
+	if(SOLVE_METHOD_DLX == s->method)
+	{
+		SOLVE_STAT(auto t0 = std::chrono::steady_clock::now());
+		/* every call gets its own links, dates may be solved on several threads at once */
+		Dance* d = new Dance();
+		danceBuild(d, s);
+		s->depth = 0;
+		danceSearch(s, d);
+		delete d;
+		SOLVE_STAT(s->stats.timeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+	}
+	else if(s->threads > 1)
+	{
+		solveParallel(s);
+	}
+	else
+	{
+		solveGrid(s, 0);
+	}
+	solveCacheStore(s, mon, day);
+}
+int solveBranches(Solve* s, int mon, int day)
+{
+	solveInit(s, mon, day);
+	SolveFrame f;
+	solvePick(s, 0, &f);
+	return f.num;
+}
+void solveBranch(Solve* s, int mon, int day, int branch)
+{
+	solveInit(s, mon, day);
+	arenaClear(&s->results);
+	s->finished = true;
+	SolveFrame f;
+	solvePick(s, 0, &f);
+	if(branch < 0 || branch >= f.num)
+	{
+		return;
+	}
+	const Placement* p = &s->places[0][0] + f.list[branch];
+	if(solvePlace(s, p) && !solvePrune(s))
+	{
+		solveGrid(s, f.index + 1);
+	}
+}
+uint64_t solveHash()
+{
+	uint64_t h = 14695981039346656037ull;
+	const uint8_t version = SOLVE_TABLE_VERSION;
+	const uint8_t* data[] = { &version, gGridMarks, gGridValues, (const uint8_t*)gBlockInfos };
+	const size_t lens[] = { sizeof(version), sizeof(gGridMarks), sizeof(gGridValues), sizeof(gBlockInfos) };
+	for(int k = 0; k < 4; ++k)
+	{
+		for(size_t i = 0; i < lens[k]; ++i)
+		{
+			h ^= data[k][i];
+			h *= 1099511628211ull;
+		}
+	}
+	return h;
+}
+bool writeSolutionTable(Solve* s, const char* path)
+{
+	FILE* fp = fopen(path, "w");
+	if(nullptr == fp)
+	{
+		printf("Could not open %s\n", path);
+		return false;
+	}
+	std::vector<uint32_t> index;
+	std::vector<uint64_t> codes;
+	const bool useTable = s->useTable;
+	const bool autoOrder = s->autoOrder;
+	const int cellOrder = s->cellOrder;
+	const int pieceOrder = s->pieceOrder;
+	/* the table keeps the results in the order of the plain search */
+	s->useTable = false;
+	s->autoOrder = false;
+	solveOrder(s, ORDER_CELL_FIRST, ORDER_PIECE_INDEX);
+	for(int mon = 1; mon <= 12; ++mon)
+	{
+		for(int day = 1; day <= SOLVE_TABLE_DAYS; ++day)
+		{
+			index.push_back((uint32_t)codes.size());
+			solve(s, mon, day);
+			for(size_t i = 0; i < s->results.num; ++i)
+			{
+				codes.push_back(arenaAt(&s->results, i));
+			}
+		}
+	}
+	index.push_back((uint32_t)codes.size());
+	s->useTable = useTable;
+	s->autoOrder = autoOrder;
+	solveOrder(s, cellOrder, pieceOrder);
+
+	fprintf(fp, "/* Generated by `moyuday-cli --gen-table solutions.h`, do not edit. */\n");
+	fprintf(fp, "#pragma once\n\n");
+	fprintf(fp, "#define SOLUTION_TABLE_HASH 0x%016llxull\n\n", (unsigned long long)s->hash);
+	fprintf(fp, "static constexpr uint32_t gSolutionIndex[%d] = {", (int)index.size());
+	for(size_t i = 0; i < index.size(); ++i)
+	{
+		fprintf(fp, "%s%u,", 0 == i % 12 ? "\n\t" : " ", index[i]);
+	}
+	fprintf(fp, "\n};\n");
+	if(codes.empty())
+	{
+		codes.push_back(0);
+	}
+	fprintf(fp, "static constexpr uint64_t gSolutionData[%d] = {", (int)codes.size());
+	for(size_t i = 0; i < codes.size(); ++i)
+	{
+		fprintf(fp, "%s0x%016llx,", 0 == i % 6 ? "\n\t" : " ", (unsigned long long)codes[i]);
+	}
+	fprintf(fp, "\n};\n");
+	fclose(fp);
+	return true;
+}
+void initSolve(Solve* s)
+{
+	s->useTable = true;
+	s->hash = solveHash();
+	s->method = SOLVE_METHOD_GRID;
+	s->threads = (int)std::thread::hardware_concurrency();
+	s->pruneEvery = 1;
+	s->transBits = TRANS_BITS;
+	s->finished = true;
+	memcpy(s->blkData, gShapes.blkData, sizeof(s->blkData));
+	s->boardMask = gShapes.boardMask;
+	s->firstColMask = gShapes.firstColMask;
+	s->lastColMask = gShapes.lastColMask;
+	memcpy(s->sumMasks, gShapes.sumMasks, sizeof(s->sumMasks));
+	memcpy(s->placeNum, gShapes.placeNum, sizeof(s->placeNum));
+	memcpy(s->places, gShapes.places, sizeof(s->places));
+	s->autoOrder = false;
+	solveOrder(s, ORDER_CELL_FIRST, ORDER_PIECE_INDEX);
+}
+void solveOrder(Solve* s, int cellOrder, int pieceOrder)
+{
+	/* lower ranks are tried first, pieces with fewer placements or more holes in their bounding box */
+	int ranks[MAX_BLK_NUM];
+	for(int i = 0; i < MAX_BLK_NUM; ++i)
+	{
+		const BlockInfo* info = &gBlockInfos[i];
+		int cells = 0;
+		for(int k = 0; k < info->rows * info->cols; ++k)
+		{
+			cells += 0 != info->data[k] ? 1 : 0;
+		}
+		int num = 0;
+		for(int idx = 0; idx < MAX_COL_NUM * MAX_ROW_NUM; ++idx)
+		{
+			for(int k = 0; k < s->placeNum[idx]; ++k)
+			{
+				num += i == s->places[idx][k].blk ? 1 : 0;
+			}
+		}
+		ranks[i] = ORDER_PIECE_CONSTRAINED == pieceOrder ? num :
+			(ORDER_PIECE_AWKWARD == pieceOrder ? cells - info->rows * info->cols : 0);
+	}
+	int pieces[MAX_BLK_NUM];
+	for(int i = 0; i < MAX_BLK_NUM; ++i)
+	{
+		int k = i;
+		for(; k > 0 && ranks[pieces[k - 1]] > ranks[i]; --k)
+		{
+			pieces[k] = pieces[k - 1];
+		}
+		pieces[k] = i;
+	}
+
+	int anchorNum[MAX_COL_NUM * MAX_ROW_NUM] = { 0 };
+	memset(s->coverNum, 0, sizeof(s->coverNum));
+	for(int n = 0; n < MAX_BLK_NUM; ++n)
+	{
+		for(int idx = 0; idx < MAX_COL_NUM * MAX_ROW_NUM; ++idx)
+		{
+			for(int k = 0; k < s->placeNum[idx]; ++k)
+			{
+				const Placement* p = &s->places[idx][k];
+				if(pieces[n] != p->blk)
+				{
+					continue;
+				}
+				const uint16_t code = (uint16_t)(idx * MAX_PLACE_NUM + k);
+				const uint64_t test = p->mask | (1ull << (MAX_COL_NUM * MAX_ROW_NUM + p->blk));
+				s->anchorTests[idx][anchorNum[idx]] = test;
+				s->anchors[idx][anchorNum[idx]++] = code;
+				for(uint64_t m = p->mask; 0 != m; m &= m - 1)
+				{
+					const int cell = bitCount((m & (0 - m)) - 1);
+					if(s->coverNum[cell] < MAX_COVER_NUM)
+					{
+						s->coverTests[cell][s->coverNum[cell]] = test;
+						s->covers[cell][s->coverNum[cell]++] = code;
+					}
+				}
+			}
+		}
+	}
+	s->cellOrder = cellOrder;
+	s->pieceOrder = pieceOrder;
+	s->tables = ++gVersion;
+}
+bool parseOrder(const char* str, Solve* s)
+{
+	if(0 == strcmp(str, "auto"))
+	{
+		s->autoOrder = true;
+		return true;
+	}
+	int cellOrder = -1;
+	int pieceOrder = ORDER_PIECE_INDEX;
+	const char* comma = strchr(str, ',');
+	const size_t len = nullptr != comma ? (size_t)(comma - str) : strlen(str);
+	for(int i = 0; i < ORDER_CELL_NUM; ++i)
+	{
+		if(len == strlen(gCellOrderNames[i]) && 0 == strncmp(str, gCellOrderNames[i], len))
+		{
+			cellOrder = i;
+		}
+	}
+	if(nullptr != comma)
+	{
+		pieceOrder = -1;
+		for(int i = 0; i < ORDER_PIECE_NUM; ++i)
+		{
+			if(0 == strcmp(comma + 1, gPieceOrderNames[i]))
+			{
+				pieceOrder = i;
+			}
+		}
+	}
+	if(cellOrder < 0 || pieceOrder < 0)
+	{
+		fprintf(stderr, "invalid order: %s\n", str);
+		return false;
+	}
+	s->autoOrder = false;
+	solveOrder(s, cellOrder, pieceOrder);
+	return true;
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#define MAX_ROW_NUM 7
+#define MAX_COL_NUM 7
+#define MAX_BLK_NUM 8
+#define MAX_BLKROW_NUM 4
+#define MAX_BLKCOL_NUM 4
+
+struct BlockInfo {
+	int rows;
+	int cols;
+	uint8_t data[MAX_BLKROW_NUM * MAX_BLKCOL_NUM];
+};
+extern const uint8_t gGridMarks[MAX_ROW_NUM * MAX_COL_NUM];
+extern const uint8_t gGridValues[MAX_ROW_NUM * MAX_COL_NUM];
+extern const BlockInfo gBlockInfos[MAX_BLK_NUM];
+
+struct Result {
+	BlockInfo blkData[MAX_BLK_NUM];
+	uint8_t gridData[MAX_COL_NUM * MAX_ROW_NUM];
+};
+/* packed results, 8 bytes each, chunks are never reallocated once filled */
+#define RESULT_CHUNK_NUM 4096
+struct ResultArena {
+	size_t num;
+	std::vector<std::vector<uint64_t>> chunks;
+};
+struct Branch {
+	int idx;
+	int pos;
+	int num;
+	int firstCols[8];
+	BlockInfo data[8];
+	uint64_t masks[8];
+};
+/* search counters, only compiled in with -DSOLVE_STATS=1 so the shipped builds and the benchmarks never pay for them */
+#ifndef SOLVE_STATS
+#define SOLVE_STATS 0
+#endif
+#if SOLVE_STATS
+#define SOLVE_STAT(...) __VA_ARGS__
+#else
+#define SOLVE_STAT(...)
+#endif
+#define SOLVE_METHOD_GRID 0
+#define SOLVE_METHOD_DLX 1
+#define MAX_PLACE_NUM 64
+struct Placement {
+	uint64_t mask;
+	uint8_t blk;
+	uint8_t branch;
+	uint8_t pos;
+};
+/**
+ * search order, the cell the next piece has to cover and the order pieces are tried there,
+ * only the first empty cell keeps the results in table order
+ */
+#define ORDER_CELL_FIRST 0
+#define ORDER_CELL_EDGE 1
+#define ORDER_CELL_FEWEST 2
+#define ORDER_CELL_NUM 3
+#define ORDER_PIECE_INDEX 0
+#define ORDER_PIECE_CONSTRAINED 1
+#define ORDER_PIECE_AWKWARD 2
+#define ORDER_PIECE_NUM 3
+#define MAX_COVER_NUM 384
+extern const char* const gCellOrderNames[ORDER_CELL_NUM];
+extern const char* const gPieceOrderNames[ORDER_PIECE_NUM];
+/**
+ * candidate filter, tests a list of placements against the occupied cells and used pieces in one pass,
+ * the widest kernel the cpu supports is picked at startup
+ */
+#define FILTER_SCALAR 0
+#define FILTER_SSE2 1
+#define FILTER_AVX2 2
+#define FILTER_NUM 3
+extern const char* const gFilterNames[FILTER_NUM];
+struct SolveFrame {
+	int index;
+	int next;
+	int num;
+	/* placements to try, as indexes into places, and their cells with the piece bit above them like transKey() */
+	const uint16_t* list;
+	const uint64_t* tests;
+	/* bit i is set when list[next + i] fits, for the part of the list up to end that is already filtered */
+	int end;
+	uint64_t fits;
+	const Placement* place;
+	/* results and nodes when the frame was entered, for the transposition table */
+	uint32_t first;
+	uint64_t nodes;
+#if SOLVE_STATS
+	bool extended;
+#endif
+};
+/**
+ * transposition table, keyed by the occupied cells and the used pieces,
+ * the first slot of a bucket keeps the most expensive answer and the second one is always replaced
+ */
+#define TRANS_BITS 16
+#define TRANS_MIN_WORK 4
+#define TRANS_NONE 0
+#define TRANS_DEAD 1
+#define TRANS_SOME 2
+#define TRANS_COUNT 3
+#define TRANS_LIST 4
+struct TransEntry {
+	uint64_t key;
+	/* solutions below the state, the completions are results[first, first + count) of the same gen for TRANS_LIST */
+	uint64_t count;
+	uint32_t first;
+	uint32_t work;
+	uint32_t gen;
+	uint8_t kind;
+};
+struct SolveStats {
+	uint64_t nodes[MAX_BLK_NUM];
+	uint64_t tried[MAX_BLK_NUM];
+	uint64_t placed[MAX_BLK_NUM];
+	uint64_t deadEnds[MAX_COL_NUM * MAX_ROW_NUM];
+	uint64_t solutions;
+	double timeMs;
+};
+struct Solve {
+	bool useTable;
+	int method;
+	int threads;
+	uint64_t hash;
+	uint8_t gridData[MAX_COL_NUM * MAX_ROW_NUM];
+	uint64_t baseMask;
+	uint64_t gridMask;
+	uint32_t blkMask;
+	int depth;
+	uint64_t boardMask;
+	uint64_t firstColMask;
+	uint64_t lastColMask;
+	uint64_t sumMasks[1 << MAX_BLK_NUM];
+	int pruneEvery;
+	uint64_t nodes;
+	uint64_t pruneChecks;
+	uint64_t pruned;
+	uint64_t transHits;
+#if SOLVE_STATS
+	SolveStats stats;
+#endif
+	/* 0 disables the table, it is allocated on first use so copies of an idle Solve stay cheap */
+	int transBits;
+	uint32_t transGen;
+	/* bumped by transClear(), worker copies drop their own table when it moved */
+	uint32_t transEpoch;
+	std::vector<TransEntry> trans;
+	Branch blkData[MAX_BLK_NUM];
+	int placeNum[MAX_COL_NUM * MAX_ROW_NUM];
+	Placement places[MAX_COL_NUM * MAX_ROW_NUM][MAX_PLACE_NUM];
+	/* autoOrder picks the order per date from the generated order table */
+	bool autoOrder;
+	int cellOrder;
+	int pieceOrder;
+	/* version of the placement tables below, set by solveOrder() */
+	uint32_t tables;
+	uint16_t anchors[MAX_COL_NUM * MAX_ROW_NUM][MAX_PLACE_NUM];
+	uint64_t anchorTests[MAX_COL_NUM * MAX_ROW_NUM][MAX_PLACE_NUM];
+	int coverNum[MAX_COL_NUM * MAX_ROW_NUM];
+	uint16_t covers[MAX_COL_NUM * MAX_ROW_NUM][MAX_COVER_NUM];
+	uint64_t coverTests[MAX_COL_NUM * MAX_ROW_NUM][MAX_COVER_NUM];
+	bool finished;
+	uint32_t budget;
+	int top;
+	SolveFrame stack[MAX_BLK_NUM + 1];
+	ResultArena results;
+};
+
+void rotateBlock(BlockInfo* blk);
+void mirrorBlock(BlockInfo* blk);
+int bitCount(uint64_t val);
+/* bit i is set when tests[i] shares nothing with key, num is at most 64 */
+uint64_t filterPlaces(const uint64_t* tests, int num, uint64_t key);
+int filterKernel();
+/* false when the cpu lacks the kernel */
+bool setFilterKernel(int kernel);
+
+void arenaClear(ResultArena* a);
+void arenaPush(ResultArena* a, uint64_t code);
+uint64_t arenaAt(const ResultArena* a, size_t idx);
+uint64_t packResult(const Solve* s);
+void unpackResult(const Solve* s, uint64_t code, Result* res);
+
+void statsClear(SolveStats* st);
+void statsMerge(SolveStats* dst, const SolveStats* src);
+void printStats(FILE* fp, const SolveStats* st);
+
+void initSolve(Solve* s);
+void solveOrder(Solve* s, int cellOrder, int pieceOrder);
+/* "auto" or CELL[,PIECE] by name */
+bool parseOrder(const char* str, Solve* s);
+void transClear(Solve* s);
+void solveInit(Solve* s, int mon, int day);
+void solveStart(Solve* s, int index);
+bool solveNext(Solve* s);
+bool solveTable(Solve* s, int mon, int day);
+void solve(Solve* s, int mon, int day);
+uint64_t countSolutions(Solve* s, int mon, int day);
+/* placements the search tries first, a full enumeration is the concatenation of the branches in order */
+int solveBranches(Solve* s, int mon, int day);
+/* searches below one of them only, into results */
+void solveBranch(Solve* s, int mon, int day, int branch);
+/* whether the pieces not in blkMask can fill the cells gridMask leaves free */
+bool solveExists(Solve* s, uint64_t gridMask, uint32_t blkMask);
+uint64_t solveHash();
+/* whether the compiled table was generated for other pieces, only then the cache below is used */
+bool solveTableStale(const Solve* s);
+/**
+ * solutions of the dates already searched for a board the compiled table does not match, the file is mapped
+ * read-only and solveTable() looks dates up in it, a finished search in table order is appended,
+ * nothing is created or read before the first date that misses the table
+ */
+bool openSolveCache(const char* path, uint64_t hash);
+void closeSolveCache();
+void solveCacheStore(const Solve* s, int mon, int day);
+bool writeSolutionTable(Solve* s, const char* path);